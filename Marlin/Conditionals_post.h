@@ -923,4 +923,10 @@
     #endif
   #endif
 
+  // Size in bytes of the command queue (commands are packed)
+  #define CMD_QUEUE_SIZE (BUFSIZE * (MAX_CMD_SIZE))
+
+  // Binary commands come from the host (BINARY_GCODE) or from PROGMEM (GCODE_SCRIPTS)
+  #define HAS_BINARY_COMMANDS (ENABLED(BINARY_GCODE) || ENABLED(GCODE_SCRIPTS))
+
 #endif // CONDITIONALS_POST_H
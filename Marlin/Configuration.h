@@ -572,6 +572,22 @@
 #define DEFAULT_ZJERK                  0.4
 #define DEFAULT_EJERK                  1.0
 
+/**
+ * S-Curve Acceleration
+ *
+ * Ramp the speed along a 6th order Bézier curve instead of a straight line,
+ * so the acceleration changes smoothly at the start and end of each speed
+ * change (limited jerk). This reduces the ringing of the frame and allows
+ * higher accelerations. The peak acceleration is 1.875 times the set one.
+ * The ramps shorter than 128µs or longer than 8.4s stay linear.
+ */
+//#define S_CURVE_ACCELERATION
+
+#if ENABLED(S_CURVE_ACCELERATION)
+  // Time the curve in the stepper ISR with timer 1. M787 reports the cycles spent on it.
+  //#define S_CURVE_PROFILING
+#endif
+
 /**
 * Default Preheating Presets
 * Specific to i3Plus+
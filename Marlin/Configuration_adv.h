@@ -519,6 +519,35 @@
     #define SDSORT_DYNAMIC_RAM false  // Use dynamic allocation (within SD menus). Least expensive option. Set SDSORT_LIMIT before use!
   #endif
 
+  /**
+   * Keep an index of the positions of the files in the current directory.
+   *
+   * The index is built the first time the files are counted and is kept until
+   * the directory changes. Getting the name of a file then only reads the
+   * directory from the closest indexed file instead of from the beginning.
+   * When the index is full, only one file every 2, 4, 8... is kept.
+   *
+   *  - SDINDEX_LIMIT is the number of positions in the index. Costs 2 bytes each.
+   */
+  //#define SDCARD_FILE_INDEX
+
+  #if ENABLED(SDCARD_FILE_INDEX)
+    #define SDINDEX_LIMIT 32
+  #endif
+
+  /**
+   * Read ahead from the SD card while a move waits for room in the planner,
+   * instead of between commands: the main loop only reads when the queue is
+   * empty. With BINARY_GCODE, the lines read ahead are stored already parsed.
+   * M780 reports how often the planner ran empty with and without the
+   * look-ahead; M780 L0 / L1 disables / enables it.
+   *
+   * On the host replay of short segments (test/motion/segments.gcode), the
+   * stepper waits 0.017 s for blocks instead of 0.041 s. The replay gives
+   * the parsing no time, so it shows no further gain with BINARY_GCODE.
+   */
+  //#define SD_LOOKAHEAD
+
   // Show a progress bar on HD44780 LCDs for SD printing
   //#define LCD_PROGRESS_BAR
 
@@ -724,9 +753,41 @@
   #define BLOCK_BUFFER_SIZE 16 // maximize block buffer
 #endif
 
+// Measure the time spent planning each block and the time waiting for room in
+// the planner. M782 reports it with the planned blocks per second and the print
+// time at nominal speed. M782 B1 also echoes every block as it is planned, to
+// compare the block stream of a G-code file before and after a change.
+// During a print job, it also counts the blocks added to an empty buffer, the
+// blocks ending with an empty buffer (stepper underruns) and the fewest blocks
+// in the buffer. M782 L1 reports them at the end of each layer, M782 S<seconds>
+// every few seconds.
+//#define PLANNER_PROFILING
+
+// Compute the acceleration and deceleration step counts of the trapezoids with
+// 32-bit integer divisions instead of floats. The counts are exact, the floats
+// are off by up to 3 steps in 1 block in 6000. The rest of the planner still uses
+// floats, as do the blocks faster than 65535 steps/s. Compare the time per block
+// reported by M782 (PLANNER_PROFILING).
+//#define INTEGER_TRAPEZOID_STEPS
+
+// Merge runs of short collinear segments (as in G-code sliced from STL facets)
+// into one block, so fewer blocks are planned and executed for the same path.
+// A segment joins the line before it when it goes in the same direction within
+// MERGE_SEGMENTS_ANGLE, the path stays within MERGE_SEGMENTS_CHORD of the merged
+// line and the E per mm is within MERGE_SEGMENTS_E_RATIO of the first segment.
+// M782 reports the number of merged segments.
+//#define MERGE_SEGMENTS
+#if ENABLED(MERGE_SEGMENTS)
+  #define MERGE_SEGMENTS_ANGLE   2     // (degrees) Largest direction change of a segment
+  #define MERGE_SEGMENTS_CHORD   0.01  // (mm) Largest deviation from the merged line
+  #define MERGE_SEGMENTS_E_RATIO 0.05  // Largest relative change of the E per mm
+#endif
+
 // @section serial
 
 // The ASCII buffer for serial input
+// Commands are packed in a buffer of BUFSIZE * MAX_CMD_SIZE bytes so it holds
+// at least BUFSIZE commands and many more short ones (such as G1 moves).
 #define MAX_CMD_SIZE 96
 #define BUFSIZE 4
 
@@ -736,9 +797,16 @@
 // For ADVANCED_OK (M105) you need 32 bytes.
 // For debug-echo: 128 bytes for the optimal speed.
 // Other output doesn't need to be that speedy.
+// Boards with ARDUINO_SERIAL (such as the Duplicator i3 Plus) use the 64 bytes
+// buffer of the Arduino core instead.
 // :[0, 2, 4, 8, 16, 32, 64, 128, 256]
 #define TX_BUFFER_SIZE 0
 
+// Measure the time spent sending the "ok" and the temperature reports, the
+// waits for room in the TX buffer (MarlinSerial only) and the postponed
+// temperature reports. Report them with M783.
+//#define SERIAL_TX_STATS
+
 // Host Receive Buffer Size
 // Without XON/XOFF flow control (see SERIAL_XON_XOFF below) 32 bytes should be enough.
 // To use flow control, set this buffer size to at least 1024 bytes.
@@ -776,6 +844,52 @@
 // Some clients will have this feature soon. This could make the NO_TIMEOUTS unnecessary.
 //#define ADVANCED_OK
 
+/**
+ * Windowed flow control
+ *
+ * Once enabled by the host with M785 S1, the host can send several numbered
+ * lines without waiting for an "ok" (up to the number of bytes reported by
+ * M785), and a single "ok C<lines> B<bytes> P<blocks>" acknowledges several
+ * lines at once. Resend requests work as usual.
+ */
+//#define WINDOWED_FLOW_CONTROL
+#if ENABLED(WINDOWED_FLOW_CONTROL)
+  #define FLOW_WINDOW_MAX_ACKS  4  // Lines acknowledged by a single "ok" at most
+  #define FLOW_WINDOW_ACK_DELAY 10 // (ms) Longest delay before acknowledging a line
+#endif
+
+/**
+ * Command profiler
+ *
+ * Count the calls and measure the time spent in each command (G0, M104...).
+ * Report with M781, reset with M781 R. Each slot uses 15 bytes of SRAM.
+ * Commands seen once all the slots are used are only counted.
+ */
+//#define GCODE_PROFILER
+#define GCODE_PROFILER_SLOTS 16
+
+/**
+ * Binary G-code frames
+ *
+ * Once enabled by the host with M784 S1, commands can also be sent as
+ * compact binary frames with a CRC-16 instead of ASCII lines. Values are
+ * sent as fixed-point integers and are not scanned as text by the parser.
+ * ASCII lines are still accepted at any time (M23, M117... must use them).
+ * See buildroot/share/scripts/binary_gcode.py for the encoding.
+ * Requires FASTER_GCODE_PARSER.
+ */
+//#define BINARY_GCODE
+
+/**
+ * Command scripts
+ *
+ * Multi-step procedures of the firmware (bed leveling steps, filament
+ * load and unload...) are stored in PROGMEM as binary commands. They are
+ * executed directly by the command handlers, without text parsing and
+ * without using the command queue. Requires FASTER_GCODE_PARSER.
+ */
+//#define GCODE_SCRIPTS
+
 // @section extras
 
 /**
@@ -1237,6 +1351,8 @@
 
 /**
  * Auto-report temperatures with M155 S<seconds>
+ * A report is postponed while the TX buffer is more than half full, so it
+ * doesn't block the main loop.
  */
 #define AUTO_REPORT_TEMPERATURES
 
@@ -196,10 +196,21 @@ extern bool Running;
 inline bool IsRunning() { return  Running; }
 inline bool IsStopped() { return !Running; }
 
+extern uint8_t commands_in_queue; // Count of commands in the queue (including the one being executed)
+
 bool enqueue_and_echo_command(const char* cmd, bool say_ok=false); // Add a single command to the end of the buffer. Return false on failure.
 void enqueue_and_echo_commands_P(const char * const cmd);          // Set one or more commands to be prioritized over the next Serial/SD command.
 void clear_command_queue();
 
+#if ENABLED(GCODE_SCRIPTS)
+  bool enqueue_script_P(const char * const script);               // Run a command script (see gcode.h) after the queued commands. Return false on failure.
+  bool scripts_running();                                          // Is a script running or waiting to run?
+  void clear_scripts();                                            // Drop the running and waiting scripts
+#else
+  inline bool scripts_running() { return false; }
+  inline void clear_scripts() {}
+#endif
+
 extern millis_t previous_cmd_ms;
 inline void refresh_cmd_timeout() { previous_cmd_ms = millis(); }
 
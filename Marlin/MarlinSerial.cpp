@@ -76,6 +76,10 @@
     ring_buffer_pos_t rx_max_enqueued = 0;
   #endif
 
+  #if ENABLED(SERIAL_TX_STATS) && TX_BUFFER_SIZE > 0
+    uint32_t tx_full_waits = 0, tx_full_wait_us = 0;
+  #endif
+
   #if ENABLED(EMERGENCY_PARSER)
 
     #include "stepper.h"
@@ -401,7 +405,7 @@
       CRITICAL_SECTION_START;
         const uint8_t h = tx_buffer.head, t = tx_buffer.tail;
       CRITICAL_SECTION_END;
-      return (uint8_t)(TX_BUFFER_SIZE + h - t) & (TX_BUFFER_SIZE - 1);
+      return (uint8_t)(TX_BUFFER_SIZE + t - h - 1) & (TX_BUFFER_SIZE - 1); // Free bytes
     }
 
     void MarlinSerial::write(const uint8_t c) {
@@ -437,6 +441,10 @@
 
       // If the output buffer is full, there's nothing for it other than to
       // wait for the interrupt handler to empty it a bit
+      #if ENABLED(SERIAL_TX_STATS)
+        const bool was_full = (i == tx_buffer.tail);
+        const uint32_t wait_start = was_full ? micros() : 0;
+      #endif
       while (i == tx_buffer.tail) {
         if (!TEST(SREG, SREG_I)) {
           // Interrupts are disabled, so we'll have to poll the data
@@ -451,6 +459,13 @@
         }
       }
 
+      #if ENABLED(SERIAL_TX_STATS)
+        if (was_full) {
+          tx_full_waits++;
+          tx_full_wait_us += micros() - wait_start;
+        }
+      #endif
+
       tx_buffer.buffer[tx_buffer.head] = c;
       { CRITICAL_SECTION_START;
           tx_buffer.head = i;
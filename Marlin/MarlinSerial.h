@@ -112,6 +112,10 @@
     extern ring_buffer_pos_t rx_max_enqueued;
   #endif
 
+  #if ENABLED(SERIAL_TX_STATS) && TX_BUFFER_SIZE > 0
+    extern uint32_t tx_full_waits, tx_full_wait_us;
+  #endif
+
   class MarlinSerial { //: public Stream
 
     public:
@@ -138,6 +142,12 @@
         FORCE_INLINE static ring_buffer_pos_t rxMaxEnqueued() { return rx_max_enqueued; }
       #endif
 
+      #if ENABLED(SERIAL_TX_STATS) && TX_BUFFER_SIZE > 0
+        FORCE_INLINE static uint32_t txFullWaits() { return tx_full_waits; }
+        FORCE_INLINE static uint32_t txFullWaitTime() { return tx_full_wait_us; }
+        FORCE_INLINE static void resetTxStats() { tx_full_waits = tx_full_wait_us = 0; }
+      #endif
+
     private:
       static void printNumber(unsigned long, const uint8_t);
       static void printFloat(double, uint8_t);
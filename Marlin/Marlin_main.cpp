@@ -232,6 +232,16 @@
  * M364 - SCARA calibration: Move to cal-position PSIC (90 deg to Theta calibration position)
  *
  * ************ Custom codes - This can change to suit future G-code regulations
+ * M770 - Report statistics about the communication with the ADVi3++ LCD.
+ * M771 - Report the execution time of the ADVi3++ LCD actions. R to reset the timings.
+ * M772 - Measure the throughput and latency of the link with the ADVi3++ LCD. S<frames>
+ * M780 - Report the depth statistics of the command queue. R to reset them. L<bool> to enable the SD look-ahead.
+ * M781 - Report the number of calls and the time spent in each command. R to reset. (Requires GCODE_PROFILER)
+ * M782 - Report the planner profiling. R to reset. B<bool> to echo the planned blocks. L<bool> to report each layer. S<secs> to report every S seconds. (Requires PLANNER_PROFILING)
+ * M783 - Report the time spent sending the "ok" and the temperature reports. R to reset. (Requires SERIAL_TX_STATS)
+ * M784 - Enable or disable binary G-code frames. S<0|1> (Requires BINARY_GCODE)
+ * M785 - Enable or disable the windowed flow control. S<0|1> (Requires WINDOWED_FLOW_CONTROL)
+ * M787 - Report the cycles spent on the S-curve in the stepper ISR. R to reset. (Requires S_CURVE_PROFILING)
  * M928 - Start SD logging: "M928 filename.gco". Stop with M29. (Requires SDSUPPORT)
  * M999 - Restart after being stopped by error
  *
@@ -404,22 +414,40 @@ static long gcode_N, gcode_LastN, Stopped_gcode_LastN = 0;
 
 /**
  * GCode Command Queue
- * A simple ring buffer of BUFSIZE command strings.
+ * A ring buffer of variable-length commands packed in CMD_QUEUE_SIZE bytes.
  *
  * Commands are copied into this buffer by the command injectors
  * (immediate, serial, sd card) and they are processed sequentially by
  * the main loop. The process_next_command function parses the next
  * command and hands off execution to individual handler functions.
+ *
+ * Each command is stored as a flags byte (CMD_QUEUE_SAY_OK) followed by
+ * the nul-terminated command string. A command is never split: if it does
+ * not fit at the end of the buffer, a CMD_QUEUE_WRAP byte is stored and
+ * the command is stored at the beginning.
+ *
+ * Binary commands (CMD_QUEUE_BINARY) are stored as a length byte followed
+ * by the payload of the frame (see BINARY_GCODE).
  */
+#define CMD_QUEUE_SAY_OK 0x01
+#define CMD_QUEUE_BINARY 0x02
+#define CMD_QUEUE_WRAP   0xFF
+
 uint8_t commands_in_queue = 0; // Count of commands in the queue
-static uint8_t cmd_queue_index_r = 0, // Ring buffer read position
-               cmd_queue_index_w = 0; // Ring buffer write position
+static uint16_t cmd_queue_index_r = 0, // Ring buffer read position
+                cmd_queue_index_w = 0; // Ring buffer write position
 #if ENABLED(M100_FREE_MEMORY_WATCHER)
-  char command_queue[BUFSIZE][MAX_CMD_SIZE];  // Necessary so M100 Free Memory Dumper can show us the commands and any corruption
-#else                                         // This can be collapsed back to the way it was soon.
-static char command_queue[BUFSIZE][MAX_CMD_SIZE];
+  char command_queue[CMD_QUEUE_SIZE];  // Necessary so M100 Free Memory Dumper can show us the commands and any corruption
+#else                                  // This can be collapsed back to the way it was soon.
+static char command_queue[CMD_QUEUE_SIZE];
 #endif
 
+// Depth statistics of the command queue (M780)
+static uint8_t cmd_queue_max_commands = 0;
+static uint16_t cmd_queue_max_bytes = 0;
+static uint32_t cmd_queue_nb_commands = 0, // Commands taken from the queue
+                cmd_queue_depth_sum = 0;   // Sum of the queue depths when a command is taken
+
 /**
  * Next Injected Command pointer. NULL if no commands are being injected.
  * Used by Marlin internally to ensure that commands initiated from within
@@ -665,8 +693,6 @@ float cartes[XYZ] = { 0 };
   #endif
 #endif
 
-static bool send_ok[BUFSIZE];
-
 #if HAS_SERVOS
   Servo servo[NUM_SERVOS];
   #define MOVE_SERVO(I, P) servo[I].move(P)
@@ -866,12 +892,67 @@ void clear_command_queue() {
 }
 
 /**
- * Once a new command is in the ring buffer, call this to commit it
+ * Number of bytes used by the commands in the queue
+ */
+inline uint16_t cmd_queue_bytes() {
+  if (!commands_in_queue) return 0;
+  return cmd_queue_index_w > cmd_queue_index_r
+    ? cmd_queue_index_w - cmd_queue_index_r
+    : CMD_QUEUE_SIZE - cmd_queue_index_r + cmd_queue_index_w;
+}
+
+/**
+ * Get the position where a command of 'len' bytes (flags and nul included)
+ * can be stored in the ring buffer. Return -1 if there is not enough room.
  */
-inline void _commit_command(bool say_ok) {
-  send_ok[cmd_queue_index_w] = say_ok;
-  if (++cmd_queue_index_w >= BUFSIZE) cmd_queue_index_w = 0;
+static int16_t cmd_queue_position(const uint16_t len) {
+  if (commands_in_queue == 255) return -1;
+  const uint16_t r = cmd_queue_index_r, w = cmd_queue_index_w;
+  if (w > r || !commands_in_queue) { // Room at the end and at the beginning
+    if (CMD_QUEUE_SIZE - w >= len) return w;
+    return r >= len ? 0 : -1;
+  }
+  return (w < r && r - w >= len) ? w : -1; // w == r when full
+}
+
+/**
+ * Is there enough room in the queue for a command of the maximum size?
+ */
+inline bool cmd_queue_has_room() { return cmd_queue_position(MAX_CMD_SIZE + 1) >= 0; }
+
+/**
+ * Once a new command is in the ring buffer at 'pos', call this to commit it
+ */
+inline void _commit_command(const uint16_t pos, const uint16_t len, const uint8_t flags) {
+  if (pos != cmd_queue_index_w) command_queue[cmd_queue_index_w] = CMD_QUEUE_WRAP;
+  if (!commands_in_queue) cmd_queue_index_r = pos;
+  command_queue[pos] = flags;
+  cmd_queue_index_w = pos + len;
+  if (cmd_queue_index_w >= CMD_QUEUE_SIZE) cmd_queue_index_w = 0;
   commands_in_queue++;
+
+  NOLESS(cmd_queue_max_commands, commands_in_queue);
+  NOLESS(cmd_queue_max_bytes, cmd_queue_bytes());
+}
+
+/**
+ * Remove the command that was just processed from the queue
+ */
+inline void _advance_command_queue() {
+  cmd_queue_nb_commands++;
+  cmd_queue_depth_sum += commands_in_queue;
+  if (--commands_in_queue) {
+    #if ENABLED(BINARY_GCODE)
+      if (command_queue[cmd_queue_index_r] & CMD_QUEUE_BINARY)
+        cmd_queue_index_r += (uint8_t)command_queue[cmd_queue_index_r + 1] + 2;
+      else
+    #endif
+        cmd_queue_index_r += strlen(&command_queue[cmd_queue_index_r + 1]) + 2;
+    if (cmd_queue_index_r >= CMD_QUEUE_SIZE || command_queue[cmd_queue_index_r] == (char)CMD_QUEUE_WRAP)
+      cmd_queue_index_r = 0;
+  }
+  else
+    cmd_queue_index_r = cmd_queue_index_w = 0; // Empty, make all the room contiguous
 }
 
 /**
@@ -880,9 +961,12 @@ inline void _commit_command(bool say_ok) {
  * Return false for a full buffer, or if the 'command' is a comment.
  */
 inline bool _enqueuecommand(const char* cmd, bool say_ok=false) {
-  if (*cmd == ';' || commands_in_queue >= BUFSIZE) return false;
-  strcpy(command_queue[cmd_queue_index_w], cmd);
-  _commit_command(say_ok);
+  if (*cmd == ';') return false;
+  const uint16_t len = strlen(cmd) + 2;
+  const int16_t pos = cmd_queue_position(len);
+  if (pos < 0) return false;
+  strcpy(&command_queue[pos + 1], cmd);
+  _commit_command(pos, len, say_ok ? CMD_QUEUE_SAY_OK : 0);
   return true;
 }
 
@@ -1092,6 +1176,137 @@ void gcode_line_error(const char* err, bool doFlush = true) {
   serial_count = 0;
 }
 
+#if ENABLED(BINARY_GCODE)
+
+  /**
+   * Binary G-code frames, accepted at the start of a line once enabled with M784 S1
+   *
+   *   B5 | length | line (2 bytes) | payload (length bytes) | CRC (2 bytes)
+   *
+   * The CRC-16 (XMODEM) covers the length, line and payload bytes. The line is
+   * the low 16 bits of the line number (N), shared with the ASCII lines.
+   * The payload is queued as is and decoded by GCodeParser::parse_binary.
+   * All multi-byte fields are little-endian.
+   */
+  #define BINARY_GCODE_SYNC 0xB5
+
+  enum BinaryFrameState : char {
+    BINARY_FRAME_IDLE,
+    BINARY_FRAME_LENGTH,
+    BINARY_FRAME_LINE_LOW,
+    BINARY_FRAME_LINE_HIGH,
+    BINARY_FRAME_PAYLOAD,
+    BINARY_FRAME_CRC_LOW,
+    BINARY_FRAME_CRC_HIGH
+  };
+
+  static bool binary_gcode_enabled = false;
+  static BinaryFrameState binary_frame_state = BINARY_FRAME_IDLE;
+  static uint8_t binary_frame_length, binary_frame_count;
+  static uint16_t binary_frame_line, binary_frame_crc;
+
+  /**
+   * Queue the payload of a complete binary frame after checking its CRC and line number.
+   * Commands with a string argument can't be binary: they are rejected with an error.
+   */
+  inline void binary_gcode_frame(const char* payload, const uint16_t crc) {
+    uint16_t expected_crc = 0;
+    const uint8_t header[3] = { binary_frame_length, (uint8_t)binary_frame_line, (uint8_t)(binary_frame_line >> 8) };
+    crc16(&expected_crc, header, sizeof(header));
+    crc16(&expected_crc, payload, binary_frame_length);
+    if (crc != expected_crc) {
+      gcode_line_error(PSTR(MSG_ERR_CHECKSUM_MISMATCH));
+      return;
+    }
+    if (binary_frame_line != (uint16_t)(gcode_LastN + 1)) {
+      gcode_line_error(PSTR(MSG_ERR_LINE_NO));
+      return;
+    }
+    gcode_LastN++;
+
+    const char letter = payload[0];
+    const uint16_t code = (uint8_t)payload[1] | (uint8_t)payload[2] << 8;
+
+    // The argument of M23, M117... would be decoded as parameters: reject the line
+    if (parser.has_string_arg(letter, code)) {
+      SERIAL_ERROR_START();
+      serialprintPGM(PSTR(MSG_ERR_BINARY_STRING));
+      SERIAL_CHAR(letter);
+      SERIAL_ERRORLN(code);
+      ok_to_send();
+      return;
+    }
+
+    // Movement commands alert when stopped
+    if (IsStopped() && letter == 'G' && code <= 3) {
+      SERIAL_ERRORLNPGM(MSG_ERR_STOPPED);
+      LCD_MESSAGEPGM(MSG_STOPPED);
+    }
+
+    #if DISABLED(EMERGENCY_PARSER)
+      // If command was e-stop process now
+      if (letter == 'M') switch (code) {
+        case 108:
+          wait_for_heatup = false;
+          #if ENABLED(ULTIPANEL)
+            wait_for_user = false;
+          #endif
+          break;
+        case 112: kill(PSTR(MSG_KILLED)); break;
+        case 410: quickstop_stepper(); break;
+      }
+    #endif
+
+    // Add the command to the queue (there is always room for MAX_CMD_SIZE + 1 bytes)
+    const int16_t pos = cmd_queue_position(binary_frame_length + 2);
+    command_queue[pos + 1] = binary_frame_length;
+    memcpy(&command_queue[pos + 2], payload, binary_frame_length);
+    _commit_command(pos, binary_frame_length + 2, CMD_QUEUE_SAY_OK | CMD_QUEUE_BINARY);
+  }
+
+  /**
+   * Process a byte of a binary frame. The payload is stored in 'buffer'.
+   */
+  inline void binary_gcode_byte(const uint8_t c, char * const buffer) {
+    switch (binary_frame_state) {
+      case BINARY_FRAME_IDLE: // The sync byte
+        binary_frame_state = BINARY_FRAME_LENGTH;
+        break;
+      case BINARY_FRAME_LENGTH:
+        if (!WITHIN(c, 3, MAX_CMD_SIZE - 1)) { // Letter and code at least; the queue has room for MAX_CMD_SIZE + 1 bytes
+          binary_frame_state = BINARY_FRAME_IDLE;
+          gcode_line_error(PSTR(MSG_ERR_BINARY_LENGTH));
+          break;
+        }
+        binary_frame_length = c;
+        binary_frame_state = BINARY_FRAME_LINE_LOW;
+        break;
+      case BINARY_FRAME_LINE_LOW:
+        binary_frame_line = c;
+        binary_frame_state = BINARY_FRAME_LINE_HIGH;
+        break;
+      case BINARY_FRAME_LINE_HIGH:
+        binary_frame_line |= (uint16_t)c << 8;
+        binary_frame_count = 0;
+        binary_frame_state = BINARY_FRAME_PAYLOAD;
+        break;
+      case BINARY_FRAME_PAYLOAD:
+        buffer[binary_frame_count++] = c;
+        if (binary_frame_count >= binary_frame_length) binary_frame_state = BINARY_FRAME_CRC_LOW;
+        break;
+      case BINARY_FRAME_CRC_LOW:
+        binary_frame_crc = c;
+        binary_frame_state = BINARY_FRAME_CRC_HIGH;
+        break;
+      case BINARY_FRAME_CRC_HIGH:
+        binary_frame_state = BINARY_FRAME_IDLE;
+        binary_gcode_frame(buffer, binary_frame_crc | (uint16_t)c << 8);
+        break;
+    }
+  }
+
+#endif // BINARY_GCODE
+
 /**
  * Get all commands waiting on the serial port and queue them.
  * Exit when the buffer is full or when no more characters are
@@ -1116,10 +1331,20 @@ inline void get_serial_commands() {
    * Loop while serial characters are incoming and the queue is not full
    */
   int c;
-  while (commands_in_queue < BUFSIZE && (c = MYSERIAL.read()) >= 0) {
+  while (cmd_queue_has_room() && (c = MYSERIAL.read()) >= 0) {
 
     char serial_char = c;
 
+    #if ENABLED(BINARY_GCODE)
+      // A binary frame starts with the sync byte instead of a line
+      if (binary_frame_state != BINARY_FRAME_IDLE
+        || (binary_gcode_enabled && c == BINARY_GCODE_SYNC && !serial_count && !serial_comment_mode)
+      ) {
+        binary_gcode_byte(c, serial_line_buffer);
+        continue;
+      }
+    #endif
+
     /**
      * If the character ends the line
      */
@@ -1235,17 +1460,57 @@ inline void get_serial_commands() {
 
 #if ENABLED(SDSUPPORT)
 
+  #if ENABLED(SD_LOOKAHEAD)
+    static bool sd_lookahead_enabled = true,  // M780 L
+                sd_lookahead_allowed = false; // Set while a motion command is processed
+    static bool planner_was_empty = true;
+    static uint32_t sd_planner_empty[2] = { 0 }; // Times the planner ran empty while printing, without and with the look-ahead
+  #endif
+
+  /**
+   * The end of the file was read: finish the print or go back to the calling file
+   */
+  inline void sd_print_finished() {
+    SERIAL_PROTOCOLLNPGM(MSG_FILE_PRINTED);
+    card.printingHasFinished();
+    #if ENABLED(PRINTER_EVENT_LEDS)
+      LCD_MESSAGEPGM(MSG_INFO_COMPLETED_PRINTS);
+      set_led_color(0, 255, 0); // Green
+      #if HAS_RESUME_CONTINUE
+        enqueue_and_echo_commands_P(PSTR("M0")); // end of the queue!
+      #else
+        safe_delay(1000);
+      #endif
+      set_led_color(0, 0, 0);   // OFF
+    #endif
+    card.checkautostart(true);
+  }
+
   /**
    * Get commands from the SD Card until the command buffer is full
    * or until the end of the file is reached. The special character '#'
    * can also interrupt buffering.
+   *
+   * With 'lookahead' (from idle() during a move), the end of the file is
+   * left for the main loop, and the lines are parsed ahead of time.
    */
-  inline void get_sdcard_commands() {
+  inline void get_sdcard_commands(const bool lookahead=false) {
     static bool stop_buffering = false,
                 sd_comment_mode = false;
 
     if (!card.sdprinting) return;
 
+    #if ENABLED(SD_LOOKAHEAD)
+      // The look-ahead reads the next lines while the moves wait for the planner
+      if (!lookahead && sd_lookahead_enabled && commands_in_queue) return;
+    #endif
+
+    // The look-ahead has already read the end of the file
+    if (card.eof()) {
+      if (!lookahead) sd_print_finished();
+      return;
+    }
+
     /**
      * '#' stops reading from SD to the buffer prematurely, so procedural
      * macro calls are possible. If it occurs, stop_buffering is triggered
@@ -1256,8 +1521,9 @@ inline void get_serial_commands() {
     if (commands_in_queue == 0) stop_buffering = false;
 
     uint16_t sd_count = 0;
+    int16_t sd_pos;
     bool card_eof = card.eof();
-    while (commands_in_queue < BUFSIZE && !card_eof && !stop_buffering) {
+    while (!card_eof && !stop_buffering && (sd_pos = cmd_queue_position(MAX_CMD_SIZE + 1)) >= 0) {
       const int16_t n = card.get();
       char sd_char = (char)n;
       card_eof = card.eof();
@@ -1266,19 +1532,7 @@ inline void get_serial_commands() {
           || ((sd_char == '#' || sd_char == ':') && !sd_comment_mode)
       ) {
         if (card_eof) {
-          SERIAL_PROTOCOLLNPGM(MSG_FILE_PRINTED);
-          card.printingHasFinished();
-          #if ENABLED(PRINTER_EVENT_LEDS)
-            LCD_MESSAGEPGM(MSG_INFO_COMPLETED_PRINTS);
-            set_led_color(0, 255, 0); // Green
-            #if HAS_RESUME_CONTINUE
-              enqueue_and_echo_commands_P(PSTR("M0")); // end of the queue!
-            #else
-              safe_delay(1000);
-            #endif
-            set_led_color(0, 0, 0);   // OFF
-          #endif
-          card.checkautostart(true);
+          if (!lookahead) sd_print_finished();
         }
         else if (n == -1) {
           SERIAL_ERROR_START();
@@ -1290,10 +1544,21 @@ inline void get_serial_commands() {
 
         if (!sd_count) continue; // skip empty lines (and comment lines)
 
-        command_queue[cmd_queue_index_w][sd_count] = '\0'; // terminate string
-        sd_count = 0; // clear sd line buffer
+        command_queue[sd_pos + 1 + sd_count] = '\0'; // terminate string
 
-        _commit_command(false);
+        #if ENABLED(SD_LOOKAHEAD) && ENABLED(BINARY_GCODE)
+          // Store the line already parsed, if possible (static: too big for the stack of idle())
+          static char record[MAX_CMD_SIZE - 1];
+          const uint8_t length = lookahead ? parser.tokenize(&command_queue[sd_pos + 1], record) : 0;
+          if (length) {
+            command_queue[sd_pos + 1] = length;
+            memcpy(&command_queue[sd_pos + 2], record, length);
+            _commit_command(sd_pos, length + 2, CMD_QUEUE_BINARY);
+          }
+          else
+        #endif
+            _commit_command(sd_pos, sd_count + 2, 0);
+        sd_count = 0; // clear sd line buffer
       }
       else if (sd_count >= MAX_CMD_SIZE - 1) {
         /**
@@ -1303,11 +1568,34 @@ inline void get_serial_commands() {
       }
       else {
         if (sd_char == ';') sd_comment_mode = true;
-        if (!sd_comment_mode) command_queue[cmd_queue_index_w][sd_count++] = sd_char;
+        if (!sd_comment_mode) command_queue[sd_pos + 1 + sd_count++] = sd_char;
       }
     }
   }
 
+  #if ENABLED(SD_LOOKAHEAD)
+
+    /**
+     * Called by idle(): count the times the planner runs empty while printing
+     * and read ahead from the SD card while a move waits for the planner.
+     * The command being processed must still be in the queue.
+     */
+    inline void sd_lookahead() {
+      if (!card.sdprinting) return;
+
+      const bool planner_empty = !planner.blocks_queued();
+      if (planner_empty && !planner_was_empty) sd_planner_empty[sd_lookahead_enabled]++;
+      planner_was_empty = planner_empty;
+
+      if (sd_lookahead_enabled && sd_lookahead_allowed && commands_in_queue && cmd_queue_has_room()) {
+        sd_lookahead_allowed = false; // No nested look-ahead
+        get_sdcard_commands(true);
+        sd_lookahead_allowed = true;
+      }
+    }
+
+  #endif
+
 #endif // SDSUPPORT
 
 /**
@@ -7420,10 +7708,44 @@ inline void gcode_M105() {
   SERIAL_EOL();
 }
 
+// Free bytes in an empty TX buffer, if it can be queried
+#if defined(ARDUINO_SERIAL) && defined(SERIAL_TX_BUFFER_SIZE)
+  #define TX_BUFFER_CAPACITY (SERIAL_TX_BUFFER_SIZE - 1) // Arduino HardwareSerial
+#elif !defined(USBCON) && !defined(ARDUINO_SERIAL) && TX_BUFFER_SIZE > 0
+  #define TX_BUFFER_CAPACITY (TX_BUFFER_SIZE - 1)
+#else
+  #define TX_BUFFER_CAPACITY 0
+#endif
+
+#if ENABLED(SERIAL_TX_STATS)
+
+  /**
+   * Time spent sending messages to the host (M783)
+   */
+  typedef struct TxStats {
+    uint32_t count, total_time, max_time; // Time in microseconds
+    void add(const uint32_t time) { count++; total_time += time; NOLESS(max_time, time); }
+    void report(const char * const name_P) const {
+      serialprintPGM(name_P);
+      SERIAL_ECHOPAIR(":", count);
+      SERIAL_ECHOPAIR(" avg:", count ? total_time / count : 0);
+      SERIAL_ECHOPAIR("us max:", max_time);
+      SERIAL_ECHOPGM("us");
+    }
+  } tx_stats_t;
+
+  static tx_stats_t tx_stats_ok, tx_stats_temperatures;
+  static uint32_t tx_deferred_reports = 0; // Temperature reports postponed for room in the TX buffer
+
+#endif // SERIAL_TX_STATS
+
 #if ENABLED(AUTO_REPORT_TEMPERATURES) && (HAS_TEMP_HOTEND || HAS_TEMP_BED)
 
   static uint8_t auto_report_temp_interval;
   static millis_t next_temp_report_ms;
+  #if TX_BUFFER_CAPACITY > 0
+    static bool temp_report_postponed = false; // The due report waits for room in the TX buffer
+  #endif
 
   /**
    * M155: Set temperature auto-report interval. M155 S<seconds>
@@ -7438,9 +7760,26 @@ inline void gcode_M105() {
 
   inline void auto_report_temperatures() {
     if (auto_report_temp_interval && ELAPSED(millis(), next_temp_report_ms)) {
+      #if TX_BUFFER_CAPACITY > 0
+        // Wait for room in the TX buffer rather than block the main loop
+        if (MYSERIAL.availableForWrite() < TX_BUFFER_CAPACITY / 2) {
+          #if ENABLED(SERIAL_TX_STATS)
+            if (!temp_report_postponed) tx_deferred_reports++;
+          #endif
+          temp_report_postponed = true;
+          return;
+        }
+        temp_report_postponed = false;
+      #endif
+      #if ENABLED(SERIAL_TX_STATS)
+        const uint32_t report_start = micros();
+      #endif
       next_temp_report_ms = millis() + 1000UL * auto_report_temp_interval;
       print_heaterstates();
       SERIAL_EOL();
+      #if ENABLED(SERIAL_TX_STATS)
+        tx_stats_temperatures.add(micros() - report_start);
+      #endif
     }
   }
 
@@ -8294,6 +8633,20 @@ inline void gcode_M115() {
       SERIAL_PROTOCOLLNPGM("Cap:EMERGENCY_PARSER:0");
     #endif
 
+    // WINDOWED_FLOW_CONTROL (M785)
+    #if ENABLED(WINDOWED_FLOW_CONTROL)
+      SERIAL_PROTOCOLLNPGM("Cap:FLOW_WINDOW:1");
+    #else
+      SERIAL_PROTOCOLLNPGM("Cap:FLOW_WINDOW:0");
+    #endif
+
+    // BINARY_GCODE (M784)
+    #if ENABLED(BINARY_GCODE)
+      SERIAL_PROTOCOLLNPGM("Cap:BINARY_GCODE:1");
+    #else
+      SERIAL_PROTOCOLLNPGM("Cap:BINARY_GCODE:0");
+    #endif
+
   #endif // EXTENDED_CAPABILITIES_REPORT
 }
 
@@ -10261,6 +10614,355 @@ inline void gcode_M355() {
 
 #endif // MIXING_EXTRUDER
 
+/**
+ * M770: Report statistics about the communication with the ADVi3++ LCD
+ */
+inline void gcode_M770() { advi3pp::i3PlusPrinter::report_statistics(); }
+
+/**
+ * M771: Report the execution time (average and worst) of the handlers of the ADVi3++ LCD actions
+ *
+ *   R  Reset the timings after reporting them
+ */
+inline void gcode_M771() { advi3pp::i3PlusPrinter::report_action_timings(parser.seen('R')); }
+
+/**
+ * M772: Measure the link with the ADVi3++ LCD: sustained throughput and latency of a page change.
+ *       The LCD does not respond to the user during the measure.
+ *
+ *   S<frames>  Number of frames to send to measure the throughput (default 50)
+ */
+inline void gcode_M772() { advi3pp::i3PlusPrinter::benchmark_link(parser.ushortval('S', 50)); }
+
+/**
+ * M780: Report the depth statistics of the command queue
+ *
+ *   R       Reset the statistics after reporting them
+ *   L<bool> Enable or disable the SD look-ahead (Requires SD_LOOKAHEAD)
+ */
+inline void gcode_M780() {
+  SERIAL_ECHO_START();
+  SERIAL_ECHOPAIR("Command queue commands:", commands_in_queue);
+  SERIAL_ECHOPAIR(" bytes:", cmd_queue_bytes());
+  SERIAL_ECHOPAIR("/", CMD_QUEUE_SIZE);
+  SERIAL_ECHOPAIR(" max commands:", cmd_queue_max_commands);
+  SERIAL_ECHOPAIR(" max bytes:", cmd_queue_max_bytes);
+  SERIAL_ECHOLNPAIR(" avg depth:", cmd_queue_nb_commands ? float(cmd_queue_depth_sum) / cmd_queue_nb_commands : 0.0);
+
+  #if ENABLED(SD_LOOKAHEAD)
+    if (parser.seen('L')) sd_lookahead_enabled = parser.value_bool();
+    SERIAL_ECHO_START();
+    SERIAL_ECHOPAIR("SD look-ahead:", sd_lookahead_enabled ? 1 : 0);
+    SERIAL_ECHOPAIR(" planner empty without:", sd_planner_empty[0]);
+    SERIAL_ECHOLNPAIR(" with:", sd_planner_empty[1]);
+  #endif
+
+  if (parser.seen('R')) {
+    cmd_queue_max_commands = cmd_queue_max_bytes = 0;
+    cmd_queue_nb_commands = cmd_queue_depth_sum = 0;
+    #if ENABLED(SD_LOOKAHEAD)
+      sd_planner_empty[0] = sd_planner_empty[1] = 0;
+    #endif
+  }
+}
+
+#if ENABLED(GCODE_PROFILER)
+
+  /**
+   * Time spent in each command, in the order the commands are first seen.
+   * This includes the time the handler waits, i.e. for room in the planner.
+   */
+  typedef struct {
+    char letter;
+    uint16_t code;
+    uint32_t count, total_time, max_time; // Time in microseconds
+  } command_profile_t;
+
+  static command_profile_t command_profiles[GCODE_PROFILER_SLOTS];
+  static uint8_t nb_command_profiles = 0;
+  static uint32_t nb_unprofiled_commands = 0; // Commands seen once all the slots were used
+
+  /**
+   * Account the time spent in the command that was just processed.
+   * The letter and code are the ones seen before the dispatch: handlers
+   * running other commands (M32, scripts...) leave the parser on those.
+   */
+  inline void profile_command(const char letter, const uint16_t code, const uint32_t time) {
+    uint8_t i = 0;
+    while (i < nb_command_profiles && (command_profiles[i].code != code || command_profiles[i].letter != letter)) ++i;
+    if (i >= nb_command_profiles) {
+      if (i >= GCODE_PROFILER_SLOTS) { nb_unprofiled_commands++; return; }
+      nb_command_profiles++;
+      command_profiles[i].letter = letter;
+      command_profiles[i].code = code;
+      command_profiles[i].count = command_profiles[i].total_time = command_profiles[i].max_time = 0;
+    }
+    command_profile_t &profile = command_profiles[i];
+    profile.count++;
+    profile.total_time += time;
+    NOLESS(profile.max_time, time);
+  }
+
+  /**
+   * M781: Report the number of calls and the time spent in each command
+   *
+   *   R  Reset the profiles after reporting them
+   */
+  inline void gcode_M781() {
+    for (uint8_t i = 0; i < nb_command_profiles; ++i) {
+      const command_profile_t &profile = command_profiles[i];
+      SERIAL_ECHO_START();
+      SERIAL_CHAR(profile.letter);
+      SERIAL_ECHO(profile.code);
+      SERIAL_ECHOPAIR(" count:", profile.count);
+      SERIAL_ECHOPAIR(" total:", profile.total_time);
+      SERIAL_ECHOPAIR("us avg:", profile.total_time / profile.count);
+      SERIAL_ECHOPAIR("us max:", profile.max_time);
+      SERIAL_ECHOLNPGM("us");
+    }
+    if (nb_unprofiled_commands) {
+      SERIAL_ECHO_START();
+      SERIAL_ECHOLNPAIR("Not profiled:", nb_unprofiled_commands);
+    }
+
+    if (parser.seen('R')) {
+      nb_command_profiles = 0;
+      nb_unprofiled_commands = 0;
+    }
+  }
+
+#endif // GCODE_PROFILER
+
+#if ENABLED(PLANNER_PROFILING)
+
+  static bool planner_layer_reports = false;
+  static uint8_t planner_report_interval;      // Seconds between the reports of the starvation (M782 S)
+  static millis_t next_planner_report_ms;
+
+  /**
+   * Report the starvation of the planner buffer during the last layer (M782 L1)
+   */
+  inline void report_planner_layer() {
+    if (!planner.layer_stats_ready) return;
+    planner.layer_stats_ready = false;
+    if (!planner_layer_reports) return;
+    const Planner::layer_stats_t &layer = planner.last_layer_stats;
+    SERIAL_ECHO_START();
+    SERIAL_ECHOPAIR("Layer Z:", layer.z);
+    SERIAL_ECHOPAIR(" min planned:", layer.min_moves_planned);
+    SERIAL_ECHOPAIR(" starved:", layer.starved_blocks);
+    SERIAL_ECHOPAIR(" underruns:", layer.underruns);
+    SERIAL_ECHOLNPAIR(" last line:", gcode_LastN);
+  }
+
+  /**
+   * Report the starvation of the planner buffer every few seconds of a print job (M782 S)
+   */
+  inline void auto_report_planner() {
+    if (!planner_report_interval || !ELAPSED(millis(), next_planner_report_ms)) return;
+    next_planner_report_ms = millis() + 1000UL * planner_report_interval;
+    if (!print_job_timer.isRunning()) return;
+    SERIAL_ECHO_START();
+    SERIAL_ECHOPAIR("Planner starved:", planner.starved_blocks);
+    SERIAL_ECHOPAIR(" underruns:", planner.get_underruns());
+    SERIAL_ECHOPAIR(" min planned:", planner.min_moves_planned);
+    SERIAL_ECHOLNPAIR(" last line:", gcode_LastN);
+  }
+
+  /**
+   * M782: Report the planner profiling
+   *
+   *   R        Reset the profiling after reporting it
+   *   B<bool>  Echo each block as it is planned
+   *   L<bool>  Report the starvation of the buffer at the end of each layer
+   *   S<secs>  Report the starvation of the buffer every S seconds (0 to stop)
+   *
+   * The starvation is only counted during a print job.
+   */
+  inline void gcode_M782() {
+    const uint32_t elapsed_ms = millis() - planner.profiling_start_ms,
+                   nb_blocks = planner.nb_planned_blocks;
+    SERIAL_ECHO_START();
+    SERIAL_ECHOPAIR("Planner blocks:", nb_blocks);
+    SERIAL_ECHOPAIR(" per second:", elapsed_ms ? nb_blocks * 1000.0 / elapsed_ms : 0.0);
+    SERIAL_ECHOPAIR(" plan avg:", nb_blocks ? planner.plan_time_us / nb_blocks : 0);
+    SERIAL_ECHOPAIR("us max:", planner.max_plan_time_us);
+    SERIAL_ECHOPAIR("us max segments/s:", planner.plan_time_us ? nb_blocks * 1000000.0 / planner.plan_time_us : 0.0);
+    SERIAL_ECHOPAIR(" recalculate avg:", nb_blocks ? planner.recalculate_time_us / nb_blocks : 0);
+    SERIAL_ECHOPAIR("us replanned blocks avg:", nb_blocks ? float(planner.replanned_blocks) / nb_blocks : 0.0);
+    SERIAL_ECHOPAIR(" trapezoids avg:", nb_blocks ? float(planner.recalculated_trapezoids) / nb_blocks : 0.0);
+    #if ENABLED(MERGE_SEGMENTS)
+      SERIAL_ECHOPAIR(" merged segments:", planner.merged_segments);
+    #endif
+    SERIAL_ECHOPAIR(" wait:", planner.wait_time_us / 1000);
+    SERIAL_ECHOPAIR("ms planned time:", planner.planned_time_s);
+    SERIAL_ECHOPAIR("s starved:", planner.starved_blocks);
+    SERIAL_ECHOPAIR(" underruns:", planner.get_underruns());
+    SERIAL_ECHOLNPAIR(" min planned:", planner.min_moves_planned);
+
+    if (parser.seen('B')) planner.echo_blocks = parser.value_bool();
+    if (parser.seen('L')) planner_layer_reports = parser.value_bool();
+    if (parser.seenval('S')) {
+      planner_report_interval = parser.value_byte();
+      NOMORE(planner_report_interval, 60);
+      next_planner_report_ms = millis() + 1000UL * planner_report_interval;
+    }
+    if (parser.seen('R')) planner.reset_profiling();
+  }
+
+#endif // PLANNER_PROFILING
+
+#if ENABLED(SERIAL_TX_STATS)
+
+  /**
+   * M783: Report the time spent sending the "ok" and the temperature reports
+   *
+   *   R  Reset the statistics after reporting them
+   */
+  inline void gcode_M783() {
+    SERIAL_ECHO_START();
+    tx_stats_ok.report(PSTR("TX ok"));
+    tx_stats_temperatures.report(PSTR(" temperature reports"));
+    SERIAL_ECHOPAIR(" postponed:", tx_deferred_reports);
+    #if !defined(USBCON) && !defined(ARDUINO_SERIAL) && TX_BUFFER_SIZE > 0
+      SERIAL_ECHOPAIR(" buffer full waits:", customizedSerial.txFullWaits());
+      SERIAL_ECHOPAIR(" time:", customizedSerial.txFullWaitTime());
+      SERIAL_ECHOPGM("us");
+    #endif
+    SERIAL_EOL();
+
+    if (parser.seen('R')) {
+      tx_stats_ok = tx_stats_temperatures = tx_stats_t();
+      tx_deferred_reports = 0;
+      #if !defined(USBCON) && !defined(ARDUINO_SERIAL) && TX_BUFFER_SIZE > 0
+        customizedSerial.resetTxStats();
+      #endif
+    }
+  }
+
+#endif // SERIAL_TX_STATS
+
+#if ENABLED(WINDOWED_FLOW_CONTROL)
+
+  /**
+   * Windowed flow control (M785 S1)
+   *
+   * The host may send numbered lines without waiting for an "ok", as long as
+   * the lines not acknowledged yet use at most FLOW_WINDOW_BYTES, each line
+   * counting for its length plus one byte. These bytes always fit in the RX
+   * buffer and in the part of the command queue that accepts lines even when
+   * it is fragmented.
+   *
+   * Lines are acknowledged in order and in ranges: "ok C<lines> B<bytes> P<blocks>"
+   * acknowledges the next C lines, with the free bytes of the command queue and
+   * the free blocks of the planner. On a "Resend: N" the lines from N are dropped;
+   * the lines before N are still acknowledged.
+   */
+  #if defined(USBCON) || defined(ARDUINO_SERIAL)
+    #ifndef SERIAL_RX_BUFFER_SIZE
+      #define SERIAL_RX_BUFFER_SIZE 64 // Arduino HardwareSerial default
+    #endif
+    #define FLOW_WINDOW_RX_BYTES (SERIAL_RX_BUFFER_SIZE - 1)
+  #else
+    #define FLOW_WINDOW_RX_BYTES (RX_BUFFER_SIZE - 1)
+  #endif
+  #define FLOW_WINDOW_BYTES (FLOW_WINDOW_RX_BYTES + CMD_QUEUE_SIZE - 2 * (MAX_CMD_SIZE + 1))
+
+  static bool flow_window_enabled = false;
+  static uint8_t flow_window_acks = 0;  // Lines processed but not acknowledged yet
+  static millis_t flow_window_ack_ms = 0;
+
+  /**
+   * Acknowledge the lines processed since the last "ok"
+   */
+  void flow_window_ack() {
+    #if ENABLED(SERIAL_TX_STATS)
+      const uint32_t ok_start = micros();
+    #endif
+    SERIAL_PROTOCOLPGM(MSG_OK);
+    SERIAL_PROTOCOLPAIR(" C", flow_window_acks);
+    SERIAL_PROTOCOLPAIR(" B", CMD_QUEUE_SIZE - cmd_queue_bytes());
+    SERIAL_PROTOCOLPAIR(" P", int(BLOCK_BUFFER_SIZE - planner.movesplanned() - 1));
+    SERIAL_EOL();
+    #if ENABLED(SERIAL_TX_STATS)
+      tx_stats_ok.add(micros() - ok_start);
+    #endif
+    flow_window_acks = 0;
+    flow_window_ack_ms = millis();
+  }
+
+  /**
+   * Called by idle(): acknowledge once the queue is drained, when there are
+   * FLOW_WINDOW_MAX_ACKS lines to acknowledge, or after FLOW_WINDOW_ACK_DELAY.
+   */
+  inline void flow_window_task() {
+    if (flow_window_acks && (commands_in_queue <= 1 || flow_window_acks >= FLOW_WINDOW_MAX_ACKS
+                             || ELAPSED(millis(), flow_window_ack_ms + FLOW_WINDOW_ACK_DELAY)))
+      flow_window_ack();
+  }
+
+  /**
+   * M785: Enable or disable the windowed flow control and report the window
+   *
+   *   S<bool>  Acknowledge ranges of lines instead of each line
+   */
+  inline void gcode_M785() {
+    if (parser.seen('S')) {
+      if (flow_window_acks) flow_window_ack();
+      flow_window_enabled = parser.value_bool();
+      flow_window_ack_ms = millis();
+    }
+    SERIAL_ECHO_START();
+    SERIAL_ECHOPAIR("Flow window:", flow_window_enabled ? 1 : 0);
+    SERIAL_ECHOLNPAIR(" bytes:", FLOW_WINDOW_BYTES);
+  }
+
+#endif // WINDOWED_FLOW_CONTROL
+
+#if ENABLED(S_CURVE_PROFILING)
+
+  /**
+   * M787: Report the cost of the S-curve in the stepper ISR
+   *
+   *   R  Reset the measure after reporting it
+   *
+   * Timer 1 counts every 8 cycles.
+   */
+  inline void gcode_M787() {
+    CRITICAL_SECTION_START;
+    const uint32_t bezier_evals = stepper.bezier_evals,
+                   bezier_ticks = stepper.bezier_ticks;
+    const uint8_t bezier_max_ticks = stepper.bezier_max_ticks;
+    if (parser.seen('R')) {
+      stepper.bezier_evals = stepper.bezier_ticks = 0;
+      stepper.bezier_max_ticks = 0;
+    }
+    CRITICAL_SECTION_END;
+    SERIAL_ECHO_START();
+    SERIAL_ECHOPAIR("S-curve evaluations:", bezier_evals);
+    SERIAL_ECHOPAIR(" cycles avg:", bezier_evals ? bezier_ticks * 8.0 / bezier_evals : 0.0);
+    SERIAL_ECHOLNPAIR(" max:", bezier_max_ticks * 8);
+  }
+
+#endif // S_CURVE_PROFILING
+
+#if ENABLED(BINARY_GCODE)
+
+  /**
+   * M784: Enable or disable binary G-code frames and report the state
+   *
+   *   S<bool>  Accept binary frames at the start of a line
+   *
+   * ASCII lines are accepted in both modes.
+   */
+  inline void gcode_M784() {
+    if (parser.seen('S')) binary_gcode_enabled = parser.value_bool();
+    SERIAL_ECHO_START();
+    SERIAL_ECHOLNPAIR("Binary G-code:", binary_gcode_enabled ? 1 : 0);
+  }
+
+#endif // BINARY_GCODE
+
 /**
  * M999: Restart after being stopped
  *
@@ -10844,47 +11546,19 @@ inline void gcode_T(uint8_t tmp_extruder) {
 }
 
 /**
- * Process a single command and dispatch it to its handler
- * This is called from the main loop()
+ * Dispatch a parsed command to its handler
+ *
+ * This stays a switch rather than a PROGMEM table of handlers: gcc already
+ * compiles it into jump tables and compare trees, while a table would need
+ * a common signature for all the handlers and an entry per feature #if.
+ * The frequent motion commands don't come here (see execute_parsed_command).
  */
-void process_next_command() {
-  char * const current_command = command_queue[cmd_queue_index_r];
-
-  if (DEBUGGING(ECHO)) {
-    SERIAL_ECHO_START();
-    SERIAL_ECHOLN(current_command);
-    #if ENABLED(M100_FREE_MEMORY_WATCHER)
-      SERIAL_ECHOPAIR("slot:", cmd_queue_index_r);
-      M100_dump_routine("   Command Queue:", (const char*)command_queue, (const char*)(command_queue + sizeof(command_queue)));
-    #endif
-  }
-
-  KEEPALIVE_STATE(IN_HANDLER);
-
-  // Parse the next command in the queue
-  parser.parse(current_command);
-
+void process_parsed_command() {
   // Handle a known G, M, or T
   switch (parser.command_letter) {
     case 'G': switch (parser.codenum) {
 
-      // G0, G1
-      case 0:
-      case 1:
-        #if IS_SCARA
-          gcode_G0_G1(parser.codenum == 0);
-        #else
-          gcode_G0_G1();
-        #endif
-        break;
-
-      // G2, G3
-      #if ENABLED(ARC_SUPPORT) && DISABLED(SCARA)
-        case 2: // G2: CW ARC
-        case 3: // G3: CCW ARC
-          gcode_G2_G3(parser.codenum == 2);
-          break;
-      #endif
+      // G0-G3 are handled by process_next_command
 
       // G4 Dwell
       case 4:
@@ -11674,6 +12348,58 @@ void process_next_command() {
 
       #endif // I2C_POSITION_ENCODERS
 
+      case 770: // M770: Report ADVi3++ LCD statistics
+        gcode_M770();
+        break;
+
+      case 771: // M771: Report ADVi3++ LCD action timings
+        gcode_M771();
+        break;
+
+      case 772: // M772: Benchmark the ADVi3++ LCD link
+        gcode_M772();
+        break;
+
+      case 780: // M780: Report command queue statistics
+        gcode_M780();
+        break;
+
+      #if ENABLED(GCODE_PROFILER)
+        case 781: // M781: Report the time spent in each command
+          gcode_M781();
+          break;
+      #endif
+
+      #if ENABLED(PLANNER_PROFILING)
+        case 782: // M782: Report the planner profiling
+          gcode_M782();
+          break;
+      #endif
+
+      #if ENABLED(SERIAL_TX_STATS)
+        case 783: // M783: Report the time spent sending messages to the host
+          gcode_M783();
+          break;
+      #endif
+
+      #if ENABLED(BINARY_GCODE)
+        case 784: // M784: Enable or disable binary G-code frames
+          gcode_M784();
+          break;
+      #endif
+
+      #if ENABLED(WINDOWED_FLOW_CONTROL)
+        case 785: // M785: Enable or disable the windowed flow control
+          gcode_M785();
+          break;
+      #endif
+
+      #if ENABLED(S_CURVE_PROFILING)
+        case 787: // M787: Report the cost of the S-curve in the stepper ISR
+          gcode_M787();
+          break;
+      #endif
+
       case 999: // M999: Restart after being Stopped
         gcode_M999();
         break;
@@ -11686,12 +12412,202 @@ void process_next_command() {
 
     default: parser.unknown_command_error();
   }
+}
+
+/**
+ * Run the command in the parser with its handler
+ */
+static void execute_parsed_command() {
+  KEEPALIVE_STATE(IN_HANDLER);
+
+  #if ENABLED(GCODE_PROFILER)
+    const char command_letter = parser.command_letter;
+    const uint16_t command_code = parser.codenum;
+    const uint32_t command_start = micros();
+  #endif
+
+  // The motion commands bypass the dispatch of all the other commands
+  #if ENABLED(SD_LOOKAHEAD)
+    sd_lookahead_allowed = true; // Read from the SD card while waiting for the planner
+  #endif
+  if (parser.command_letter == 'G' && parser.codenum <= 1) {
+    #if IS_SCARA
+      gcode_G0_G1(parser.codenum == 0);
+    #else
+      gcode_G0_G1();
+    #endif
+  }
+  #if ENABLED(ARC_SUPPORT) && DISABLED(SCARA)
+    else if (parser.command_letter == 'G' && parser.codenum <= 3)
+      gcode_G2_G3(parser.codenum == 2);
+  #endif
+  else {
+    #if ENABLED(SD_LOOKAHEAD)
+      sd_lookahead_allowed = false;
+    #endif
+    #if ENABLED(MERGE_SEGMENTS)
+      // The other commands (fan, flow, temperatures...) apply after the moves before them
+      planner.flush_merged_line();
+    #endif
+    process_parsed_command();
+  }
+  #if ENABLED(SD_LOOKAHEAD)
+    sd_lookahead_allowed = false;
+  #endif
+
+  #if ENABLED(GCODE_PROFILER)
+    profile_command(command_letter, command_code, micros() - command_start);
+  #endif
 
   KEEPALIVE_STATE(NOT_BUSY);
+}
+
+/**
+ * Process a single command and dispatch it to its handler
+ * This is called from the main loop()
+ */
+void process_next_command() {
+  char * const current_command = &command_queue[cmd_queue_index_r + 1];
+  #if ENABLED(BINARY_GCODE)
+    const bool binary = command_queue[cmd_queue_index_r] & CMD_QUEUE_BINARY;
+  #endif
+
+  if (DEBUGGING(ECHO)) {
+    SERIAL_ECHO_START();
+    #if ENABLED(BINARY_GCODE)
+      if (binary) {
+        SERIAL_CHAR(current_command[1]);
+        SERIAL_ECHOLN((uint8_t)current_command[2] | (uint8_t)current_command[3] << 8);
+      }
+      else
+    #endif
+        SERIAL_ECHOLN(current_command);
+    #if ENABLED(M100_FREE_MEMORY_WATCHER)
+      SERIAL_ECHOPAIR("slot:", cmd_queue_index_r);
+      M100_dump_routine("   Command Queue:", (const char*)command_queue, (const char*)(command_queue + sizeof(command_queue)));
+    #endif
+  }
+
+  // Parse the next command in the queue
+  #if ENABLED(BINARY_GCODE)
+    if (binary)
+      parser.parse_binary(current_command + 1, (uint8_t)current_command[0]);
+    else
+  #endif
+      parser.parse(current_command);
+
+  execute_parsed_command();
 
   ok_to_send();
 }
 
+#if ENABLED(GCODE_SCRIPTS)
+
+  /**
+   * Command scripts waiting to run (see GCODE_SCRIPTS in gcode.h).
+   * scripts_P[0] is the running script and points to its next command.
+   */
+  #define SCRIPT_QUEUE_SIZE 4
+  static const char *scripts_P[SCRIPT_QUEUE_SIZE];
+  static uint8_t scripts_wait[SCRIPT_QUEUE_SIZE]; // Commands of the queue to run before each script
+  static uint8_t scripts_count = 0;
+
+  // The command being executed (letter, code and at most 5 int32 values)
+  static char script_record[28];
+
+  /**
+   * Add a script to run once the previous ones and the commands already
+   * in the queue are done. A running script holds back the commands queued
+   * after it, one command per loop().
+   * Return false if too many scripts are waiting.
+   */
+  bool enqueue_script_P(const char * const script) {
+    if (scripts_count >= SCRIPT_QUEUE_SIZE) return false;
+    scripts_wait[scripts_count] = commands_in_queue;
+    scripts_P[scripts_count++] = script;
+    return true;
+  }
+
+  /**
+   * The first script may run: the commands queued before it are done.
+   * The queue may have been cleared in the meantime.
+   */
+  static bool script_ready() {
+    NOMORE(scripts_wait[0], commands_in_queue);
+    return !scripts_wait[0];
+  }
+
+  /**
+   * A command of the queue is done: one less to wait for.
+   */
+  static void script_queue_advanced() {
+    for (uint8_t i = 0; i < scripts_count; i++) if (scripts_wait[i]) --scripts_wait[i];
+  }
+
+  /**
+   * A script is running or waiting to run. Its moves may not be
+   * planned yet, so commands_in_queue and the planner don't show it.
+   */
+  bool scripts_running() { return scripts_count > 0; }
+
+  /**
+   * Drop the running and waiting scripts (stop, cancel).
+   * The command being executed, if any, is not interrupted.
+   */
+  void clear_scripts() { scripts_count = 0; }
+
+  /**
+   * Copy the next command of the running script into script_record.
+   * Return its length, or 0 at the end of the script.
+   */
+  static uint8_t read_script_command() {
+    const char *p = scripts_P[0];
+    if (!pgm_read_byte(p)) return 0; // SCRIPT_END
+
+    uint8_t length = 0;
+    for (uint8_t i = 3; i--;) script_record[length++] = pgm_read_byte(p++);
+
+    for (uint8_t param; (param = pgm_read_byte(p)) != (uint8_t)SCRIPT_EOL;) {
+      const uint8_t type = param >> 5,
+                    size = 1 + (type == GCodeParser::BINARY_NO_VALUE ? 0 : type <= GCodeParser::BINARY_INT32_5 ? 4 : 2);
+      if (length + size <= sizeof(script_record))
+        for (uint8_t i = size; i--;) script_record[length++] = pgm_read_byte(p++);
+      else
+        p += size; // Too many parameters
+    }
+
+    scripts_P[0] = p + 1;
+    return length;
+  }
+
+  /**
+   * Execute the next command of the running script, without text parsing
+   * and without using the command queue. Start the next script at the end.
+   */
+  static void run_script_command() {
+    const uint8_t length = read_script_command();
+    if (!length) {
+      for (uint8_t i = 1; i < scripts_count; i++) {
+        scripts_P[i - 1] = scripts_P[i];
+        scripts_wait[i - 1] = scripts_wait[i];
+      }
+      --scripts_count;
+      return;
+    }
+
+    parser.parse_binary(script_record, length);
+
+    if (DEBUGGING(ECHO)) {
+      SERIAL_ECHO_START();
+      SERIAL_CHAR(parser.command_letter);
+      SERIAL_ECHOLN(parser.codenum);
+    }
+
+    execute_parsed_command();
+  }
+
+#endif // GCODE_SCRIPTS
+
 /**
  * Send a "Resend: nnn" message to the host to
  * indicate that a command needs to be re-sent.
@@ -11699,6 +12615,14 @@ void process_next_command() {
 void FlushSerialRequestResend() {
   //char command_queue[cmd_queue_index_r][100]="Resend:";
   MYSERIAL.flush();
+  #if ENABLED(WINDOWED_FLOW_CONTROL)
+    if (flow_window_enabled) {
+      if (flow_window_acks) flow_window_ack(); // Lines before the resent one
+      SERIAL_PROTOCOLPGM(MSG_RESEND);
+      SERIAL_PROTOCOLLN(gcode_LastN + 1);
+      return;
+    }
+  #endif
   SERIAL_PROTOCOLPGM(MSG_RESEND);
   SERIAL_PROTOCOLLN(gcode_LastN + 1);
   ok_to_send();
@@ -11715,20 +12639,37 @@ void FlushSerialRequestResend() {
  */
 void ok_to_send() {
   refresh_cmd_timeout();
-  if (!send_ok[cmd_queue_index_r]) return;
+  // With an empty queue this is a resend request and the host expects an "ok"
+  if (commands_in_queue && !(command_queue[cmd_queue_index_r] & CMD_QUEUE_SAY_OK)) return;
+  #if ENABLED(WINDOWED_FLOW_CONTROL)
+    if (flow_window_enabled) { flow_window_acks++; return; } // Acknowledged by flow_window_task()
+  #endif
+  #if ENABLED(SERIAL_TX_STATS)
+    const uint32_t ok_start = micros();
+  #endif
   SERIAL_PROTOCOLPGM(MSG_OK);
   #if ENABLED(ADVANCED_OK)
-    char* p = command_queue[cmd_queue_index_r];
-    if (*p == 'N') {
-      SERIAL_PROTOCOL(' ');
-      SERIAL_ECHO(*p++);
-      while (NUMERIC_SIGNED(*p))
+    // No command at cmd_queue_index_r (resend request): the ring may hold anything there
+    if (commands_in_queue) {
+      char* p = &command_queue[cmd_queue_index_r + 1];
+      if (*p == 'N'
+        #if ENABLED(BINARY_GCODE)
+          && !(command_queue[cmd_queue_index_r] & CMD_QUEUE_BINARY)
+        #endif
+      ) {
+        SERIAL_PROTOCOL(' ');
         SERIAL_ECHO(*p++);
+        while (NUMERIC_SIGNED(*p))
+          SERIAL_ECHO(*p++);
+      }
+      SERIAL_PROTOCOLPGM(" P"); SERIAL_PROTOCOL(int(BLOCK_BUFFER_SIZE - planner.movesplanned() - 1));
+      SERIAL_PROTOCOLPGM(" B"); SERIAL_PROTOCOL(int((CMD_QUEUE_SIZE - cmd_queue_bytes()) / (MAX_CMD_SIZE + 1)));
     }
-    SERIAL_PROTOCOLPGM(" P"); SERIAL_PROTOCOL(int(BLOCK_BUFFER_SIZE - planner.movesplanned() - 1));
-    SERIAL_PROTOCOLPGM(" B"); SERIAL_PROTOCOL(BUFSIZE - commands_in_queue);
   #endif
   SERIAL_EOL();
+  #if ENABLED(SERIAL_TX_STATS)
+    tx_stats_ok.add(micros() - ok_start);
+  #endif
 }
 
 #if HAS_SOFTWARE_ENDSTOPS
@@ -13098,7 +14039,7 @@ void manage_inactivity(bool ignore_stepper_queue/*=false*/) {
       handle_filament_runout();
   #endif
 
-  if (commands_in_queue < BUFSIZE) get_available_commands();
+  if (cmd_queue_has_room()) get_available_commands();
 
   const millis_t ms = millis();
 
@@ -13275,6 +14216,19 @@ void idle(
   lcd_update();
   advi3pp::i3PlusPrinter::task();
 
+  #if ENABLED(SD_LOOKAHEAD)
+    sd_lookahead();
+  #endif
+
+  #if ENABLED(WINDOWED_FLOW_CONTROL)
+    flow_window_task();
+  #endif
+
+  #if ENABLED(PLANNER_PROFILING)
+    report_planner_layer();
+    auto_report_planner();
+  #endif
+
   host_keepalive();
 
   #if ENABLED(AUTO_REPORT_TEMPERATURES) && (HAS_TEMP_HOTEND || HAS_TEMP_BED)
@@ -13441,9 +14395,6 @@ void setup() {
   SERIAL_ECHOPAIR(MSG_FREE_MEMORY, freeMemory());
   SERIAL_ECHOLNPAIR(MSG_PLANNER_BUFFER_BYTES, (int)sizeof(block_t)*BLOCK_BUFFER_SIZE);
 
-  // Send "ok" after commands by default
-  for (int8_t i = 0; i < BUFSIZE; i++) send_ok[i] = true;
-
   // Load data from EEPROM if available (or use defaults)
   // This also updates variables in the planner, elsewhere
   (void)settings.load();
@@ -13629,25 +14580,39 @@ void setup() {
  * The main Marlin program loop
  *
  *  - Save or log commands to SD
+ *  - Run the next command of a script (GCODE_SCRIPTS) once the commands
+ *    queued before it are done
  *  - Process available commands (if not saving)
+ *  - Add the merged line to the planner if the queue is empty (MERGE_SEGMENTS)
  *  - Call heater manager
  *  - Call inactivity manager
  *  - Call endstop manager
  *  - Call LCD update
  */
 void loop() {
-  if (commands_in_queue < BUFSIZE) get_available_commands();
+  if (cmd_queue_has_room()) get_available_commands();
 
   #if ENABLED(SDSUPPORT)
     card.checkautostart(false);
   #endif
 
+  #if ENABLED(GCODE_SCRIPTS)
+    if (scripts_count && script_ready()) run_script_command(); else
+  #endif
   if (commands_in_queue) {
 
     #if ENABLED(SDSUPPORT)
 
       if (card.saving) {
-        char* command = command_queue[cmd_queue_index_r];
+        char* command = &command_queue[cmd_queue_index_r + 1];
+        #if ENABLED(BINARY_GCODE)
+          if (command_queue[cmd_queue_index_r] & CMD_QUEUE_BINARY) {
+            SERIAL_ERROR_START();
+            SERIAL_ERRORLNPGM(MSG_ERR_BINARY_SAVING);
+            ok_to_send();
+          }
+          else
+        #endif
         if (strstr_P(command, PSTR("M29"))) {
           // M29 closes the file
           card.closefile();
@@ -13683,10 +14648,18 @@ void loop() {
 
     // The queue may be reset by a command handler or by code invoked by idle() within a handler
     if (commands_in_queue) {
-      --commands_in_queue;
-      if (++cmd_queue_index_r >= BUFSIZE) cmd_queue_index_r = 0;
+      _advance_command_queue();
+      #if ENABLED(GCODE_SCRIPTS)
+        script_queue_advanced();
+      #endif
     }
   }
+
+  #if ENABLED(MERGE_SEGMENTS)
+    // Don't hold back a merged line when no other move may come soon
+    if (!commands_in_queue || planner.movesplanned() < 2) planner.flush_merged_line();
+  #endif
+
   endstops.report_state();
   idle();
 }
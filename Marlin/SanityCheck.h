@@ -284,6 +284,55 @@ static_assert(X_MAX_LENGTH >= X_BED_SIZE && Y_MAX_LENGTH >= Y_BED_SIZE,
   #endif
 #endif
 
+/**
+ * Command queue
+ */
+#if BUFSIZE < 2
+  #error "BUFSIZE must be 2 or greater."
+#elif CMD_QUEUE_SIZE > 32767
+  #error "BUFSIZE * MAX_CMD_SIZE must be 32767 or smaller."
+#endif
+
+#if ENABLED(WINDOWED_FLOW_CONTROL)
+  #if CMD_QUEUE_SIZE < 2 * (MAX_CMD_SIZE + 1)
+    #error "WINDOWED_FLOW_CONTROL requires BUFSIZE of 3 or more."
+  #elif FLOW_WINDOW_MAX_ACKS < 1 || FLOW_WINDOW_MAX_ACKS > 255
+    #error "FLOW_WINDOW_MAX_ACKS must be between 1 and 255."
+  #endif
+#endif
+
+#if ENABLED(GCODE_PROFILER) && (GCODE_PROFILER_SLOTS < 1 || GCODE_PROFILER_SLOTS > 255)
+  #error "GCODE_PROFILER_SLOTS must be between 1 and 255."
+#endif
+
+#if ENABLED(BINARY_GCODE)
+  #if DISABLED(FASTER_GCODE_PARSER)
+    #error "BINARY_GCODE requires FASTER_GCODE_PARSER."
+  #elif MAX_CMD_SIZE > 256
+    #error "BINARY_GCODE requires MAX_CMD_SIZE of 256 or smaller."
+  #endif
+#endif
+
+#if ENABLED(GCODE_SCRIPTS) && DISABLED(FASTER_GCODE_PARSER)
+  #error "GCODE_SCRIPTS requires FASTER_GCODE_PARSER."
+#endif
+
+#if ENABLED(S_CURVE_ACCELERATION) && ENABLED(LIN_ADVANCE)
+  #error "S_CURVE_ACCELERATION is not compatible with LIN_ADVANCE."
+#endif
+
+#if ENABLED(MERGE_SEGMENTS) && IS_KINEMATIC
+  #error "MERGE_SEGMENTS is not compatible with DELTA or SCARA."
+#endif
+
+#if ENABLED(SDCARD_FILE_INDEX)
+  #if SDINDEX_LIMIT > 128
+    #error "SDINDEX_LIMIT must be 128 or smaller."
+  #elif SDINDEX_LIMIT < 2 || (SDINDEX_LIMIT & 1)
+    #error "SDINDEX_LIMIT must be an even number greater than 1."
+  #endif
+#endif
+
 /**
  * I2C Position Encoders
  */
@@ -27,6 +27,7 @@
 #include "cardreader.h"
 #include "stepper.h"
 #include "watchdog.h"
+#include "gcode.h"
 
 #include "adv_i3_plus_plus.h"
 #include "adv_i3_plus_plus_utils.h"
@@ -43,7 +44,73 @@ namespace
     const uint16_t advi3_pp_newest_lcd_compatible_version = 0x0101; // 1.0.1
 }
 
-namespace { const unsigned long advi3_pp_baudrate = 115200; }
+namespace
+{
+    //! Baudrates of the link with the LCD, the fastest first. The last one is used if the LCD does not answer.
+    //! The baudrate is configured on the LCD panel, the firmware only detects it.
+    const uint32_t advi3_pp_baudrates[] = {230400, 115200};
+    const unsigned int baudrate_probe_timeout = 100; // ms
+    const uint8_t baudrate_probe_attempts = 3;
+}
+
+namespace
+{
+    const unsigned int status_update_fast_period = 250;  // ms, while heating
+    const unsigned int status_update_slow_period = 1000; // ms, when temperatures are stable
+}
+
+namespace
+{
+    //! Commands of the procedures. With GCODE_SCRIPTS, they are command scripts executed without text parsing and
+    //! without using the command queue. Otherwise, they are lines of text added to the command queue.
+#if ENABLED(GCODE_SCRIPTS)
+    const char script_absolute_mode[] PROGMEM = { SCRIPT_G(90), SCRIPT_EOL, SCRIPT_END };
+    const char script_relative_mode[] PROGMEM = { SCRIPT_G(91), SCRIPT_EOL, SCRIPT_END };
+    const char script_unload_filament[] PROGMEM = { SCRIPT_G(1), SCRIPT_INT('E', -1), SCRIPT_INT('F', 120), SCRIPT_EOL, SCRIPT_END };
+    const char script_load_filament[] PROGMEM = { SCRIPT_G(1), SCRIPT_INT('E', 1), SCRIPT_INT('F', 120), SCRIPT_EOL, SCRIPT_END };
+    const char script_save_settings[] PROGMEM = { SCRIPT_M(500), SCRIPT_EOL, SCRIPT_END };
+    const char script_factory_reset[] PROGMEM = { SCRIPT_M(502), SCRIPT_EOL, SCRIPT_M(500), SCRIPT_EOL, SCRIPT_END };
+
+    //! Leveling: home in absolute mode
+    const char script_level_start[] PROGMEM = { SCRIPT_G(90), SCRIPT_EOL, SCRIPT_G(28), SCRIPT_EOL, SCRIPT_END };
+
+    //! Leveling: raise the nozzle, move it above a point of the bed and lower it
+    #define LEVEL_STEP_SCRIPT(x, y) { \
+        SCRIPT_G(1), SCRIPT_INT('Z', 10), SCRIPT_INT('F', 2000), SCRIPT_EOL, \
+        SCRIPT_G(1), SCRIPT_INT('X', x), SCRIPT_INT('Y', y), SCRIPT_INT('F', 6000), SCRIPT_EOL, \
+        SCRIPT_G(1), SCRIPT_INT('Z', 0), SCRIPT_INT('F', 1000), SCRIPT_EOL, \
+        SCRIPT_END }
+
+    //! Leveling: raise the nozzle at the end
+    const char script_level_finish[] PROGMEM = { SCRIPT_G(1), SCRIPT_INT('Z', 30), SCRIPT_INT('F', 2000), SCRIPT_EOL, SCRIPT_END };
+#else
+    const char script_absolute_mode[] PROGMEM = "G90";
+    const char script_relative_mode[] PROGMEM = "G91";
+    const char script_unload_filament[] PROGMEM = "G1 E-1 F120";
+    const char script_load_filament[] PROGMEM = "G1 E1 F120";
+    const char script_save_settings[] PROGMEM = "M500";
+    const char script_factory_reset[] PROGMEM = "M502\nM500";
+    const char script_level_start[] PROGMEM = "G90\nG28";
+    #define LEVEL_STEP_SCRIPT(x, y) "G1 Z10 F2000\nG1 X" #x " Y" #y " F6000\nG1 Z0 F1000"
+    const char script_level_finish[] PROGMEM = "G1 Z30 F2000";
+#endif
+
+    const char script_level_step1[] PROGMEM = LEVEL_STEP_SCRIPT(30, 30);
+    const char script_level_step2[] PROGMEM = LEVEL_STEP_SCRIPT(170, 170);
+    const char script_level_step3[] PROGMEM = LEVEL_STEP_SCRIPT(170, 30);
+    const char script_level_step4[] PROGMEM = LEVEL_STEP_SCRIPT(30, 170);
+    #undef LEVEL_STEP_SCRIPT
+
+    //! Run the commands of a procedure.
+    void run_script(const char* script)
+    {
+#if ENABLED(GCODE_SCRIPTS)
+        enqueue_script_P(script);
+#else
+        enqueue_and_echo_commands_P(script);
+#endif
+    }
+}
 
 namespace advi3pp {
 
@@ -107,6 +174,303 @@ void i3PlusPrinter::temperature_error()
     i3plus.temperature_error();
 }
 
+//! Report statistics about the communication with the LCD (M770).
+void i3PlusPrinter::report_statistics()
+{
+    i3plus.report_statistics();
+}
+
+//! Report the execution time of the handlers of the LCD actions (M771).
+//! @param reset    Reset the timings after reporting them
+void i3PlusPrinter::report_action_timings(bool reset)
+{
+    i3plus.report_action_timings(reset);
+}
+
+//! Measure the throughput and the latency of the link with the LCD (M772).
+//! @param nb_frames    Number of Frames to send to measure the throughput
+void i3PlusPrinter::benchmark_link(uint16_t nb_frames)
+{
+    i3plus.benchmark_link(nb_frames);
+}
+
+
+// --------------------------------------------------------------------
+// ReadRequests
+// --------------------------------------------------------------------
+
+//! Queue an asynchronous request to read registers of the LCD.
+//! @param reg          The first register to read
+//! @param nb_bytes     Number of registers (bytes) to read
+//! @param handler      Function to call when the request is completed
+//! @param key_value    Key value passed to the handler
+//! @return             False if the queue is full
+bool ReadRequests::read_register(Register reg, uint8_t nb_bytes, ReadResponseHandler handler, KeyValue key_value)
+{
+    return push(Command::ReadRegisterData, static_cast<uint8_t>(reg), nb_bytes, handler, key_value);
+}
+
+//! Queue an asynchronous request to read variables (RAM) of the LCD.
+//! @param var          The first variable to read
+//! @param nb_words     Number of words to read
+//! @param handler      Function to call when the request is completed
+//! @param key_value    Key value passed to the handler
+//! @return             False if the queue is full
+bool ReadRequests::read_ram(Variable var, uint8_t nb_words, ReadResponseHandler handler, KeyValue key_value)
+{
+    return push(Command::ReadRamData, static_cast<uint16_t>(var), nb_words, handler, key_value);
+}
+
+//! Queue an asynchronous request. It is sent immediately if there is no request in flight.
+//! @return             False if the queue is full
+bool ReadRequests::push(Command command, uint16_t address, uint8_t nb, ReadResponseHandler handler, KeyValue key_value)
+{
+    if(nb > (command == Command::ReadRamData ? IncomingFrame::MAX_NB_WORDS : 2 * IncomingFrame::MAX_NB_WORDS))
+    {
+        ADVi3PP_ERROR("Read request " << address << " is too big for the response Frame");
+        return false;
+    }
+
+    if(nb_requests_ >= NB_REQUESTS)
+    {
+        ADVi3PP_ERROR("Too many pending read requests, request " << address << " is dropped");
+        return false;
+    }
+
+    Request& request = requests_[(first_ + nb_requests_) % NB_REQUESTS];
+    request.command = command;
+    request.address = address;
+    request.nb = nb;
+    request.handler = handler;
+    request.key_value = key_value;
+    ++nb_requests_;
+
+    if(!in_flight_)
+        send_first();
+    return true;
+}
+
+//! Send the first request of the queue to the LCD.
+void ReadRequests::send_first()
+{
+    const Request& request = requests_[first_];
+    if(request.command == Command::ReadRegisterData)
+    {
+        ReadRegisterDataRequest frame{static_cast<Register>(request.address), request.nb};
+        frame.send();
+    }
+    else
+    {
+        ReadRamDataRequest frame{static_cast<Variable>(request.address), request.nb};
+        frame.send();
+    }
+
+    in_flight_ = true;
+    timeout_time_ = millis() + TIMEOUT;
+}
+
+//! Complete the request in flight and send the next one (if any).
+//! @param response     The response from the LCD or nullptr if the request failed
+void ReadRequests::complete(IncomingFrame* response)
+{
+    // Copy the request so the queue can be modified (by the handler) while it is executed
+    Request request = requests_[first_];
+    first_ = (first_ + 1) % NB_REQUESTS;
+    --nb_requests_;
+    in_flight_ = false;
+    retries_ = 0;
+
+    if(nb_requests_ > 0)
+        send_first();
+
+    (printer_.*request.handler)(response, request.key_value);
+}
+
+//! Check if a Frame received from the LCD is the response to the request in flight and if it is the case, complete it.
+//! @param frame        The Frame received from the LCD
+//! @return             True if the Frame was a response
+bool ReadRequests::handle_response(IncomingFrame& frame)
+{
+    if(!in_flight_)
+        return false;
+
+    const Request& request = requests_[first_];
+    if(!frame.match_response(request.command, request.address, request.nb))
+        return false;
+
+    complete(&frame);
+    return true;
+}
+
+//! Handle timeouts and retries of the request in flight.
+void ReadRequests::task()
+{
+    if(!in_flight_ || !ELAPSED(millis(), timeout_time_))
+        return;
+
+    if(retries_ < MAX_RETRIES)
+    {
+        ++retries_;
+        ADVi3PP_LOG("Timeout for read request " << requests_[first_].address << ", retry " << retries_);
+        send_first();
+        return;
+    }
+
+    ADVi3PP_ERROR("No response from the LCD for read request " << requests_[first_].address);
+    complete(nullptr);
+}
+
+
+// --------------------------------------------------------------------
+// StatusVariables
+// --------------------------------------------------------------------
+
+//! Set the value of a status variable. It is marked as dirty if its value changed.
+//! @param var      The variable (from TargetBed to FilePercentDone)
+//! @param value    The new value of the variable
+void StatusVariables::set(Variable var, uint16_t value)
+{
+    auto index = static_cast<uint16_t>(var) - static_cast<uint16_t>(Variable::TargetBed);
+    if(index >= NB_VARIABLES || values_[index] == value)
+        return;
+    values_[index] = value;
+    dirty_ |= 1 << index;
+}
+
+//! Mark all the variables as dirty so they are all sent with the next update.
+void StatusVariables::invalidate()
+{
+    dirty_ = ALL_DIRTY;
+}
+
+//! Send the dirty variables to the LCD. Adjacent dirty variables (or separated by a few clean ones) are coalesced
+//! into the same Frame.
+void StatusVariables::send()
+{
+    if(++nb_updates_ >= FULL_UPDATE_PERIOD)
+    {
+        nb_updates_ = 0;
+        invalidate();
+    }
+
+    uint16_t bytes = 0;
+    uint8_t index = 0;
+    while(index < NB_VARIABLES)
+    {
+        if(!(dirty_ & (1 << index)))
+        {
+            ++index;
+            continue;
+        }
+
+        // Find the end of this run of dirty variables, allowing small gaps of clean ones
+        uint8_t last = index;
+        for(uint8_t next = index + 1; next < NB_VARIABLES && next <= last + MAX_CLEAN_GAP + 1; ++next)
+            if(dirty_ & (1 << next))
+                last = next;
+
+        WriteRamDataRequest frame{static_cast<Variable>(static_cast<uint16_t>(Variable::TargetBed) + index)};
+        for(uint8_t i = index; i <= last; ++i)
+            frame << Uint16(values_[i]);
+
+        // If the Frame is not sent (the transmission queue is full), the variables stay dirty
+        if(frame.send())
+        {
+            for(uint8_t i = index; i <= last; ++i)
+                dirty_ &= ~(1 << i);
+            bytes += FRAME_OVERHEAD + 2 * (last - index + 1);
+            nb_frames_ += 1;
+        }
+
+        index = last + 1;
+    }
+
+    bytes_sent_ += bytes;
+    if(dirty_ == 0)
+        bytes_saved_ += FRAME_OVERHEAD + 2 * NB_VARIABLES - bytes;
+}
+
+//! Report the statistics of the status updates.
+void StatusVariables::report_statistics()
+{
+    SERIAL_ECHO_START();
+    SERIAL_ECHOPAIR("LCD status frames:", nb_frames_);
+    SERIAL_ECHOPAIR(" bytes sent:", bytes_sent_);
+    SERIAL_ECHOLNPAIR(" bytes saved:", bytes_saved_);
+}
+
+
+// --------------------------------------------------------------------
+// TemperatureGraph
+// --------------------------------------------------------------------
+
+//! Read the temperatures if it is time to do so and send the samples to the LCD when there are enough of them.
+void TemperatureGraph::task()
+{
+    auto now = millis();
+    if(!ELAPSED(now, next_reading_time_))
+        return;
+
+    // Keep a fixed rate, unless we are late by more than a period (task not called for a while)
+    next_reading_time_ += READING_PERIOD;
+    if(ELAPSED(now, next_reading_time_))
+        next_reading_time_ = now + READING_PERIOD;
+
+    bed_sum_ += thermalManager.degBed();
+    hotend_sum_ += thermalManager.degHotend(0);
+    if(++nb_readings_ < NB_READINGS)
+        return;
+
+    samples_[nb_samples_].bed = static_cast<uint16_t>(bed_sum_ / NB_READINGS + 0.5);
+    samples_[nb_samples_].hotend = static_cast<uint16_t>(hotend_sum_ / NB_READINGS + 0.5);
+    bed_sum_ = hotend_sum_ = 0;
+    nb_readings_ = 0;
+
+    if(++nb_samples_ >= NB_SAMPLES)
+        send();
+}
+
+//! Send the samples to the LCD. They are interleaved: bed (channel 0) then hotend (channel 1) for each sample.
+void TemperatureGraph::send()
+{
+    WriteCurveDataRequest frame{0b00000011};
+    for(uint8_t index = 0; index < nb_samples_; ++index)
+        frame << Uint16{samples_[index].bed} << Uint16{samples_[index].hotend};
+    frame.send();
+    nb_samples_ = 0;
+}
+
+// --------------------------------------------------------------------
+// Jog
+// --------------------------------------------------------------------
+
+//! Distance of each jog move (X, Y, Z, E). Change them to adjust the step sizes.
+const float Jog::STEPS[NUM_AXIS] = {5, 5, 0.5, 1};
+//! Feedrate of each jog move (X, Y, Z, E). They are limited by the maximal feedrates of the planner.
+const float Jog::FEEDRATES[NUM_AXIS] = {50, 50, 50, 2};
+
+//! Move an axis (or the extruder) by one step. The move is ignored if the printer is busy or if enough jog moves
+//! are already planned.
+//! @param axis         The axis to move
+//! @param positive     Direction of the move
+//! @return             True if the move was planned
+bool Jog::move(AxisEnum axis, bool positive)
+{
+    // Never interfere with a print (from the SD card or from a host) or with commands in the queue or in a script
+    // (such as homing). Moves planned since the last jog move come from another source (such as a host).
+    if(card.sdprinting || print_job_timer.isRunning() || commands_in_queue > 0 || scripts_running() ||
+       (planner.blocks_queued() && planner.block_buffer_head != head_) || planner.movesplanned() >= MAX_PLANNED_MOVES)
+        return false;
+
+    current_position[axis] += positive ? STEPS[axis] : -STEPS[axis];
+    if(axis != E_AXIS)
+        clamp_to_software_endstops(current_position);
+
+    planner.buffer_line_kinematic(current_position, FEEDRATES[axis], active_extruder);
+    head_ = planner.block_buffer_head;
+    return true;
+}
+
 
 // --------------------------------------------------------------------
 // i3PlusPrinterImpl
@@ -120,18 +484,102 @@ void i3PlusPrinterImpl::setup()
     ADVi3PP_LOG("This is a DEBUG build");
 #endif
 
-    Serial2.begin(advi3_pp_baudrate);
+    probe_baudrate();
     send_versions();
     show_page(Page::Boot);
 }
 
+//! Find the baudrate of the LCD panel by reading its version at each baudrate, the fastest first.
+//! The LCD may still be booting so this is tried a few times. If it never answers, the slowest baudrate is used.
+void i3PlusPrinterImpl::probe_baudrate()
+{
+    for(uint8_t attempt = 0; attempt < baudrate_probe_attempts; ++attempt)
+    {
+        for(auto baudrate: advi3_pp_baudrates)
+        {
+            Serial2.begin(baudrate);
+            while(Serial2.available() > 0)
+                Serial2.read();
+            incoming_frame_.reset();
+
+            ReadRegisterDataRequest frame{Register::Version, 1};
+            frame.send();
+            bool answered = wait_for_response(Command::ReadRegisterData, static_cast<uint8_t>(Register::Version), 1,
+                                              baudrate_probe_timeout);
+            incoming_frame_.reset();
+            Serial2.flush();
+
+            if(answered)
+            {
+                ADVi3PP_LOG("LCD answered at " << baudrate << " bauds");
+                baudrate_ = baudrate;
+                return;
+            }
+        }
+    }
+
+    ADVi3PP_ERROR("LCD did not answer, fallback to the slowest baudrate");
+    baudrate_ = advi3_pp_baudrates[COUNT(advi3_pp_baudrates) - 1];
+    Serial2.begin(baudrate_);
+}
+
+//! Wait (blocking) for a response from the LCD. This is only used during setup and benchmarks: other Frames
+//! received in the meantime are dropped. The heaters are still managed.
+//! @param command      The command of the request
+//! @param address      The register or variable of the request
+//! @param nb           The number of bytes or words of the request
+//! @param timeout      Maximal time to wait (ms)
+//! @return             True if the response was received. It is then in incoming_frame_.
+bool i3PlusPrinterImpl::wait_for_response(Command command, uint16_t address, uint8_t nb, unsigned int timeout)
+{
+    millis_t timeout_time = millis() + timeout;
+    while(PENDING(millis(), timeout_time))
+    {
+        watchdog_reset();
+        thermalManager.manage_heater();
+        TxQueue::task();
+        if(!incoming_frame_.receive())
+            continue;
+        if(incoming_frame_.match_response(command, address, nb))
+            return true;
+        incoming_frame_.reset();
+    }
+    return false;
+}
+
+//! Wait (blocking) until the transmission queue is empty. This is only used by benchmarks. The heaters are still
+//! managed but not idle(): it would serve the LCD in the meantime.
+//! @param timeout      Maximal time to wait (ms)
+//! @return             True if the queue is empty
+bool i3PlusPrinterImpl::wait_for_tx_queue(unsigned int timeout)
+{
+    millis_t timeout_time = millis() + timeout;
+    while(!TxQueue::empty())
+    {
+        if(ELAPSED(millis(), timeout_time))
+            return false;
+        watchdog_reset();
+        thermalManager.manage_heater();
+        TxQueue::task();
+    }
+    return true;
+}
+
 //! Read data from the LCD and act accordingly
 //!
 void i3PlusPrinterImpl::task()
 {
     read_lcd_serial();
+    read_requests_.task();
     execute_background_task();
     send_status_update();
+    TxQueue::task();
+
+    // Send again what did not fit in the transmission queue
+    if(sd_files_pending_)
+        send_sd_files();
+    else if(pending_page_ != Page::None)
+        show_page(pending_page_);
 }
 
 //! Store presets in permanent memory.
@@ -214,7 +662,7 @@ void i3PlusPrinterImpl::unload_filament()
     if(thermalManager.current_temperature[0] >= thermalManager.target_temperature[0] - 10)
     {
         ADVi3PP_LOG("Unload Filament");
-        enqueue_and_echo_commands_P(PSTR("G1 E-1 F120"));
+        run_script(script_unload_filament);
     }
     set_next_background_task_time();
 }
@@ -225,7 +673,7 @@ void i3PlusPrinterImpl::load_filament()
     if(thermalManager.current_temperature[0] >= thermalManager.target_temperature[0] - 10)
     {
         ADVi3PP_LOG("Load Filament");
-        enqueue_and_echo_commands_P(PSTR("G1 E1 F120"));
+        run_script(script_load_filament);
     }
     set_next_background_task_time();
 }
@@ -262,53 +710,45 @@ namespace
     int16_t scale(int16_t value, int16_t valueScale, int16_t targetScale) { return value * targetScale / valueScale; }
 }
 
-//! Update the status of the printer on the LCD.
+//! Update the status of the printer on the LCD. Only the values that changed are sent. Updates are more frequent
+//! while heating.
 void i3PlusPrinterImpl::send_status_update()
 {
+    send_graph_update();
+
     auto current_time = millis();
     if(!ELAPSED(current_time, next_update_time_))
         return;
-    set_next_update_time();
-
-    WriteRamDataRequest frame{Variable::TargetBed};
-    frame << Uint16(thermalManager.target_temperature_bed)
-          << Uint16(thermalManager.degBed())
-          << Uint16(thermalManager.target_temperature[0])
-          << Uint16(thermalManager.degHotend(0))
-          << Uint16(scale(fanSpeeds[0], 256, 100))
-          << Uint16(card.percentDone());
-    frame.send();
 
+    status_.set(Variable::TargetBed, thermalManager.target_temperature_bed);
+    status_.set(Variable::Bed, thermalManager.degBed());
+    status_.set(Variable::TargetHotEnd, thermalManager.target_temperature[0]);
+    status_.set(Variable::HotEnd, thermalManager.degHotend(0));
+    status_.set(Variable::FanSpeed, scale(fanSpeeds[0], 256, 100));
+    status_.set(Variable::FilePercentDonc, card.percentDone());
+    status_.send();
+
+    bool heating = thermalManager.isHeatingHotend(0) || thermalManager.isHeatingBed();
+    set_next_update_time(heating ? status_update_fast_period : status_update_slow_period);
+}
+
+//! Update the graphs on the LCD screen (if they are displayed).
+void i3PlusPrinterImpl::send_graph_update()
+{
     if(temp_graph_update_)
-         update_graph_data();
+        graph_.task();
 }
 
 //! Show the given page on the LCD screen
 //! @param [in] page The page to be displayed on the LCD screen
+//! If the transmission queue is full, the page is shown by task() later.
 void i3PlusPrinterImpl::show_page(Page page)
 {
     ADVi3PP_LOG("Show page " << static_cast<uint8_t>(page));
+    sd_files_pending_ = false; // Another page replaces the SD card page
     WriteRegisterDataRequest frame{Register::PictureID};
     frame << 00_u8 << page;
-    frame.send();
-}
-
-//! Retrieve the current page on the LCD screen
-Page i3PlusPrinterImpl::get_current_page()
-{
-    ReadRegisterDataRequest frame{Register::PictureID, 2};
-    frame.send();
-
-    ReadRegisterDataResponse response;
-    if(!response.receive(frame))
-    {
-        ADVi3PP_ERROR("Error while receiving Frame to read PictureID");
-        return Page::None;
-    }
-
-    Uint16 page; response >> page;
-    ADVi3PP_LOG("Current page index = " << page.word);
-    return static_cast<Page>(page.word);
+    pending_page_ = frame.send() ? Page::None : page;
 }
 
 //! Read a frame from the LCD and act accordingly
@@ -320,68 +760,108 @@ void i3PlusPrinterImpl::read_lcd_serial()
     //      2 |      1 |       1 |      2 |        1 |        2   bytes
     //  5A A5 |     06 |      83 |  04 60 |       01 |    01 50
 
-    IncomingFrame frame;
-    if(!frame.available())
+    if(!incoming_frame_.receive())
         return;
 
-    if(!frame.receive())
+    IncomingFrame& frame = incoming_frame_;
+    if(read_requests_.handle_response(frame))
     {
-        ADVi3PP_ERROR("Error while reading an incoming Frame");
+        frame.reset();
         return;
     }
 
     Command command; Action action; Uint8 nb_words; Uint16 value;
     frame >> command >> action >> nb_words >> value;
-    auto key_value = static_cast<KeyValue>(value.word);
 
-    // TODO: Check that length == 1, that Hi(action) == 0x04
+    // An action is a read of one word of RAM, in the range 0x04xx
+    if(command != Command::ReadRamData || frame.get_length() != 6 || nb_words.byte != 1 ||
+       (static_cast<uint16_t>(action) & 0xFF00) != 0x0400)
+    {
+        ADVi3PP_ERROR("Invalid Frame with command = " << static_cast<uint8_t>(command) << " and action = " << static_cast<uint16_t>(action));
+        frame.reset();
+        return;
+    }
+
     ADVi3PP_LOG("Receive a Frame of " << nb_words.byte << " words, with action = " << static_cast<uint16_t>(action) << " and KeyValue = " << value.word);
 
-    switch(action)
+    frame.reset();
+    dispatch_action(action, static_cast<KeyValue>(value.word));
+}
+
+//! Handlers of the actions sent by the LCD.
+const i3PlusPrinterImpl::ActionHandler i3PlusPrinterImpl::action_handlers_[NB_ACTIONS] PROGMEM =
+{
+    {Action::XPlus,             &i3PlusPrinterImpl::move_x_plus},
+    {Action::XMinus,            &i3PlusPrinterImpl::move_x_minus},
+    {Action::YPlus,             &i3PlusPrinterImpl::move_y_plus},
+    {Action::YMinus,            &i3PlusPrinterImpl::move_y_minus},
+    {Action::ZPlus,             &i3PlusPrinterImpl::move_z_plus},
+    {Action::ZMinus,            &i3PlusPrinterImpl::move_z_minus},
+    {Action::EPlus,             &i3PlusPrinterImpl::move_e_plus},
+    {Action::EMinus,            &i3PlusPrinterImpl::move_e_minus},
+    {Action::HomeAll,           &i3PlusPrinterImpl::home_all},
+    {Action::SdCard,            &i3PlusPrinterImpl::sd_card},
+    {Action::SdCardSelectFile,  &i3PlusPrinterImpl::sd_card_select_file},
+    {Action::Cooldown,          &i3PlusPrinterImpl::cooldown},
+    {Action::PrintStop,         &i3PlusPrinterImpl::print_stop},
+    {Action::PrintPause,        &i3PlusPrinterImpl::print_pause},
+    {Action::PrintResume,       &i3PlusPrinterImpl::print_resume},
+    {Action::Preheat,           &i3PlusPrinterImpl::preheat},
+    {Action::TemperatureGraph,  &i3PlusPrinterImpl::temperature_graph},
+    {Action::MotorsSettings,    &i3PlusPrinterImpl::motors_or_pid_settings},
+    {Action::SaveSettings,      &i3PlusPrinterImpl::save_motors_or_pid_settings},
+    {Action::SavePrintSettings, &i3PlusPrinterImpl::save_print_settings},
+    {Action::FactoryReset,      &i3PlusPrinterImpl::factory_reset},
+    {Action::HomeX,             &i3PlusPrinterImpl::home_X},
+    {Action::HomeY,             &i3PlusPrinterImpl::home_y},
+    {Action::HomeZ,             &i3PlusPrinterImpl::home_z},
+    {Action::PrintSettings,     &i3PlusPrinterImpl::print_settings},
+    {Action::LoadUnloadBack,    &i3PlusPrinterImpl::load_unload_back},
+    {Action::Level,             &i3PlusPrinterImpl::level},
+    {Action::Filament,          &i3PlusPrinterImpl::filament},
+    {Action::DisableMotors,     &i3PlusPrinterImpl::disable_motors},
+    {Action::Print,             &i3PlusPrinterImpl::print},
+    {Action::Statistics,        &i3PlusPrinterImpl::statistics},
+    {Action::PidTuning,         &i3PlusPrinterImpl::pid_tuning},
+    {Action::About,             &i3PlusPrinterImpl::about},
+    {Action::LcdUpdate,         &i3PlusPrinterImpl::lcd_update_mode}
+};
+
+//! Call the handler of an action and record its execution time.
+//! @param action       The action sent by the LCD
+//! @param key_value    The key value sent with the action
+void i3PlusPrinterImpl::dispatch_action(Action action, KeyValue key_value)
+{
+    for(uint8_t index = 0; index < NB_ACTIONS; ++index)
     {
-        case Action::SdCard:              sd_card(key_value); break;
-        case Action::SdCardSelectFile:    sd_card_select_file(key_value); break;
-        case Action::PrintStop:           print_stop(key_value); break;
-        case Action::PrintPause:          print_pause(key_value); break;
-        case Action::PrintResume:         print_resume(key_value); break;
-        case Action::Preheat:             preheat(key_value); break;
-        case Action::Cooldown:            cooldown(key_value); break;
-        case Action::MotorsSettings:      motors_or_pid_settings(key_value); break;
-        case Action::SaveSettings:        save_motors_or_pid_settings(key_value); break;
-        case Action::FactoryReset:        factory_reset(key_value); break;
-        case Action::PrintSettings:       print_settings(key_value); break;
-        case Action::SavePrintSettings:   save_print_settings(key_value); break;
-        case Action::LoadUnloadBack:      load_unload_back(key_value); break;
-        case Action::Level:               level(key_value); break;
-        case Action::Filament:            filament(key_value); break;
-        case Action::XPlus:               move_x_plus(key_value); break;
-        case Action::XMinus:              move_x_minus(key_value); break;
-        case Action::YPlus:               move_y_plus(key_value); break;
-        case Action::YMinus:              move_y_minus(key_value); break;
-        case Action::ZPlus:               move_z_plus(key_value); break;
-        case Action::ZMinus:              move_z_minus(key_value); break;
-        case Action::EPlus:               move_e_plus(key_value); break;
-        case Action::EMinus:              move_e_minus(key_value); break;
-        case Action::DisableMotors:       disable_motors(key_value); break;
-        case Action::HomeX:               home_X(key_value); break;
-        case Action::HomeY:               home_y(key_value); break;
-        case Action::HomeZ:               home_z(key_value); break;
-        case Action::HomeAll:             home_all(key_value); break;
-        case Action::Statistics:          statistics(key_value); break;
-        case Action::PidTuning:           pid_tuning(key_value); break;
-        case Action::TemperatureGraph:    temperature_graph(key_value); break;
-        case Action::Print:               print(key_value); break;
-        case Action::About:               about(key_value); break;
-        case Action::LcdUpdate:           lcd_update_mode(key_value);
-        default:                          ADVi3PP_ERROR("Unknown action " << static_cast<uint16_t>(action)); break;
+        if(static_cast<Action>(pgm_read_word(&action_handlers_[index].action)) != action)
+            continue;
+
+        ActionHandlerFunction handler;
+        memcpy_P(&handler, &action_handlers_[index].handler, sizeof(handler));
+
+        uint32_t start = micros();
+        (this->*handler)(key_value);
+        uint32_t duration = micros() - start;
+
+        ActionTiming& timing = action_timings_[index];
+        if(duration > timing.max_time)
+            timing.max_time = duration > 0xFFFF ? 0xFFFF : static_cast<uint16_t>(duration);
+        // Once the count or the sum saturates, stop both so the average stays right
+        if(timing.nb_calls < 0xFFFF && timing.total_time <= 0xFFFFFFFF - duration)
+        {
+            timing.total_time += duration;
+            timing.nb_calls += 1;
+        }
+        return;
     }
+
+    ADVi3PP_ERROR("Unknown action " << static_cast<uint16_t>(action));
 }
 
 //! LCD SD card menu
 void i3PlusPrinterImpl::sd_card(KeyValue key_value)
 {
-    static const uint16_t NB_VISIBLE_FILES = 5;
-
     if(card.sdprinting)
     {
         show_page(Page::Print);
@@ -391,6 +871,7 @@ void i3PlusPrinterImpl::sd_card(KeyValue key_value)
     if(key_value == KeyValue::Show)
     {
         card.initsd();
+        sd_page_max_time_ = 0;
         if(card.cardOK)
             last_file_index_ = card.getnrfilenames() - 1;
         else
@@ -424,29 +905,37 @@ void i3PlusPrinterImpl::sd_card(KeyValue key_value)
         }
     }
 
-    WriteRamDataRequest frame{Variable::FileName1};
+    sd_page_nb_files_ = nb_files;
+    send_sd_files();
+};
+
+//! Send the names of the visible files and show the SD card page.
+//! If the transmission queue is full, they are sent by task() later.
+void i3PlusPrinterImpl::send_sd_files()
+{
+    uint32_t start = micros();
 
-    Chars<> name;
+    WriteRamDataRequest frame{Variable::FileName1};
     for(uint8_t index = 0; index < NB_VISIBLE_FILES; ++index)
-    {
-        get_file_name(index, name);
-        frame << name;
-    }
+        frame.append(get_file_name(index), FILE_NAME_SIZE);
+    sd_files_pending_ = !frame.send();
+    if(sd_files_pending_)
+        return;
 
-    frame.send();
+    sd_page_time_ = micros() - start;
+    if(sd_page_time_ > sd_page_max_time_)
+        sd_page_max_time_ = sd_page_time_;
 
     show_page(Page::SdCard);
-};
+}
 
 //! Get a filename with a given index.
-//! @tparam S       Size of the buffer
 //! @param index    Index of the filename
-//! @param name     Copy the filename into this Chars
-template<size_t S>
-void i3PlusPrinterImpl::get_file_name(uint8_t index, Chars<S>& name)
+//! @return         The filename (valid until the next access to the SD card)
+const char* i3PlusPrinterImpl::get_file_name(uint8_t index)
 {
     card.getfilename(last_file_index_ - index);
-    name = card.longFilename;
+    return card.longFilename;
 };
 
 //! Select a filename as sent by the LCD screen.
@@ -460,10 +949,9 @@ void i3PlusPrinterImpl::sd_card_select_file(KeyValue key_value)
     if(file_index > last_file_index_)
         return;
     card.getfilename(last_file_index_ - file_index);
-    Chars<> name{card.longFilename};
 
     WriteRamDataRequest frame{Variable::SelectedFileName};
-    frame << name;
+    frame.append(card.longFilename, FILE_NAME_SIZE);
     frame.send();
 
     card.openFile(card.filename, true);
@@ -481,6 +969,7 @@ void i3PlusPrinterImpl::print_stop(KeyValue)
 
     card.stopSDPrint();
     clear_command_queue();
+    clear_scripts();
     quickstop_stepper();
     print_job_timer.stop();
     thermalManager.disable_all_heaters();
@@ -532,12 +1021,15 @@ void i3PlusPrinterImpl::preheat(KeyValue key_value)
     }
 
     ADVi3PP_LOG("Preheat Start");
+    read_requests_.read_ram(Variable::Preset1Bed, 6, &i3PlusPrinterImpl::preheat_response, key_value);
+}
 
-    ReadRamDataRequest frame{Variable::Preset1Bed, 6};
-    frame.send();
-
-    ReadRamDataResponse response;
-    if(!response.receive(frame))
+//! Presets read from the LCD: save them and preheat the nozzle.
+//! @param response     The response from the LCD (or nullptr)
+//! @param key_value    The index (starting from 1) of the preset to use
+void i3PlusPrinterImpl::preheat_response(IncomingFrame* response, KeyValue key_value)
+{
+    if(response == nullptr)
     {
         ADVi3PP_ERROR("Error while receiving Frame to read Presets");
         return;
@@ -546,12 +1038,12 @@ void i3PlusPrinterImpl::preheat(KeyValue key_value)
     Uint16 hotend, bed;
     for(auto& preset : presets_)
     {
-        response >> hotend >> bed;
+        *response >> hotend >> bed;
         preset.hotend = hotend.word;
         preset.bed = bed.word;
     }
 
-    enqueue_and_echo_commands_P(PSTR("M500"));
+    run_script(script_save_settings);
 
     auto presetIndex = static_cast<uint16_t>(key_value) - 1;
     if(presetIndex >= NB_PRESETS)
@@ -592,20 +1084,23 @@ void i3PlusPrinterImpl::motors_or_pid_settings(KeyValue key_value)
 }
 
 //! Save the Motors and PID settings.
-void i3PlusPrinterImpl::save_motors_or_pid_settings(KeyValue)
+void i3PlusPrinterImpl::save_motors_or_pid_settings(KeyValue key_value)
 {
-    ReadRamDataRequest frame{Variable::MotorSettingsX, 7};
-    frame.send();
+    read_requests_.read_ram(Variable::MotorSettingsX, 7, &i3PlusPrinterImpl::save_motors_or_pid_settings_response, key_value);
+}
 
-    ReadRamDataResponse response;
-    if(!response.receive(frame))
+//! Motors and PID settings read from the LCD: save them.
+//! @param response     The response from the LCD (or nullptr)
+void i3PlusPrinterImpl::save_motors_or_pid_settings_response(IncomingFrame* response, KeyValue)
+{
+    if(response == nullptr)
     {
         ADVi3PP_ERROR("Error while receiving Frame to read Motors Settings");
         return;
     }
 
     Uint16 x, y, z, e, p, i, d;
-    response >> x >> y >> z >> e >> p >> i >> d;
+    *response >> x >> y >> z >> e >> p >> i >> d;
 
     planner.axis_steps_per_mm[X_AXIS] = static_cast<float>(x.word) / 10;
     planner.axis_steps_per_mm[Y_AXIS] = static_cast<float>(y.word) / 10;
@@ -616,15 +1111,14 @@ void i3PlusPrinterImpl::save_motors_or_pid_settings(KeyValue)
     PID_PARAM(Ki, 0) = scalePID_i(static_cast<float>(i.word) / 10);
     PID_PARAM(Kd, 0) = scalePID_d(static_cast<float>(d.word) / 10);
 
-    enqueue_and_echo_commands_P(PSTR("M500"));
+    run_script(script_save_settings);
     show_page(Page::System);
 }
 
 //! Reset all settings of the printer to factory ones.
 void i3PlusPrinterImpl::factory_reset(KeyValue)
 {
-    enqueue_and_echo_commands_P(PSTR("M502"));
-    enqueue_and_echo_commands_P(PSTR("M500"));
+    run_script(script_factory_reset);
 }
 
 //! Display on the LCD screen the printing settings.
@@ -640,20 +1134,23 @@ void i3PlusPrinterImpl::print_settings(KeyValue)
 }
 
 //! Save the printing settings.
-void i3PlusPrinterImpl::save_print_settings(KeyValue)
+void i3PlusPrinterImpl::save_print_settings(KeyValue key_value)
 {
-    ReadRamDataRequest frame{Variable::PrintSettingsSpeed, 4};
-    frame.send();
+    read_requests_.read_ram(Variable::PrintSettingsSpeed, 4, &i3PlusPrinterImpl::save_print_settings_response, key_value);
+}
 
-    ReadRamDataResponse response;
-    if(!response.receive(frame))
+//! Printing settings read from the LCD: apply them.
+//! @param response     The response from the LCD (or nullptr)
+void i3PlusPrinterImpl::save_print_settings_response(IncomingFrame* response, KeyValue)
+{
+    if(response == nullptr)
     {
         ADVi3PP_ERROR("Error while receiving Frame to read Print Settings");
         return;
     }
 
     Uint16 speed, hotend, bed, fan;
-    response >> speed >> hotend >> bed >> fan;
+    *response >> speed >> hotend >> bed >> fan;
 
     feedrate_percentage = speed.word;
     thermalManager.setTargetHotend(hotend.word, 0);
@@ -669,7 +1166,8 @@ void i3PlusPrinterImpl::load_unload_back(KeyValue)
     ADVi3PP_LOG("Load/Unload Back");
     background_task_ = BackgroundTask::None;
     clear_command_queue();
-    enqueue_and_echo_commands_P(PSTR("G90")); // absolute mode
+    clear_scripts();
+    run_script(script_absolute_mode);
     thermalManager.setTargetHotend(0, 0);
     show_page(Page::Filament);
 }
@@ -684,38 +1182,29 @@ void i3PlusPrinterImpl::level(KeyValue key_value)
         case KeyValue::LevelStart:
             show_page(Page::LevelingStart);
             axis_homed[X_AXIS] = axis_homed[Y_AXIS] = axis_homed[Z_AXIS] = false;
-            enqueue_and_echo_commands_P(PSTR("G90")); // absolute mode
-            enqueue_and_echo_commands_P((PSTR("G28"))); // homing
+            run_script(script_level_start);
             next_op_time_ = millis() + 200;
             background_task_ = BackgroundTask::LevelInit;
             break;
 
         case KeyValue::LevelStep1:
-            enqueue_and_echo_commands_P((PSTR("G1 Z10 F2000")));
-            enqueue_and_echo_commands_P((PSTR("G1 X30 Y30 F6000")));
-            enqueue_and_echo_commands_P((PSTR("G1 Z0 F1000")));
+            run_script(script_level_step1);
             break;
 
         case KeyValue::LevelStep2:
-            enqueue_and_echo_commands_P((PSTR("G1 Z10 F2000")));
-            enqueue_and_echo_commands_P((PSTR("G1 X170 Y170 F6000")));
-            enqueue_and_echo_commands_P((PSTR("G1 Z0 F1000")));
+            run_script(script_level_step2);
             break;
 
         case KeyValue::LevelStep3:
-            enqueue_and_echo_commands_P((PSTR("G1 Z10 F2000")));
-            enqueue_and_echo_commands_P((PSTR("G1 X170 Y30 F6000")));
-            enqueue_and_echo_commands_P((PSTR("G1 Z0 F1000")));
+            run_script(script_level_step3);
             break;
 
         case KeyValue::LevelStep4:
-            enqueue_and_echo_commands_P((PSTR("G1 Z10 F2000")));
-            enqueue_and_echo_commands_P((PSTR("G1 X30 Y170 F6000")));
-            enqueue_and_echo_commands_P((PSTR("G1 Z0 F1000")));
+            run_script(script_level_step4);
             break;
 
         case KeyValue::LevelFinish:
-            enqueue_and_echo_commands_P((PSTR("G1 Z30 F2000")));
+            run_script(script_level_finish);
             show_page(Page::Tools);
             break;
     }
@@ -734,21 +1223,25 @@ void i3PlusPrinterImpl::filament(KeyValue key_value)
         return;
     }
 
-    ReadRamDataRequest frame{Variable::TargetTemperature, 1};
-    frame.send();
+    read_requests_.read_ram(Variable::TargetTemperature, 1, &i3PlusPrinterImpl::filament_response, key_value);
+}
 
-    ReadRamDataResponse response;
-    if(!response.receive(frame))
+//! Target temperature read from the LCD: start to load or unload the filament.
+//! @param response     The response from the LCD (or nullptr)
+//! @param key_value    Load or Unload
+void i3PlusPrinterImpl::filament_response(IncomingFrame* response, KeyValue key_value)
+{
+    if(response == nullptr)
     {
         ADVi3PP_ERROR("Error while receiving Frame to read Target Temperature");
         return;
     }
 
     Uint16 hotend;
-    response >> hotend;
+    *response >> hotend;
 
     thermalManager.setTargetHotend(hotend.word, 0);
-    enqueue_and_echo_commands_P(PSTR("G91")); // relative mode
+    run_script(script_relative_mode);
 
     next_op_time_ = millis() + 500;
 
@@ -760,79 +1253,51 @@ void i3PlusPrinterImpl::filament(KeyValue key_value)
 //! Move the nozzle.
 void i3PlusPrinterImpl::move_x_plus(KeyValue)
 {
-    clear_command_queue();
-    enqueue_and_echo_commands_P(PSTR("G91"));
-    enqueue_and_echo_commands_P(PSTR("G1 X5 F3000"));
-    enqueue_and_echo_commands_P(PSTR("G90"));
+    jog_.move(X_AXIS, true);
 }
 
 //! Move the nozzle.
 void i3PlusPrinterImpl::move_x_minus(KeyValue)
 {
-    clear_command_queue();
-    enqueue_and_echo_commands_P(PSTR("G91"));
-    enqueue_and_echo_commands_P(PSTR("G1 X-5 F3000"));
-    enqueue_and_echo_commands_P(PSTR("G90"));
+    jog_.move(X_AXIS, false);
 }
 
 //! Move the nozzle.
 void i3PlusPrinterImpl::move_y_plus(KeyValue)
 {
-    clear_command_queue();
-    enqueue_and_echo_commands_P(PSTR("G91"));
-    enqueue_and_echo_commands_P(PSTR("G1 Y5 F3000"));
-    enqueue_and_echo_commands_P(PSTR("G90"));
+    jog_.move(Y_AXIS, true);
 }
 
 //! Move the nozzle.
 void i3PlusPrinterImpl::move_y_minus(KeyValue)
 {
-    clear_command_queue();
-    enqueue_and_echo_commands_P(PSTR("G91"));
-    enqueue_and_echo_commands_P(PSTR("G1 Y-5 F3000"));
-    enqueue_and_echo_commands_P(PSTR("G90"));
+    jog_.move(Y_AXIS, false);
 }
 
 //! Move the nozzle.
 void i3PlusPrinterImpl::move_z_plus(KeyValue)
 {
-    clear_command_queue();
-    enqueue_and_echo_commands_P(PSTR("G91"));
-    enqueue_and_echo_commands_P(PSTR("G1 Z0.5 F3000"));
-    enqueue_and_echo_commands_P(PSTR("G90"));
+    jog_.move(Z_AXIS, true);
 }
 
 //! Move the nozzle.
 void i3PlusPrinterImpl::move_z_minus(KeyValue)
 {
-    clear_command_queue();
-    enqueue_and_echo_commands_P(PSTR("G91"));
-    enqueue_and_echo_commands_P(PSTR("G1 Z-0.5 F3000"));
-    enqueue_and_echo_commands_P(PSTR("G90"));
+    jog_.move(Z_AXIS, false);
 }
 
 //! Extrude some filament.
 void i3PlusPrinterImpl::move_e_plus(KeyValue)
 {
     if(thermalManager.degHotend(0) >= 180)
-    {
-        clear_command_queue();
-        enqueue_and_echo_commands_P(PSTR("G91"));
-        enqueue_and_echo_commands_P(PSTR("G1 E1 F120"));
-        enqueue_and_echo_commands_P(PSTR("G90"));
-    }
+        jog_.move(E_AXIS, true);
 }
 
 //! Unextrude.
 void i3PlusPrinterImpl::move_e_minus(KeyValue)
 {
     if(thermalManager.degHotend(0) >= 180)
-    {
-        clear_command_queue();
-        enqueue_and_echo_commands_P(PSTR("G91"));
-        enqueue_and_echo_commands_P(PSTR("G1 E-1 F120"));
-        enqueue_and_echo_commands_P(PSTR("G90"));
-    }
+        jog_.move(E_AXIS, false);
 }
 
 //! Disable the motors.
@@ -886,16 +1351,19 @@ void i3PlusPrinterImpl::pid_tuning(KeyValue key_value)
         return;
     };
 
-    ReadRamDataRequest frame{Variable::TargetTemperature, 1};
-    frame.send();
+    read_requests_.read_ram(Variable::TargetTemperature, 1, &i3PlusPrinterImpl::pid_tuning_response, key_value);
+}
 
-    ReadRamDataResponse response;
-    if(!response.receive(frame))
+//! Target temperature read from the LCD: start the PID tuning.
+//! @param response     The response from the LCD (or nullptr)
+void i3PlusPrinterImpl::pid_tuning_response(IncomingFrame* response, KeyValue)
+{
+    if(response == nullptr)
     {
         ADVi3PP_ERROR("Error while receiving Frame to read Target Temperature");
         return;
     }
-    Uint16 hotend; response >> hotend;
+    Uint16 hotend; *response >> hotend;
 
     enqueue_and_echo_command("M106 S255"); // Turn on fam
     Chars<> auto_pid_command; auto_pid_command << "M303 S" << hotend.word << "E0 C8 U1";
@@ -917,7 +1385,25 @@ void i3PlusPrinterImpl::temperature_graph(KeyValue key_value)
         return;
     }
 
-    last_page_ = get_current_page();
+    read_requests_.read_register(Register::PictureID, 2, &i3PlusPrinterImpl::temperature_graph_response, key_value);
+}
+
+//! Current page read from the LCD: remember it and show the temperatures.
+//! @param response     The response from the LCD (or nullptr)
+void i3PlusPrinterImpl::temperature_graph_response(IncomingFrame* response, KeyValue)
+{
+    if(response == nullptr)
+    {
+        ADVi3PP_ERROR("Error while receiving Frame to read PictureID");
+        last_page_ = Page::None;
+    }
+    else
+    {
+        Uint16 page; *response >> page;
+        ADVi3PP_LOG("Current page index = " << page.word);
+        last_page_ = static_cast<Page>(page.word);
+    }
+
     temp_graph_update_ = true;
     show_page(Page::Temperature);
 }
@@ -929,7 +1415,7 @@ void i3PlusPrinterImpl::print(KeyValue)
     if(!card.sdprinting)
     {
         WriteRamDataRequest frame{Variable::SelectedFileName};
-        frame << Chars<>{""};
+        frame.append("", FILE_NAME_SIZE);
         frame.send();
     }
 
@@ -944,31 +1430,13 @@ void i3PlusPrinterImpl::lcd_update_mode(KeyValue)
     while(true)
     {
         watchdog_reset();
-        if(Serial.available())
+        if(!TxQueue::empty())
+            TxQueue::task();
+        else if(Serial.available())
             Serial2.write(Serial.read());
     }
 }
 
-//! Get the current LCD firmware version.
-//! @return     The version as a string.
-Chars<16> i3PlusPrinterImpl::get_lcd_firmware_version()
-{
-    ReadRegisterDataRequest frame{Register::Version, 1};
-    frame.send();
-
-    ReadRegisterDataResponse response;
-    if(!response.receive(frame))
-    {
-        ADVi3PP_ERROR("Error while receiving Frame to read Version");
-        return Chars<16>("Unknown");
-    }
-
-    Uint8 version; response >> version;
-    Chars<16> lcd_version; lcd_version << (version.byte / 0x10) << "." << (version.byte % 0x10);
-    ADVi3PP_LOG("LCD Firmware raw version = " << version.byte);
-    return lcd_version;
-}
-
 //! Convert a version from its hexadecimal representation.
 //! @param hex_version  Hexadecimal representation of the version
 //! @return             Version as a string
@@ -979,13 +1447,31 @@ Chars<16> convert_version(uint16_t hex_version)
     return version;
 }
 
-//! Send the different versions to the LCD screen.
+//! Send the different versions to the LCD screen. The LCD firmware version is first read from the LCD.
 void i3PlusPrinterImpl::send_versions()
 {
+    read_requests_.read_register(Register::Version, 1, &i3PlusPrinterImpl::send_versions_response);
+}
+
+//! LCD firmware version read from the LCD: send the different versions to the LCD screen.
+//! @param response     The response from the LCD (or nullptr)
+void i3PlusPrinterImpl::send_versions_response(IncomingFrame* response, KeyValue)
+{
+    Chars<16> lcd_firmware_version{"Unknown"};
+    if(response == nullptr)
+    {
+        ADVi3PP_ERROR("Error while receiving Frame to read Version");
+    }
+    else
+    {
+        Uint8 version; *response >> version;
+        lcd_firmware_version = ""; lcd_firmware_version << (version.byte / 0x10) << "." << (version.byte % 0x10);
+        ADVi3PP_LOG("LCD Firmware raw version = " << version.byte);
+    }
+
     Chars<16> marlin_version{SHORT_BUILD_VERSION};
     Chars<16> motherboard_version = convert_version(advi3_pp_version);
     Chars<16> advi3pp_lcd_version = convert_version(adv_i3_pp_lcd_version_);
-    Chars<16> lcd_firmware_version = get_lcd_firmware_version();
 
     WriteRamDataRequest frame{Variable::MarlinVersion};
     frame << marlin_version << motherboard_version << advi3pp_lcd_version << lcd_firmware_version;
@@ -1034,13 +1520,10 @@ void i3PlusPrinterImpl::send_stats()
 #endif
 }
 
-//! Update the graphics (two channels: the bed and the hotend).
+//! Update the graphics (two channels: the bed and the hotend). Called while the printer is busy (auto PID).
 void i3PlusPrinterImpl::update_graph_data()
 {
-    WriteCurveDataRequest frame{0b00000011};
-    frame << Uint16{thermalManager.degBed()}
-          << Uint16{thermalManager.degHotend(0)};
-    frame.send();
+    graph_.task();
 }
 
 //! Display the Thermal Runaway Error screen.
@@ -1049,4 +1532,127 @@ void i3PlusPrinterImpl::temperature_error()
     show_page(advi3pp::Page::ThermalRunawayError);
 }
 
+//! Report statistics about the communication with the LCD.
+void i3PlusPrinterImpl::report_statistics()
+{
+    TxQueue::report_statistics();
+    status_.report_statistics();
+
+    SERIAL_ECHO_START();
+    SERIAL_ECHOLNPAIR("LCD baudrate:", baudrate_);
+
+    SERIAL_ECHO_START();
+    SERIAL_ECHOPAIR("LCD SD page files:", sd_page_nb_files_);
+    SERIAL_ECHOPAIR(" last (us):", sd_page_time_);
+    SERIAL_ECHOLNPAIR(" max (us):", sd_page_max_time_);
+}
+
+//! Measure the sustained throughput of the link with the LCD and the latency of a page change (show the current
+//! page again and read it back). This is blocking: actions sent by the LCD in the meantime are dropped.
+//! @param nb_frames    Number of Frames to send to measure the throughput
+void i3PlusPrinterImpl::benchmark_link(uint16_t nb_frames)
+{
+    static const uint8_t NB_ROUND_TRIPS = 10;
+    static const unsigned int ROUND_TRIP_TIMEOUT = 200; // ms
+    static const uint8_t STATUS_FRAME_SIZE = 6 + 2 * 6; // header, length, command, variable and 6 status variables
+    static const unsigned int TX_QUEUE_TIMEOUT = 500; // ms, more than the whole queue at the slowest baudrate
+
+    if(!wait_for_tx_queue(TX_QUEUE_TIMEOUT))
+    {
+        SERIAL_ERROR_START();
+        SERIAL_ERRORLNPGM("LCD link benchmark: the frames are not sent");
+        return;
+    }
+    Serial2.flush();
+
+    // Throughput: send the status variables (with their current values) again and again
+    uint32_t start = millis();
+    for(uint16_t index = 0; index < nb_frames; ++index)
+    {
+        status_.invalidate();
+        status_.send();
+        if(!wait_for_tx_queue(TX_QUEUE_TIMEOUT))
+        {
+            SERIAL_ERROR_START();
+            SERIAL_ERRORLNPGM("LCD link benchmark: the frames are not sent");
+            return;
+        }
+    }
+    Serial2.flush();
+    uint32_t duration = millis() - start;
+    uint32_t nb_bytes = static_cast<uint32_t>(nb_frames) * STATUS_FRAME_SIZE;
+
+    SERIAL_ECHO_START();
+    SERIAL_ECHOPAIR("LCD link baudrate:", baudrate_);
+    SERIAL_ECHOPAIR(" frames:", nb_frames);
+    SERIAL_ECHOPAIR(" bytes:", nb_bytes);
+    SERIAL_ECHOPAIR(" time (ms):", duration);
+    SERIAL_ECHOLNPAIR(" bytes/s:", duration > 0 ? nb_bytes * 1000 / duration : 0);
+
+    // Latency: show_page followed by a read of the current page
+    Page page = Page::None;
+    uint32_t min_time = 0xFFFFFFFF, max_time = 0, total_time = 0;
+    uint8_t nb_round_trips = 0, nb_failures = 0;
+    for(uint8_t index = 0; index <= NB_ROUND_TRIPS; ++index)
+    {
+        if(index > 0 && page == Page::None) // The current page is unknown
+            break;
+
+        start = micros();
+        if(index > 0) // The first round trip only reads the current page
+            show_page(page);
+        ReadRegisterDataRequest frame{Register::PictureID, 2};
+        frame.send();
+        if(!wait_for_response(Command::ReadRegisterData, static_cast<uint8_t>(Register::PictureID), 2, ROUND_TRIP_TIMEOUT))
+        {
+            ++nb_failures;
+            continue;
+        }
+        uint32_t round_trip_time = micros() - start;
+
+        Uint16 value; incoming_frame_ >> value;
+        incoming_frame_.reset();
+        page = static_cast<Page>(value.word);
+        if(index == 0)
+            continue;
+
+        ++nb_round_trips;
+        total_time += round_trip_time;
+        NOMORE(min_time, round_trip_time);
+        NOLESS(max_time, round_trip_time);
+    }
+
+    SERIAL_ECHO_START();
+    SERIAL_ECHOPAIR("LCD show/get page round trips:", nb_round_trips);
+    SERIAL_ECHOPAIR(" failures:", nb_failures);
+    if(nb_round_trips > 0)
+    {
+        SERIAL_ECHOPAIR(" min (us):", min_time);
+        SERIAL_ECHOPAIR(" avg (us):", total_time / nb_round_trips);
+        SERIAL_ECHOPAIR(" max (us):", max_time);
+    }
+    SERIAL_EOL();
+}
+
+//! Report the execution time of the handlers of the LCD actions that were called at least once.
+//! @param reset    Reset the timings after reporting them
+void i3PlusPrinterImpl::report_action_timings(bool reset)
+{
+    for(uint8_t index = 0; index < NB_ACTIONS; ++index)
+    {
+        const ActionTiming& timing = action_timings_[index];
+        if(timing.nb_calls == 0)
+            continue;
+
+        SERIAL_ECHO_START();
+        SERIAL_ECHOPAIR("LCD action:", pgm_read_word(&action_handlers_[index].action));
+        SERIAL_ECHOPAIR(" calls:", timing.nb_calls);
+        SERIAL_ECHOPAIR(" avg (us):", timing.total_time / timing.nb_calls);
+        SERIAL_ECHOLNPAIR(" max (us):", timing.max_time);
+    }
+
+    if(reset)
+        memset(action_timings_, 0, sizeof(action_timings_));
+}
+
 }
@@ -78,6 +78,9 @@ struct i3PlusPrinter
     static void restore_presets(eeprom_read read, int& eeprom_index, uint16_t& working_crc);
     static void reset_presets();
     static void temperature_error();
+    static void report_statistics();
+    static void report_action_timings(bool reset);
+    static void benchmark_link(uint16_t nb_frames);
 };
 
 }
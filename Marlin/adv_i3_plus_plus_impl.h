@@ -49,6 +49,141 @@ struct Preset
     uint16_t bed;
 };
 
+// --------------------------------------------------------------------
+// ReadRequests
+// --------------------------------------------------------------------
+
+class i3PlusPrinterImpl;
+
+//! Function called when an asynchronous read request is completed.
+//! The response is nullptr if the request failed (timeout).
+using ReadResponseHandler = void (i3PlusPrinterImpl::*)(IncomingFrame* response, KeyValue key_value);
+
+//! Asynchronous read requests (registers or RAM) sent to the LCD.
+//! Requests are queued and only one is in flight at a time. They are retried when the LCD does not answer in time.
+class ReadRequests
+{
+public:
+    explicit ReadRequests(i3PlusPrinterImpl& printer): printer_(printer) {}
+
+    bool read_register(Register reg, uint8_t nb_bytes, ReadResponseHandler handler, KeyValue key_value = KeyValue::Show);
+    bool read_ram(Variable var, uint8_t nb_words, ReadResponseHandler handler, KeyValue key_value = KeyValue::Show);
+    bool handle_response(IncomingFrame& frame);
+    void task();
+
+private:
+    //! A pending read request.
+    struct Request
+    {
+        Command command;                //!< ReadRegisterData or ReadRamData
+        uint16_t address;               //!< Register or Variable to read
+        uint8_t nb;                     //!< Number of bytes (registers) or words (RAM) to read
+        ReadResponseHandler handler;    //!< Function to call when the request is completed
+        KeyValue key_value;             //!< Key value of the action at the origin of the request
+    };
+
+    bool push(Command command, uint16_t address, uint8_t nb, ReadResponseHandler handler, KeyValue key_value);
+    void send_first();
+    void complete(IncomingFrame* response);
+
+private:
+    static const size_t NB_REQUESTS = 4;
+    static const uint8_t MAX_RETRIES = 2;
+    static const unsigned int TIMEOUT = 200; // ms
+
+    i3PlusPrinterImpl& printer_;
+    Request requests_[NB_REQUESTS];
+    uint8_t first_ = 0;
+    uint8_t nb_requests_ = 0;
+    uint8_t retries_ = 0;
+    bool in_flight_ = false;
+    millis_t timeout_time_ = 0;
+};
+
+// --------------------------------------------------------------------
+// StatusVariables
+// --------------------------------------------------------------------
+
+//! Shadow copy of the status variables of the LCD (from TargetBed to FilePercentDone).
+//! Only the variables that changed since the last update are sent, adjacent ones in the same Frame.
+class StatusVariables
+{
+public:
+    void set(Variable var, uint16_t value);
+    void send();
+    void invalidate();
+    void report_statistics();
+
+private:
+    static const uint8_t NB_VARIABLES = 6;
+    static const uint8_t MAX_CLEAN_GAP = 2; // Sending 2 unchanged words (4 bytes) is cheaper than a new Frame (6 bytes)
+    static const uint8_t FULL_UPDATE_PERIOD = 20; // Send everything from time to time in case the LCD was reset
+    static const uint8_t FRAME_OVERHEAD = 6; // header (2), length (1), command (1), variable (2)
+    static const uint8_t ALL_DIRTY = (1 << NB_VARIABLES) - 1;
+
+    uint16_t values_[NB_VARIABLES] = {};
+    uint8_t dirty_ = ALL_DIRTY; // One bit per variable
+    uint8_t nb_updates_ = 0;
+    uint32_t nb_frames_ = 0;
+    uint32_t bytes_sent_ = 0;
+    uint32_t bytes_saved_ = 0;
+};
+
+// --------------------------------------------------------------------
+// TemperatureGraph
+// --------------------------------------------------------------------
+
+//! Temperatures of the bed and of the hotend for the graphs of the LCD.
+//! The temperatures are read at a fixed rate, averaged into samples (points of the graphs) and several samples
+//! are sent in each Frame.
+class TemperatureGraph
+{
+public:
+    void task();
+
+private:
+    void send();
+
+private:
+    static const unsigned int READING_PERIOD = 125; // ms
+    static const uint8_t NB_READINGS = 4;           // Readings averaged into a sample, i.e. a sample every 500 ms
+    static const uint8_t NB_SAMPLES = 4;            // Samples sent in each Frame
+
+    //! A point of the graphs
+    struct Sample
+    {
+        uint16_t bed;
+        uint16_t hotend;
+    };
+
+    Sample samples_[NB_SAMPLES];
+    float bed_sum_ = 0;
+    float hotend_sum_ = 0;
+    uint8_t nb_readings_ = 0;
+    uint8_t nb_samples_ = 0;
+    millis_t next_reading_time_ = 0;
+};
+
+// --------------------------------------------------------------------
+// Jog
+// --------------------------------------------------------------------
+
+//! Manual moves of the axes sent directly to the planner (no G-code).
+//! When the LCD repeats a move (button held), the moves are chained by the planner and the axis moves continuously.
+class Jog
+{
+public:
+    bool move(AxisEnum axis, bool positive);
+
+private:
+    //! Do not queue more jog moves than this so the axis stops soon after the button is released.
+    static const uint8_t MAX_PLANNED_MOVES = 2;
+    static const float STEPS[NUM_AXIS];      // mm
+    static const float FEEDRATES[NUM_AXIS];  // mm/s
+
+    uint8_t head_ = 0; //!< Head of the planner after the last jog move
+};
+
 // --------------------------------------------------------------------
 // i3PlusPrinterImpl
 // --------------------------------------------------------------------
@@ -66,21 +201,28 @@ public:
     void restore_presets(eeprom_read read, int& eeprom_index, uint16_t& working_crc);
     void reset_presets();
     void temperature_error();
+    void report_statistics();
+    void report_action_timings(bool reset);
+    void benchmark_link(uint16_t nb_frames);
 
 private:
+    void probe_baudrate();
+    bool wait_for_response(Command command, uint16_t address, uint8_t nb, unsigned int timeout);
+    bool wait_for_tx_queue(unsigned int timeout);
     void send_versions();
     void execute_background_task();
     void leveling_init();
     void unload_filament();
     void load_filament();
     void send_status_update();
-    Page get_current_page();
     void read_lcd_serial();
+    void dispatch_action(Action action, KeyValue key_value);
     void send_stats();
-    template<size_t S> void get_file_name(uint8_t index, Chars<S>& name);
-    Chars<16> get_lcd_firmware_version();
+    const char* get_file_name(uint8_t index);
+    void send_sd_files();
     void set_next_background_task_time(unsigned int delta = 500);
     void set_next_update_time(unsigned int delta = 500);
+    void send_graph_update();
 
 private: // Actions
     void sd_card(KeyValue key_value);
@@ -118,17 +260,60 @@ private: // Actions
     void about(KeyValue key_value);
     void lcd_update_mode(KeyValue key_value);
 
+private: // Responses
+    void send_versions_response(IncomingFrame* response, KeyValue key_value);
+    void preheat_response(IncomingFrame* response, KeyValue key_value);
+    void save_motors_or_pid_settings_response(IncomingFrame* response, KeyValue key_value);
+    void save_print_settings_response(IncomingFrame* response, KeyValue key_value);
+    void filament_response(IncomingFrame* response, KeyValue key_value);
+    void pid_tuning_response(IncomingFrame* response, KeyValue key_value);
+    void temperature_graph_response(IncomingFrame* response, KeyValue key_value);
+
 private:
+    using ActionHandlerFunction = void (i3PlusPrinterImpl::*)(KeyValue key_value);
+
+    //! Entry of the table of the handlers of the actions sent by the LCD (in PROGMEM).
+    struct ActionHandler
+    {
+        Action action;
+        ActionHandlerFunction handler;
+    };
+
+    //! Execution time of the handler of an action.
+    struct ActionTiming
+    {
+        uint32_t total_time;    //!< Sum of the execution times (us), of the first nb_calls executions
+        uint16_t max_time;      //!< Worst execution time (us, saturated)
+        uint16_t nb_calls;      //!< Number of executions (saturated, then total_time is not updated anymore)
+    };
+
+    static const uint8_t NB_ACTIONS = 34;
+    static const ActionHandler action_handlers_[NB_ACTIONS];
+
     static const size_t NB_PRESETS = 3;
+    static const uint8_t FILE_NAME_SIZE = 26; //!< Size of the file name variables on the LCD
+    static const uint16_t NB_VISIBLE_FILES = 5; //!< Number of files on the SD card page of the LCD
 
     uint16_t last_file_index_ = 0;
+    uint16_t sd_page_nb_files_ = 0;     //!< Number of files when the last page was displayed
+    uint32_t sd_page_time_ = 0;         //!< Time to get the names of the last page of files (us)
+    uint32_t sd_page_max_time_ = 0;     //!< Worst time to get the names of a page of files (us)
     millis_t next_op_time_ = 0;
     millis_t next_update_time_ = 0;
     BackgroundTask background_task_ = BackgroundTask::None;
     bool temp_graph_update_ = false;
     Page last_page_ = Page::None;
+    Page pending_page_ = Page::None;    //!< Page not shown because the transmission queue was full
+    bool sd_files_pending_ = false;     //!< Names of files not sent because the transmission queue was full
     Preset presets_[NB_PRESETS];
     uint16_t adv_i3_pp_lcd_version_ = 0x0000;
+    StatusVariables status_;
+    TemperatureGraph graph_;
+    Jog jog_;
+    IncomingFrame incoming_frame_;
+    ReadRequests read_requests_{*this};
+    uint32_t baudrate_ = 0;
+    ActionTiming action_timings_[NB_ACTIONS] = {};
 };
 
 }}
@@ -57,35 +57,156 @@ void Dump(const uint8_t* bytes, size_t size)
 #endif
 
 // --------------------------------------------------------------------
-// Frame
+// TxQueue
 // --------------------------------------------------------------------
 
-//! Construct an input, empty, Frame.
-Frame::Frame()
-: position_{0}
+uint8_t TxQueue::buffer_[TxQueue::SIZE];
+uint8_t TxQueue::head_ = 0;
+uint8_t TxQueue::tail_ = 0;
+uint16_t TxQueue::count_ = 0;
+uint8_t TxQueue::frame_head_ = 0;
+uint16_t TxQueue::frame_length_ = 0;
+bool TxQueue::writing_ = false;
+bool TxQueue::overflow_ = false;
+uint16_t TxQueue::high_water_mark_ = 0;
+uint32_t TxQueue::nb_frames_ = 0;
+uint32_t TxQueue::nb_bytes_ = 0;
+uint32_t TxQueue::nb_dropped_frames_ = 0;
+
+//! Start to write a Frame into the queue.
+//! @return         False if another Frame is already being written
+bool TxQueue::begin_frame()
+{
+    if(writing_)
+    {
+        ADVi3PP_ERROR("A Frame is already being written into the transmission queue");
+        return false;
+    }
+
+    writing_ = true;
+    overflow_ = false;
+    frame_head_ = head_;
+    frame_length_ = 0;
+    return true;
+}
+
+//! Append a byte to the Frame being written.
+//! @param byte     The byte to append
+void TxQueue::write(uint8_t byte)
+{
+    if(count_ + frame_length_ >= SIZE)
+    {
+        overflow_ = true;
+        return;
+    }
+
+    buffer_[frame_head_++] = byte;
+    ++frame_length_;
+}
+
+//! Overwrite a byte of the Frame being written.
+//! @param offset   The offset of the byte, from the beginning of the Frame
+//! @param byte     The new value of the byte
+void TxQueue::write_at(uint8_t offset, uint8_t byte)
+{
+    if(offset < frame_length_)
+        buffer_[static_cast<uint8_t>(head_ + offset)] = byte;
+}
+
+//! Commit the Frame being written so it can be sent to the LCD.
+//! @return         False if the Frame was dropped because there was not enough room in the queue
+bool TxQueue::commit_frame()
 {
+    writing_ = false;
+    if(overflow_)
+    {
+        ++nb_dropped_frames_;
+        return false;
+    }
+
+    head_ = frame_head_;
+    count_ += frame_length_;
+
+    if(count_ > high_water_mark_)
+        high_water_mark_ = count_;
+    ++nb_frames_;
+    nb_bytes_ += frame_length_;
+
+    task();
+    return true;
+}
+
+//! Abort the Frame being written. Its bytes are discarded.
+void TxQueue::abort_frame()
+{
+    writing_ = false;
+}
+
+//! Transfer queued bytes to the serial port, without blocking (i.e. as long as there is room in its buffer).
+void TxQueue::task()
+{
+    auto room = Serial2.availableForWrite();
+    while(count_ > 0 && room-- > 0)
+    {
+        Serial2.write(buffer_[tail_++]);
+        --count_;
+    }
 }
 
+//! Report the statistics of the queue.
+void TxQueue::report_statistics()
+{
+    SERIAL_ECHO_START();
+    SERIAL_ECHOPAIR("LCD TX frames:", nb_frames_);
+    SERIAL_ECHOPAIR(" bytes:", nb_bytes_);
+    SERIAL_ECHOPAIR(" dropped frames:", nb_dropped_frames_);
+    SERIAL_ECHOPAIR(" queued:", count_);
+    SERIAL_ECHOPAIR(" high-water mark:", high_water_mark_);
+    SERIAL_ECHOLNPAIR(" / ", SIZE);
+}
+
+// --------------------------------------------------------------------
+// OutgoingFrame
+// --------------------------------------------------------------------
+
 //! Construct an output Frame.
 //! @param command  The command to be set into this Frame
-Frame::Frame(Command command)
+OutgoingFrame::OutgoingFrame(Command command)
+{
+    begin(command);
+}
+
+//! Destruct an output Frame. If it was not sent, it is discarded.
+OutgoingFrame::~OutgoingFrame()
 {
-    buffer_[Position::Header0] = HEADER_BYTE_0;
-    buffer_[Position::Header1] = HEADER_BYTE_1;
-    buffer_[Position::Length] = 1;
-    buffer_[Position::Command] = static_cast<uint8_t>(command);
-    position_ = Position::Data;
+    if(writing_)
+        TxQueue::abort_frame();
+}
+
+//! Start to write this Frame into the transmission queue.
+//! @param command      The command to be set into this Frame
+void OutgoingFrame::begin(Command command)
+{
+    writing_ = TxQueue::begin_frame();
+    length_ = 0;
+    if(!writing_)
+        return;
+
+    TxQueue::write(HEADER_BYTE_0);
+    TxQueue::write(HEADER_BYTE_1);
+    TxQueue::write(0); // Length, set when the Frame is sent
+    *this << Uint8(static_cast<uint8_t>(command));
 }
 
 //! Append a byte to this Frame.
 //! @param data     Byte to be appended
 //! @return         Itself
-Frame& Frame::operator<<(const Uint8 &data)
+OutgoingFrame& OutgoingFrame::operator<<(const Uint8 &data)
 {
-    if(position_ < FRAME_BUFFER_SIZE)
+    if(writing_ && length_ < 0xFF)
     {
-        buffer_[position_++] = data.byte;
-        buffer_[Position::Length] += 1;
+        TxQueue::write(data.byte);
+        length_ += 1;
     }
     else
         ADVi3PP_ERROR("Data truncated");
@@ -95,23 +216,32 @@ Frame& Frame::operator<<(const Uint8 &data)
 //! Append a word to this Frame.
 //! @param data     Word to be appended
 //! @return         Itself
-Frame& Frame::operator<<(const Uint16 &data)
+OutgoingFrame& OutgoingFrame::operator<<(const Uint16 &data)
 {
-    if(position_ < FRAME_BUFFER_SIZE - 1)
+    *this << Uint8(highByte(data.word)) << Uint8(lowByte(data.word));
+    return *this;
+}
+
+//! Append a string of characters with a fixed size (including the terminating 0 byte), like a Chars.
+//! It is truncated or padded with 0s.
+//! @param chars    String of characters to be appended
+//! @param size     Number of bytes to append
+//! @return         Itself
+OutgoingFrame& OutgoingFrame::append(const char* chars, uint8_t size)
+{
+    bool end_of_string = false;
+    for(uint8_t index = 0; index < size; ++index)
     {
-        buffer_[position_++] = highByte(data.word);
-        buffer_[position_++] = lowByte(data.word);
-        buffer_[Position::Length] += 2;
+        end_of_string = end_of_string || index == size - 1 || chars[index] == 0;
+        *this << Uint8(end_of_string ? 0 : static_cast<uint8_t>(chars[index]));
     }
-    else
-        ADVi3PP_ERROR("Data truncated");
     return *this;
 }
 
 //! Append a Register to this Frame.
 //! @param reg      Register to be appended
 //! @return         Itself
-Frame& Frame::operator<<(Register reg)
+OutgoingFrame& OutgoingFrame::operator<<(Register reg)
 {
     *this << Uint8(reg);
     return *this;
@@ -120,7 +250,7 @@ Frame& Frame::operator<<(Register reg)
 //! Append a Page to this Frame.
 //! @param page     Page to be appended
 //! @return         Itself
-Frame& Frame::operator<<(Page page)
+OutgoingFrame& OutgoingFrame::operator<<(Page page)
 {
     *this << Uint8(page);
     return *this;
@@ -129,52 +259,53 @@ Frame& Frame::operator<<(Page page)
 //! Append a Variable to this Frame.
 //! @param var      Variable to be appended
 //! @return         Itself
-Frame& Frame::operator<<(Variable var)
+OutgoingFrame& OutgoingFrame::operator<<(Variable var)
 {
     *this << Uint16(var);
     return *this;
 }
 
-//! Send tis Frame to the LCD display.
-void Frame::send()
+//! Send this Frame to the LCD display. The Frame is queued and the function returns immediately.
+//! @return         False if the Frame was dropped because the transmission queue is full
+bool OutgoingFrame::send()
 {
-    //ADVi3PP_LOG("Send a Frame of " << get_length() << " bytes, with command = " << static_cast<uint8_t>(get_command()));
-    //ADVi3PP_DUMP(buffer_, get_length() + 3);
-    Serial2.write(buffer_, 3 + buffer_[Position::Length]); // Header, length and data
-}
+    if(!writing_)
+        return false;
 
-//! Reset this Frame as an input Frame
-void Frame::reset()
-{
-    position_ = 0;
+    TxQueue::write_at(Position::Length, length_);
+    writing_ = false;
+    if(!TxQueue::commit_frame())
+    {
+        ADVi3PP_ERROR("LCD transmission queue full, Frame dropped");
+        return false;
+    }
+    return true;
 }
 
-//! Reset this Frame as an output Frame.
+//! Reset this Frame as a new output Frame. If the previous one was not sent, it is discarded.
 //! @param command      The command to be set into this Frame
-void Frame::reset(Command command)
+void OutgoingFrame::reset(Command command)
 {
-    buffer_[Position::Header0] = HEADER_BYTE_0;
-    buffer_[Position::Header1] = HEADER_BYTE_1;
-    buffer_[Position::Length] = 1;
-    buffer_[Position::Command] = static_cast<uint8_t>(command);
-    position_ = Position::Data;
+    if(writing_)
+        TxQueue::abort_frame();
+    begin(command);
 }
 
-//! Wait for the given amount of bytes from the LCD display.
-//! @param length       Number of bvtes to be available before returning
-void Frame::wait_for_data(uint8_t length)
-{
-    while (Serial2.available() < length)
-        delay(50);
-}
+// --------------------------------------------------------------------
+// IncomingFrame
+// --------------------------------------------------------------------
 
-bool Frame::available(uint8_t bytes)
+//! Reset this Frame so a new Frame can be received.
+void IncomingFrame::reset()
 {
-    return Serial2.available() >= bytes;
+    position_ = 0;
 }
 
-//! Receive data from the LCD display.
-bool Frame::receive()
+//! Receive, without blocking, the data available from the LCD display.
+//! The Frame is accumulated across calls. Once a complete Frame is received, reset() has to be called before
+//! receiving the next one.
+//! @return             True if a complete Frame is received
+bool IncomingFrame::receive()
 {
     // Format of the frame:
     // header | length | command | data
@@ -182,55 +313,96 @@ bool Frame::receive()
     //      2 |      1 |       1 |    N  bytes
     //  5A A5 |     06 |      83 |  ...
 
-    wait_for_data(3);
-
-    if(Serial2.read() != HEADER_BYTE_0 || Serial2.read() != HEADER_BYTE_1)
+    while(Serial2.available() > 0)
     {
-        ADVi3PP_ERROR("Invalid header when receiving a Frame");
-        return false;
+        auto byte = static_cast<uint8_t>(Serial2.read());
+        switch(position_)
+        {
+            case Position::Header0:
+                if(byte != HEADER_BYTE_0)
+                    continue; // Skip garbage until the beginning of a Frame
+                break;
+
+            case Position::Header1:
+                if(byte != HEADER_BYTE_1)
+                {
+                    ADVi3PP_ERROR("Invalid header when receiving a Frame");
+                    position_ = Position::Header0;
+                    continue;
+                }
+                break;
+
+            case Position::Length:
+                if(byte == 0 || byte > FRAME_BUFFER_SIZE - 3)
+                {
+                    ADVi3PP_ERROR("Data to be received is too big for the Frame buffer so skip it");
+                    position_ = Position::Header0;
+                    continue;
+                }
+                break;
+
+            default:
+                break;
+        }
+
+        buffer_[position_++] = byte;
+        if(position_ > Position::Length && position_ == 3 + buffer_[Position::Length])
+        {
+            ADVi3PP_LOG("Receive a Frame of " << get_length() << " bytes.");
+            ADVi3PP_DUMP(buffer_, position_);
+            position_ = Position::Command;
+            return true;
+        }
     }
 
-    auto length = static_cast<uint8_t>(Serial2.read());
+    return false;
+}
 
-    buffer_[0] = HEADER_BYTE_0;
-    buffer_[1] = HEADER_BYTE_1;
+//! Check if this (received) Frame is the response to a read request. If it is the case, skip the header of the
+//! response so the data can be extracted.
+//! @param command      The command of the request (ReadRegisterData or ReadRamData)
+//! @param address      The register or the variable of the request
+//! @param nb           The number of bytes (registers) or words (RAM) requested
+//! @return             True if this Frame is the response to the request
+bool IncomingFrame::match_response(Command command, uint16_t address, uint8_t nb)
+{
+    // Format of the responses:
+    // header | length | command | register | nb bytes | data
+    // header | length | command | variable | nb words | data
 
-    if(length >= FRAME_BUFFER_SIZE - 3)
-    {
-        ADVi3PP_ERROR("Data to be received is too big for the Frame buffer so skip it");
+    if(get_command() != command)
         return false;
-    }
 
-    buffer_[2] = length;
-    auto read = Serial2.readBytes(buffer_ + 3, length);
-    if(read != length)
+    if(command == Command::ReadRegisterData)
     {
-        ADVi3PP_ERROR("Invalid amount of bytes received");
-        return 0;
+        if(get_length() < 3 || buffer_[Position::Register] != address || buffer_[Position::NbBytes] != nb)
+            return false;
+        position_ = Position::NbBytes + 1;
+        return true;
     }
 
-    ADVi3PP_LOG("Receive a Frame of " << length << " bytes.");
-    ADVi3PP_DUMP(buffer_, length + 3);
-
-    position_ = Position::Command;
+    if(get_length() < 4 || buffer_[Position::Variable] != highByte(address) ||
+       buffer_[Position::Variable + 1] != lowByte(address) || buffer_[Position::NbWords] != nb)
+        return false;
+    position_ = Position::NbWords + 1;
     return true;
 }
 
 //! Get the Command set inside this Frame.
-Command Frame::get_command() const
+Command IncomingFrame::get_command() const
 {
     return static_cast<Command>(buffer_[Position::Command]);
 }
 
 //! Return the length of the data portion (including the Command).
-size_t Frame::get_length() const
+size_t IncomingFrame::get_length() const
 {
     return static_cast<size_t>(buffer_[Position::Length]);
 }
 
 #ifdef UNIT_TEST
 //! Return the raw data. This is used by unit testing.
-const uint8_t* Frame::get_data() const
+const uint8_t* IncomingFrame::get_data() const
 {
     return buffer_;
 }
@@ -239,7 +411,7 @@ const uint8_t* Frame::get_data() const
 //! Extract the next byte from this input Frame.
 //! @param data     Next byte extracted from this Frame
 //! @return         Itself
-Frame& Frame::operator>>(Uint8& data)
+IncomingFrame& IncomingFrame::operator>>(Uint8& data)
 {
     if(position_ >= 3 + get_length())
     {
@@ -254,7 +426,7 @@ Frame& Frame::operator>>(Uint8& data)
 //! Extract the next word from this input Frame.
 //! @param data     Next word extracted from this Frame
 //! @return         Itself
-Frame& Frame::operator>>(Uint16& data)
+IncomingFrame& IncomingFrame::operator>>(Uint16& data)
 {
     if(position_ >= 3 + get_length() - 1)
     {
@@ -271,7 +443,7 @@ Frame& Frame::operator>>(Uint16& data)
 //! Extract the Action from this input Frame.
 //! @param action   Action extracted from this Frame
 //! @return         Itself
-Frame& Frame::operator>>(Action& action)
+IncomingFrame& IncomingFrame::operator>>(Action& action)
 {
     Uint16 value;
     *this >> value;
@@ -279,7 +451,7 @@ Frame& Frame::operator>>(Action& action)
     return *this;
 }
 
-Frame& Frame::operator>>(Command& command)
+IncomingFrame& IncomingFrame::operator>>(Command& command)
 {
     Uint8 value;
     *this >> value;
@@ -287,7 +459,7 @@ Frame& Frame::operator>>(Command& command)
     return *this;
 }
 
-Frame& Frame::operator>>(Register& reg)
+IncomingFrame& IncomingFrame::operator>>(Register& reg)
 {
     Uint8 value;
     *this >> value;
@@ -295,7 +467,7 @@ Frame& Frame::operator>>(Register& reg)
     return *this;
 }
 
-Frame& Frame::operator>>(Variable& var)
+IncomingFrame& IncomingFrame::operator>>(Variable& var)
 {
     Uint16 value;
     *this >> value;
@@ -304,125 +476,37 @@ Frame& Frame::operator>>(Variable& var)
 }
 
 WriteRegisterDataRequest::WriteRegisterDataRequest(Register reg)
-: Frame(Command::WriteRegisterData)
+: OutgoingFrame{Command::WriteRegisterData}
 {
     *this << reg;
 }
 
 ReadRegisterDataRequest::ReadRegisterDataRequest(Register reg, uint8_t nb_bytes)
-: Frame{Command::ReadRegisterData}
+: OutgoingFrame{Command::ReadRegisterData}
 {
     *this << reg << Uint8{nb_bytes};
 }
 
-Register ReadRegisterDataRequest::get_register() const
-{
-    return static_cast<Register>(buffer_[Position::Register]);
-}
-
-uint8_t ReadRegisterDataRequest::get_nb_bytes() const
-{
-    return buffer_[Position::NbBytes];
-}
-
-bool ReadRegisterDataResponse::receive(Register reg, uint8_t nb_bytes)
-{
-    if(!Frame::receive())
-        return false;
-
-    Command command; Register frame_reg; Uint8 frame_nb_bytes;
-    *this >> command >> frame_reg >> frame_nb_bytes;
-    if(command != Command::ReadRegisterData)
-    {
-        ADVi3PP_ERROR("Command in response (" << command << ") does not correspond to request (" << Command::ReadRegisterData << ")");
-        return false;
-    }
-    if(frame_reg != reg)
-    {
-        ADVi3PP_ERROR("Register in response (" << frame_reg << ") does not correspond to request (" << reg << ")");
-        return false;
-    }
-    if(frame_nb_bytes.byte != nb_bytes)
-    {
-        ADVi3PP_ERROR("Data length in response (" << frame_nb_bytes.byte << ") does not correspond to request (" << nb_bytes << ")");
-        return false;
-    }
-
-    return true;
-}
-
-bool ReadRegisterDataResponse::receive(const ReadRegisterDataRequest& request)
-{
-    return receive(request.get_register(), request.get_nb_bytes());
-}
-
 WriteRamDataRequest::WriteRamDataRequest(Variable var)
-: Frame{Command::WriteRamData}
+: OutgoingFrame{Command::WriteRamData}
 {
     *this << var;
 }
 
 void WriteRamDataRequest::reset(Variable var)
 {
-    Frame::reset(get_command());
+    OutgoingFrame::reset(Command::WriteRamData);
     *this << var;
 }
 
 ReadRamDataRequest::ReadRamDataRequest(Variable var, uint8_t nb_words)
-: Frame{Command::ReadRamData}
+: OutgoingFrame{Command::ReadRamData}
 {
     *this << var << Uint8{nb_words};
 }
 
-Variable ReadRamDataRequest::get_variable() const
-{
-    return static_cast<Variable>(buffer_[Position::Variable] * 256 + buffer_[Position::Variable + 1]);
-}
-
-uint8_t ReadRamDataRequest::get_nb_words() const
-{
-    return buffer_[Position::NbWords];
-}
-
-
-bool ReadRamDataResponse::receive(Variable var, uint8_t nb_words)
-{
-    // Format of the frame:
-    // header | length | command | variable | nb words | value
-    // -------|--------|---------|----------|----------|------
-    //      2 |      1 |       1 |        2 |        1 |     2   bytes
-    //  5A A5 |     06 |      83 |     0460 |       01 | 01 50
-
-    if(!Frame::receive())
-        return false;
-    Command command; Variable frame_var; Uint8 frame_nb_words;
-    *this >> command >> frame_var >> frame_nb_words;
-    if(command != Command::ReadRamData)
-    {
-        ADVi3PP_ERROR("Command in response (" << command << ") does not correspond to request (" << Command::ReadRamData << ")");
-        return false;
-    }
-    if(frame_var != var)
-    {
-        ADVi3PP_ERROR("Register in response (" << frame_var << ") does not correspond to request (" << var << ")");
-        return false;
-    }
-    if(frame_nb_words.byte != nb_words)
-    {
-        ADVi3PP_ERROR("Data length in response (" << frame_nb_words.byte << ") does not correspond to request (" << nb_words << ")");
-        return false;
-    }
-
-    return true;
-}
-
-bool ReadRamDataResponse::receive(const ReadRamDataRequest& request)
-{
-    return receive(request.get_variable(), request.get_nb_words());
-}
-
 WriteCurveDataRequest::WriteCurveDataRequest(uint8_t channels)
-: Frame{Command::WriteCurveData}
+: OutgoingFrame{Command::WriteCurveData}
 {
     *this << Uint8{channels};
 }
@@ -124,69 +124,129 @@ private:
     uint16_t length_; //!< Length of the Chars content
 };
 
+// --------------------------------------------------------------------
+// TxQueue
+// --------------------------------------------------------------------
+
+//! Queue of bytes to be sent to the LCD. Frames are written directly into the queue and transferred to the
+//! (interrupt-driven) buffer of the serial port when there is room, so sending a Frame never blocks.
+//! Only one Frame can be written at a time. It is only visible to the serial port once it is committed.
+class TxQueue
+{
+public:
+    static bool begin_frame();
+    static void write(uint8_t byte);
+    static void write_at(uint8_t offset, uint8_t byte);
+    static bool commit_frame();
+    static void abort_frame();
+    static void task();
+    static bool empty() { return count_ == 0; }
+    static uint32_t nb_dropped_frames() { return nb_dropped_frames_; }
+    static void report_statistics();
+
+private:
+    static const uint16_t SIZE = 256; // Indexes are uint8_t so they wrap around automatically
+
+    static uint8_t buffer_[SIZE];
+    static uint8_t head_;
+    static uint8_t tail_;
+    static uint16_t count_;
+    static uint8_t frame_head_;
+    static uint16_t frame_length_;
+    static bool writing_;
+    static bool overflow_;
+    static uint16_t high_water_mark_;
+    static uint32_t nb_frames_;
+    static uint32_t nb_bytes_;
+    static uint32_t nb_dropped_frames_;
+};
+
 // --------------------------------------------------------------------
 // Frame
 // --------------------------------------------------------------------
+
 //! A frame to be send to the LCD or received from the LCD
 struct Frame
 {
-    void send();
-    Frame& operator<<(const Uint8& data);
-    Frame& operator<<(const Uint16& data);
-    template<size_t S> Frame& operator<<(const Chars<S>& name);
-    Frame& operator<<(Page page);
+protected:
+    static const uint8_t HEADER_BYTE_0 = 0x5A;
+    static const uint8_t HEADER_BYTE_1 = 0xA5;
+    struct Position { enum { Header0 = 0, Header1 = 1, Length = 2, Command = 3, Data = 4, Register = 4, Variable = 4, NbBytes = 5, NbWords = 6 }; };
+};
 
-    bool available(uint8_t bytes = 3);
-    bool receive();
-    Command get_command() const;
-    size_t get_length() const;
-    Frame& operator>>(Uint8& data);
-    Frame& operator>>(Uint16& data);
-    Frame& operator>>(Action& action);
-    Frame& operator>>(Command& command);
-    Frame& operator>>(Register& reg);
-    Frame& operator>>(Variable& var);
+// --------------------------------------------------------------------
+// OutgoingFrame
+// --------------------------------------------------------------------
 
-    void reset();
+//! A frame to be send to the LCD. It has no buffer: it is serialised directly into the transmission queue.
+struct OutgoingFrame: Frame
+{
+    OutgoingFrame(const OutgoingFrame&) = delete;
+    OutgoingFrame& operator=(const OutgoingFrame&) = delete;
+    ~OutgoingFrame();
 
-#ifdef UNIT_TEST
-    const uint8_t* get_data() const;
-#endif
+    bool send();
+    OutgoingFrame& operator<<(const Uint8& data);
+    OutgoingFrame& operator<<(const Uint16& data);
+    template<size_t S> OutgoingFrame& operator<<(const Chars<S>& name);
+    OutgoingFrame& operator<<(Page page);
+    OutgoingFrame& append(const char* chars, uint8_t size);
 
 protected:
-    Frame();
-    explicit Frame(Command command);
+    explicit OutgoingFrame(Command command);
     void reset(Command command);
-    Frame& operator<<(Register reg);
-    Frame& operator<<(Variable var);
+    OutgoingFrame& operator<<(Register reg);
+    OutgoingFrame& operator<<(Variable var);
 
 private:
-    void wait_for_data(uint8_t length);
-
-protected:
-    static const size_t FRAME_BUFFER_SIZE = 255;
-    static const uint8_t HEADER_BYTE_0 = 0x5A;
-    static const uint8_t HEADER_BYTE_1 = 0xA5;
-    struct Position { enum { Header0 = 0, Header1 = 1, Length = 2, Command = 3, Data = 4, Register = 4, Variable = 4, NbBytes = 5, NbWords = 6 }; };
+    void begin(Command command);
+    void end();
 
-    uint8_t buffer_[FRAME_BUFFER_SIZE];
-    uint8_t position_ = 0;
+private:
+    uint8_t length_ = 0; //!< Length of the data portion (including the Command)
+    bool writing_ = false; //!< The Frame is currently written into the transmission queue
 };
 
 // --------------------------------------------------------------------
 // IncomingFrame
 // --------------------------------------------------------------------
 
+//! A frame received from the LCD.
 struct IncomingFrame: Frame
 {
-    IncomingFrame(): Frame{} {}
+    bool receive();
+    bool match_response(Command command, uint16_t address, uint8_t nb);
+    Command get_command() const;
+    size_t get_length() const;
+    IncomingFrame& operator>>(Uint8& data);
+    IncomingFrame& operator>>(Uint16& data);
+    IncomingFrame& operator>>(Action& action);
+    IncomingFrame& operator>>(Command& command);
+    IncomingFrame& operator>>(Register& reg);
+    IncomingFrame& operator>>(Variable& var);
+
+    void reset();
+
+#ifdef UNIT_TEST
+    const uint8_t* get_data() const;
+#endif
+
+public:
+    static const uint8_t MAX_NB_WORDS = 16; //!< Maximal number of words of a response
+
+private:
+    //! The biggest Frame received is a response: header, length, command, variable, nb words and data.
+    static const size_t FRAME_BUFFER_SIZE = 3 + 1 + 2 + 1 + 2 * MAX_NB_WORDS;
+
+    uint8_t buffer_[FRAME_BUFFER_SIZE];
+    uint8_t position_ = 0;
 };
 
 // --------------------------------------------------------------------
 // WriteRegisterDataRequest
 // --------------------------------------------------------------------
 
-struct WriteRegisterDataRequest: Frame
+struct WriteRegisterDataRequest: OutgoingFrame
 {
     explicit WriteRegisterDataRequest(Register reg);
 };
@@ -195,29 +255,16 @@ struct WriteRegisterDataRequest: Frame
 // ReadRegisterDataRequest
 // --------------------------------------------------------------------
 
-struct ReadRegisterDataRequest: Frame
+struct ReadRegisterDataRequest: OutgoingFrame
 {
     ReadRegisterDataRequest(Register reg, uint8_t nb_bytes);
-    Register get_register() const;
-    uint8_t get_nb_bytes() const;
-};
-
-// --------------------------------------------------------------------
-// ReadRegisterDataResponse
-// --------------------------------------------------------------------
-
-struct ReadRegisterDataResponse: Frame
-{
-    ReadRegisterDataResponse() = default;
-    bool receive(Register reg, uint8_t nb_bytes);
-    bool receive(const ReadRegisterDataRequest& request);
 };
 
 // --------------------------------------------------------------------
 // WriteRamDataRequest
 // --------------------------------------------------------------------
 
-struct WriteRamDataRequest: Frame
+struct WriteRamDataRequest: OutgoingFrame
 {
     explicit WriteRamDataRequest(Variable var);
     void reset(Variable var);
@@ -227,29 +274,16 @@ struct WriteRamDataRequest: Frame
 // ReadRamDataRequest
 // --------------------------------------------------------------------
 
-struct ReadRamDataRequest: Frame
+struct ReadRamDataRequest: OutgoingFrame
 {
     ReadRamDataRequest(Variable var, uint8_t nb_words);
-    Variable get_variable() const;
-    uint8_t get_nb_words() const;
-};
-
-// --------------------------------------------------------------------
-// ReadRamDataResponse
-// --------------------------------------------------------------------
-
-struct ReadRamDataResponse: Frame
-{
-    ReadRamDataResponse() = default;
-    bool receive(Variable var, uint8_t nb_words);
-    bool receive(const ReadRamDataRequest& request);
 };
 
 // --------------------------------------------------------------------
 // WriteCurveDataRequest
 // --------------------------------------------------------------------
 
-struct WriteCurveDataRequest: Frame
+struct WriteCurveDataRequest: OutgoingFrame
 {
     explicit WriteCurveDataRequest(uint8_t channels);
 };
@@ -391,7 +425,7 @@ Chars<S>&  Chars<S>::operator<<(Variable var)
 
 
 // --------------------------------------------------------------------
-// Frame
+// OutgoingFrame
 // --------------------------------------------------------------------
 
 //! Append a Chars to this Frame.
@@ -399,14 +433,9 @@ Chars<S>&  Chars<S>::operator<<(Variable var)
 //! @param name         The name to be append
 //! @return             Itself
 template<size_t S>
-Frame& Frame::operator<<(const Chars<S>& name)
+OutgoingFrame& OutgoingFrame::operator<<(const Chars<S>& name)
 {
-    size_t length = position_ + name.size() < FRAME_BUFFER_SIZE ? name.size() : FRAME_BUFFER_SIZE - position_;
-    // TODO: Truncate
-    memcpy(buffer_ + position_, name.get(), length);
-    position_ += length;
-    buffer_[Position::Length] += length;
-    return *this;
+    return append(name.c_str(), name.size());
 }
 
 
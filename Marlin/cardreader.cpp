@@ -42,6 +42,9 @@ CardReader::CardReader() {
     #endif
   #endif
   sdprinting = cardOK = saving = logging = false;
+  #if ENABLED(SDCARD_FILE_INDEX)
+    file_index_valid = false;
+  #endif
   filesize = 0;
   sdpos = 0;
   workDirDepth = 0;
@@ -78,11 +81,20 @@ char *createFilename(char *buffer, const dir_t &p) { //buffer > 12characters
  */
 void CardReader::lsDive(const char *prepend, SdFile parent, const char * const match/*=NULL*/) {
   dir_t p;
-  uint8_t cnt = 0;
+  uint16_t cnt = 0;
+  #if ENABLED(SDCARD_FILE_INDEX)
+    uint32_t next_entry_pos = parent.curPosition();
+  #endif
 
   // Read the next entry from a directory
   while (parent.readDir(p, longFilename) > 0) {
 
+    #if ENABLED(SDCARD_FILE_INDEX)
+      // Position of the entry just read, including its long filename
+      const uint32_t entry_pos = next_entry_pos;
+      next_entry_pos = parent.curPosition();
+    #endif
+
     // If the entry is a directory and the action is LS_SerialPrint
     if (DIR_IS_SUBDIR(&p) && lsAction != LS_Count && lsAction != LS_GetFilename) {
 
@@ -131,6 +143,9 @@ void CardReader::lsDive(const char *prepend, SdFile parent, const char * const m
 
       switch (lsAction) {
         case LS_Count:
+          #if ENABLED(SDCARD_FILE_INDEX)
+            add_to_file_index(nrFiles, entry_pos);
+          #endif
           nrFiles++;
           break;
 
@@ -156,6 +171,24 @@ void CardReader::lsDive(const char *prepend, SdFile parent, const char * const m
   } // while readDir
 }
 
+#if ENABLED(SDCARD_FILE_INDEX)
+
+  /**
+   * Add the position of a file to the index if it falls on the stride.
+   * When the index is full, drop every other position and double the stride.
+   */
+  void CardReader::add_to_file_index(const uint16_t nr, const uint32_t pos) {
+    if (nr & ((1 << file_index_shift) - 1)) return;
+    if ((nr >> file_index_shift) >= SDINDEX_LIMIT) {
+      for (uint8_t i = 0; i < SDINDEX_LIMIT / 2; i++) file_index[i] = file_index[i * 2];
+      file_index_shift++;
+      if (nr & ((1 << file_index_shift) - 1)) return;
+    }
+    file_index[nr >> file_index_shift] = pos >> 5; // Directory entries are 32 bytes
+  }
+
+#endif // SDCARD_FILE_INDEX
+
 void CardReader::ls() {
   lsAction = LS_SerialPrint;
   root.rewind();
@@ -257,6 +290,9 @@ void CardReader::initsd() {
   }
   workDir = root;
   curDir = &root;
+  #if ENABLED(SDCARD_FILE_INDEX)
+    flush_file_index();
+  #endif
   #if ENABLED(SDCARD_SORT_ALPHA)
     presort();
   #endif
@@ -273,6 +309,9 @@ void CardReader::setroot() {
   }*/
   workDir = root;
   curDir = &workDir;
+  #if ENABLED(SDCARD_FILE_INDEX)
+    flush_file_index();
+  #endif
   #if ENABLED(SDCARD_SORT_ALPHA)
     presort();
   #endif
@@ -281,6 +320,9 @@ void CardReader::setroot() {
 void CardReader::release() {
   sdprinting = false;
   cardOK = false;
+  #if ENABLED(SDCARD_FILE_INDEX)
+    flush_file_index();
+  #endif
 }
 
 void CardReader::openAndPrintFile(const char *name) {
@@ -432,6 +474,9 @@ void CardReader::openFile(char* name, bool read, bool push_current/*=false*/) {
     }
     else {
       saving = true;
+      #if ENABLED(SDCARD_FILE_INDEX)
+        flush_file_index();
+      #endif
       SERIAL_PROTOCOLLNPAIR(MSG_SD_WRITE_TO_FILE, name);
       lcd_setstatus(fname);
     }
@@ -488,6 +533,9 @@ void CardReader::removeFile(char* name) {
     SERIAL_PROTOCOLPGM("File deleted:");
     SERIAL_PROTOCOLLN(fname);
     sdpos = 0;
+    #if ENABLED(SDCARD_FILE_INDEX)
+      flush_file_index();
+    #endif
     #if ENABLED(SDCARD_SORT_ALPHA)
       presort();
     #endif
@@ -595,18 +643,36 @@ void CardReader::getfilename(uint16_t nr, const char * const match/*=NULL*/) {
   #endif // SDSORT_CACHE_NAMES
   curDir = &workDir;
   lsAction = LS_GetFilename;
+  #if ENABLED(SDCARD_FILE_INDEX)
+    // Start from the closest indexed file instead of the beginning of the directory
+    if (match == NULL && file_index_valid && nr < file_index_count) {
+      const uint16_t i = nr >> file_index_shift;
+      nrFiles = nr - (i << file_index_shift);
+      curDir->seekSet((uint32_t)file_index[i] << 5);
+      lsDive("", *curDir);
+      return;
+    }
+  #endif
   nrFiles = nr;
   curDir->rewind();
   lsDive("", *curDir, match);
 }
 
 uint16_t CardReader::getnrfilenames() {
+  #if ENABLED(SDCARD_FILE_INDEX)
+    if (file_index_valid) return file_index_count;
+    file_index_shift = 0;
+  #endif
   curDir = &workDir;
   lsAction = LS_Count;
   nrFiles = 0;
   curDir->rewind();
   lsDive("", *curDir);
   //SERIAL_ECHOLN(nrFiles);
+  #if ENABLED(SDCARD_FILE_INDEX)
+    file_index_count = nrFiles;
+    file_index_valid = true;
+  #endif
   return nrFiles;
 }
 
@@ -625,6 +691,9 @@ void CardReader::chdir(const char * relpath) {
     if (workDirDepth < MAX_DIR_DEPTH)
       workDirParents[workDirDepth++] = *parent;
     workDir = newfile;
+    #if ENABLED(SDCARD_FILE_INDEX)
+      flush_file_index();
+    #endif
     #if ENABLED(SDCARD_SORT_ALPHA)
       presort();
     #endif
@@ -634,6 +703,9 @@ void CardReader::chdir(const char * relpath) {
 void CardReader::updir() {
   if (workDirDepth > 0) {
     workDir = workDirParents[--workDirDepth];
+    #if ENABLED(SDCARD_FILE_INDEX)
+      flush_file_index();
+    #endif
     #if ENABLED(SDCARD_SORT_ALPHA)
       presort();
     #endif
@@ -162,6 +162,16 @@ private:
   #if ENABLED(SDCARD_SORT_ALPHA)
     void flush_presort();
   #endif
+
+  // Index of the files in the current directory.
+  #if ENABLED(SDCARD_FILE_INDEX)
+    bool file_index_valid;                // The index matches the current directory
+    uint8_t file_index_shift;             // One file every (1 << file_index_shift) is indexed
+    uint16_t file_index_count;            // Count of files in the current directory
+    uint16_t file_index[SDINDEX_LIMIT];   // Directory entry of the indexed files
+    void add_to_file_index(const uint16_t nr, const uint32_t pos);
+    FORCE_INLINE void flush_file_index() { file_index_valid = false; }
+  #endif
 };
 
 extern CardReader card;
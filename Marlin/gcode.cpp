@@ -57,6 +57,10 @@ int GCodeParser::codenum;
   char *GCodeParser::command_args; // start of parameters
 #endif
 
+#if HAS_BINARY_COMMANDS
+  bool GCodeParser::binary;
+#endif
+
 // Create a global instance of the GCode parser singleton
 GCodeParser parser;
 
@@ -77,6 +81,9 @@ void GCodeParser::reset() {
     ZERO(codebits);                     // No codes yet
     //ZERO(param);                      // No parameters (should be safe to comment out this line)
   #endif
+  #if HAS_BINARY_COMMANDS
+    binary = false;                     // Text command
+  #endif
 }
 
 // Populate all fields by parsing a single line of GCode
@@ -228,9 +235,267 @@ void GCodeParser::parse(char *p) {
   }
 }
 
+#if HAS_BINARY_COMMANDS
+
+  /**
+   * Populate all fields from a binary command (see BINARY_GCODE and GCODE_SCRIPTS).
+   * Parameter pointers point to the type byte of each value.
+   */
+  void GCodeParser::parse_binary(char * const record, const uint8_t length) {
+
+    reset(); // No codes to report
+
+    binary = true;
+    command_ptr = record;
+
+    // Bail if the letter is not G, M, or T
+    const char letter = record[0];
+    switch (letter) { case 'G': case 'M': case 'T': break; default: return; }
+    if (length < 3) return;
+
+    command_letter = letter;
+    codenum = (uint8_t)record[1] | (uint8_t)record[2] << 8;
+
+    for (uint8_t i = 3; i < length;) {
+      const uint8_t type = (uint8_t)record[i] >> 5,
+                    size = type == BINARY_NO_VALUE ? 0 : type <= BINARY_INT32_5 ? 4 : type <= BINARY_INT16_5 ? 2 : 0xFF;
+      if (i + 1 + size > length) break;         // Unknown type or truncated value
+      set('A' + (record[i] & 0x1F), size ? &record[i] : NULL);
+      i += 1 + size;
+    }
+  }
+
+#endif // HAS_BINARY_COMMANDS
+
+#if ENABLED(BINARY_GCODE)
+
+  /**
+   * Convert a line of GCode into a binary command (at most MAX_CMD_SIZE - 1 bytes),
+   * so it can be parsed ahead of time. Lines with a subcode, a string, a checksum
+   * or a value that is not exact in 24 bits with 0, 3 or 5 decimals are kept as
+   * text (return 0).
+   */
+  uint8_t GCodeParser::tokenize(const char *p, char * const record) {
+
+    // Skip spaces and N[-0-9]
+    while (*p == ' ') ++p;
+    if (*p == 'N' && NUMERIC_SIGNED(p[1])) {
+      p += 2;
+      while (NUMERIC(*p)) ++p;
+      while (*p == ' ') ++p;
+    }
+
+    const char letter = *p++;
+    switch (letter) { case 'G': case 'M': case 'T': break; default: return 0; }
+    while (*p == ' ') p++;
+    if (!NUMERIC(*p)) return 0;
+
+    uint16_t code = 0;
+    do code = code * 10 + (*p++ - '0'); while (NUMERIC(*p));
+    if (*p == '.') return 0; // Subcode
+
+    if (has_string_arg(letter, code)) return 0;
+
+    record[0] = letter;
+    record[1] = code & 0xFF;
+    record[2] = code >> 8;
+    uint8_t length = 3;
+
+    for (;;) {
+      while (*p == ' ') p++;
+      const char param = *p++;
+      if (!param) return length;
+      if (!WITHIN(param, 'A', 'Z')) return 0;   // String or checksum
+      if (length > MAX_CMD_SIZE - 6) return 0;  // No room for a 4-byte value
+
+      while (*p == ' ') p++;
+      if (!DECIMAL_SIGNED(*p)) {
+        if (letter == 'M') return 0;            // May be a string (M0, M1...)
+        record[length++] = BINARY_NO_VALUE << 5 | (param - 'A');
+        continue;
+      }
+
+      int32_t mantissa;
+      int8_t exponent;
+      p = parse_decimal(p, mantissa, exponent);
+
+      // Use 0, 3 or 5 decimals
+      while (exponent < 0 && mantissa % 10 == 0) { mantissa /= 10; ++exponent; }
+      if (exponent > 0 || exponent < -5) return 0;
+      const uint8_t decimals = exponent == 0 ? 0 : exponent >= -3 ? 3 : 5;
+      // Keep value_float() exactly as with the text: 24 bits at most
+      if (!WITHIN(mantissa, -16777216L, 16777216L)) return 0;
+      for (exponent += decimals; exponent > 0; --exponent) {
+        mantissa *= 10;
+        if (!WITHIN(mantissa, -16777216L, 16777216L)) return 0;
+      }
+
+      const uint8_t offset = decimals == 0 ? 0 : decimals == 3 ? 1 : 2;
+      const bool is_short = WITHIN(mantissa, -32768, 32767);
+      record[length++] = ((is_short ? BINARY_INT16 : BINARY_INT32) + offset) << 5 | (param - 'A');
+      record[length++] = mantissa & 0xFF;
+      record[length++] = (mantissa >> 8) & 0xFF;
+      if (!is_short) {
+        record[length++] = (mantissa >> 16) & 0xFF;
+        record[length++] = (mantissa >> 24) & 0xFF;
+      }
+    }
+  }
+
+#endif // BINARY_GCODE
+
+/**
+ * Parse a decimal number [-+]123[.456] without strtod:
+ * digits are accumulated in an integer mantissa with a power of ten.
+ * The mantissa keeps as many digits as an int32 can hold (9 or 10) and
+ * at most max_decimals fractional digits. The first digit that does not
+ * fit rounds it (half away from zero), so value_fixed() is exact.
+ * There is no scientific notation since 'E' is a parameter.
+ */
+const char* GCodeParser::parse_decimal(const char *p, int32_t &mantissa, int8_t &exponent, const uint8_t max_decimals/*=127*/) {
+  const bool negative = (*p == '-');
+  if (negative || *p == '+') ++p;
+
+  const uint32_t limit = negative ? 0x80000000UL : 0x7FFFFFFFUL;
+  uint32_t m = 0;
+  int8_t e = 0;
+  bool full = false, round_up = false;
+  for (; NUMERIC(*p); ++p) {
+    const uint8_t digit = *p - '0';
+    if (!full && m <= (limit - digit) / 10) { m = m * 10 + digit; continue; }
+    if (!full) { full = true; round_up = digit >= 5; }
+    ++e;
+  }
+  if (*p == '.') {
+    for (++p; NUMERIC(*p); ++p) {
+      const uint8_t digit = *p - '0';
+      if (!full && -e < max_decimals && m <= (limit - digit) / 10) { m = m * 10 + digit; --e; continue; }
+      if (!full) { full = true; round_up = digit >= 5; }
+    }
+  }
+  if (round_up && ++m > limit) { m /= 10; ++e; }
+
+  mantissa = negative ? (int32_t)-m : (int32_t)m;
+  exponent = e;
+  return p;
+}
+
+/**
+ * Parse an integer [-+]123 like strtoul: the magnitude is returned in value.
+ * Return false if it does not fit in 32 bits.
+ */
+static bool parse_unsigned(const char *p, uint32_t &value, bool &negative) {
+  negative = (*p == '-');
+  if (negative || *p == '+') ++p;
+
+  value = 0;
+  for (; NUMERIC(*p); ++p) {
+    const uint8_t digit = *p - '0';
+    if (value > (0xFFFFFFFFUL - digit) / 10) return false;
+    value = value * 10 + digit;
+  }
+  return true;
+}
+
+void GCodeParser::value_decimal(int32_t &mantissa, int8_t &exponent, const uint8_t max_decimals/*=127*/) {
+  #if HAS_BINARY_COMMANDS
+    if (binary) {
+      const uint8_t type = (uint8_t)value_ptr[0] >> 5, * const v = (const uint8_t*)&value_ptr[1];
+      if (type <= BINARY_INT32_5) {
+        mantissa = (int32_t)((uint32_t)v[0] | (uint32_t)v[1] << 8 | (uint32_t)v[2] << 16 | (uint32_t)v[3] << 24);
+        exponent = type == BINARY_INT32 ? 0 : type == BINARY_INT32_3 ? -3 : -5;
+      }
+      else {
+        mantissa = (int16_t)(v[0] | v[1] << 8);
+        exponent = type == BINARY_INT16 ? 0 : type == BINARY_INT16_3 ? -3 : -5;
+      }
+      return;
+    }
+  #endif
+  parse_decimal(value_ptr, mantissa, exponent, max_decimals);
+}
+
+// Powers of ten that are exact as floats
+static const float pow10_table[] PROGMEM = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10 };
+
+float GCodeParser::value_float() {
+  if (!value_ptr) return 0.0;
+
+  int32_t mantissa;
+  int8_t exponent;
+  value_decimal(mantissa, exponent);
+
+  float value = mantissa;
+  for (; exponent < -10; exponent += 10) value /= 1e10;
+  for (; exponent > 10; exponent -= 10) value *= 1e10;
+  if (exponent < 0) value /= pgm_read_float(&pow10_table[-exponent]);
+  else if (exponent > 0) value *= pgm_read_float(&pow10_table[exponent]);
+  return value;
+}
+
+int32_t GCodeParser::value_fixed(const uint8_t decimals) {
+  if (!value_ptr) return 0;
+
+  int32_t mantissa;
+  int8_t exponent;
+  value_decimal(mantissa, exponent, decimals);
+
+  for (exponent += decimals; exponent > 0; --exponent) mantissa *= 10;
+  if (exponent < -9) return 0;
+  if (exponent < 0) {
+    uint32_t divisor = 1;
+    for (; exponent < 0; ++exponent) divisor *= 10;
+    const int32_t half = divisor / 2;
+    mantissa = (mantissa + (mantissa < 0 ? -half : half)) / (int32_t)divisor; // Round half away from zero
+  }
+  return mantissa;
+}
+
+int32_t GCodeParser::value_long() {
+  if (!value_ptr) return 0;
+
+  #if HAS_BINARY_COMMANDS
+    if (binary) {
+      int32_t mantissa;
+      int8_t exponent;
+      value_decimal(mantissa, exponent);
+      for (; exponent < 0; ++exponent) mantissa /= 10; // Truncate like strtol
+      return mantissa;
+    }
+  #endif
+
+  // Saturate like strtol
+  uint32_t value;
+  bool negative;
+  if (!parse_unsigned(value_ptr, value, negative) || value > (negative ? 0x80000000UL : 0x7FFFFFFFUL))
+    return negative ? (int32_t)0x80000000UL : 0x7FFFFFFFL;
+  return negative ? (int32_t)-value : (int32_t)value;
+}
+
+uint32_t GCodeParser::value_ulong() {
+  if (!value_ptr) return 0;
+
+  #if HAS_BINARY_COMMANDS
+    if (binary) return (uint32_t)value_long();
+  #endif
+
+  // Like strtoul: saturate, and negate in unsigned
+  uint32_t value;
+  bool negative;
+  if (!parse_unsigned(value_ptr, value, negative)) return 0xFFFFFFFFUL;
+  return negative ? -value : value;
+}
+
 void GCodeParser::unknown_command_error() {
   SERIAL_ECHO_START();
-  SERIAL_ECHOPAIR(MSG_UNKNOWN_COMMAND, command_ptr);
+  #if HAS_BINARY_COMMANDS
+    if (binary) {
+      SERIAL_ECHOPAIR(MSG_UNKNOWN_COMMAND, command_ptr[0]);
+      SERIAL_ECHO(codenum);
+    }
+    else
+  #endif
+      SERIAL_ECHOPAIR(MSG_UNKNOWN_COMMAND, command_ptr);
   SERIAL_CHAR('"');
   SERIAL_EOL();
 }
@@ -72,6 +72,13 @@ private:
     static char *command_args;      // Args start here, for slow scan
   #endif
 
+  #if HAS_BINARY_COMMANDS
+    static bool binary;             // The command is a binary record
+  #endif
+
+  // Get the code value as a mantissa and a power of ten
+  static void value_decimal(int32_t &mantissa, int8_t &exponent, const uint8_t max_decimals=127);
+
 public:
 
   // Global states for GCode-level units features
@@ -169,35 +176,54 @@ public:
   // This uses 54 bytes of SRAM to speed up seen/value
   static void parse(char * p);
 
+  #if HAS_BINARY_COMMANDS
+
+    /**
+     * Binary command: letter | code (2 bytes) | parameters
+     * Each parameter is a (type << 5 | letter - 'A') byte followed by its value.
+     * Values are little-endian integers, scaled by the power of ten of their type.
+     */
+    enum BinaryValueType : uint8_t {
+      BINARY_NO_VALUE,
+      BINARY_INT32, BINARY_INT32_3, BINARY_INT32_5,   // 4 bytes, 0, 3 or 5 decimals
+      BINARY_INT16, BINARY_INT16_3, BINARY_INT16_5    // 2 bytes, 0, 3 or 5 decimals
+    };
+
+    // Populate all fields from a binary command without any text scanning
+    static void parse_binary(char * const record, const uint8_t length);
+
+    // Commands with a string argument (file names, messages) have no binary form
+    FORCE_INLINE static bool has_string_arg(const char letter, const uint16_t code) {
+      if (letter != 'M') return false;
+      switch (code) { case 23: case 28: case 30: case 32: case 117: case 118: case 928: return true; default: return false; }
+    }
+
+    #if ENABLED(BINARY_GCODE)
+      // Convert a line of GCode into a binary command. Return its length, or 0 to keep the text.
+      static uint8_t tokenize(const char *p, char * const record);
+    #endif
+
+  #endif
+
   // The code value pointer was set
   FORCE_INLINE static bool has_value() { return value_ptr != NULL; }
 
   // Seen a parameter with a value
   inline static bool seenval(const char c) { return seen(c) && has_value(); }
 
-  // Float removes 'E' to prevent scientific notation interpretation
-  inline static float value_float() {
-    if (value_ptr) {
-      char *e = value_ptr;
-      for (;;) {
-        const char c = *e;
-        if (c == '\0' || c == ' ') break;
-        if (c == 'E' || c == 'e') {
-          *e = '\0';
-          const float ret = strtod(value_ptr, NULL);
-          *e = c;
-          return ret;
-        }
-        ++e;
-      }
-      return strtod(value_ptr, NULL);
-    }
-    return 0.0;
-  }
+  // Parse a decimal number [-+]123[.456] into a mantissa and a power of ten, rounded to max_decimals.
+  // No scientific notation ('E' is an axis) and no locale. Return the end of the number.
+  static const char* parse_decimal(const char *p, int32_t &mantissa, int8_t &exponent, const uint8_t max_decimals=127);
+
+  // Code value as a float
+  static float value_float();
+
+  // Code value as a fixed-point number with the given number of decimals (i.e. 1.2345 with 3 decimals is 1235)
+  static int32_t value_fixed(const uint8_t decimals);
 
   // Code value as a long or ulong
-  inline static int32_t value_long() { return value_ptr ? strtol(value_ptr, NULL, 10) : 0L; }
-  inline static uint32_t value_ulong() { return value_ptr ? strtoul(value_ptr, NULL, 10) : 0UL; }
+  static int32_t value_long();
+  static uint32_t value_ulong();
 
   // Code value for use as time
   FORCE_INLINE static millis_t value_millis() { return value_ulong(); }
@@ -320,4 +346,32 @@ public:
 
 extern GCodeParser parser;
 
+#if ENABLED(GCODE_SCRIPTS)
+
+  /**
+   * Command scripts, stored in PROGMEM as binary commands and executed with
+   * enqueue_script_P(). Each command ends with SCRIPT_EOL and the script with
+   * SCRIPT_END. Values are stored as int32 (SCRIPT_INT) or with 3 decimals
+   * (SCRIPT_FLOAT). A command is limited to 5 parameters with a value.
+   *
+   *   const char level_step[] PROGMEM = {
+   *     SCRIPT_G(1), SCRIPT_INT('Z', 10), SCRIPT_INT('F', 2000), SCRIPT_EOL,
+   *     SCRIPT_G(1), SCRIPT_FLOAT('X', 30.5), SCRIPT_INT('F', 6000), SCRIPT_EOL,
+   *     SCRIPT_END
+   *   };
+   */
+  #define SCRIPT_BYTE(V, N)   char(((int32_t)(V) >> (8 * (N))) & 0xFF)
+  #define SCRIPT_CODE(L, C)   char(L), SCRIPT_BYTE(C, 0), SCRIPT_BYTE(C, 1)
+  #define SCRIPT_G(C)         SCRIPT_CODE('G', C)
+  #define SCRIPT_M(C)         SCRIPT_CODE('M', C)
+  #define SCRIPT_VALUE(P, T, V) \
+    char(GCodeParser::T << 5 | ((P) - 'A')), SCRIPT_BYTE(V, 0), SCRIPT_BYTE(V, 1), SCRIPT_BYTE(V, 2), SCRIPT_BYTE(V, 3)
+  #define SCRIPT_INT(P, V)    SCRIPT_VALUE(P, BINARY_INT32, V)
+  #define SCRIPT_FLOAT(P, V)  SCRIPT_VALUE(P, BINARY_INT32_3, (V) * 1000 + ((V) < 0 ? -0.5 : 0.5))
+  #define SCRIPT_FLAG(P)      char(GCodeParser::BINARY_NO_VALUE << 5 | ((P) - 'A'))
+  #define SCRIPT_EOL          char(0xFF)  // Not a valid parameter type
+  #define SCRIPT_END          char(0)
+
+#endif
+
 #endif // GCODE_H
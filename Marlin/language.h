@@ -130,6 +130,9 @@
 #define MSG_ERR_CHECKSUM_MISMATCH           "checksum mismatch, Last Line: "
 #define MSG_ERR_NO_CHECKSUM                 "No Checksum with line number, Last Line: "
 #define MSG_ERR_NO_LINENUMBER_WITH_CHECKSUM "No Line Number with checksum, Last Line: "
+#define MSG_ERR_BINARY_LENGTH               "Invalid binary frame length, Last Line: "
+#define MSG_ERR_BINARY_SAVING               "Binary commands can't be written to SD"
+#define MSG_ERR_BINARY_STRING               "Binary frame of a command with a string argument: "
 #define MSG_FILE_PRINTED                    "Done printing file"
 #define MSG_BEGIN_FILE_LIST                 "Begin file list"
 #define MSG_END_FILE_LIST                   "End file list"
@@ -82,6 +82,7 @@ Planner planner;
 block_t Planner::block_buffer[BLOCK_BUFFER_SIZE];
 volatile uint8_t Planner::block_buffer_head = 0,           // Index of the next block to be pushed
                  Planner::block_buffer_tail = 0;
+uint8_t Planner::block_buffer_planned = 0;
 
 float Planner::max_feedrate_mm_s[XYZE_N], // Max speeds in mm per second
       Planner::axis_steps_per_mm[XYZE_N],
@@ -154,6 +155,39 @@ float Planner::previous_speed[NUM_AXIS],
   volatile uint32_t Planner::block_buffer_runtime_us = 0;
 #endif
 
+#if ENABLED(MERGE_SEGMENTS)
+  float Planner::segment_start[XYZE],
+        Planner::segment_end[XYZE],
+        Planner::segment_dir[XYZ],
+        Planner::segment_e_ratio,
+        Planner::segment_fr_mm_s,
+        Planner::segment_position[XYZE];
+  uint8_t Planner::segment_extruder;
+  bool Planner::segment_pending = false,
+       Planner::segment_position_valid = false;
+#endif
+
+#if ENABLED(PLANNER_PROFILING)
+  uint32_t Planner::nb_planned_blocks,
+           Planner::plan_time_us,
+           Planner::recalculate_time_us,
+           Planner::replanned_blocks,
+           Planner::recalculated_trapezoids,
+           Planner::merged_segments,
+           Planner::max_plan_time_us,
+           Planner::wait_time_us;
+  float Planner::planned_time_s;
+  millis_t Planner::profiling_start_ms;
+  bool Planner::echo_blocks = false;
+  uint32_t Planner::starved_blocks;
+  uint8_t Planner::min_moves_planned = BLOCK_BUFFER_SIZE;
+  Planner::layer_stats_t Planner::layer_stats, Planner::last_layer_stats;
+  bool Planner::layer_stats_ready = false;
+  static int32_t layer_z;                    // Height of the current layer in steps
+  static bool layer_started = false;
+  static uint16_t layer_start_underruns;
+#endif
+
 /**
  * Class and Instance Methods
  */
@@ -161,7 +195,7 @@ float Planner::previous_speed[NUM_AXIS],
 Planner::Planner() { init(); }
 
 void Planner::init() {
-  block_buffer_head = block_buffer_tail = 0;
+  block_buffer_head = block_buffer_tail = block_buffer_planned = 0;
   ZERO(position);
   #if ENABLED(LIN_ADVANCE)
     ZERO(position_float);
@@ -188,29 +222,108 @@ void Planner::calculate_trapezoid_for_block(block_t* const block, const float &e
   NOLESS(final_rate, MINIMAL_STEP_RATE);
 
   int32_t accel = block->acceleration_steps_per_s2,
-          accelerate_steps = CEIL(estimate_acceleration_distance(initial_rate, block->nominal_rate, accel)),
-          decelerate_steps = FLOOR(estimate_acceleration_distance(block->nominal_rate, final_rate, -accel)),
-          plateau_steps = block->step_event_count - accelerate_steps - decelerate_steps;
-
-  // Is the Plateau of Nominal Rate smaller than nothing? That means no cruising, and we will
-  // have to use intersection_distance() to calculate when to abort accel and start braking
-  // in order to reach the final_rate exactly at the end of this block.
-  if (plateau_steps < 0) {
-    accelerate_steps = CEIL(intersection_distance(initial_rate, final_rate, accel, block->step_event_count));
-    NOLESS(accelerate_steps, 0); // Check limits due to numerical round-off
-    accelerate_steps = min((uint32_t)accelerate_steps, block->step_event_count);//(We can cast here to unsigned, because the above line ensures that we are above zero)
-    plateau_steps = 0;
+          accelerate_steps, decelerate_steps, plateau_steps;
+
+  #if ENABLED(INTEGER_TRAPEZOID_STEPS)
+    if (accel > 0 && block->nominal_rate <= 65535 && initial_rate <= block->nominal_rate && final_rate <= block->nominal_rate) {
+      /**
+       * The same distances in integer arithmetic, rounded exactly (the squares
+       * of the rates don't fit in a float): accelerate_steps = ceil(na / den),
+       * decelerate_steps = floor(nd / den). The intersection distance is
+       * (steps + na / den - nd / den) / 2, so it needs no other division.
+       * The float version is off by up to 3 steps in about 1 block in 6000
+       * (see test/motion/trapezoid.cpp).
+       */
+      const uint32_t nominal_sq = sq(block->nominal_rate),
+                     den = (uint32_t)accel * 2,
+                     na = nominal_sq - sq(initial_rate),
+                     nd = nominal_sq - sq(final_rate),
+                     qa = na / den, qd = nd / den;
+      const int32_t ra = na - qa * den, rd = nd - qd * den;
+
+      accelerate_steps = qa + (ra ? 1 : 0);
+      decelerate_steps = qd;
+      plateau_steps = block->step_event_count - accelerate_steps - decelerate_steps;
+
+      if (plateau_steps < 0) {
+        const int32_t x = block->step_event_count + qa - qd, // Twice the intersection, plus (ra - rd) / den
+                      half = (x - (x & 1)) / 2;
+        accelerate_steps = (x & 1) ? half + 1 : half + (ra > rd ? 1 : 0);
+        NOLESS(accelerate_steps, 0);
+        accelerate_steps = min((uint32_t)accelerate_steps, block->step_event_count);
+        plateau_steps = 0;
+      }
+    }
+    else
+  #endif
+  {
+    accelerate_steps = CEIL(estimate_acceleration_distance(initial_rate, block->nominal_rate, accel));
+    decelerate_steps = FLOOR(estimate_acceleration_distance(block->nominal_rate, final_rate, -accel));
+    plateau_steps = block->step_event_count - accelerate_steps - decelerate_steps;
+
+    // Is the Plateau of Nominal Rate smaller than nothing? That means no cruising, and we will
+    // have to use intersection_distance() to calculate when to abort accel and start braking
+    // in order to reach the final_rate exactly at the end of this block.
+    if (plateau_steps < 0) {
+      accelerate_steps = CEIL(intersection_distance(initial_rate, final_rate, accel, block->step_event_count));
+      NOLESS(accelerate_steps, 0); // Check limits due to numerical round-off
+      accelerate_steps = min((uint32_t)accelerate_steps, block->step_event_count);//(We can cast here to unsigned, because the above line ensures that we are above zero)
+      plateau_steps = 0;
+    }
   }
 
   // block->accelerate_until = accelerate_steps;
   // block->decelerate_after = accelerate_steps+plateau_steps;
 
+  #if ENABLED(S_CURVE_ACCELERATION)
+    /**
+     * The S-curve is evaluated against the time since the start of the
+     * acceleration or deceleration, so it needs the rate it reaches and the
+     * durations. A Bézier ramp has the average speed of the linear ramp, so
+     * it covers the same steps in the same time.
+     */
+    uint32_t cruise_rate = block->nominal_rate;
+    if (!plateau_steps) {
+      // The nominal rate may not be reached
+      NOMORE(cruise_rate, (uint32_t)SQRT(sq((float)initial_rate) + 2.0 * accel * accelerate_steps));
+      NOLESS(cruise_rate, max(initial_rate, final_rate));
+    }
+    NOMORE(cruise_rate, 65535);
+
+    uint32_t acceleration_time = 0, deceleration_time = 0;
+    if (accel > 0) {
+      acceleration_time = (float)(cruise_rate - min(initial_rate, cruise_rate)) * ((F_CPU) * 0.125) / accel;
+      deceleration_time = (float)(cruise_rate - min(final_rate, cruise_rate)) * ((F_CPU) * 0.125) / accel;
+    }
+
+    /**
+     * The stepper gets the time t in [0, 1) as a 16-bit fraction with
+     * MultiU24X32toH16(t, time, inverse), so inverse = 2^40 / duration.
+     * It's reduced by 2^-16 so the rounding of the ISR can't reach 1.
+     * Ramps shorter than 256 ticks (128µs) stay linear (acceleration_rate),
+     * as do the ramps of 2^24 ticks (8.4s) or more: MultiU24X32toH16 only
+     * takes 24 bits of the time.
+     */
+    #define BEZIER_SCALE 1099494850560.0 // 2^40 - 2^24
+    #define BEZIER_TIME(T) WITHIN(T, 256, 0xFFFFFF)
+    uint32_t acceleration_time_inverse = 0, deceleration_time_inverse = 0;
+    if (!BEZIER_TIME(acceleration_time)) acceleration_time = 0; else acceleration_time_inverse = BEZIER_SCALE / acceleration_time;
+    if (!BEZIER_TIME(deceleration_time)) deceleration_time = 0; else deceleration_time_inverse = BEZIER_SCALE / deceleration_time;
+  #endif
+
   CRITICAL_SECTION_START;  // Fill variables used by the stepper in a critical section
   if (!TEST(block->flag, BLOCK_BIT_BUSY)) { // Don't update variables if block is busy.
     block->accelerate_until = accelerate_steps;
     block->decelerate_after = accelerate_steps + plateau_steps;
     block->initial_rate = initial_rate;
     block->final_rate = final_rate;
+    #if ENABLED(S_CURVE_ACCELERATION)
+      block->cruise_rate = cruise_rate;
+      block->acceleration_time = acceleration_time;
+      block->deceleration_time = deceleration_time;
+      block->acceleration_time_inverse = acceleration_time_inverse;
+      block->deceleration_time_inverse = deceleration_time_inverse;
+    #endif
   }
   CRITICAL_SECTION_END;
 }
@@ -234,44 +347,43 @@ void Planner::reverse_pass_kernel(block_t* const current, const block_t *next) {
   if (current->entry_speed != max_entry_speed) {
     // If nominal length true, max junction speed is guaranteed to be reached. Only compute
     // for max allowable speed if block is decelerating and nominal length is false.
-    current->entry_speed = (TEST(current->flag, BLOCK_BIT_NOMINAL_LENGTH) || max_entry_speed <= next->entry_speed)
+    const float entry_speed = (TEST(current->flag, BLOCK_BIT_NOMINAL_LENGTH) || max_entry_speed <= next->entry_speed)
       ? max_entry_speed
       : min(max_entry_speed, max_allowable_speed(-current->acceleration, next->entry_speed, current->millimeters));
-    SBI(current->flag, BLOCK_BIT_RECALCULATE);
+    // Only the trapezoids next to a changed junction are recalculated
+    if (current->entry_speed != entry_speed) {
+      current->entry_speed = entry_speed;
+      SBI(current->flag, BLOCK_BIT_RECALCULATE);
+    }
   }
 }
 
 /**
  * recalculate() needs to go over the current plan twice.
- * Once in reverse and once forward. This implements the reverse pass.
+ * Once in reverse and once forward. This implements the reverse pass,
+ * from the newest block back to the optimally planned one (excluded).
  */
 void Planner::reverse_pass() {
-
-  if (movesplanned() > 3) {
-
-    block_t* block[3] = { NULL, NULL, NULL };
-
-    // Make a local copy of block_buffer_tail, because the interrupt can alter it
-    // Is a critical section REALLY needed for a single byte change?
-    //CRITICAL_SECTION_START;
-    uint8_t tail = block_buffer_tail;
-    //CRITICAL_SECTION_END
-
-    uint8_t b = BLOCK_MOD(block_buffer_head - 3);
-    while (b != tail) {
-      if (block[0] && TEST(block[0]->flag, BLOCK_BIT_START_FROM_FULL_HALT)) break;
-      b = prev_block_index(b);
-      block[2] = block[1];
-      block[1] = block[0];
-      block[0] = &block_buffer[b];
-      reverse_pass_kernel(block[1], block[2]);
-    }
+  uint8_t b = prev_block_index(block_buffer_head);
+  const block_t *next = &block_buffer[b];
+  while (b != block_buffer_planned) {
+    b = prev_block_index(b);
+    if (b == block_buffer_planned) break;
+    block_t* const current = &block_buffer[b];
+    // A block starting from a full halt is not affected by the next ones, nor the blocks before it
+    if (TEST(current->flag, BLOCK_BIT_START_FROM_FULL_HALT)) break;
+    reverse_pass_kernel(current, next);
+    next = current;
+    #if ENABLED(PLANNER_PROFILING)
+      replanned_blocks++;
+    #endif
   }
 }
 
 // The kernel called by recalculate() when scanning the plan from first to last entry.
-void Planner::forward_pass_kernel(const block_t* previous, block_t* const current) {
-  if (!previous) return;
+// Return true if the entry speed of the current block is limited by the acceleration.
+bool Planner::forward_pass_kernel(const block_t* previous, block_t* const current) {
+  if (!previous) return false;
 
   // If the previous block is an acceleration block, but it is not long enough to complete the
   // full speed change within the block, we need to adjust the entry speed accordingly. Entry
@@ -285,34 +397,42 @@ void Planner::forward_pass_kernel(const block_t* previous, block_t* const curren
       if (current->entry_speed != entry_speed) {
         current->entry_speed = entry_speed;
         SBI(current->flag, BLOCK_BIT_RECALCULATE);
+        return true;
       }
     }
   }
+  return false;
 }
 
 /**
  * recalculate() needs to go over the current plan twice.
- * Once in reverse and once forward. This implements the forward pass.
+ * Once in reverse and once forward. This implements the forward pass,
+ * from the optimally planned block to the newest one.
+ *
+ * A block at its maximum entry speed, or whose entry speed is limited by
+ * the acceleration from the optimally planned blocks before it, can't be
+ * improved by the blocks added later: it becomes the optimally planned block.
  */
 void Planner::forward_pass() {
-  block_t* block[3] = { NULL, NULL, NULL };
-
-  for (uint8_t b = block_buffer_tail; b != block_buffer_head; b = next_block_index(b)) {
-    block[0] = block[1];
-    block[1] = block[2];
-    block[2] = &block_buffer[b];
-    forward_pass_kernel(block[0], block[1]);
+  const block_t *previous = &block_buffer[block_buffer_planned];
+  for (uint8_t b = next_block_index(block_buffer_planned); b != block_buffer_head; b = next_block_index(b)) {
+    block_t* const current = &block_buffer[b];
+    if (forward_pass_kernel(previous, current) || current->entry_speed == current->max_entry_speed)
+      block_buffer_planned = b;
+    previous = current;
+    #if ENABLED(PLANNER_PROFILING)
+      replanned_blocks++;
+    #endif
   }
-  forward_pass_kernel(block[1], block[2]);
 }
 
 /**
- * Recalculate the trapezoid speed profiles for all blocks in the plan
- * according to the entry_factor for each junction. Must be called by
- * recalculate() after updating the blocks.
+ * Recalculate the trapezoid speed profiles of the blocks, starting with the
+ * 'first' one, according to the entry_factor for each junction. Must be called
+ * by recalculate() after updating the blocks.
  */
-void Planner::recalculate_trapezoids() {
-  int8_t block_index = block_buffer_tail;
+void Planner::recalculate_trapezoids(const uint8_t first) {
+  uint8_t block_index = first;
   block_t *current, *next = NULL;
 
   while (block_index != block_buffer_head) {
@@ -325,6 +445,9 @@ void Planner::recalculate_trapezoids() {
         float nom = current->nominal_speed;
         calculate_trapezoid_for_block(current, current->entry_speed / nom, next->entry_speed / nom);
         CBI(current->flag, BLOCK_BIT_RECALCULATE); // Reset current only to ensure next trapezoid is computed
+        #if ENABLED(PLANNER_PROFILING)
+          recalculated_trapezoids++;
+        #endif
       }
     }
     block_index = next_block_index(block_index);
@@ -334,6 +457,9 @@ void Planner::recalculate_trapezoids() {
     float nom = next->nominal_speed;
     calculate_trapezoid_for_block(next, next->entry_speed / nom, (MINIMUM_PLANNER_SPEED) / nom);
     CBI(next->flag, BLOCK_BIT_RECALCULATE);
+    #if ENABLED(PLANNER_PROFILING)
+      recalculated_trapezoids++;
+    #endif
   }
 }
 
@@ -360,11 +486,20 @@ void Planner::recalculate_trapezoids() {
  * jerk is jerkier than the set limit, Jerky. Finally it will:
  *
  *   3. Recalculate "trapezoids" for all blocks.
+ *
+ * The blocks up to block_buffer_planned are optimally planned and can't change:
+ * only the blocks after it are visited.
  */
 void Planner::recalculate() {
+  // Start from the tail if the stepper took the optimally planned block
+  const uint8_t tail = block_buffer_tail;
+  if (BLOCK_MOD(block_buffer_planned - tail) >= BLOCK_MOD(block_buffer_head - tail))
+    block_buffer_planned = tail;
+
+  const uint8_t first = block_buffer_planned;
   reverse_pass();
   forward_pass();
-  recalculate_trapezoids();
+  recalculate_trapezoids(first);
 }
 
 
@@ -687,6 +822,15 @@ void Planner::check_axes_activity() {
  */
 void Planner::_buffer_line(const float &a, const float &b, const float &c, const float &e, float fr_mm_s, const uint8_t extruder) {
 
+  // Keep the order of the moves when called directly (e.g., by UBL)
+  #if ENABLED(MERGE_SEGMENTS)
+    if (segment_pending) flush_merged_line();
+  #endif
+
+  #if ENABLED(PLANNER_PROFILING)
+    const uint32_t plan_start = micros();
+  #endif
+
   // The target position of the tool in absolute steps
   // Calculate target position in absolute steps
   //this should be done after the wait, because otherwise a M92 code within the gcode disrupts this calculation somehow
@@ -810,9 +954,44 @@ void Planner::_buffer_line(const float &a, const float &b, const float &c, const
   // Calculate the buffer head after we push this byte
   const uint8_t next_buffer_head = next_block_index(block_buffer_head);
 
+  #if ENABLED(PLANNER_PROFILING)
+    if (print_job_timer.isRunning()) {
+      // Blocks left to the stepper when this one arrives
+      const uint8_t moves = movesplanned();
+      if (!moves) {
+        starved_blocks++;
+        layer_stats.starved_blocks++;
+      }
+      NOMORE(min_moves_planned, moves);
+      NOMORE(layer_stats.min_moves_planned, moves);
+
+      // The first extrusion at another height starts a new layer
+      if (de > 0 && (da || db) && (target[Z_AXIS] != layer_z || !layer_started)) {
+        const uint16_t underruns = get_underruns();
+        if (layer_started) {
+          last_layer_stats = layer_stats;
+          last_layer_stats.underruns = underruns - layer_start_underruns;
+          layer_stats_ready = true;
+        }
+        layer_started = true;
+        layer_z = target[Z_AXIS];
+        layer_start_underruns = underruns;
+        layer_stats.z = target[Z_AXIS] * steps_to_mm[Z_AXIS];
+        layer_stats.min_moves_planned = moves;
+        layer_stats.starved_blocks = 0;
+      }
+    }
+  #endif
+
   // If the buffer is full: good! That means we are well ahead of the robot.
   // Rest here until there is room in the buffer.
+  #if ENABLED(PLANNER_PROFILING)
+    const uint32_t wait_start = micros();
+  #endif
   while (block_buffer_tail == next_buffer_head) idle();
+  #if ENABLED(PLANNER_PROFILING)
+    const uint32_t wait_time = micros() - wait_start;
+  #endif
 
   // Prepare to set up new block
   block_t* block = &block_buffer[block_buffer_head];
@@ -1410,6 +1589,13 @@ void Planner::_buffer_line(const float &a, const float &b, const float &c, const
 
   // Update the position (only when a move was queued)
   COPY(position, target);
+  #if ENABLED(MERGE_SEGMENTS)
+    segment_position[X_AXIS] = a;
+    segment_position[Y_AXIS] = b;
+    segment_position[Z_AXIS] = c;
+    segment_position[E_AXIS] = e;
+    segment_position_valid = true;
+  #endif
   #if ENABLED(LIN_ADVANCE)
     position_float[X_AXIS] = a;
     position_float[Y_AXIS] = b;
@@ -1417,12 +1603,148 @@ void Planner::_buffer_line(const float &a, const float &b, const float &c, const
     position_float[E_AXIS] = e;
   #endif
 
+  #if ENABLED(PLANNER_PROFILING)
+    const uint32_t recalculate_start = micros();
+  #endif
+
   recalculate();
 
+  #if ENABLED(PLANNER_PROFILING)
+    const uint32_t now = micros(),
+                   time = now - plan_start - wait_time;
+    nb_planned_blocks++;
+    plan_time_us += time;
+    recalculate_time_us += now - recalculate_start;
+    NOLESS(max_plan_time_us, time);
+    wait_time_us += wait_time;
+    planned_time_s += block->millimeters / block->nominal_speed;
+
+    if (echo_blocks) {
+      SERIAL_ECHOPGM("block steps:");
+      SERIAL_ECHO(block->steps[X_AXIS]);
+      SERIAL_CHAR(','); SERIAL_ECHO(block->steps[Y_AXIS]);
+      SERIAL_CHAR(','); SERIAL_ECHO(block->steps[Z_AXIS]);
+      SERIAL_CHAR(','); SERIAL_ECHO(block->steps[E_AXIS]);
+      SERIAL_ECHOPAIR(" dir:", block->direction_bits);
+      SERIAL_ECHOPAIR(" events:", block->step_event_count);
+      SERIAL_ECHOPAIR(" rates:", block->initial_rate);
+      SERIAL_CHAR('/'); SERIAL_ECHO(block->nominal_rate);
+      SERIAL_CHAR('/'); SERIAL_ECHO(block->final_rate);
+      SERIAL_ECHOPAIR(" accel:", block->acceleration_steps_per_s2);
+      SERIAL_ECHOPAIR(" until:", block->accelerate_until);
+      SERIAL_ECHOLNPAIR(" after:", block->decelerate_after);
+    }
+  #endif
+
   stepper.wake_up();
 
 } // buffer_line()
 
+#if ENABLED(PLANNER_PROFILING)
+
+  void Planner::reset_profiling() {
+    nb_planned_blocks = plan_time_us = recalculate_time_us = max_plan_time_us = wait_time_us = 0;
+    replanned_blocks = recalculated_trapezoids = merged_segments = 0;
+    starved_blocks = 0;
+    min_moves_planned = BLOCK_BUFFER_SIZE;
+    layer_started = layer_stats_ready = false;
+    CRITICAL_SECTION_START;
+    stepper.underruns = 0;
+    CRITICAL_SECTION_END;
+    planned_time_s = 0;
+    profiling_start_ms = millis();
+  }
+
+  // The counter of the stepper ISR, read atomically
+  uint16_t Planner::get_underruns() {
+    CRITICAL_SECTION_START;
+    const uint16_t underruns = stepper.underruns;
+    CRITICAL_SECTION_END;
+    return underruns;
+  }
+
+#endif
+
+#if ENABLED(MERGE_SEGMENTS)
+
+  /**
+   * Can the segment from segment_end to target extend the merged line?
+   *  - It goes in the direction of the first segment, within MERGE_SEGMENTS_ANGLE
+   *  - Its end is within MERGE_SEGMENTS_CHORD / 2 of the line of the first segment
+   *  - Its E per mm is within MERGE_SEGMENTS_E_RATIO of the first segment
+   */
+  bool Planner::can_merge(const float target[XYZE]) {
+    const float dx = target[X_AXIS] - segment_end[X_AXIS],
+                dy = target[Y_AXIS] - segment_end[Y_AXIS],
+                dz = target[Z_AXIS] - segment_end[Z_AXIS],
+                length = SQRT(sq(dx) + sq(dy) + sq(dz));
+    if (length < 0.000001) return false; // E only move
+
+    // Angle with the first segment
+    const float min_cos = cos(RADIANS(MERGE_SEGMENTS_ANGLE));
+    if (dx * segment_dir[X_AXIS] + dy * segment_dir[Y_AXIS] + dz * segment_dir[Z_AXIS] < min_cos * length) return false;
+
+    // Distance from the line (cross product with the unit vector, no cancellation on long lines)
+    const float vx = target[X_AXIS] - segment_start[X_AXIS],
+                vy = target[Y_AXIS] - segment_start[Y_AXIS],
+                vz = target[Z_AXIS] - segment_start[Z_AXIS],
+                cx = vy * segment_dir[Z_AXIS] - vz * segment_dir[Y_AXIS],
+                cy = vz * segment_dir[X_AXIS] - vx * segment_dir[Z_AXIS],
+                cz = vx * segment_dir[Y_AXIS] - vy * segment_dir[X_AXIS];
+    if (sq(cx) + sq(cy) + sq(cz) > sq(0.5 * (MERGE_SEGMENTS_CHORD))) return false;
+
+    // Extrusion (travel moves are only merged with travel moves)
+    const float e_ratio = (target[E_AXIS] - segment_end[E_AXIS]) / length;
+    return FABS(e_ratio - segment_e_ratio) <= (MERGE_SEGMENTS_E_RATIO) * FABS(segment_e_ratio);
+  }
+
+  void Planner::merge_line(const float &a, const float &b, const float &c, const float &e, const float &fr_mm_s, const uint8_t extruder) {
+    const float target[XYZE] = { a, b, c, e };
+
+    if (segment_pending) {
+      if (fr_mm_s == segment_fr_mm_s && extruder == segment_extruder && can_merge(target)) {
+        COPY(segment_end, target);
+        #if ENABLED(PLANNER_PROFILING)
+          merged_segments++;
+        #endif
+        // Don't starve the stepper while merging
+        if (movesplanned() < 2) flush_merged_line();
+        return;
+      }
+      flush_merged_line();
+    }
+
+    // Without a known start, or for E only moves, nothing to merge with
+    const float dx = a - segment_position[X_AXIS],
+                dy = b - segment_position[Y_AXIS],
+                dz = c - segment_position[Z_AXIS],
+                length = SQRT(sq(dx) + sq(dy) + sq(dz));
+    if (!segment_position_valid || length < 0.000001 || movesplanned() < 2) {
+      _buffer_line(a, b, c, e, fr_mm_s, extruder);
+      return;
+    }
+
+    // Start a new line with this segment
+    const float inverse_length = 1.0 / length;
+    segment_dir[X_AXIS] = dx * inverse_length;
+    segment_dir[Y_AXIS] = dy * inverse_length;
+    segment_dir[Z_AXIS] = dz * inverse_length;
+    segment_e_ratio = (e - segment_position[E_AXIS]) * inverse_length;
+    COPY(segment_start, segment_position);
+    COPY(segment_end, target);
+    segment_fr_mm_s = fr_mm_s;
+    segment_extruder = extruder;
+    segment_pending = true;
+  }
+
+  void Planner::flush_merged_line() {
+    if (!segment_pending) return;
+    segment_pending = false;
+    _buffer_line(segment_end[X_AXIS], segment_end[Y_AXIS], segment_end[Z_AXIS], segment_end[E_AXIS], segment_fr_mm_s, segment_extruder);
+  }
+
+#endif // MERGE_SEGMENTS
+
 /**
  * Directly set the planner XYZ position (and stepper positions)
  * converting mm (or angles for SCARA) into steps.
@@ -1431,6 +1753,9 @@ void Planner::_buffer_line(const float &a, const float &b, const float &c, const
  */
 
 void Planner::_set_position_mm(const float &a, const float &b, const float &c, const float &e) {
+  #if ENABLED(MERGE_SEGMENTS)
+    flush_merged_line();
+  #endif
   #if ENABLED(DISTINCT_E_FACTORS)
     #define _EINDEX (E_AXIS + active_extruder)
     last_extruder = active_extruder;
@@ -1448,6 +1773,13 @@ void Planner::_set_position_mm(const float &a, const float &b, const float &c, c
     position_float[E_AXIS] = e;
   #endif
   stepper.set_position(na, nb, nc, ne);
+  #if ENABLED(MERGE_SEGMENTS)
+    segment_position[X_AXIS] = a;
+    segment_position[Y_AXIS] = b;
+    segment_position[Z_AXIS] = c;
+    segment_position[E_AXIS] = e;
+    segment_position_valid = true;
+  #endif
   previous_nominal_speed = 0.0; // Resets planner junction speeds. Assumes start from rest.
   ZERO(previous_speed);
 }
@@ -1471,6 +1803,9 @@ void Planner::set_position_mm_kinematic(const float position[NUM_AXIS]) {
  * Sync from the stepper positions. (e.g., after an interrupted move)
  */
 void Planner::sync_from_steppers() {
+  #if ENABLED(MERGE_SEGMENTS)
+    discard_merged_line(); // The move was interrupted
+  #endif
   LOOP_XYZE(i) {
     position[i] = stepper.position((AxisEnum)i);
     #if ENABLED(LIN_ADVANCE)
@@ -1487,6 +1822,11 @@ void Planner::sync_from_steppers() {
  * Setters for planner position (also setting stepper position).
  */
 void Planner::set_position_mm(const AxisEnum axis, const float &v) {
+  #if ENABLED(MERGE_SEGMENTS)
+    flush_merged_line();
+    // Only E is not leveled
+    if (axis == E_AXIS) segment_position[E_AXIS] = v; else segment_position_valid = false;
+  #endif
   #if ENABLED(DISTINCT_E_FACTORS)
     const uint8_t axis_index = axis + (axis == E_AXIS ? active_extruder : 0);
     last_extruder = active_extruder;
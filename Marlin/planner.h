@@ -111,6 +111,15 @@ typedef struct {
            final_rate,                      // The minimal rate at exit
            acceleration_steps_per_s2;       // acceleration steps/sec^2
 
+  #if ENABLED(S_CURVE_ACCELERATION)
+    // Settings for the S-curve generator (times in stepper timer ticks)
+    uint32_t cruise_rate,                   // The step rate at the end of the acceleration
+             acceleration_time,             // Duration of the acceleration
+             deceleration_time,             // Duration of the deceleration
+             acceleration_time_inverse,     // Scaled inverses of the durations (see calculate_trapezoid_for_block)
+             deceleration_time_inverse;
+  #endif
+
   #if FAN_COUNT > 0
     uint16_t fan_speed[FAN_COUNT];
   #endif
@@ -135,6 +144,7 @@ class Planner {
     static block_t block_buffer[BLOCK_BUFFER_SIZE];
     static volatile uint8_t block_buffer_head,  // Index of the next block to be pushed
                             block_buffer_tail;
+    static uint8_t block_buffer_planned;        // Index of the last optimally planned block
 
     #if ENABLED(DISTINCT_E_FACTORS)
       static uint8_t last_extruder;             // Respond to extruder change
@@ -216,6 +226,27 @@ class Planner {
       volatile static uint32_t block_buffer_runtime_us; //Theoretical block buffer runtime in µs
     #endif
 
+    #if ENABLED(MERGE_SEGMENTS)
+      /**
+       * The line being merged, not yet in the buffer
+       */
+      static float segment_start[XYZE],      // Start of the line
+                   segment_end[XYZE],        // End of the last merged segment
+                   segment_dir[XYZ],         // Unit vector of the first segment
+                   segment_e_ratio,          // E per mm of the first segment
+                   segment_fr_mm_s;
+      static uint8_t segment_extruder;
+      static bool segment_pending;
+
+      /**
+       * The end of the last line given to _buffer_line, in mm
+       */
+      static float segment_position[XYZE];
+      static bool segment_position_valid;
+
+      static bool can_merge(const float target[XYZE]);
+    #endif
+
   public:
 
     /**
@@ -243,6 +274,43 @@ class Planner {
 
     static bool is_full() { return (block_buffer_tail == BLOCK_MOD(block_buffer_head + 1)); }
 
+    #if ENABLED(PLANNER_PROFILING)
+      /**
+       * Planner profiling (M782)
+       */
+      static uint32_t nb_planned_blocks,       // Blocks added to the buffer
+                      plan_time_us,            // Time in _buffer_line, without the waits for room
+                      recalculate_time_us,     // Part of plan_time_us spent in recalculate()
+                      replanned_blocks,        // Blocks visited by recalculate()
+                      recalculated_trapezoids, // Trapezoids computed by recalculate()
+                      merged_segments,         // Segments merged into the line before them
+                      max_plan_time_us,
+                      wait_time_us;            // Time waiting for room in the buffer
+      static float planned_time_s;             // Duration of the blocks at their nominal speed
+      static millis_t profiling_start_ms;
+      static bool echo_blocks;                 // Echo each block as it is planned
+
+      /**
+       * Starvation of the buffer during a print job, in total and per layer.
+       * A layer starts with the first extrusion at a new height.
+       */
+      typedef struct {
+        float z;                               // Height of the layer
+        uint8_t min_moves_planned;             // Fewest blocks in the buffer when a block was added
+        uint16_t starved_blocks,               // Blocks added to an empty buffer
+                 underruns;                    // Blocks that ended with an empty buffer
+      } layer_stats_t;
+
+      static uint32_t starved_blocks;
+      static uint8_t min_moves_planned;
+      static layer_stats_t layer_stats,        // The current layer
+                           last_layer_stats;   // The last finished layer
+      static bool layer_stats_ready;           // last_layer_stats was not reported yet
+
+      static void reset_profiling();
+      static uint16_t get_underruns();
+    #endif
+
     #if PLANNER_LEVELING
 
       #define ARG_X float lx
@@ -278,6 +346,21 @@ class Planner {
      */
     static void _buffer_line(const float &a, const float &b, const float &c, const float &e, float fr_mm_s, const uint8_t extruder);
 
+    #if ENABLED(MERGE_SEGMENTS)
+      /**
+       * Add a linear movement, merged with the previous one when both are
+       * collinear. The merged line is kept out of the buffer until a segment
+       * can't be merged, the buffer runs low or flush_merged_line is called.
+       */
+      static void merge_line(const float &a, const float &b, const float &c, const float &e, const float &fr_mm_s, const uint8_t extruder);
+
+      /**
+       * Add the merged line to the buffer, or drop it (e.g., after a quick stop)
+       */
+      static void flush_merged_line();
+      static FORCE_INLINE void discard_merged_line() { segment_pending = segment_position_valid = false; }
+    #endif
+
     static void _set_position_mm(const float &a, const float &b, const float &c, const float &e);
 
     /**
@@ -296,7 +379,7 @@ class Planner {
       #if PLANNER_LEVELING && IS_CARTESIAN
         apply_leveling(lx, ly, lz);
       #endif
-      _buffer_line(lx, ly, lz, e, fr_mm_s, extruder);
+      plan_line(lx, ly, lz, e, fr_mm_s, extruder);
     }
 
     /**
@@ -317,9 +400,9 @@ class Planner {
       #endif
       #if IS_KINEMATIC
         inverse_kinematics(lpos);
-        _buffer_line(delta[A_AXIS], delta[B_AXIS], delta[C_AXIS], ltarget[E_AXIS], fr_mm_s, extruder);
+        plan_line(delta[A_AXIS], delta[B_AXIS], delta[C_AXIS], ltarget[E_AXIS], fr_mm_s, extruder);
       #else
-        _buffer_line(lpos[X_AXIS], lpos[Y_AXIS], lpos[Z_AXIS], ltarget[E_AXIS], fr_mm_s, extruder);
+        plan_line(lpos[X_AXIS], lpos[Y_AXIS], lpos[Z_AXIS], ltarget[E_AXIS], fr_mm_s, extruder);
       #endif
     }
 
@@ -415,6 +498,17 @@ class Planner {
 
   private:
 
+    /**
+     * Plan a line: merged with the segments before it, or added to the buffer
+     */
+    static FORCE_INLINE void plan_line(const float &a, const float &b, const float &c, const float &e, const float &fr_mm_s, const uint8_t extruder) {
+      #if ENABLED(MERGE_SEGMENTS)
+        merge_line(a, b, c, e, fr_mm_s, extruder);
+      #else
+        _buffer_line(a, b, c, e, fr_mm_s, extruder);
+      #endif
+    }
+
     /**
      * Get the index of the next / previous block in the ring buffer
      */
@@ -455,12 +549,12 @@ class Planner {
     static void calculate_trapezoid_for_block(block_t* const block, const float &entry_factor, const float &exit_factor);
 
     static void reverse_pass_kernel(block_t* const current, const block_t *next);
-    static void forward_pass_kernel(const block_t *previous, block_t* const current);
+    static bool forward_pass_kernel(const block_t *previous, block_t* const current);
 
     static void reverse_pass();
     static void forward_pass();
 
-    static void recalculate_trapezoids();
+    static void recalculate_trapezoids(const uint8_t first);
 
     static void recalculate();
 
@@ -68,6 +68,16 @@ Stepper stepper; // Singleton
 
 block_t* Stepper::current_block = NULL;  // A pointer to the block currently being traced
 
+#if ENABLED(PLANNER_PROFILING)
+  volatile uint16_t Stepper::underruns = 0;
+#endif
+
+#if ENABLED(S_CURVE_PROFILING)
+  volatile uint32_t Stepper::bezier_evals = 0,
+                    Stepper::bezier_ticks = 0;
+  volatile uint8_t Stepper::bezier_max_ticks = 0;
+#endif
+
 #if ENABLED(ABORT_ON_ENDSTOP_HIT_FEATURE_ENABLED)
   bool Stepper::abort_on_endstop_hit = false;
 #endif
@@ -137,6 +147,13 @@ volatile signed char Stepper::count_direction[NUM_AXIS] = { 1, 1, 1, 1 };
 #endif
 
 unsigned short Stepper::acc_step_rate; // needed for deceleration start point
+
+#if ENABLED(S_CURVE_ACCELERATION)
+  uint16_t Stepper::bezier_delta,
+           Stepper::bezier_rate;
+  uint32_t Stepper::bezier_inverse;
+  bool Stepper::bezier_2nd_half;
+#endif
 uint8_t Stepper::step_loops, Stepper::step_loops_nominal;
 unsigned short Stepper::OCR1A_nominal;
 
@@ -215,6 +232,11 @@ volatile long Stepper::endstops_trigsteps[XYZ];
 // C1 B1 A1 is longIn1
 // D2 C2 B2 A2 is longIn2
 //
+#ifndef __AVR__
+  // Host build (test/): the exact rounded result
+  #define MultiU24X32toH16(intRes, longIn1, longIn2) \
+    intRes = (uint16_t)(((uint64_t)((uint32_t)(longIn1) & 0xFFFFFF) * (uint32_t)(longIn2) + 0x800000) >> 24)
+#else
 #define MultiU24X32toH16(intRes, longIn1, longIn2) \
   asm volatile ( \
                  "clr r26 \n\t" \
@@ -260,6 +282,7 @@ volatile long Stepper::endstops_trigsteps[XYZ];
                  : \
                  "r26" , "r27" \
                )
+#endif
 
 // Some useful constants
 
@@ -283,6 +306,53 @@ volatile long Stepper::endstops_trigsteps[XYZ];
  *  step_events_completed reaches block->decelerate_after after which it decelerates until the trapezoid generator is reset.
  *  The slope of acceleration is calculated using v = u + at where t is the accumulated timer values of the steps so far.
  */
+
+#if ENABLED(S_CURVE_ACCELERATION)
+
+  /**
+   * With S_CURVE_ACCELERATION the speed follows a 6th order Bézier curve with
+   * its first three points at the start rate and the last three at the end
+   * rate, so the acceleration is 0 at both ends:
+   *
+   *   v(t) = v0 + (v1 - v0) * s(t)   with   s(t) = 10t³ - 15t⁴ + 6t⁵ = t³ (10 - 15t + 6t²)
+   *
+   * t is the time since the start of the ramp over its duration. Return the
+   * change of the rate since the start, (v1 - v0) * s(t), in integer math:
+   * 16-bit fractions and 16x16 bit products, within 0.04% of the exact curve
+   * plus a step/s of rounding (test/motion/bezier.cpp). The truncations can make it go back by a few
+   * steps/s, so it never returns less than the last time.
+   */
+  uint16_t Stepper::_eval_bezier_curve(const uint32_t curr_time) {
+    uint16_t t;
+    MultiU24X32toH16(t, curr_time, bezier_inverse);
+    const uint16_t t2 = ((uint32_t)t * t) >> 16,
+                   t3 = ((uint32_t)t2 * t) >> 16,
+                   p = (655360UL + 6UL * t2 - 15UL * t) >> 4; // (10 - 15t + 6t²) / 16, >= 4096
+    uint32_t s = ((uint32_t)t3 * p) >> 12;
+    NOMORE(s, 0xFFFF);
+    const uint16_t rate = ((uint32_t)bezier_delta * (uint16_t)s) >> 16;
+    NOLESS(bezier_rate, rate);
+    return bezier_rate;
+  }
+
+  #if ENABLED(S_CURVE_PROFILING)
+    // Measure the curve in timer ticks (8 cycles) for M787. Drop the samples where the timer wrapped.
+    #define BEZIER_PROFILE_START() const uint16_t bezier_start = TCNT1
+    #define BEZIER_PROFILE_END() do{ \
+      const uint16_t bezier_end = TCNT1; \
+      if (bezier_end >= bezier_start) { \
+        const uint8_t ticks = min(bezier_end - bezier_start, 255); \
+        bezier_evals++; \
+        bezier_ticks += ticks; \
+        NOLESS(bezier_max_ticks, ticks); \
+      } \
+    }while(0)
+  #else
+    #define BEZIER_PROFILE_START() NOOP
+    #define BEZIER_PROFILE_END() NOOP
+  #endif
+
+#endif // S_CURVE_ACCELERATION
 void Stepper::wake_up() {
   // TCNT1 = 0;
   ENABLE_STEPPER_DRIVER_INTERRUPT();
@@ -425,11 +495,11 @@ void Stepper::isr() {
       trapezoid_generator_reset();
 
       // Initialize Bresenham counters to 1/2 the ceiling
-      counter_X = counter_Y = counter_Z = counter_E = -(current_block->step_event_count >> 1);
+      counter_X = counter_Y = counter_Z = counter_E = -(long)(current_block->step_event_count >> 1);
 
       #if ENABLED(MIXING_EXTRUDER)
         MIXING_STEPPERS_LOOP(i)
-          counter_m[i] = -(current_block->mix_event_count[i] >> 1);
+          counter_m[i] = -(long)(current_block->mix_event_count[i] >> 1);
       #endif
 
       step_events_completed = 0;
@@ -677,11 +747,27 @@ void Stepper::isr() {
   // Calculate new timer value
   if (step_events_completed <= (uint32_t)current_block->accelerate_until) {
 
-    MultiU24X32toH16(acc_step_rate, acceleration_time, current_block->acceleration_rate);
-    acc_step_rate += current_block->initial_rate;
+    #if ENABLED(S_CURVE_ACCELERATION)
+      // Jerk limited: the rate along the curve, then the cruise rate. The ramps too short for a curve are linear.
+      if (!current_block->acceleration_time) {
+        MultiU24X32toH16(acc_step_rate, acceleration_time, current_block->acceleration_rate);
+        acc_step_rate += current_block->initial_rate;
+        NOMORE(acc_step_rate, current_block->cruise_rate);
+      }
+      else if (acceleration_time < current_block->acceleration_time) {
+        BEZIER_PROFILE_START();
+        acc_step_rate = current_block->initial_rate + _eval_bezier_curve(acceleration_time);
+        BEZIER_PROFILE_END();
+      }
+      else
+        acc_step_rate = current_block->cruise_rate;
+    #else
+      MultiU24X32toH16(acc_step_rate, acceleration_time, current_block->acceleration_rate);
+      acc_step_rate += current_block->initial_rate;
 
-    // upper limit
-    NOMORE(acc_step_rate, current_block->nominal_rate);
+      // upper limit
+      NOMORE(acc_step_rate, current_block->nominal_rate);
+    #endif
 
     // step_rate to timer interval
     const uint16_t timer = calc_timer(acc_step_rate);
@@ -707,14 +793,39 @@ void Stepper::isr() {
   }
   else if (step_events_completed > (uint32_t)current_block->decelerate_after) {
     uint16_t step_rate;
-    MultiU24X32toH16(step_rate, deceleration_time, current_block->acceleration_rate);
 
-    if (step_rate < acc_step_rate) { // Still decelerating?
-      step_rate = acc_step_rate - step_rate;
-      NOLESS(step_rate, current_block->final_rate);
-    }
-    else
-      step_rate = current_block->final_rate;
+    #if ENABLED(S_CURVE_ACCELERATION)
+      // The deceleration curve, from the cruise to the final rate
+      if (!bezier_2nd_half) {
+        _calc_bezier_curve_coeffs(current_block->cruise_rate - current_block->final_rate, current_block->deceleration_time_inverse);
+        bezier_2nd_half = true;
+      }
+      if (!current_block->deceleration_time) {
+        MultiU24X32toH16(step_rate, deceleration_time, current_block->acceleration_rate);
+        if (step_rate < current_block->cruise_rate) {
+          step_rate = current_block->cruise_rate - step_rate;
+          NOLESS(step_rate, current_block->final_rate);
+        }
+        else
+          step_rate = current_block->final_rate;
+      }
+      else if (deceleration_time < current_block->deceleration_time) {
+        BEZIER_PROFILE_START();
+        step_rate = current_block->cruise_rate - _eval_bezier_curve(deceleration_time);
+        BEZIER_PROFILE_END();
+      }
+      else
+        step_rate = current_block->final_rate;
+    #else
+      MultiU24X32toH16(step_rate, deceleration_time, current_block->acceleration_rate);
+
+      if (step_rate < acc_step_rate) { // Still decelerating?
+        step_rate = acc_step_rate - step_rate;
+        NOLESS(step_rate, current_block->final_rate);
+      }
+      else
+        step_rate = current_block->final_rate;
+    #endif
 
     // step_rate to timer interval
     const uint16_t timer = calc_timer(step_rate);
@@ -762,8 +873,15 @@ void Stepper::isr() {
 
   // If current block is finished, reset pointer
   if (all_steps_done) {
+    #if ENABLED(PLANNER_PROFILING)
+      const uint32_t final_rate = current_block->final_rate;
+    #endif
     current_block = NULL;
     planner.discard_current_block();
+    #if ENABLED(PLANNER_PROFILING)
+      // A block of a print job that ended moving, with no block to continue
+      if (!planner.blocks_queued() && final_rate && print_job_timer.isRunning()) underruns++;
+    #endif
   }
   #if DISABLED(LIN_ADVANCE)
     _ENABLE_ISRs(); // re-enable ISRs
@@ -1102,7 +1220,12 @@ void Stepper::init() {
 /**
  * Block until all buffered steps are executed
  */
-void Stepper::synchronize() { while (planner.blocks_queued()) idle(); }
+void Stepper::synchronize() {
+  #if ENABLED(MERGE_SEGMENTS)
+    planner.flush_merged_line();
+  #endif
+  while (planner.blocks_queued()) idle();
+}
 
 /**
  * Set the stepper positions directly in steps
@@ -1206,6 +1329,9 @@ void Stepper::quick_stop() {
   #else
     cleaning_buffer_counter = 5000;
   #endif
+  #if ENABLED(MERGE_SEGMENTS)
+    planner.discard_merged_line();
+  #endif
   DISABLE_STEPPER_DRIVER_INTERRUPT();
   while (planner.blocks_queued()) planner.discard_current_block();
   current_block = NULL;
@@ -56,6 +56,11 @@ extern Stepper stepper;
 // uses:
 // r26 to store 0
 // r27 to store the byte 1 of the 24 bit result
+#ifndef __AVR__
+  // Host build (test/): the same result in C
+  #define MultiU16X8toH16(intRes, charIn1, intIn2) \
+    intRes = (uint16_t)(((uint32_t)(uint8_t)(charIn1) * (uint16_t)(intIn2) + 0x80) >> 8)
+#else
 #define MultiU16X8toH16(intRes, charIn1, intIn2) \
   asm volatile ( \
                  "clr r26 \n\t" \
@@ -76,6 +81,7 @@ extern Stepper stepper;
                  : \
                  "r26" \
                )
+#endif
 
 class Stepper {
 
@@ -98,6 +104,16 @@ class Stepper {
       static uint32_t motor_current_setting[3];
     #endif
 
+    #if ENABLED(PLANNER_PROFILING)
+      static volatile uint16_t underruns;      // Blocks that ended with no other block in the buffer
+    #endif
+
+    #if ENABLED(S_CURVE_PROFILING)
+      static volatile uint32_t bezier_evals,   // S-curve evaluations in the ISR (M787)
+                               bezier_ticks;   // and their duration in timer ticks
+      static volatile uint8_t bezier_max_ticks;
+    #endif
+
   private:
 
     static uint8_t last_direction_bits;        // The next stepping-bits to be output
@@ -130,6 +146,13 @@ class Stepper {
     static long acceleration_time, deceleration_time;
     //unsigned long accelerate_until, decelerate_after, acceleration_rate, initial_rate, final_rate, nominal_rate;
     static unsigned short acc_step_rate; // needed for deceleration start point
+
+    #if ENABLED(S_CURVE_ACCELERATION)
+      static uint16_t bezier_delta;      // Change of the step rate along the curve
+      static uint32_t bezier_inverse;    // Scaled inverse of the duration of the curve
+      static uint16_t bezier_rate;       // Last value of the curve: the rounding must not make it go back
+      static bool bezier_2nd_half;       // The deceleration curve is set
+    #endif
     static uint8_t step_loops, step_loops_nominal;
     static unsigned short OCR1A_nominal;
 
@@ -302,14 +325,14 @@ class Stepper {
       NOLESS(step_rate, F_CPU / 500000);
       step_rate -= F_CPU / 500000; // Correct for minimal speed
       if (step_rate >= (8 * 256)) { // higher step rate
-        unsigned short table_address = (unsigned short)&speed_lookuptable_fast[(unsigned char)(step_rate >> 8)][0];
+        uintptr_t table_address = (uintptr_t)&speed_lookuptable_fast[(unsigned char)(step_rate >> 8)][0];
         unsigned char tmp_step_rate = (step_rate & 0x00FF);
         unsigned short gain = (unsigned short)pgm_read_word_near(table_address + 2);
         MultiU16X8toH16(timer, tmp_step_rate, gain);
         timer = (unsigned short)pgm_read_word_near(table_address) - timer;
       }
       else { // lower step rates
-        unsigned short table_address = (unsigned short)&speed_lookuptable_slow[0][0];
+        uintptr_t table_address = (uintptr_t)&speed_lookuptable_slow[0][0];
         table_address += ((step_rate) >> 1) & 0xFFFC;
         timer = (unsigned short)pgm_read_word_near(table_address);
         timer -= (((unsigned short)pgm_read_word_near(table_address + 2) * (unsigned char)(step_rate & 0x0007)) >> 3);
@@ -322,6 +345,16 @@ class Stepper {
       return timer;
     }
 
+    #if ENABLED(S_CURVE_ACCELERATION)
+      // Set the curve for a change of the step rate by delta in the time of the inverse
+      static FORCE_INLINE void _calc_bezier_curve_coeffs(const uint16_t delta, const uint32_t inverse) {
+        bezier_delta = delta;
+        bezier_inverse = inverse;
+        bezier_rate = 0;
+      }
+      static uint16_t _eval_bezier_curve(const uint32_t curr_time);
+    #endif
+
     // Initialize the trapezoid generator from the current block.
     // Called whenever a new block begins.
     static FORCE_INLINE void trapezoid_generator_reset() {
@@ -343,6 +376,12 @@ class Stepper {
       acceleration_time = calc_timer(acc_step_rate);
       _NEXT_ISR(acceleration_time);
 
+      #if ENABLED(S_CURVE_ACCELERATION)
+        // The acceleration curve, from the initial to the cruise rate
+        _calc_bezier_curve_coeffs(current_block->cruise_rate - current_block->initial_rate, current_block->acceleration_time_inverse);
+        bezier_2nd_half = false;
+      #endif
+
       #if ENABLED(LIN_ADVANCE)
         if (current_block->use_advance_lead) {
           current_estep_rate[current_block->active_extruder] = ((unsigned long)acc_step_rate * current_block->abs_adv_steps_multiplier8) >> 17;
@@ -391,7 +391,6 @@ uint8_t Temperature::soft_pwm_amount[HOTENDS],
       if (ELAPSED(ms, temp_ms + 2000UL)) {
         #if HAS_TEMP_HOTEND || HAS_TEMP_BED
           print_heaterstates();
-          advi3pp::i3PlusPrinter::update_graph_data();
           SERIAL_EOL();
         #endif
 
@@ -449,6 +448,7 @@ uint8_t Temperature::soft_pwm_amount[HOTENDS],
         return;
       }
       lcd_update();
+      advi3pp::i3PlusPrinter::update_graph_data();
     }
     if (!wait_for_heatup) disable_all_heaters();
   }
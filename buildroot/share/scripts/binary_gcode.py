@@ -0,0 +1,106 @@
+#!/usr/bin/env python
+"""Reference encoder for the binary G-code frames of Marlin (BINARY_GCODE).
+
+Convert a G-code file into the byte stream a host would send after M784 S1.
+Lines that can't be encoded (strings, comments only...) are sent as ASCII
+lines with a line number and checksum, so both formats share the numbering.
+
+Frame:     B5 | length | line (2) | payload (length bytes) | CRC-16 XMODEM (2)
+Payload:   letter (G, M or T) | code (2) | parameters
+Parameter: type << 5 | letter - 'A', followed by the value
+
+Types:  0 no value
+        1, 2, 3 int32 with 0, 3 or 5 decimals
+        4, 5, 6 int16 with 0, 3 or 5 decimals
+
+All multi-byte fields are little-endian. The CRC covers length, line and payload.
+
+Usage: binary_gcode.py input.gcode output.bin [first line number]
+"""
+
+from __future__ import print_function
+import re
+import struct
+import sys
+
+SYNC = 0xB5
+MAX_PAYLOAD = 95  # MAX_CMD_SIZE - 1
+STRING_CODES = {('M', 23), ('M', 28), ('M', 30), ('M', 32), ('M', 117), ('M', 118), ('M', 928)}
+WORD = re.compile(r'([A-Z])\s*([-+]?[0-9]*\.?[0-9]*)')
+
+def crc16(data, crc=0):
+    for b in bytearray(data):
+        crc ^= b << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) if crc & 0x8000 else (crc << 1)
+            crc &= 0xFFFF
+    return crc
+
+def encode_value(letter, text):
+    """Smallest exact encoding of a value, or None"""
+    index = ord(letter) - ord('A')
+    if text in ('', '+', '-'):
+        return struct.pack('<B', index)
+    sign, digits = (-1, text[1:]) if text[0] == '-' else (1, text.lstrip('+'))
+    whole, _, fraction = digits.partition('.')
+    fraction = fraction.rstrip('0')
+    for decimals, offset in ((0, 0), (3, 1), (5, 2)):
+        if len(fraction) <= decimals:
+            value = sign * int((whole or '0') + fraction.ljust(decimals, '0'))
+            if -32768 <= value <= 32767:
+                return struct.pack('<Bh', (4 + offset) << 5 | index, value)
+            if -2**31 <= value < 2**31:
+                return struct.pack('<Bi', (1 + offset) << 5 | index, value)
+            return None
+    return None
+
+def encode_payload(line):
+    """Binary payload of a G-code line, or None if it must be sent as ASCII"""
+    words = WORD.findall(line.upper())
+    if not words or ''.join(l + v for l, v in words) != re.sub(r'\s', '', line.upper()):
+        return None
+    (letter, code), params = words[0], words[1:]
+    if letter not in 'GMT' or not code.isdigit() or (letter, int(code)) in STRING_CODES:
+        return None
+    payload = struct.pack('<cH', letter.encode(), int(code))
+    for l, v in params:
+        value = encode_value(l, v)
+        if value is None:
+            return None
+        payload += value
+    return payload if len(payload) <= MAX_PAYLOAD else None
+
+def encode_line(line, number):
+    """Bytes to send for a line: a binary frame or an ASCII line"""
+    payload = encode_payload(line)
+    if payload is None:
+        text = 'N%d %s' % (number, line)
+        checksum = 0
+        for c in bytearray(text.encode()):
+            checksum ^= c
+        return ('%s*%d\n' % (text, checksum)).encode()
+    header = struct.pack('<BH', len(payload), number & 0xFFFF)
+    return struct.pack('<B', SYNC) + header + payload + struct.pack('<H', crc16(header + payload))
+
+def main(argv):
+    if len(argv) < 3:
+        print(__doc__)
+        return 1
+    number = int(argv[3]) if len(argv) > 3 else 1
+    count = ascii_size = binary_size = 0
+    with open(argv[1]) as source, open(argv[2], 'wb') as output:
+        for line in source:
+            line = line.split(';')[0].strip()
+            if not line:
+                continue
+            data = encode_line(line, number)
+            output.write(data)
+            ascii_size += len('N%d %s*000\n' % (number, line))
+            binary_size += len(data)
+            number += 1
+            count += 1
+    print('%d lines, %d bytes instead of about %d in ASCII' % (count, binary_size, ascii_size))
+    return 0
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv))
@@ -0,0 +1,333 @@
+/**
+ * Throughput benchmark of the command queue and of the parser.
+ *
+ * Each G-code file (corpus) goes through the stages of the firmware:
+ *
+ *  - read: get_serial_commands() on the bytes of the file, with its
+ *    comments and empty lines, without the time of _enqueuecommand();
+ *  - enqueue: _enqueuecommand() of the lines, as the serial reader queues them;
+ *  - parse: GCodeParser::parse() of the lines;
+ *  - values: seenval() and value_float() of the parameters read by the
+ *    handlers of the commands (X, Y, Z, E, F, I, J, R, S, P).
+ *
+ * The serial reader reads the file from memory (HardwareSerial::read() is
+ * wrapped) and the queue is emptied when it is full. Each stage is run a
+ * number of passes over the whole corpus and the fastest pass is kept. The
+ * report gives the time per line of each stage, the lines and bytes per
+ * second of all the stages and, on the G0/G1 lines alone, the cycles of
+ * the host (TSC) per G1.
+ *
+ * The results can be written to a file (-o) and compared with a previous
+ * one (-b): the exit status is not 0 if a stage of a corpus is slower than
+ * in the baseline by more than a tolerance (-t, in %). The host does not
+ * always run at the same speed (frequency scaling, other processes), so a
+ * reference loop (a digest of the bytes) is timed with the stages and the
+ * times are compared relative to it.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <x86intrin.h>
+#include <chrono>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <string>
+#include <vector>
+
+// The command queue and the serial reader are private to Marlin_main.cpp
+#include "../../Marlin/Marlin_main.cpp"
+
+typedef std::chrono::steady_clock Clock;
+
+namespace
+{
+    const unsigned PASSES = 100;
+    const double TOLERANCE = 10;            //!< Slowdown of a stage reported as a regression (%)
+    const char PARAMETERS[] = "XYZEFIJRSP"; //!< Read by the handlers of G0-G3, G92, M104, M106...
+
+    //! The stages of the firmware, and a reference loop that does not depend on the firmware.
+    enum Stage { READ, ENQUEUE, PARSE, VALUES, NB_STAGES, REFERENCE = NB_STAGES };
+    const char* const STAGE_NAMES[NB_STAGES + 1] = {"read", "enqueue", "parse", "values", "reference"};
+
+    //! Bytes read by the serial reader of the firmware.
+    const char* input = nullptr;
+    const char* input_end = nullptr;
+    volatile float sink;
+    volatile uint32_t digest;
+
+    //! Lines of a corpus: the bytes of the file and the commands queued by the serial reader.
+    struct Lines
+    {
+        std::string data;
+        std::vector<char*> commands;
+        std::vector<char> buffer;           //!< The commands, separated by '\0'
+
+        void add(const std::string& line, const char* command)
+        {
+            data += line;
+            data += '\n';
+            buffer.insert(buffer.end(), command, command + strlen(command) + 1);
+        }
+
+        //! Pointers to the commands, once the buffer is complete.
+        void index()
+        {
+            for(size_t offset = 0; offset < buffer.size(); offset += strlen(&buffer[offset]) + 1)
+                commands.push_back(&buffer[offset]);
+        }
+    };
+
+    //! Time of a pass over the lines, in ns and in cycles.
+    struct PassTime
+    {
+        double ns;
+        double cycles;
+    };
+
+    void read_bytes(const std::string& data)
+    {
+        input = data.data();
+        input_end = input + data.size();
+    }
+
+    //! The commands queued by the serial reader for some bytes.
+    std::vector<std::string> queued_commands(const std::string& data)
+    {
+        std::vector<std::string> commands;
+        read_bytes(data);
+        while(input < input_end)
+        {
+            get_serial_commands();
+            for(; commands_in_queue; _advance_command_queue())
+                commands.push_back(&command_queue[cmd_queue_index_r + 1]);
+        }
+        return commands;
+    }
+
+    void reader_pass(const Lines& lines)
+    {
+        read_bytes(lines.data);
+        while(input < input_end)
+        {
+            get_serial_commands();
+            clear_command_queue();
+        }
+    }
+
+    void enqueue_pass(const Lines& lines)
+    {
+        for(auto command: lines.commands)
+            if(!_enqueuecommand(command, true))
+            {
+                clear_command_queue();
+                _enqueuecommand(command, true);
+            }
+        clear_command_queue();
+    }
+
+    void parse_pass(const Lines& lines)
+    {
+        for(auto command: lines.commands)
+            parser.parse(command);
+    }
+
+    void values_pass(const Lines& lines)
+    {
+        for(auto command: lines.commands)
+        {
+            parser.parse(command);
+            for(const char* parameter = PARAMETERS; *parameter; ++parameter)
+                if(parser.seenval(*parameter))
+                    sink = parser.value_float();
+        }
+    }
+
+    //! A FNV-1a digest of the bytes: the speed of the host, to compare with a baseline taken on a busier or
+    //! slower host.
+    void reference_pass(const Lines& lines)
+    {
+        uint32_t hash = 2166136261u;
+        for(char byte: lines.data)
+            hash = (hash ^ static_cast<uint8_t>(byte)) * 16777619u;
+        digest = hash;
+    }
+
+    //! Time of each stage for the lines, per line. The passes of the stages alternate, so a change of the
+    //! speed of the host affects all of them, and the fastest pass of each one is kept.
+    void run_stages(const Lines& lines, unsigned passes, double ns[NB_STAGES + 1], double cycles[NB_STAGES + 1])
+    {
+        void (* const stages[])(const Lines&) = {reader_pass, enqueue_pass, parse_pass, values_pass, reference_pass};
+        const size_t nb_passes = sizeof(stages) / sizeof(stages[0]);
+        PassTime best[nb_passes];
+        for(auto& time: best)
+            time = PassTime{1e30, 1e30};
+
+        for(unsigned index = 0; index < passes; ++index)
+            for(size_t stage = 0; stage < nb_passes; ++stage)
+            {
+                const Clock::time_point start = Clock::now();
+                const uint64_t start_cycles = __rdtsc();
+                stages[stage](lines);
+                const double pass_cycles = static_cast<double>(__rdtsc() - start_cycles);
+                const double pass_ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+                if(pass_ns < best[stage].ns) best[stage].ns = pass_ns;
+                if(pass_cycles < best[stage].cycles) best[stage].cycles = pass_cycles;
+            }
+
+        // The reader queues the commands, the values are read after a parse
+        const PassTime times[NB_STAGES + 1] = {
+            {best[0].ns - best[1].ns, best[0].cycles - best[1].cycles},
+            best[1],
+            best[2],
+            {best[3].ns - best[2].ns, best[3].cycles - best[2].cycles},
+            best[4]
+        };
+        const double nb_lines = lines.commands.empty() ? 1 : lines.commands.size();
+        for(int stage = 0; stage <= NB_STAGES; ++stage)
+        {
+            ns[stage] = times[stage].ns > 0 ? times[stage].ns / nb_lines : 0;
+            cycles[stage] = times[stage].cycles > 0 ? times[stage].cycles / nb_lines : 0;
+        }
+    }
+
+    //! Results of a previous run: ns per line by "corpus stage".
+    std::map<std::string, double> read_results(const char* path)
+    {
+        std::map<std::string, double> results;
+        std::ifstream file{path};
+        std::string corpus, stage;
+        double ns, cycles;
+        while(file >> corpus)
+        {
+            if(corpus[0] == '#')
+            {
+                std::getline(file, corpus);
+                continue;
+            }
+            if(file >> stage >> ns >> cycles)
+                results[corpus + " " + stage] = ns;
+        }
+        return results;
+    }
+
+    const char* base_name(const char* path)
+    {
+        const char* slash = strrchr(path, '/');
+        return slash != nullptr ? slash + 1 : path;
+    }
+}
+
+// Linked with --wrap: the serial port of the host reads the corpus from memory
+extern "C" int __real__ZN14HardwareSerial4readEv(HardwareSerial* serial);
+extern "C" int __wrap__ZN14HardwareSerial4readEv(HardwareSerial* serial)
+{
+    if(serial != &MYSERIAL)
+        return __real__ZN14HardwareSerial4readEv(serial);
+    return input < input_end ? static_cast<uint8_t>(*input++) : -1;
+}
+
+int main(int argc, char* argv[])
+{
+    unsigned passes = PASSES;
+    double tolerance = TOLERANCE;
+    const char* baseline_path = nullptr;
+    FILE* results_file = nullptr;
+    int option;
+    while((option = getopt(argc, argv, "p:b:o:t:")) != -1)
+    {
+        switch(option)
+        {
+            case 'p': passes = static_cast<unsigned>(atoi(optarg)); break;
+            case 'b': baseline_path = optarg; break;
+            case 'o': results_file = fopen(optarg, "w"); break;
+            case 't': tolerance = atof(optarg); break;
+            default: break;
+        }
+    }
+    if(optind >= argc || passes < 1)
+    {
+        printf("Usage: %s [-p passes] [-b baseline.txt] [-t tolerance (%%)] [-o results.txt] corpus.gcode...\n", argv[0]);
+        return 2;
+    }
+
+    const auto baseline = baseline_path != nullptr ? read_results(baseline_path) : std::map<std::string, double>{};
+    if(results_file != nullptr)
+        fprintf(results_file, "# corpus stage ns/line cycles/G1\n");
+
+    unsigned nb_regressions = 0;
+    for(int index = optind; index < argc; ++index)
+    {
+        std::ifstream file{argv[index]};
+        if(!file)
+        {
+            printf("%s: cannot be read\n", argv[index]);
+            return 2;
+        }
+
+        // The lines of the file with the commands queued for each of them, all of them and the G0/G1 alone
+        Lines all, g1;
+        std::string line;
+        while(std::getline(file, line))
+        {
+            const auto commands = queued_commands(line + "\n");
+            const char* command = commands.empty() ? nullptr : commands[0].c_str();
+            if(command != nullptr)
+                all.add(line, command);
+            if(command != nullptr && command[0] == 'G' && (command[1] == '0' || command[1] == '1') && command[2] == ' ')
+                g1.add(line, command);
+        }
+        all.index();
+        g1.index();
+
+        double ns[NB_STAGES + 1], cycles[NB_STAGES + 1], g1_ns[NB_STAGES + 1], g1_cycles[NB_STAGES + 1];
+        run_stages(all, passes, ns, cycles);
+        run_stages(g1, passes, g1_ns, g1_cycles);
+
+        const char* name = base_name(argv[index]);
+        printf("%s: %zu lines (%zu G0/G1), %zu bytes\n", argv[index], all.commands.size(), g1.commands.size(), all.data.size());
+        double total_ns = 0, total_cycles = 0;
+        std::string comparison;
+        // The stages are compared with the baseline relative to the reference loop, not to the speed of the host
+        const auto base_reference = baseline.find(std::string{name} + " " + STAGE_NAMES[REFERENCE]);
+        const double host_speed = base_reference != baseline.end() && ns[REFERENCE] > 0 ? base_reference->second / ns[REFERENCE] : 0;
+        if(results_file != nullptr)
+            fprintf(results_file, "%s %s %.2f %.0f\n", name, STAGE_NAMES[REFERENCE], ns[REFERENCE], g1_cycles[REFERENCE]);
+        for(int stage = 0; stage < NB_STAGES; ++stage)
+        {
+            total_ns += ns[stage];
+            total_cycles += g1_cycles[stage];
+            printf("    %-8s %8.1f ns/line %8.0f cycles/G1\n", STAGE_NAMES[stage], ns[stage], g1_cycles[stage]);
+            if(results_file != nullptr)
+                fprintf(results_file, "%s %s %.1f %.0f\n", name, STAGE_NAMES[stage], ns[stage], g1_cycles[stage]);
+
+            const auto base = baseline.find(std::string{name} + " " + STAGE_NAMES[stage]);
+            if(host_speed <= 0 || base == baseline.end() || base->second <= 0)
+                continue;
+            const double change = (ns[stage] * host_speed / base->second - 1) * 100;
+            char text[64];
+            snprintf(text, sizeof(text), "%s%s %+.1f%%", comparison.empty() ? "" : ", ", STAGE_NAMES[stage], change);
+            comparison += text;
+            if(change > tolerance)
+            {
+                comparison += " (REGRESSION)";
+                ++nb_regressions;
+            }
+        }
+        const double bytes_per_line = all.commands.empty() ? 0 : static_cast<double>(all.data.size()) / all.commands.size();
+        printf("    %-8s %8.1f ns/line %8.0f cycles/G1, %.2f M lines/s, %.1f MB/s\n", "total", total_ns, total_cycles,
+               total_ns > 0 ? 1e3 / total_ns : 0.0, total_ns > 0 ? bytes_per_line * 1e3 / total_ns : 0.0);
+        if(!comparison.empty())
+            printf("    vs baseline: %s (host %+.1f%%)\n", comparison.c_str(), (1 / host_speed - 1) * 100);
+    }
+
+    if(results_file != nullptr)
+        fclose(results_file);
+    if(baseline_path != nullptr)
+        printf("%u regressions (tolerance %.0f%%)\n", nb_regressions, tolerance);
+
+    // As on the printer, the objects of the firmware are never destroyed (some are cleared with memset)
+    fflush(stdout);
+    _Exit(nb_regressions == 0 ? 0 : 1);
+}
@@ -0,0 +1,42 @@
+; Sample of the commands a slicer sends, for the binary G-code loopback test
+M117 Heating...
+M140 S60
+M104 S200 T0
+M190 S60
+M109 S200
+G21 ; millimeters
+G90
+M82
+M107
+G28 ; home all axes
+G28 X Y
+G29.1
+G1 Z15.0 F6000
+G92 E0
+G1 F140 E6
+G92 E0
+
+G1 F1800
+G1 X73.515 Y68.264 Z0.3 F7800
+G1 X74.308 Y67.472 E0.03726
+G1 X75.12 Y66.863 E0.05305
+G1 X-12.5 Y+3.25 E-1.5
+G1 X123456.7 Y0.00001 E0.12345
+G1 X30000 Y32767 Z-32768 E40000
+G1 X0.5 Y.5 Z5. E-.25
+G2 X10 Y10 I5 J0 E1.2
+G3 X0 Y0 I-5 J-5 E2.4
+G4 P250
+M106 S255
+M106 S127.5
+M220 S100
+M221 S95
+T1
+T0
+M400
+M118 Layer 2
+M23 part.gcode
+M32 P !part.gcode#
+M104 S0
+M140 S0
+M84
@@ -0,0 +1,259 @@
+/**
+ * Loopback test of the binary G-code frames (BINARY_GCODE).
+ *
+ * A G-code file is encoded with buildroot/share/scripts/binary_gcode.py and
+ * sent to the firmware over the emulated serial port, after M784 S1, like a
+ * host would do: one line at a time, waiting for its "ok". Each command
+ * queued by the firmware is parsed like process_next_command() does and
+ * compared with the parse of the ASCII line. Then a frame of M117 is sent:
+ * commands with a string argument have no binary form and must be rejected
+ * with an error and an "ok", without breaking the line numbering.
+ *
+ * The exit status is not 0 if a check failed.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "../hal/host_port.h"
+
+// The command queue is private to Marlin_main.cpp
+#include "../../Marlin/Marlin_main.cpp"
+
+#if DISABLED(BINARY_GCODE)
+  #error "The loopback test requires BINARY_GCODE"
+#endif
+
+using host::Time;
+using host::MS;
+using host::US;
+using host::SECOND;
+
+namespace
+{
+    const Time LINE_TIMEOUT = 1 * SECOND;
+
+    host::HostPort host_port{0, BAUDRATE};
+    unsigned nb_failures = 0;
+
+    //! A parsed command, as seen by the handlers.
+    struct Command
+    {
+        char letter;
+        int code;
+        bool seen[26];
+        bool has_value[26];
+        float value_float[26];
+        int32_t value_long[26];
+        std::string string_arg;
+
+        Command()
+        {
+            letter = parser.command_letter;
+            code = parser.codenum;
+            for(int index = 0; index < 26; ++index)
+            {
+                seen[index] = parser.seen('A' + index);
+                has_value[index] = seen[index] && parser.has_value();
+                value_float[index] = has_value[index] ? parser.value_float() : 0;
+                value_long[index] = has_value[index] ? parser.value_long() : 0;
+            }
+            // The checksum of ASCII lines is still in the queue
+            if(parser.string_arg != nullptr)
+                string_arg.assign(parser.string_arg, strcspn(parser.string_arg, "*"));
+        }
+    };
+
+    void check(bool condition, const std::string& description)
+    {
+        if(condition)
+            return;
+        if(++nb_failures <= 20)
+            printf("    FAILED: %s\n", description.c_str());
+    }
+
+    void compare(const Command& command, bool binary, const std::string& line)
+    {
+        char text[MAX_CMD_SIZE];
+        snprintf(text, sizeof(text), "%s", line.c_str());
+        parser.parse(text);
+        const Command expected;
+
+        check(command.letter == expected.letter && command.code == expected.code, line + ": command");
+        // The text parser also keeps the rest of the line after a parameter without value or a '.'
+        check(binary ? command.string_arg.empty() : command.string_arg == expected.string_arg, line + ": string argument");
+        for(int index = 0; index < 26; ++index)
+        {
+            const std::string parameter = line + ": parameter " + static_cast<char>('A' + index);
+            check(command.seen[index] == expected.seen[index], parameter + " seen");
+            check(command.has_value[index] == expected.has_value[index], parameter + " has a value");
+            check(command.value_float[index] == expected.value_float[index], parameter + " value_float");
+            check(command.value_long[index] == expected.value_long[index], parameter + " value_long");
+        }
+    }
+
+    unsigned count_lines(const char* prefix)
+    {
+        unsigned count = 0;
+        for(auto& line: host_port.lines())
+            if(line.compare(0, strlen(prefix), prefix) == 0)
+                ++count;
+        return count;
+    }
+
+    /**
+     * Run the main loop of the firmware until the next "ok". Queued commands are executed if
+     * 'expected' is null, else parsed and compared with the parse of the next expected lines.
+     */
+    bool run_until_ok(const std::vector<std::string>* expected = nullptr, size_t* next = nullptr)
+    {
+        const unsigned nb_ok = count_lines("ok");
+        const Time end = host::now() + LINE_TIMEOUT;
+        while(count_lines("ok") == nb_ok)
+        {
+            if(host::now() >= end)
+                return false;
+
+            if(cmd_queue_has_room()) get_available_commands();
+            if(commands_in_queue)
+            {
+                if(expected == nullptr)
+                    process_next_command();
+                else
+                {
+                    // As process_next_command() does
+                    char * const current_command = &command_queue[cmd_queue_index_r + 1];
+                    const bool binary = command_queue[cmd_queue_index_r] & CMD_QUEUE_BINARY;
+                    if(binary)
+                        parser.parse_binary(current_command + 1, (uint8_t)current_command[0]);
+                    else
+                        parser.parse(current_command);
+                    const Command command;
+
+                    if(*next < expected->size())
+                        compare(command, binary, (*expected)[(*next)++]);
+                    else
+                        check(false, "unexpected command");
+                    ok_to_send();
+                }
+                _advance_command_queue();
+            }
+            host::advance(100 * US);
+        }
+        return true;
+    }
+
+    //! Lines of the G-code file, as binary_gcode.py reads them.
+    std::vector<std::string> read_lines(const char* path)
+    {
+        std::vector<std::string> lines;
+        std::ifstream file{path};
+        std::string line;
+        while(std::getline(file, line))
+        {
+            line = line.substr(0, line.find(';'));
+            const size_t start = line.find_first_not_of(" \t\r");
+            if(start == std::string::npos)
+                continue;
+            lines.push_back(line.substr(start, line.find_last_not_of(" \t\r") + 1 - start));
+        }
+        return lines;
+    }
+
+    //! Split the output of binary_gcode.py into lines: binary frames and ASCII lines.
+    std::vector<std::string> read_units(const char* path)
+    {
+        std::ifstream file{path, std::ios::binary};
+        const std::string data{std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+
+        std::vector<std::string> units;
+        for(size_t index = 0; index < data.size();)
+        {
+            const size_t size = static_cast<uint8_t>(data[index]) == 0xB5 && index + 1 < data.size()
+                                ? 6 + static_cast<uint8_t>(data[index + 1])
+                                : data.find('\n', index) + 1 - index;
+            units.push_back(data.substr(index, size));
+            index += size;
+        }
+        return units;
+    }
+
+    //! A binary frame, with its CRC.
+    std::string frame(uint16_t line, const std::string& payload)
+    {
+        std::string header;
+        header += static_cast<char>(payload.size());
+        header += static_cast<char>(line & 0xFF);
+        header += static_cast<char>(line >> 8);
+        uint16_t crc = 0;
+        crc16(&crc, header.data(), header.size());
+        crc16(&crc, payload.data(), payload.size());
+        return '\xB5' + header + payload + static_cast<char>(crc & 0xFF) + static_cast<char>(crc >> 8);
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    if(argc < 3)
+    {
+        printf("Usage: %s file.gcode file.bin\n", argv[0]);
+        return 2;
+    }
+
+    const auto lines = read_lines(argv[1]);
+    const auto units = read_units(argv[2]);
+    if(lines.empty() || lines.size() != units.size())
+    {
+        printf("    FAILED: %zu lines in %s, %zu in %s\n", lines.size(), argv[1], units.size(), argv[2]);
+        return 1;
+    }
+
+    setup();
+    host::advance(10 * MS);
+    host_port.clear_lines();
+
+    host_port.send("M110 N0\nM784 S1\n");
+    check(run_until_ok() && run_until_ok(), "binary frames enabled");
+
+    // The file, one line at a time
+    unsigned nb_binary = 0;
+    size_t next = 0;
+    for(size_t index = 0; index < units.size(); ++index)
+    {
+        nb_binary += static_cast<uint8_t>(units[index][0]) == 0xB5;
+        host_port.send(units[index]);
+        check(run_until_ok(&lines, &next), lines[index] + ": ok");
+    }
+    check(next == lines.size(), "all lines queued");
+
+    // A frame of M117 is rejected, the next line number is still expected
+    const uint16_t line_number = static_cast<uint16_t>(lines.size() + 1);
+    host_port.send(frame(line_number, std::string{"M\x75\x00", 3}));
+    check(run_until_ok(), "M117 frame answered");
+    check(count_lines("Error:" MSG_ERR_BINARY_STRING "M117") == 1, "M117 frame rejected");
+
+    const std::vector<std::string> last{"G1 X1"};
+    size_t last_next = 0;
+    host_port.send(frame(line_number + 1, std::string{"G\x01\x00\x97\x01\x00", 6}));
+    check(run_until_ok(&last, &last_next) && last_next == 1, "next line accepted");
+
+    const unsigned expected_ok = 2 + lines.size() + 2;
+    check(count_lines("ok") == expected_ok, "one ok per line");
+    check(count_lines("Resend") == 0, "no resend");
+    check(count_lines("Error") == 1, "only the M117 frame rejected");
+
+    printf("%zu lines, %u binary frames, %u ok, %s\n", lines.size(), nb_binary, count_lines("ok"),
+           nb_failures == 0 ? "OK" : "FAILED");
+    if(nb_failures > 0)
+        for(auto& line: host_port.lines())
+            if(line.compare(0, 2, "ok") != 0)
+                printf("    < %s\n", line.c_str());
+
+    // As on the printer, the objects of the firmware are never destroyed (some are cleared with memset)
+    fflush(stdout);
+    _Exit(nb_failures == 0 ? 0 : 1);
+}
@@ -0,0 +1,321 @@
+; Postprocessed by [ArcWelder](https://github.com/FormerLurker/ArcWelderLib)
+; Copyright(C) 2020 - Brad Hochgesang
+; resolution=0.05mm
+; path_tolerance=5%
+; max_radius=9999.00mm
+;FLAVOR:Marlin
+;TIME:1802
+;Generated with Cura_SteamEngine 4.8.0
+M140 S60
+M190 S60
+M104 S210
+M109 S210
+M82 ;absolute extrusion mode
+G28 ;Home
+G92 E0
+G1 F200 E3
+G92 E0
+;LAYER_COUNT:10
+;LAYER:0
+G0 F7200 X120.000 Y100.000 Z0.3
+;TYPE:WALL-OUTER
+G3 F1800 X120.024 Y107.687 I-8.741 J3.871 E0.29612
+G3 X112.513 Y113.898 I-13.261 J-8.390 E0.66694
+G2 X106.180 Y119.021 I22.448 J34.223 E0.97238
+G3 X93.820 Y119.021 I-6.180 J-6.465 E1.48040
+G2 X87.487 Y113.898 I-28.781 J29.099 E1.78584
+G3 X79.552 Y106.644 I5.121 J-13.568 E2.19877
+G3 X80.415 Y98.974 I10.044 J-2.754 E2.49421
+G2 X83.820 Y88.244 I-29.312 J-15.206 E2.91715
+G3 X87.363 Y82.606 I9.645 J2.129 E3.17115
+G3 X100.000 Y81.500 I7.928 J17.835 E3.65734
+G3 X110.650 Y81.554 I5.172 J29.922 E4.05918
+G3 X116.448 Y89.319 I-3.589 J8.727 E4.43897
+G2 X119.585 Y98.974 I28.982 J-4.080 E4.82048
+G1 X120.000 Y100.000 E4.86191
+G0 F7200 X119.550 Y100.000 Z0.3
+;TYPE:WALL-INNER
+G3 F1800 X119.860 Y106.949 I-8.509 J3.861 E5.12843
+G3 X114.036 Y112.544 I-10.208 J-4.798 E5.43702
+G2 X105.482 Y119.027 I16.774 J31.017 E5.84029
+G3 X95.505 Y119.694 I-5.435 J-6.353 E6.24046
+G2 X85.964 Y112.544 I-39.711 J43.045 E6.68829
+G3 X79.624 Y103.462 I3.224 J-9.004 E7.12978
+G3 X83.443 Y92.026 I159.690 J46.975 E7.58302
+G3 X86.098 Y84.444 I17.759 J1.963 E7.88679
+G3 X92.299 Y81.408 I6.361 J5.141 E8.15316
+G2 X105.343 Y81.456 I6.680 J-43.321 E8.64324
+G3 X112.180 Y82.834 I1.524 J10.085 E8.90948
+G3 X117.365 Y94.997 I-15.395 J13.750 E9.41700
+G2 X119.550 Y100.000 I116.701 J-47.994 E9.62132
+G0 F7200 X119.100 Y100.000 Z0.3
+;TYPE:WALL-INNER
+G3 F1800 X118.681 Y108.229 I-7.791 J3.729 E9.94282
+G3 X107.823 Y116.422 I-166.897 J-209.918 E10.45567
+G3 X94.873 Y118.764 I-7.591 J-4.998 E11.00355
+G2 X88.877 Y113.708 I-95.528 J107.189 E11.29742
+G3 X80.055 Y103.585 I3.053 J-11.566 E11.83327
+G3 X82.786 Y95.840 I21.074 J3.077 E12.14254
+G2 X84.677 Y88.302 I-38.987 J-13.791 E12.43385
+G3 X91.394 Y81.935 I7.921 J1.629 E12.80165
+G3 X99.478 Y82.391 I2.024 J35.971 E13.10549
+G3 X112.009 Y83.263 I4.722 J22.611 E13.58616
+G3 X116.529 Y93.860 I-11.482 J11.159 E14.02907
+G2 X119.100 Y100.000 I47.696 J-16.367 E14.27842
+;TYPE:FILL
+G0 F7200 X83.173 Y92.786
+G1 F2400 X92.786 Y83.173 E14.78709
+G0 F7200 X98.298 Y81.903
+G1 F2400 X81.903 Y98.298 E15.65469
+G0 F7200 X82.058 Y102.386
+G1 F2400 X102.386 Y82.058 E16.73041
+G0 F7200 X105.785 Y82.902
+G1 F2400 X82.902 Y105.785 E17.94130
+G0 F7200 X84.223 Y108.706
+G1 F2400 X108.706 Y84.223 E19.23682
+G0 F7200 X111.237 Y85.935
+G1 F2400 X85.935 Y111.237 E20.57574
+G0 F7200 X87.998 Y113.416
+G1 F2400 X113.416 Y87.998 E21.92075
+G0 F7200 X115.247 Y90.410
+G1 F2400 X90.410 Y115.247 E23.23504
+G0 F7200 X93.194 Y116.705
+G1 F2400 X116.705 Y93.194 E24.47914
+G0 F7200 X117.723 Y96.419
+G1 F2400 X96.419 Y117.723 E25.60649
+G0 F7200 X100.239 Y118.146
+G1 F2400 X118.146 Y100.239 E26.55409
+G0 F7200 X117.527 Y105.100
+G1 F2400 X105.100 Y117.527 E27.21167
+;LAYER:1
+G0 F7200 X120.616 Y102.068 Z0.5
+;TYPE:WALL-OUTER
+G3 F1800 X115.326 Y112.291 I-8.818 J1.917 E27.67661
+G2 X107.102 Y118.244 I12.804 J26.347 E28.05813
+G3 X97.872 Y121.210 I-7.240 J-6.685 E28.43779
+G3 X89.196 Y115.018 I12.139 J-26.182 E28.84018
+G3 X79.584 Y106.740 I7.667 J-18.622 E29.32584
+G3 X82.378 Y94.366 I18.802 J-2.257 E29.81256
+G3 X85.686 Y84.253 I31.686 J4.765 E30.21384
+G3 X91.458 Y81.056 I6.558 J5.033 E30.46754
+G2 X103.907 Y81.182 I6.942 J-71.096 E30.93498
+G3 X115.377 Y86.022 I2.862 J9.228 E31.43992
+G3 X117.568 Y94.200 I-65.451 J21.916 E31.75732
+G3 X120.616 Y102.068 I-84.364 J37.203 E32.07358
+G0 F7200 X120.168 Y102.024 Z0.5
+;TYPE:WALL-INNER
+G3 F1800 X118.054 Y109.692 I-7.802 J1.975 E32.38447
+G2 X107.442 Y117.365 I40.954 J67.816 E32.87652
+G3 X95.728 Y119.827 I-7.314 J-5.699 E33.36319
+G2 X85.192 Y112.107 I-35.505 J37.410 E33.85391
+G3 X79.994 Y101.369 I3.363 J-8.255 E34.34188
+G2 X83.396 Y92.252 I-75.690 J-33.438 E34.70685
+G3 X88.615 Y82.362 I12.215 J0.123 E35.14227
+G3 X101.820 Y81.857 I8.102 J38.983 E35.64303
+G3 X112.910 Y83.399 I3.880 J12.751 E36.07648
+G3 X116.512 Y91.799 I-10.058 J9.284 E36.42546
+G2 X120.168 Y102.024 I78.785 J-22.404 E36.83299
+G0 F7200 X119.720 Y101.979 Z0.5
+;TYPE:WALL-INNER
+G3 F1800 X116.373 Y110.592 I-7.703 J1.964 E37.20096
+G3 X110.526 Y114.109 I-170.323 J-276.567 E37.45648
+G3 X99.772 Y120.596 I-15.277 J-13.169 E37.93904
+G3 X92.436 Y116.668 I1.109 J-10.884 E38.25794
+G2 X87.306 Y112.789 I-14.342 J13.637 E38.49956
+G3 X80.044 Y103.970 I2.994 J-9.865 E38.95289
+G3 X82.655 Y96.148 I18.379 J1.787 E39.26407
+G2 X84.300 Y89.843 I-23.812 J-9.581 E39.50852
+G3 X93.472 Y81.809 I8.581 J0.544 E40.01362
+G2 X104.573 Y81.956 I5.962 J-30.917 E40.43107
+G3 X112.667 Y83.783 I2.025 J9.872 E40.75156
+G3 X117.090 Y95.533 I-20.158 J14.295 E41.22914
+G3 X119.720 Y101.979 I-38.866 J19.621 E41.49009
+;TYPE:FILL
+G0 F7200 X107.824 Y83.429
+G1 F2400 X116.571 Y92.176 E41.95294
+G0 F7200 X117.972 Y97.112
+G1 F2400 X102.888 Y82.028 E42.75116
+G0 F7200 X99.213 Y81.889
+G1 F2400 X118.111 Y100.787 E43.75119
+G0 F7200 X117.658 Y103.869
+G1 F2400 X96.131 Y82.342 E44.89035
+G0 F7200 X93.445 Y83.192
+G1 F2400 X116.808 Y106.555 E46.12665
+G0 F7200 X115.648 Y108.931
+G1 F2400 X91.069 Y84.352 E47.42727
+G0 F7200 X88.960 Y85.778
+G1 F2400 X114.222 Y111.040 E48.76403
+G0 F7200 X112.550 Y112.904
+G1 F2400 X87.096 Y87.450 E50.11094
+G0 F7200 X85.473 Y89.362
+G1 F2400 X110.638 Y114.527 E51.44259
+G0 F7200 X108.478 Y115.902
+G1 F2400 X84.098 Y91.522 E52.73271
+G0 F7200 X82.995 Y93.955
+G1 F2400 X106.045 Y117.005 E53.95241
+G0 F7200 X103.289 Y117.784
+G1 F2400 X82.216 Y96.711 E55.06752
+G0 F7200 X81.859 Y99.891
+G1 F2400 X100.109 Y118.141 E56.03325
+G0 F7200 X96.269 Y117.835
+G1 F2400 X82.165 Y103.731 E56.77960
+G0 F7200 X84.115 Y109.218
+G1 F2400 X90.782 Y115.885 E57.13238
+;LAYER:2
+G0 F7200 X120.838 Y104.224 Z0.7
+;TYPE:WALL-OUTER
+G3 F1800 X113.555 Y113.301 I-10.529 J-0.989 E57.59241
+G2 X105.444 Y119.577 I23.150 J38.297 E57.97725
+G3 X93.978 Y119.146 I-5.484 J-6.852 E58.44321
+G2 X89.267 Y115.070 I-124.908 J139.622 E58.67641
+G3 X79.617 Y106.836 I8.037 J-19.189 E59.16155
+G3 X81.216 Y97.206 I11.685 J-3.008 E59.53717
+G2 X83.088 Y91.583 I-19.238 J-9.528 E59.75959
+G3 X87.200 Y82.728 I13.875 J1.060 E60.13393
+G3 X94.727 Y81.039 I5.820 J8.323 E60.42956
+G2 X104.880 Y81.075 I5.180 J-28.912 E60.81110
+G3 X112.472 Y82.489 I1.854 J11.132 E61.10631
+G3 X116.633 Y90.186 I-7.090 J8.806 E61.44254
+G2 X119.507 Y98.793 I26.403 J-4.033 E61.78348
+G3 X120.838 Y104.224 I-12.337 J5.904 E61.99429
+G0 F7200 X120.397 Y104.135 Z0.7
+;TYPE:WALL-INNER
+G3 F1800 X112.548 Y113.369 I-10.817 J-1.241 E62.47431
+G2 X105.890 Y118.715 I19.599 J31.232 E62.79465
+G3 X93.106 Y117.865 I-5.985 J-6.543 E63.32708
+G2 X82.510 Y110.231 I-34.454 J36.653 E63.81770
+G3 X79.928 Y101.619 I5.204 J-6.254 E64.17331
+G3 X82.478 Y95.412 I50.568 J17.148 E64.42472
+G3 X85.174 Y85.880 I270.234 J71.291 E64.79642
+G3 X97.496 Y81.785 I8.679 J5.526 E65.32202
+G2 X109.549 Y81.681 I0.593 J-628.957 E65.77510
+G3 X114.897 Y86.019 I-1.815 J7.702 E66.04131
+G2 X117.979 Y96.492 I236.066 J-63.789 E66.45107
+G3 X120.397 Y104.135 I-17.055 J9.600 E66.75371
+G0 F7200 X119.956 Y104.045 Z0.7
+;TYPE:WALL-INNER
+G3 F1800 X112.635 Y112.822 I-10.341 J-1.185 E67.20676
+G2 X105.738 Y118.299 I16.030 J27.267 E67.53748
+G3 X92.698 Y116.917 I-5.900 J-6.534 E68.08718
+G2 X86.625 Y112.420 I-15.585 J14.700 E68.37131
+G3 X80.198 Y105.570 I3.736 J-9.945 E68.73547
+G3 X82.050 Y97.457 I12.087 J-1.509 E69.05286
+G2 X84.013 Y91.342 I-17.185 J-8.891 E69.29421
+G3 X88.373 Y83.013 I11.030 J0.468 E69.65775
+G3 X98.821 Y82.357 I6.132 J14.139 E70.05767
+G3 X110.247 Y82.351 I5.736 J45.841 E70.48858
+G3 X116.140 Y92.163 I-4.866 J9.599 E70.94070
+G2 X119.872 Y102.815 I207.815 J-66.821 E71.36466
+G1 X119.956 Y104.045 E71.41080
+;TYPE:FILL
+G0 F7200 X83.173 Y92.786
+G1 F2400 X92.786 Y83.173 E71.91948
+G0 F7200 X98.298 Y81.903
+G1 F2400 X81.903 Y98.298 E72.78707
+G0 F7200 X82.058 Y102.386
+G1 F2400 X102.386 Y82.058 E73.86279
+G0 F7200 X105.785 Y82.902
+G1 F2400 X82.902 Y105.785 E75.07369
+G0 F7200 X84.223 Y108.706
+G1 F2400 X108.706 Y84.223 E76.36920
+G0 F7200 X111.237 Y85.935
+G1 F2400 X85.935 Y111.237 E77.70812
+G0 F7200 X87.998 Y113.416
+G1 F2400 X113.416 Y87.998 E79.05313
+G0 F7200 X115.247 Y90.410
+G1 F2400 X90.410 Y115.247 E80.36742
+G0 F7200 X93.194 Y116.705
+G1 F2400 X116.705 Y93.194 E81.61152
+G0 F7200 X117.723 Y96.419
+G1 F2400 X96.419 Y117.723 E82.73887
+G0 F7200 X100.239 Y118.146
+G1 F2400 X118.146 Y100.239 E83.68647
+G0 F7200 X117.527 Y105.100
+G1 F2400 X105.100 Y117.527 E84.34405
+;LAYER:3
+G0 F7200 X120.536 Y106.353 Z0.9
+;TYPE:WALL-OUTER
+G3 F1800 X111.897 Y114.274 I-13.511 J-6.063 E84.79538
+G2 X106.415 Y118.831 I22.270 J32.369 E85.06252
+G3 X94.058 Y119.208 I-6.376 J-6.288 E85.57048
+G2 X89.337 Y115.122 I-191.559 J216.592 E85.80420
+G3 X80.718 Y108.914 I16.522 J-32.023 E86.20439
+G3 X81.177 Y97.291 I8.917 J-5.468 E86.66473
+G2 X83.742 Y88.536 I-27.348 J-12.764 E87.00728
+G3 X91.255 Y81.084 I8.777 J1.336 E87.43043
+G2 X102.687 Y81.325 I11.367 J-267.099 E87.85958
+G3 X110.360 Y81.455 I3.526 J18.462 E88.14915
+G3 X116.097 Y87.953 I-2.926 J8.366 E88.48763
+G2 X118.187 Y95.864 I48.871 J-8.676 E88.79434
+G3 X120.769 Y102.989 I-26.229 J13.537 E89.07905
+G3 X120.536 Y106.353 I-8.562 J1.097 E89.20596
+G0 F7200 X120.106 Y106.220 Z0.9
+;TYPE:WALL-INNER
+G3 F1800 X112.748 Y113.256 I-11.393 J-4.548 E89.59841
+G2 X103.062 Y120.425 I307.855 J426.044 E90.05141
+G3 X94.191 Y118.778 I-3.124 J-7.886 E90.40673
+G2 X88.424 Y113.949 I-46.145 J49.254 E90.68859
+G3 X81.839 Y109.580 I15.682 J-30.781 E90.98543
+G3 X79.661 Y103.049 I5.643 J-5.510 E91.25162
+G2 X83.515 Y91.661 I-2244.575 J-765.943 E91.70328
+G3 X90.350 Y81.706 I10.608 J-0.041 E92.18565
+G2 X103.485 Y81.664 I5.632 J-292.424 E92.67960
+G3 X114.777 Y85.788 I2.973 J9.382 E93.16433
+G3 X117.886 Y96.283 I-12578.929 J3731.937 E93.57525
+G3 X120.395 Y103.876 I-18.809 J10.427 E93.87677
+G3 X120.106 Y106.220 I-7.940 J0.210 E93.96538
+G0 F7200 X119.676 Y106.087 Z0.9
+;TYPE:WALL-INNER
+G3 F1800 X111.979 Y113.190 I-11.632 J-4.883 E94.36932
+G3 X102.914 Y120.014 I-110.862 J-137.831 E94.79591
+G3 X92.965 Y117.167 I-3.003 J-8.310 E95.20792
+G2 X84.896 Y111.444 I-18.648 J17.744 E95.58003
+G3 X80.216 Y102.284 I3.604 J-7.617 E95.99355
+G2 X84.157 Y90.566 I-60.562 J-26.889 E96.45816
+G3 X88.052 Y83.221 I10.858 J1.053 E96.77789
+G3 X95.131 Y81.923 I5.249 J8.676 E97.05306
+G2 X108.680 Y81.947 I6.879 J-59.495 E97.56244
+G3 X115.343 Y88.374 I-1.292 J8.007 E97.93021
+G2 X118.164 Y97.903 I32.699 J-4.497 E98.30372
+G3 X119.909 Y104.887 I-11.095 J6.482 E98.57676
+G1 X119.676 Y106.087 E98.62247
+;TYPE:FILL
+G0 F7200 X107.824 Y83.429
+G1 F2400 X116.571 Y92.176 E99.08532
+G0 F7200 X117.972 Y97.112
+G1 F2400 X102.888 Y82.028 E99.88354
+G0 F7200 X99.213 Y81.889
+G1 F2400 X118.111 Y100.787 E100.88358
+G0 F7200 X117.658 Y103.869
+G1 F2400 X96.131 Y82.342 E102.02273
+G0 F7200 X93.445 Y83.192
+G1 F2400 X116.808 Y106.555 E103.25903
+G0 F7200 X115.648 Y108.931
+G1 F2400 X91.069 Y84.352 E104.55965
+G0 F7200 X88.960 Y85.778
+G1 F2400 X114.222 Y111.040 E105.89641
+G0 F7200 X112.550 Y112.904
+G1 F2400 X87.096 Y87.450 E107.24332
+G0 F7200 X85.473 Y89.362
+G1 F2400 X110.638 Y114.527 E108.57497
+G0 F7200 X108.478 Y115.902
+G1 F2400 X84.098 Y91.522 E109.86509
+G0 F7200 X82.995 Y93.955
+G1 F2400 X106.045 Y117.005 E111.08479
+G0 F7200 X103.289 Y117.784
+G1 F2400 X82.216 Y96.711 E112.19990
+G0 F7200 X81.859 Y99.891
+G1 F2400 X100.109 Y118.141 E113.16563
+G0 F7200 X96.269 Y117.835
+G1 F2400 X82.165 Y103.731 E113.91198
+G0 F7200 X84.115 Y109.218
+G1 F2400 X90.782 Y115.885 E114.26477
+M140 S0
+M107
+G91
+G1 E-2 F2700
+G1 E-2 Z0.2 F2400
+G90
+M104 S0
+M84 X Y E
+;End of Gcode
@@ -0,0 +1,1637 @@
+; generated by Slic3r 1.3.0 on 2018-06-12 at 21:14:50
+
+; external perimeters extrusion width = 0.45mm
+; perimeters extrusion width = 0.45mm
+; infill extrusion width = 0.45mm
+; solid infill extrusion width = 0.45mm
+; top infill extrusion width = 0.40mm
+; first layer extrusion width = 0.70mm
+
+M107
+M190 S60 ; set bed temperature
+M104 S210 ; set temperature
+G28 ; home all axes
+G1 Z5 F5000 ; lift nozzle
+
+M109 S210 ; wait for temperature to be reached
+G21 ; set units to millimeters
+G90 ; use absolute coordinates
+M82 ; use absolute distances for extrusion
+G92 E0
+G1 E-2.00000 F2400.00000 ; retract
+G92 E0
+; layer 1, z = 0.300
+G1 Z0.300 F7800.000 ; move to next layer (0)
+G92 E0 ; reset extrusion distance
+G1 X120.000 Y100.000 F7800.000 ; move to first perimeter point
+G1 E2.00000 F2400.00000 ; unretract
+G1 X120.360 Y101.067 E2.04214 F1800.000 ; external perimeter
+G1 X120.636 Y102.169 E2.08465 ; external perimeter
+G1 X120.801 Y103.295 E2.12722 ; external perimeter
+G1 X120.834 Y104.428 E2.16965 ; external perimeter
+G1 X120.718 Y105.551 E2.21190 ; external perimeter
+G1 X120.448 Y106.644 E2.25401 ; external perimeter
+G1 X120.024 Y107.687 E2.29612 ; external perimeter
+G1 X119.458 Y108.663 E2.33836 ; external perimeter
+G1 X118.765 Y109.561 E2.38080 ; external perimeter
+G1 X117.970 Y110.375 E2.42337 ; external perimeter
+G1 X117.099 Y111.104 E2.46588 ; external perimeter
+G1 X116.180 Y111.756 E2.50802 ; external perimeter
+G1 X115.241 Y112.342 E2.54944 ; external perimeter
+G1 X114.306 Y112.881 E2.58984 ; external perimeter
+G1 X113.392 Y113.392 E2.62901 ; external perimeter
+G1 X112.513 Y113.898 E2.66694 ; external perimeter
+G1 X111.675 Y114.417 E2.70386 ; external perimeter
+G1 X110.874 Y114.967 E2.74020 ; external perimeter
+G1 X110.104 Y115.558 E2.77654 ; external perimeter
+G1 X109.350 Y116.196 E2.81346 ; external perimeter
+G1 X108.598 Y116.875 E2.85139 ; external perimeter
+G1 X107.830 Y117.586 E2.89056 ; external perimeter
+G1 X107.028 Y118.309 E2.93095 ; external perimeter
+G1 X106.180 Y119.021 E2.97238 ; external perimeter
+G1 X105.277 Y119.694 E3.01452 ; external perimeter
+G1 X104.314 Y120.297 E3.05703 ; external perimeter
+G1 X103.295 Y120.801 E3.09960 ; external perimeter
+G1 X102.226 Y121.182 E3.14204 ; external perimeter
+G1 X101.123 Y121.419 E3.18428 ; external perimeter
+G1 X100.000 Y121.500 E3.22639 ; external perimeter
+G1 X98.877 Y121.419 E3.26850 ; external perimeter
+G1 X97.774 Y121.182 E3.31075 ; external perimeter
+G1 X96.705 Y120.801 E3.35318 ; external perimeter
+G1 X95.686 Y120.297 E3.39575 ; external perimeter
+G1 X94.723 Y119.694 E3.43826 ; external perimeter
+G1 X93.820 Y119.021 E3.48040 ; external perimeter
+G1 X92.972 Y118.309 E3.52183 ; external perimeter
+G1 X92.170 Y117.586 E3.56222 ; external perimeter
+G1 X91.402 Y116.875 E3.60139 ; external perimeter
+G1 X90.650 Y116.196 E3.63932 ; external perimeter
+G1 X89.896 Y115.558 E3.67624 ; external perimeter
+G1 X89.126 Y114.967 E3.71258 ; external perimeter
+G1 X88.325 Y114.417 E3.74892 ; external perimeter
+G1 X87.487 Y113.898 E3.78584 ; external perimeter
+G1 X86.608 Y113.392 E3.82377 ; external perimeter
+G1 X85.694 Y112.881 E3.86294 ; external perimeter
+G1 X84.759 Y112.342 E3.90334 ; external perimeter
+G1 X83.820 Y111.756 E3.94476 ; external perimeter
+G1 X82.901 Y111.104 E3.98690 ; external perimeter
+G1 X82.030 Y110.375 E4.02941 ; external perimeter
+G1 X81.235 Y109.561 E4.07198 ; external perimeter
+G1 X80.542 Y108.663 E4.11442 ; external perimeter
+G1 X79.976 Y107.687 E4.15666 ; external perimeter
+G1 X79.552 Y106.644 E4.19877 ; external perimeter
+G1 X79.282 Y105.551 E4.24088 ; external perimeter
+G1 X79.166 Y104.428 E4.28313 ; external perimeter
+G1 X79.199 Y103.295 E4.32556 ; external perimeter
+G1 X79.364 Y102.169 E4.36813 ; external perimeter
+G1 X79.640 Y101.067 E4.41064 ; external perimeter
+G1 X80.000 Y100.000 E4.45278 ; external perimeter
+G1 X80.415 Y98.974 E4.49421 ; external perimeter
+G1 X80.855 Y97.988 E4.53461 ; external perimeter
+G1 X81.294 Y97.037 E4.57378 ; external perimeter
+G1 X81.708 Y96.112 E4.61171 ; external perimeter
+G1 X82.081 Y95.199 E4.64862 ; external perimeter
+G1 X82.405 Y94.283 E4.68496 ; external perimeter
+G1 X82.681 Y93.352 E4.72130 ; external perimeter
+G1 X82.916 Y92.394 E4.75822 ; external perimeter
+G1 X83.125 Y91.402 E4.79615 ; external perimeter
+G1 X83.329 Y90.375 E4.83532 ; external perimeter
+G1 X83.552 Y89.319 E4.87572 ; external perimeter
+G1 X83.820 Y88.244 E4.91715 ; external perimeter
+G1 X84.155 Y87.169 E4.95929 ; external perimeter
+G1 X84.580 Y86.116 E5.00179 ; external perimeter
+G1 X85.108 Y85.108 E5.04436 ; external perimeter
+G1 X85.748 Y84.172 E5.08680 ; external perimeter
+G1 X86.502 Y83.331 E5.12904 ; external perimeter
+G1 X87.363 Y82.606 E5.17115 ; external perimeter
+G1 X88.318 Y82.011 E5.21326 ; external perimeter
+G1 X89.350 Y81.554 E5.25551 ; external perimeter
+G1 X90.439 Y81.235 E5.29795 ; external perimeter
+G1 X91.560 Y81.044 E5.34052 ; external perimeter
+G1 X92.694 Y80.966 E5.38302 ; external perimeter
+G1 X93.820 Y80.979 E5.42516 ; external perimeter
+G1 X94.924 Y81.056 E5.46659 ; external perimeter
+G1 X95.998 Y81.171 E5.50699 ; external perimeter
+G1 X97.037 Y81.294 E5.54616 ; external perimeter
+G1 X98.045 Y81.401 E5.58409 ; external perimeter
+G1 X99.029 Y81.474 E5.62100 ; external perimeter
+G1 X100.000 Y81.500 E5.65734 ; external perimeter
+G1 X100.971 Y81.474 E5.69369 ; external perimeter
+G1 X101.955 Y81.401 E5.73060 ; external perimeter
+G1 X102.963 Y81.294 E5.76853 ; external perimeter
+G1 X104.002 Y81.171 E5.80770 ; external perimeter
+G1 X105.076 Y81.056 E5.84810 ; external perimeter
+G1 X106.180 Y80.979 E5.88953 ; external perimeter
+G1 X107.306 Y80.966 E5.93167 ; external perimeter
+G1 X108.440 Y81.044 E5.97417 ; external perimeter
+G1 X109.561 Y81.235 E6.01674 ; external perimeter
+G1 X110.650 Y81.554 E6.05918 ; external perimeter
+G1 X111.682 Y82.011 E6.10142 ; external perimeter
+G1 X112.637 Y82.606 E6.14354 ; external perimeter
+G1 X113.498 Y83.331 E6.18565 ; external perimeter
+G1 X114.252 Y84.172 E6.22789 ; external perimeter
+G1 X114.892 Y85.108 E6.27033 ; external perimeter
+G1 X115.420 Y86.116 E6.31290 ; external perimeter
+G1 X115.845 Y87.169 E6.35540 ; external perimeter
+G1 X116.180 Y88.244 E6.39754 ; external perimeter
+G1 X116.448 Y89.319 E6.43897 ; external perimeter
+G1 X116.671 Y90.375 E6.47937 ; external perimeter
+G1 X116.875 Y91.402 E6.51854 ; external perimeter
+G1 X117.084 Y92.394 E6.55647 ; external perimeter
+G1 X117.319 Y93.352 E6.59339 ; external perimeter
+G1 X117.595 Y94.283 E6.62973 ; external perimeter
+G1 X117.919 Y95.199 E6.66607 ; external perimeter
+G1 X118.292 Y96.112 E6.70298 ; external perimeter
+G1 X118.706 Y97.037 E6.74091 ; external perimeter
+G1 X119.145 Y97.988 E6.78008 ; external perimeter
+G1 X119.585 Y98.974 E6.82048 ; external perimeter
+G1 X120.000 Y100.000 E6.86191 ; external perimeter
+G1 E4.86191 F2400.00000 ; retract
+G92 E0 ; reset extrusion distance
+G1 X119.550 Y100.000 F7800.000 ; move to first perimeter point
+G1 E2.00000 F2400.00000 ; unretract
+G1 X119.934 Y101.119 E2.04428 F1800.000 ; perimeter
+G1 X120.220 Y102.278 E2.08894 ; perimeter
+G1 X120.376 Y103.462 E2.13363 ; perimeter
+G1 X120.377 Y104.651 E2.17811 ; perimeter
+G1 X120.207 Y105.822 E2.22237 ; perimeter
+G1 X119.860 Y106.949 E2.26652 ; perimeter
+G1 X119.342 Y108.012 E2.31075 ; perimeter
+G1 X118.671 Y108.991 E2.35519 ; perimeter
+G1 X117.870 Y109.877 E2.39984 ; perimeter
+G1 X116.973 Y110.665 E2.44453 ; perimeter
+G1 X116.013 Y111.362 E2.48892 ; perimeter
+G1 X115.024 Y111.981 E2.53259 ; perimeter
+G1 X114.036 Y112.544 E2.57511 ; perimeter
+G1 X113.074 Y113.074 E2.61623 ; perimeter
+G1 X112.152 Y113.598 E2.65591 ; perimeter
+G1 X111.277 Y114.141 E2.69443 ; perimeter
+G1 X110.446 Y114.723 E2.73238 ; perimeter
+G1 X109.648 Y115.355 E2.77048 ; perimeter
+G1 X108.865 Y116.040 E2.80942 ; perimeter
+G1 X108.077 Y116.771 E2.84965 ; perimeter
+G1 X107.262 Y117.532 E2.89135 ; perimeter
+G1 X106.401 Y118.294 E2.93437 ; perimeter
+G1 X105.482 Y119.027 E2.97838 ; perimeter
+G1 X104.495 Y119.694 E3.02294 ; perimeter
+G1 X103.442 Y120.259 E3.06765 ; perimeter
+G1 X102.331 Y120.689 E3.11223 ; perimeter
+G1 X101.177 Y120.958 E3.15657 ; perimeter
+G1 X100.000 Y121.050 E3.20075 ; perimeter
+G1 X98.823 Y120.958 E3.24492 ; perimeter
+G1 X97.669 Y120.689 E3.28926 ; perimeter
+G1 X96.558 Y120.259 E3.33384 ; perimeter
+G1 X95.505 Y119.694 E3.37855 ; perimeter
+G1 X94.518 Y119.027 E3.42311 ; perimeter
+G1 X93.599 Y118.294 E3.46712 ; perimeter
+G1 X92.738 Y117.532 E3.51014 ; perimeter
+G1 X91.923 Y116.771 E3.55184 ; perimeter
+G1 X91.135 Y116.040 E3.59208 ; perimeter
+G1 X90.352 Y115.355 E3.63101 ; perimeter
+G1 X89.554 Y114.723 E3.66911 ; perimeter
+G1 X88.723 Y114.141 E3.70706 ; perimeter
+G1 X87.848 Y113.598 E3.74559 ; perimeter
+G1 X86.926 Y113.074 E3.78527 ; perimeter
+G1 X85.964 Y112.544 E3.82638 ; perimeter
+G1 X84.976 Y111.981 E3.86891 ; perimeter
+G1 X83.987 Y111.362 E3.91257 ; perimeter
+G1 X83.027 Y110.665 E3.95696 ; perimeter
+G1 X82.130 Y109.877 E4.00165 ; perimeter
+G1 X81.329 Y108.991 E4.04631 ; perimeter
+G1 X80.658 Y108.012 E4.09075 ; perimeter
+G1 X80.140 Y106.949 E4.13497 ; perimeter
+G1 X79.793 Y105.822 E4.17912 ; perimeter
+G1 X79.623 Y104.651 E4.22338 ; perimeter
+G1 X79.624 Y103.462 E4.26787 ; perimeter
+G1 X79.780 Y102.278 E4.31255 ; perimeter
+G1 X80.066 Y101.119 E4.35721 ; perimeter
+G1 X80.450 Y100.000 E4.40149 ; perimeter
+G1 X80.895 Y98.927 E4.44496 ; perimeter
+G1 X81.366 Y97.900 E4.48722 ; perimeter
+G1 X81.829 Y96.913 E4.52804 ; perimeter
+G1 X82.258 Y95.950 E4.56745 ; perimeter
+G1 X82.635 Y94.997 E4.60581 ; perimeter
+G1 X82.954 Y94.035 E4.64373 ; perimeter
+G1 X83.218 Y93.049 E4.68195 ; perimeter
+G1 X83.443 Y92.026 E4.72112 ; perimeter
+G1 X83.649 Y90.963 E4.76164 ; perimeter
+G1 X83.866 Y89.862 E4.80362 ; perimeter
+G1 X84.124 Y88.736 E4.84688 ; perimeter
+G1 X84.454 Y87.603 E4.89103 ; perimeter
+G1 X84.882 Y86.489 E4.93565 ; perimeter
+G1 X85.426 Y85.426 E4.98035 ; perimeter
+G1 X86.098 Y84.444 E5.02488 ; perimeter
+G1 X86.899 Y83.572 E5.06918 ; perimeter
+G1 X87.820 Y82.834 E5.11334 ; perimeter
+G1 X88.846 Y82.248 E5.15754 ; perimeter
+G1 X89.952 Y81.819 E5.20193 ; perimeter
+G1 X91.112 Y81.543 E5.24655 ; perimeter
+G1 X92.299 Y81.408 E5.29125 ; perimeter
+G1 X93.488 Y81.389 E5.33574 ; perimeter
+G1 X94.657 Y81.456 E5.37958 ; perimeter
+G1 X95.795 Y81.575 E5.42236 ; perimeter
+G1 X96.893 Y81.712 E5.46377 ; perimeter
+G1 X97.953 Y81.835 E5.50372 ; perimeter
+G1 X98.985 Y81.920 E5.54245 ; perimeter
+G1 X100.000 Y81.950 E5.58045 ; perimeter
+G1 X101.015 Y81.920 E5.61846 ; perimeter
+G1 X102.047 Y81.835 E5.65718 ; perimeter
+G1 X103.107 Y81.712 E5.69714 ; perimeter
+G1 X104.205 Y81.575 E5.73855 ; perimeter
+G1 X105.343 Y81.456 E5.78133 ; perimeter
+G1 X106.512 Y81.389 E5.82517 ; perimeter
+G1 X107.701 Y81.408 E5.86966 ; perimeter
+G1 X108.888 Y81.543 E5.91436 ; perimeter
+G1 X110.048 Y81.819 E5.95898 ; perimeter
+G1 X111.154 Y82.248 E6.00337 ; perimeter
+G1 X112.180 Y82.834 E6.04757 ; perimeter
+G1 X113.101 Y83.572 E6.09173 ; perimeter
+G1 X113.902 Y84.444 E6.13603 ; perimeter
+G1 X114.574 Y85.426 E6.18056 ; perimeter
+G1 X115.118 Y86.489 E6.22526 ; perimeter
+G1 X115.546 Y87.603 E6.26988 ; perimeter
+G1 X115.876 Y88.736 E6.31403 ; perimeter
+G1 X116.134 Y89.862 E6.35728 ; perimeter
+G1 X116.351 Y90.963 E6.39927 ; perimeter
+G1 X116.557 Y92.026 E6.43979 ; perimeter
+G1 X116.782 Y93.049 E6.47896 ; perimeter
+G1 X117.046 Y94.035 E6.51718 ; perimeter
+G1 X117.365 Y94.997 E6.55510 ; perimeter
+G1 X117.742 Y95.950 E6.59345 ; perimeter
+G1 X118.171 Y96.913 E6.63287 ; perimeter
+G1 X118.634 Y97.900 E6.67369 ; perimeter
+G1 X119.105 Y98.927 E6.71595 ; perimeter
+G1 X119.550 Y100.000 E6.75942 ; perimeter
+G1 E4.75942 F2400.00000 ; retract
+G92 E0 ; reset extrusion distance
+G1 X119.100 Y100.000 F7800.000 ; move to first perimeter point
+G1 E2.00000 F2400.00000 ; unretract
+G1 X119.504 Y101.157 E2.04587 F1800.000 ; perimeter
+G1 X119.798 Y102.358 E2.09212 ; perimeter
+G1 X119.945 Y103.585 E2.13835 ; perimeter
+G1 X119.917 Y104.813 E2.18432 ; perimeter
+G1 X119.696 Y106.015 E2.23004 ; perimeter
+G1 X119.281 Y107.162 E2.27569 ; perimeter
+G1 X118.681 Y108.229 E2.32149 ; perimeter
+G1 X117.922 Y109.199 E2.36757 ; perimeter
+G1 X117.036 Y110.061 E2.41385 ; perimeter
+G1 X116.062 Y110.818 E2.46001 ; perimeter
+G1 X115.041 Y111.482 E2.50558 ; perimeter
+G1 X114.010 Y112.074 E2.55004 ; perimeter
+G1 X113.002 Y112.622 E2.59299 ; perimeter
+G1 X112.036 Y113.157 E2.63429 ; perimeter
+G1 X111.123 Y113.708 E2.67420 ; perimeter
+G1 X110.261 Y114.300 E2.71334 ; perimeter
+G1 X109.437 Y114.949 E2.75257 ; perimeter
+G1 X108.633 Y115.659 E2.79272 ; perimeter
+G1 X107.823 Y116.422 E2.83434 ; perimeter
+G1 X106.982 Y117.216 E2.87762 ; perimeter
+G1 X106.089 Y118.010 E2.92234 ; perimeter
+G1 X105.127 Y118.764 E2.96807 ; perimeter
+G1 X104.091 Y119.437 E3.01428 ; perimeter
+G1 X102.983 Y119.985 E3.06054 ; perimeter
+G1 X101.816 Y120.373 E3.10656 ; perimeter
+G1 X100.610 Y120.575 E3.15232 ; perimeter
+G1 X99.390 Y120.575 E3.19797 ; perimeter
+G1 X98.184 Y120.373 E3.24373 ; perimeter
+G1 X97.017 Y119.985 E3.28975 ; perimeter
+G1 X95.909 Y119.437 E3.33601 ; perimeter
+G1 X94.873 Y118.764 E3.38223 ; perimeter
+G1 X93.911 Y118.010 E3.42796 ; perimeter
+G1 X93.018 Y117.216 E3.47268 ; perimeter
+G1 X92.177 Y116.422 E3.51595 ; perimeter
+G1 X91.367 Y115.659 E3.55758 ; perimeter
+G1 X90.563 Y114.949 E3.59773 ; perimeter
+G1 X89.739 Y114.300 E3.63695 ; perimeter
+G1 X88.877 Y113.708 E3.67609 ; perimeter
+G1 X87.964 Y113.157 E3.71600 ; perimeter
+G1 X86.998 Y112.622 E3.75731 ; perimeter
+G1 X85.990 Y112.074 E3.80025 ; perimeter
+G1 X84.959 Y111.482 E3.84472 ; perimeter
+G1 X83.938 Y110.818 E3.89028 ; perimeter
+G1 X82.964 Y110.061 E3.93644 ; perimeter
+G1 X82.078 Y109.199 E3.98272 ; perimeter
+G1 X81.319 Y108.229 E4.02880 ; perimeter
+G1 X80.719 Y107.162 E4.07461 ; perimeter
+G1 X80.304 Y106.015 E4.12026 ; perimeter
+G1 X80.083 Y104.813 E4.16598 ; perimeter
+G1 X80.055 Y103.585 E4.21195 ; perimeter
+G1 X80.202 Y102.358 E4.25817 ; perimeter
+G1 X80.496 Y101.157 E4.30443 ; perimeter
+G1 X80.900 Y100.000 E4.35029 ; perimeter
+G1 X81.371 Y98.894 E4.39526 ; perimeter
+G1 X81.866 Y97.840 E4.43884 ; perimeter
+G1 X82.348 Y96.827 E4.48080 ; perimeter
+G1 X82.786 Y95.840 E4.52121 ; perimeter
+G1 X83.162 Y94.858 E4.56056 ; perimeter
+G1 X83.471 Y93.860 E4.59965 ; perimeter
+G1 X83.723 Y92.830 E4.63934 ; perimeter
+G1 X83.937 Y91.755 E4.68033 ; perimeter
+G1 X84.144 Y90.635 E4.72295 ; perimeter
+G1 X84.378 Y89.478 E4.76714 ; perimeter
+G1 X84.677 Y88.302 E4.81253 ; perimeter
+G1 X85.073 Y87.136 E4.85861 ; perimeter
+G1 X85.593 Y86.014 E4.90489 ; perimeter
+G1 X86.252 Y84.972 E4.95103 ; perimeter
+G1 X87.054 Y84.045 E4.99688 ; perimeter
+G1 X87.991 Y83.263 E5.04255 ; perimeter
+G1 X89.045 Y82.648 E5.08824 ; perimeter
+G1 X90.190 Y82.206 E5.13415 ; perimeter
+G1 X91.394 Y81.935 E5.18033 ; perimeter
+G1 X92.625 Y81.816 E5.22661 ; perimeter
+G1 X93.854 Y81.822 E5.27259 ; perimeter
+G1 X95.058 Y81.915 E5.31778 ; perimeter
+G1 X96.223 Y82.056 E5.36167 ; perimeter
+G1 X97.343 Y82.204 E5.40396 ; perimeter
+G1 X98.424 Y82.324 E5.44465 ; perimeter
+G1 X99.478 Y82.391 E5.48416 ; perimeter
+G1 X100.522 Y82.391 E5.52323 ; perimeter
+G1 X101.576 Y82.324 E5.56274 ; perimeter
+G1 X102.657 Y82.204 E5.60343 ; perimeter
+G1 X103.777 Y82.056 E5.64572 ; perimeter
+G1 X104.942 Y81.915 E5.68961 ; perimeter
+G1 X106.146 Y81.822 E5.73479 ; perimeter
+G1 X107.375 Y81.816 E5.78078 ; perimeter
+G1 X108.606 Y81.935 E5.82706 ; perimeter
+G1 X109.810 Y82.206 E5.87324 ; perimeter
+G1 X110.955 Y82.648 E5.91915 ; perimeter
+G1 X112.009 Y83.263 E5.96484 ; perimeter
+G1 X112.946 Y84.045 E6.01051 ; perimeter
+G1 X113.748 Y84.972 E6.05636 ; perimeter
+G1 X114.407 Y86.014 E6.10250 ; perimeter
+G1 X114.927 Y87.136 E6.14878 ; perimeter
+G1 X115.323 Y88.302 E6.19486 ; perimeter
+G1 X115.622 Y89.478 E6.24025 ; perimeter
+G1 X115.856 Y90.635 E6.28444 ; perimeter
+G1 X116.063 Y91.755 E6.32705 ; perimeter
+G1 X116.277 Y92.830 E6.36805 ; perimeter
+G1 X116.529 Y93.860 E6.40774 ; perimeter
+G1 X116.838 Y94.858 E6.44683 ; perimeter
+G1 X117.214 Y95.840 E6.48618 ; perimeter
+G1 X117.652 Y96.827 E6.52659 ; perimeter
+G1 X118.134 Y97.840 E6.56855 ; perimeter
+G1 X118.629 Y98.894 E6.61213 ; perimeter
+G1 X119.100 Y100.000 E6.65710 ; perimeter
+G1 E4.65710 F2400.00000 ; retract
+G92 E0 ; reset extrusion distance
+G1 X83.173 Y92.786 F7800.000 ; move to first infill point
+G1 X92.786 Y83.173 E0.50867 F2400.000 ; infill
+G1 X98.298 Y81.903 F7800.000 ; move to first infill point
+G1 X81.903 Y98.298 E1.37627 F2400.000 ; infill
+G1 X82.058 Y102.386 F7800.000 ; move to first infill point
+G1 X102.386 Y82.058 E2.45199 F2400.000 ; infill
+G1 X105.785 Y82.902 F7800.000 ; move to first infill point
+G1 X82.902 Y105.785 E3.66288 F2400.000 ; infill
+G1 X84.223 Y108.706 F7800.000 ; move to first infill point
+G1 X108.706 Y84.223 E4.95840 F2400.000 ; infill
+G1 X111.237 Y85.935 F7800.000 ; move to first infill point
+G1 X85.935 Y111.237 E6.29732 F2400.000 ; infill
+G1 X87.998 Y113.416 F7800.000 ; move to first infill point
+G1 X113.416 Y87.998 E7.64233 F2400.000 ; infill
+G1 X115.247 Y90.410 F7800.000 ; move to first infill point
+G1 X90.410 Y115.247 E8.95662 F2400.000 ; infill
+G1 X93.194 Y116.705 F7800.000 ; move to first infill point
+G1 X116.705 Y93.194 E10.20072 F2400.000 ; infill
+G1 X117.723 Y96.419 F7800.000 ; move to first infill point
+G1 X96.419 Y117.723 E11.32807 F2400.000 ; infill
+G1 X100.239 Y118.146 F7800.000 ; move to first infill point
+G1 X118.146 Y100.239 E12.27567 F2400.000 ; infill
+G1 X117.527 Y105.100 F7800.000 ; move to first infill point
+G1 X105.100 Y117.527 E12.93325 F2400.000 ; infill
+; layer 2, z = 0.500
+G1 Z0.500 F7800.000 ; move to next layer (1)
+G92 E0 ; reset extrusion distance
+G1 X120.616 Y102.068 F7800.000 ; move to first perimeter point
+G1 E2.00000 F2400.00000 ; unretract
+G1 X120.792 Y103.193 E2.04257 F1800.000 ; external perimeter
+G1 X120.837 Y104.326 E2.08503 ; external perimeter
+G1 X120.735 Y105.451 E2.12729 ; external perimeter
+G1 X120.478 Y106.547 E2.16941 ; external perimeter
+G1 X120.069 Y107.595 E2.21151 ; external perimeter
+G1 X119.514 Y108.578 E2.25374 ; external perimeter
+G1 X118.832 Y109.484 E2.29616 ; external perimeter
+G1 X118.045 Y110.305 E2.33872 ; external perimeter
+G1 X117.180 Y111.042 E2.38125 ; external perimeter
+G1 X116.264 Y111.700 E2.42343 ; external perimeter
+G1 X115.326 Y112.291 E2.46494 ; external perimeter
+G1 X114.389 Y112.834 E2.50544 ; external perimeter
+G1 X113.473 Y113.347 E2.54473 ; external perimeter
+G1 X112.591 Y113.852 E2.58276 ; external perimeter
+G1 X111.749 Y114.369 E2.61975 ; external perimeter
+G1 X110.945 Y114.916 E2.65612 ; external perimeter
+G1 X110.172 Y115.503 E2.69244 ; external perimeter
+G1 X109.418 Y116.136 E2.72928 ; external perimeter
+G1 X108.666 Y116.812 E2.76711 ; external perimeter
+G1 X107.900 Y117.521 E2.80617 ; external perimeter
+G1 X107.102 Y118.244 E2.84646 ; external perimeter
+G1 X106.259 Y118.958 E2.88780 ; external perimeter
+G1 X105.361 Y119.635 E2.92990 ; external perimeter
+G1 X104.403 Y120.246 E2.97238 ; external perimeter
+G1 X103.389 Y120.761 E3.01496 ; external perimeter
+G1 X102.324 Y121.154 E3.05741 ; external perimeter
+G1 X101.223 Y121.404 E3.09967 ; external perimeter
+G1 X100.101 Y121.499 E3.14179 ; external perimeter
+G1 X98.978 Y121.433 E3.18389 ; external perimeter
+G1 X97.872 Y121.210 E3.22612 ; external perimeter
+G1 X96.800 Y120.841 E3.26854 ; external perimeter
+G1 X95.775 Y120.347 E3.31111 ; external perimeter
+G1 X94.807 Y119.751 E3.35363 ; external perimeter
+G1 X93.899 Y119.084 E3.39582 ; external perimeter
+G1 X93.046 Y118.374 E3.43732 ; external perimeter
+G1 X92.241 Y117.651 E3.47782 ; external perimeter
+G1 X91.470 Y116.938 E3.51711 ; external perimeter
+G1 X90.717 Y116.255 E3.55514 ; external perimeter
+G1 X89.965 Y115.614 E3.59214 ; external perimeter
+G1 X89.196 Y115.018 E3.62851 ; external perimeter
+G1 X88.399 Y114.465 E3.66482 ; external perimeter
+G1 X87.564 Y113.943 E3.70167 ; external perimeter
+G1 X86.689 Y113.438 E3.73949 ; external perimeter
+G1 X85.778 Y112.928 E3.77855 ; external perimeter
+G1 X84.844 Y112.392 E3.81884 ; external perimeter
+G1 X83.904 Y111.811 E3.86019 ; external perimeter
+G1 X82.982 Y111.166 E3.90228 ; external perimeter
+G1 X82.106 Y110.444 E3.94476 ; external perimeter
+G1 X81.303 Y109.638 E3.98734 ; external perimeter
+G1 X80.600 Y108.747 E4.02979 ; external perimeter
+G1 X80.021 Y107.778 E4.07205 ; external perimeter
+G1 X79.584 Y106.740 E4.11417 ; external perimeter
+G1 X79.300 Y105.651 E4.15628 ; external perimeter
+G1 X79.171 Y104.530 E4.19850 ; external perimeter
+G1 X79.190 Y103.397 E4.24092 ; external perimeter
+G1 X79.344 Y102.270 E4.28349 ; external perimeter
+G1 X79.611 Y101.165 E4.32601 ; external perimeter
+G1 X79.965 Y100.095 E4.36820 ; external perimeter
+G1 X80.376 Y99.064 E4.40970 ; external perimeter
+G1 X80.815 Y98.075 E4.45020 ; external perimeter
+G1 X81.255 Y97.122 E4.48949 ; external perimeter
+G1 X81.672 Y96.195 E4.52753 ; external perimeter
+G1 X82.049 Y95.281 E4.56452 ; external perimeter
+G1 X82.378 Y94.366 E4.60089 ; external perimeter
+G1 X82.658 Y93.437 E4.63720 ; external perimeter
+G1 X82.896 Y92.481 E4.67405 ; external perimeter
+G1 X83.107 Y91.493 E4.71187 ; external perimeter
+G1 X83.310 Y90.469 E4.75093 ; external perimeter
+G1 X83.531 Y89.415 E4.79122 ; external perimeter
+G1 X83.793 Y88.341 E4.83257 ; external perimeter
+G1 X84.122 Y87.266 E4.87466 ; external perimeter
+G1 X84.537 Y86.209 E4.91715 ; external perimeter
+G1 X85.056 Y85.196 E4.95972 ; external perimeter
+G1 X85.686 Y84.253 E5.00217 ; external perimeter
+G1 X86.429 Y83.402 E5.04443 ; external perimeter
+G1 X87.281 Y82.666 E5.08655 ; external perimeter
+G1 X88.229 Y82.059 E5.12866 ; external perimeter
+G1 X89.255 Y81.590 E5.17088 ; external perimeter
+G1 X90.339 Y81.258 E5.21331 ; external perimeter
+G1 X91.458 Y81.056 E5.25587 ; external perimeter
+G1 X92.591 Y80.969 E5.29839 ; external perimeter
+G1 X93.719 Y80.975 E5.34058 ; external perimeter
+G1 X94.826 Y81.048 E5.38209 ; external perimeter
+G1 X95.902 Y81.160 E5.42259 ; external perimeter
+G1 X96.945 Y81.283 E5.46187 ; external perimeter
+G1 X97.955 Y81.393 E5.49991 ; external perimeter
+G1 X98.941 Y81.470 E5.53690 ; external perimeter
+G1 X99.913 Y81.500 E5.57327 ; external perimeter
+G1 X100.883 Y81.479 E5.60959 ; external perimeter
+G1 X101.865 Y81.410 E5.64643 ; external perimeter
+G1 X102.871 Y81.305 E5.68426 ; external perimeter
+G1 X103.907 Y81.182 E5.72331 ; external perimeter
+G1 X104.978 Y81.066 E5.76360 ; external perimeter
+G1 X106.080 Y80.984 E5.80495 ; external perimeter
+G1 X107.204 Y80.964 E5.84704 ; external perimeter
+G1 X108.338 Y81.033 E5.88953 ; external perimeter
+G1 X109.461 Y81.213 E5.93210 ; external perimeter
+G1 X110.553 Y81.520 E5.97455 ; external perimeter
+G1 X111.592 Y81.965 E6.01682 ; external perimeter
+G1 X112.555 Y82.547 E6.05893 ; external perimeter
+G1 X113.425 Y83.261 E6.10104 ; external perimeter
+G1 X114.189 Y84.092 E6.14327 ; external perimeter
+G1 X114.839 Y85.020 E6.18569 ; external perimeter
+G1 X115.377 Y86.022 E6.22825 ; external perimeter
+G1 X115.810 Y87.073 E6.27077 ; external perimeter
+G1 X116.153 Y88.147 E6.31296 ; external perimeter
+G1 X116.426 Y89.222 E6.35447 ; external perimeter
+G1 X116.652 Y90.281 E6.39497 ; external perimeter
+G1 X116.857 Y91.311 E6.43425 ; external perimeter
+G1 X117.065 Y92.306 E6.47229 ; external perimeter
+G1 X117.296 Y93.267 E6.50928 ; external perimeter
+G1 X117.568 Y94.200 E6.54565 ; external perimeter
+G1 X117.888 Y95.116 E6.58197 ; external perimeter
+G1 X118.257 Y96.029 E6.61881 ; external perimeter
+G1 X118.668 Y96.953 E6.65664 ; external perimeter
+G1 X119.105 Y97.901 E6.69569 ; external perimeter
+G1 X119.546 Y98.883 E6.73598 ; external perimeter
+G1 X119.964 Y99.906 E6.77733 ; external perimeter
+G1 X120.331 Y100.969 E6.81942 ; external perimeter
+G1 X120.616 Y102.068 E6.86191 ; external perimeter
+G1 E4.86191 F2400.00000 ; retract
+G92 E0 ; reset extrusion distance
+G1 X120.168 Y102.024 F7800.000 ; move to first perimeter point
+G1 E2.00000 F2400.00000 ; unretract
+G1 X120.355 Y103.203 E2.04470 F1800.000 ; perimeter
+G1 X120.391 Y104.393 E2.08924 ; perimeter
+G1 X120.259 Y105.570 E2.13354 ; perimeter
+G1 X119.950 Y106.709 E2.17770 ; perimeter
+G1 X119.469 Y107.787 E2.22190 ; perimeter
+G1 X118.829 Y108.786 E2.26628 ; perimeter
+G1 X118.054 Y109.692 E2.31090 ; perimeter
+G1 X117.175 Y110.501 E2.35560 ; perimeter
+G1 X116.225 Y111.217 E2.40010 ; perimeter
+G1 X115.240 Y111.852 E2.44396 ; perimeter
+G1 X114.250 Y112.425 E2.48676 ; perimeter
+G1 X113.280 Y112.960 E2.52819 ; perimeter
+G1 X112.349 Y113.484 E2.56817 ; perimeter
+G1 X111.464 Y114.021 E2.60691 ; perimeter
+G1 X110.624 Y114.592 E2.64492 ; perimeter
+G1 X109.820 Y115.213 E2.68293 ; perimeter
+G1 X109.035 Y115.887 E2.72163 ; perimeter
+G1 X108.250 Y116.609 E2.76156 ; perimeter
+G1 X107.442 Y117.365 E2.80294 ; perimeter
+G1 X106.593 Y118.130 E2.84570 ; perimeter
+G1 X105.687 Y118.872 E2.88953 ; perimeter
+G1 X104.715 Y119.557 E2.93401 ; perimeter
+G1 X103.676 Y120.147 E2.97871 ; perimeter
+G1 X102.577 Y120.609 E3.02334 ; perimeter
+G1 X101.431 Y120.915 E3.06773 ; perimeter
+G1 X100.257 Y121.046 E3.11193 ; perimeter
+G1 X99.078 Y120.994 E3.15609 ; perimeter
+G1 X97.917 Y120.762 E3.20038 ; perimeter
+G1 X96.795 Y120.365 E3.24491 ; perimeter
+G1 X95.728 Y119.827 E3.28961 ; perimeter
+G1 X94.727 Y119.179 E3.33423 ; perimeter
+G1 X93.793 Y118.458 E3.37840 ; perimeter
+G1 X92.921 Y117.698 E3.42167 ; perimeter
+G1 X92.098 Y116.935 E3.46368 ; perimeter
+G1 X91.305 Y116.196 E3.50423 ; perimeter
+G1 X90.523 Y115.499 E3.54342 ; perimeter
+G1 X89.730 Y114.856 E3.58164 ; perimeter
+G1 X88.907 Y114.264 E3.61956 ; perimeter
+G1 X88.042 Y113.714 E3.65791 ; perimeter
+G1 X87.130 Y113.188 E3.69730 ; perimeter
+G1 X86.176 Y112.661 E3.73810 ; perimeter
+G1 X85.192 Y112.107 E3.78033 ; perimeter
+G1 X84.201 Y111.502 E3.82378 ; perimeter
+G1 X83.232 Y110.824 E3.86805 ; perimeter
+G1 X82.318 Y110.056 E3.91271 ; perimeter
+G1 X81.494 Y109.192 E3.95739 ; perimeter
+G1 X80.792 Y108.232 E4.00188 ; perimeter
+G1 X80.239 Y107.187 E4.04615 ; perimeter
+G1 X79.854 Y106.071 E4.09030 ; perimeter
+G1 X79.645 Y104.908 E4.13452 ; perimeter
+G1 X79.609 Y103.721 E4.17895 ; perimeter
+G1 X79.734 Y102.534 E4.22360 ; perimeter
+G1 X79.994 Y101.369 E4.26830 ; perimeter
+G1 X80.360 Y100.240 E4.31270 ; perimeter
+G1 X80.795 Y99.156 E4.35638 ; perimeter
+G1 X81.263 Y98.120 E4.39893 ; perimeter
+G1 X81.730 Y97.125 E4.44007 ; perimeter
+G1 X82.168 Y96.158 E4.47977 ; perimeter
+G1 X82.558 Y95.205 E4.51831 ; perimeter
+G1 X82.890 Y94.246 E4.55627 ; perimeter
+G1 X83.165 Y93.266 E4.59436 ; perimeter
+G1 X83.396 Y92.252 E4.63327 ; perimeter
+G1 X83.604 Y91.198 E4.67348 ; perimeter
+G1 X83.816 Y90.104 E4.71516 ; perimeter
+G1 X84.063 Y88.982 E4.75816 ; perimeter
+G1 X84.375 Y87.848 E4.80215 ; perimeter
+G1 X84.779 Y86.728 E4.84671 ; perimeter
+G1 X85.297 Y85.651 E4.89142 ; perimeter
+G1 X85.941 Y84.649 E4.93600 ; perimeter
+G1 X86.714 Y83.751 E4.98035 ; perimeter
+G1 X87.610 Y82.982 E5.02452 ; perimeter
+G1 X88.615 Y82.362 E5.06869 ; perimeter
+G1 X89.705 Y81.899 E5.11303 ; perimeter
+G1 X90.856 Y81.591 E5.15761 ; perimeter
+G1 X92.040 Y81.426 E5.20232 ; perimeter
+G1 X93.230 Y81.384 E5.24688 ; perimeter
+G1 X94.405 Y81.435 E5.29090 ; perimeter
+G1 X95.550 Y81.546 E5.33395 ; perimeter
+G1 X96.657 Y81.682 E5.37567 ; perimeter
+G1 X97.726 Y81.811 E5.41593 ; perimeter
+G1 X98.762 Y81.906 E5.45489 ; perimeter
+G1 X99.780 Y81.949 E5.49300 ; perimeter
+G1 X100.794 Y81.931 E5.53094 ; perimeter
+G1 X101.820 Y81.857 E5.56945 ; perimeter
+G1 X102.874 Y81.741 E5.60911 ; perimeter
+G1 X103.963 Y81.604 E5.65020 ; perimeter
+G1 X105.092 Y81.478 E5.69270 ; perimeter
+G1 X106.256 Y81.397 E5.73635 ; perimeter
+G1 X107.442 Y81.395 E5.78073 ; perimeter
+G1 X108.631 Y81.503 E5.82542 ; perimeter
+G1 X109.800 Y81.746 E5.87008 ; perimeter
+G1 X110.920 Y82.141 E5.91452 ; perimeter
+G1 X111.965 Y82.694 E5.95875 ; perimeter
+G1 X112.910 Y83.399 E6.00290 ; perimeter
+G1 X113.739 Y84.244 E6.04715 ; perimeter
+G1 X114.439 Y85.204 E6.09164 ; perimeter
+G1 X115.010 Y86.253 E6.13631 ; perimeter
+G1 X115.462 Y87.358 E6.18098 ; perimeter
+G1 X115.811 Y88.489 E6.22527 ; perimeter
+G1 X116.082 Y89.619 E6.26876 ; perimeter
+G1 X116.306 Y90.727 E6.31104 ; perimeter
+G1 X116.512 Y91.799 E6.35189 ; perimeter
+G1 X116.730 Y92.830 E6.39132 ; perimeter
+G1 X116.984 Y93.823 E6.42970 ; perimeter
+G1 X117.291 Y94.789 E6.46762 ; perimeter
+G1 X117.655 Y95.743 E6.50582 ; perimeter
+G1 X118.074 Y96.702 E6.54497 ; perimeter
+G1 X118.532 Y97.683 E6.58547 ; perimeter
+G1 X119.003 Y98.700 E6.62743 ; perimeter
+G1 X119.457 Y99.763 E6.67066 ; perimeter
+G1 X119.857 Y100.872 E6.71480 ; perimeter
+G1 X120.168 Y102.024 E6.75942 ; perimeter
+G1 E4.75942 F2400.00000 ; retract
+G92 E0 ; reset extrusion distance
+G1 X119.720 Y101.979 F7800.000 ; move to first perimeter point
+G1 E2.00000 F2400.00000 ; unretract
+G1 X119.917 Y103.199 E2.04627 F1800.000 ; perimeter
+G1 X119.946 Y104.430 E2.09232 ; perimeter
+G1 X119.786 Y105.643 E2.13811 ; perimeter
+G1 X119.431 Y106.810 E2.18376 ; perimeter
+G1 X118.888 Y107.905 E2.22949 ; perimeter
+G1 X118.175 Y108.907 E2.27549 ; perimeter
+G1 X117.324 Y109.803 E2.32172 ; perimeter
+G1 X116.373 Y110.592 E2.36797 ; perimeter
+G1 X115.363 Y111.283 E2.41378 ; perimeter
+G1 X114.332 Y111.895 E2.45864 ; perimeter
+G1 X113.314 Y112.453 E2.50209 ; perimeter
+G1 X112.333 Y112.989 E2.54390 ; perimeter
+G1 X111.403 Y113.532 E2.58420 ; perimeter
+G1 X110.526 Y114.109 E2.62349 ; perimeter
+G1 X109.692 Y114.740 E2.66259 ; perimeter
+G1 X108.884 Y115.431 E2.70238 ; perimeter
+G1 X108.078 Y116.178 E2.74350 ; perimeter
+G1 X107.250 Y116.966 E2.78627 ; perimeter
+G1 X106.375 Y117.764 E2.83057 ; perimeter
+G1 X105.436 Y118.535 E2.87604 ; perimeter
+G1 X104.424 Y119.238 E2.92216 ; perimeter
+G1 X103.337 Y119.829 E2.96844 ; perimeter
+G1 X102.187 Y120.271 E3.01456 ; perimeter
+G1 X100.990 Y120.533 E3.06039 ; perimeter
+G1 X99.772 Y120.596 E3.10605 ; perimeter
+G1 X98.558 Y120.457 E3.15175 ; perimeter
+G1 X97.376 Y120.125 E3.19768 ; perimeter
+G1 X96.248 Y119.624 E3.24389 ; perimeter
+G1 X95.189 Y118.986 E3.29016 ; perimeter
+G1 X94.204 Y118.252 E3.33609 ; perimeter
+G1 X93.291 Y117.466 E3.38118 ; perimeter
+G1 X92.436 Y116.668 E3.42495 ; perimeter
+G1 X91.619 Y115.893 E3.46709 ; perimeter
+G1 X90.815 Y115.165 E3.50766 ; perimeter
+G1 X90.000 Y114.497 E3.54709 ; perimeter
+G1 X89.152 Y113.888 E3.58616 ; perimeter
+G1 X88.256 Y113.326 E3.62575 ; perimeter
+G1 X87.306 Y112.789 E3.66657 ; perimeter
+G1 X86.309 Y112.249 E3.70900 ; perimeter
+G1 X85.282 Y111.674 E3.75302 ; perimeter
+G1 X84.255 Y111.035 E3.79830 ; perimeter
+G1 X83.262 Y110.309 E3.84433 ; perimeter
+G1 X82.344 Y109.480 E3.89061 ; perimeter
+G1 X81.540 Y108.544 E3.93677 ; perimeter
+G1 X80.888 Y107.505 E3.98266 ; perimeter
+G1 X80.413 Y106.381 E4.02834 ; perimeter
+G1 X80.131 Y105.193 E4.07401 ; perimeter
+G1 X80.044 Y103.970 E4.11989 ; perimeter
+G1 X80.139 Y102.740 E4.16605 ; perimeter
+G1 X80.390 Y101.529 E4.21233 ; perimeter
+G1 X80.764 Y100.357 E4.25838 ; perimeter
+G1 X81.219 Y99.235 E4.30368 ; perimeter
+G1 X81.711 Y98.165 E4.34774 ; perimeter
+G1 X82.200 Y97.141 E4.39021 ; perimeter
+G1 X82.655 Y96.148 E4.43107 ; perimeter
+G1 X83.051 Y95.166 E4.47068 ; perimeter
+G1 X83.381 Y94.175 E4.50975 ; perimeter
+G1 X83.649 Y93.157 E4.54917 ; perimeter
+G1 X83.872 Y92.097 E4.58970 ; perimeter
+G1 X84.078 Y90.991 E4.63180 ; perimeter
+G1 X84.300 Y89.843 E4.67552 ; perimeter
+G1 X84.575 Y88.671 E4.72059 ; perimeter
+G1 X84.937 Y87.498 E4.76651 ; perimeter
+G1 X85.416 Y86.358 E4.81278 ; perimeter
+G1 X86.030 Y85.287 E4.85898 ; perimeter
+G1 X86.787 Y84.320 E4.90493 ; perimeter
+G1 X87.684 Y83.491 E4.95063 ; perimeter
+G1 X88.704 Y82.822 E4.99629 ; perimeter
+G1 X89.824 Y82.326 E5.04211 ; perimeter
+G1 X91.013 Y82.002 E5.08822 ; perimeter
+G1 X92.239 Y81.838 E5.13450 ; perimeter
+G1 X93.472 Y81.809 E5.18063 ; perimeter
+G1 X94.685 Y81.879 E5.22612 ; perimeter
+G1 X95.863 Y82.009 E5.27046 ; perimeter
+G1 X96.997 Y82.159 E5.31327 ; perimeter
+G1 X98.090 Y82.291 E5.35444 ; perimeter
+G1 X99.150 Y82.377 E5.39425 ; perimeter
+G1 X100.195 Y82.399 E5.43336 ; perimeter
+G1 X101.244 Y82.352 E5.47264 ; perimeter
+G1 X102.315 Y82.246 E5.51290 ; perimeter
+G1 X103.422 Y82.103 E5.55467 ; perimeter
+G1 X104.573 Y81.956 E5.59808 ; perimeter
+G1 X105.765 Y81.844 E5.64291 ; perimeter
+G1 X106.989 Y81.806 E5.68870 ; perimeter
+G1 X108.222 Y81.882 E5.73494 ; perimeter
+G1 X109.438 Y82.104 E5.78118 ; perimeter
+G1 X110.605 Y82.491 E5.82718 ; perimeter
+G1 X111.690 Y83.052 E5.87292 ; perimeter
+G1 X112.667 Y83.783 E5.91857 ; perimeter
+G1 X113.513 Y84.668 E5.96435 ; perimeter
+G1 X114.216 Y85.677 E6.01040 ; perimeter
+G1 X114.778 Y86.779 E6.05666 ; perimeter
+G1 X115.211 Y87.935 E6.10286 ; perimeter
+G1 X115.537 Y89.111 E6.14852 ; perimeter
+G1 X115.787 Y90.276 E6.19313 ; perimeter
+G1 X115.999 Y91.410 E6.23626 ; perimeter
+G1 X116.207 Y92.499 E6.27775 ; perimeter
+G1 X116.445 Y93.542 E6.31779 ; perimeter
+G1 X116.734 Y94.548 E6.35697 ; perimeter
+G1 X117.090 Y95.533 E6.39615 ; perimeter
+G1 X117.510 Y96.517 E6.43616 ; perimeter
+G1 X117.980 Y97.519 E6.47760 ; perimeter
+G1 X118.475 Y98.559 E6.52069 ; perimeter
+G1 X118.958 Y99.648 E6.56527 ; perimeter
+G1 X119.387 Y100.790 E6.61091 ; perimeter
+G1 X119.720 Y101.979 E6.65710 ; perimeter
+G1 E4.65710 F2400.00000 ; retract
+G92 E0 ; reset extrusion distance
+G1 X107.824 Y83.429 F7800.000 ; move to first infill point
+G1 X116.571 Y92.176 E0.46285 F2400.000 ; infill
+G1 X117.972 Y97.112 F7800.000 ; move to first infill point
+G1 X102.888 Y82.028 E1.26107 F2400.000 ; infill
+G1 X99.213 Y81.889 F7800.000 ; move to first infill point
+G1 X118.111 Y100.787 E2.26110 F2400.000 ; infill
+G1 X117.658 Y103.869 F7800.000 ; move to first infill point
+G1 X96.131 Y82.342 E3.40026 F2400.000 ; infill
+G1 X93.445 Y83.192 F7800.000 ; move to first infill point
+G1 X116.808 Y106.555 E4.63656 F2400.000 ; infill
+G1 X115.648 Y108.931 F7800.000 ; move to first infill point
+G1 X91.069 Y84.352 E5.93718 F2400.000 ; infill
+G1 X88.960 Y85.778 F7800.000 ; move to first infill point
+G1 X114.222 Y111.040 E7.27394 F2400.000 ; infill
+G1 X112.550 Y112.904 F7800.000 ; move to first infill point
+G1 X87.096 Y87.450 E8.62085 F2400.000 ; infill
+G1 X85.473 Y89.362 F7800.000 ; move to first infill point
+G1 X110.638 Y114.527 E9.95250 F2400.000 ; infill
+G1 X108.478 Y115.902 F7800.000 ; move to first infill point
+G1 X84.098 Y91.522 E11.24262 F2400.000 ; infill
+G1 X82.995 Y93.955 F7800.000 ; move to first infill point
+G1 X106.045 Y117.005 E12.46232 F2400.000 ; infill
+G1 X103.289 Y117.784 F7800.000 ; move to first infill point
+G1 X82.216 Y96.711 E13.57743 F2400.000 ; infill
+G1 X81.859 Y99.891 F7800.000 ; move to first infill point
+G1 X100.109 Y118.141 E14.54316 F2400.000 ; infill
+G1 X96.269 Y117.835 F7800.000 ; move to first infill point
+G1 X82.165 Y103.731 E15.28951 F2400.000 ; infill
+G1 X84.115 Y109.218 F7800.000 ; move to first infill point
+G1 X90.782 Y115.885 E15.64229 F2400.000 ; infill
+M106 S255 ; enable fan
+; layer 3, z = 0.700
+G1 Z0.700 F7800.000 ; move to next layer (2)
+G92 E0 ; reset extrusion distance
+G1 X120.838 Y104.224 F7800.000 ; move to first perimeter point
+G1 E2.00000 F2400.00000 ; unretract
+G1 X120.750 Y105.351 E2.04228 F1800.000 ; external perimeter
+G1 X120.508 Y106.450 E2.08440 ; external perimeter
+G1 X120.112 Y107.503 E2.12650 ; external perimeter
+G1 X119.570 Y108.493 E2.16872 ; external perimeter
+G1 X118.898 Y109.406 E2.21112 ; external perimeter
+G1 X118.120 Y110.235 E2.25368 ; external perimeter
+G1 X117.260 Y110.979 E2.29621 ; external perimeter
+G1 X116.348 Y111.644 E2.33845 ; external perimeter
+G1 X115.411 Y112.240 E2.38003 ; external perimeter
+G1 X114.473 Y112.786 E2.42063 ; external perimeter
+G1 X113.555 Y113.301 E2.46003 ; external perimeter
+G1 X112.669 Y113.806 E2.49817 ; external perimeter
+G1 X111.823 Y114.321 E2.53524 ; external perimeter
+G1 X111.016 Y114.865 E2.57165 ; external perimeter
+G1 X110.241 Y115.448 E2.60795 ; external perimeter
+G1 X109.486 Y116.077 E2.64472 ; external perimeter
+G1 X108.735 Y116.750 E2.68244 ; external perimeter
+G1 X107.970 Y117.456 E2.72138 ; external perimeter
+G1 X107.176 Y118.179 E2.76157 ; external perimeter
+G1 X106.337 Y118.895 E2.80283 ; external perimeter
+G1 X105.444 Y119.577 E2.84487 ; external perimeter
+G1 X104.492 Y120.194 E2.88734 ; external perimeter
+G1 X103.482 Y120.719 E2.92991 ; external perimeter
+G1 X102.422 Y121.124 E2.97238 ; external perimeter
+G1 X101.323 Y121.388 E3.01466 ; external perimeter
+G1 X100.203 Y121.497 E3.05679 ; external perimeter
+G1 X99.079 Y121.446 E3.09889 ; external perimeter
+G1 X97.970 Y121.236 E3.14110 ; external perimeter
+G1 X96.895 Y120.880 E3.18350 ; external perimeter
+G1 X95.866 Y120.396 E3.22606 ; external perimeter
+G1 X94.892 Y119.808 E3.26860 ; external perimeter
+G1 X93.978 Y119.146 E3.31083 ; external perimeter
+G1 X93.121 Y118.439 E3.35241 ; external perimeter
+G1 X92.312 Y117.716 E3.39301 ; external perimeter
+G1 X91.539 Y117.001 E3.43241 ; external perimeter
+G1 X90.785 Y116.315 E3.47055 ; external perimeter
+G1 X90.033 Y115.670 E3.50763 ; external perimeter
+G1 X89.267 Y115.070 E3.54403 ; external perimeter
+G1 X88.472 Y114.513 E3.58033 ; external perimeter
+G1 X87.641 Y113.990 E3.61710 ; external perimeter
+G1 X86.769 Y113.483 E3.65483 ; external perimeter
+G1 X85.861 Y112.974 E3.69377 ; external perimeter
+G1 X84.928 Y112.442 E3.73395 ; external perimeter
+G1 X83.988 Y111.866 E3.77522 ; external perimeter
+G1 X83.064 Y111.227 E3.81725 ; external perimeter
+G1 X82.182 Y110.513 E3.85972 ; external perimeter
+G1 X81.371 Y109.714 E3.90229 ; external perimeter
+G1 X80.659 Y108.831 E3.94476 ; external perimeter
+G1 X80.068 Y107.868 E3.98704 ; external perimeter
+G1 X79.617 Y106.836 E4.02917 ; external perimeter
+G1 X79.319 Y105.751 E4.07127 ; external perimeter
+G1 X79.176 Y104.632 E4.11348 ; external perimeter
+G1 X79.182 Y103.499 E4.15588 ; external perimeter
+G1 X79.325 Y102.371 E4.19844 ; external perimeter
+G1 X79.583 Y101.263 E4.24098 ; external perimeter
+G1 X79.930 Y100.189 E4.28321 ; external perimeter
+G1 X80.338 Y99.156 E4.32479 ; external perimeter
+G1 X80.775 Y98.163 E4.36539 ; external perimeter
+G1 X81.216 Y97.206 E4.40479 ; external perimeter
+G1 X81.636 Y96.277 E4.44294 ; external perimeter
+G1 X82.017 Y95.363 E4.48001 ; external perimeter
+G1 X82.351 Y94.449 E4.51641 ; external perimeter
+G1 X82.635 Y93.521 E4.55271 ; external perimeter
+G1 X82.876 Y92.569 E4.58948 ; external perimeter
+G1 X83.088 Y91.583 E4.62721 ; external perimeter
+G1 X83.292 Y90.563 E4.66615 ; external perimeter
+G1 X83.509 Y89.511 E4.70633 ; external perimeter
+G1 X83.767 Y88.439 E4.74760 ; external perimeter
+G1 X84.089 Y87.362 E4.78963 ; external perimeter
+G1 X84.496 Y86.303 E4.83210 ; external perimeter
+G1 X85.005 Y85.285 E4.87468 ; external perimeter
+G1 X85.624 Y84.334 E4.91715 ; external perimeter
+G1 X86.358 Y83.475 E4.95942 ; external perimeter
+G1 X87.200 Y82.728 E5.00155 ; external perimeter
+G1 X88.140 Y82.109 E5.04365 ; external perimeter
+G1 X89.160 Y81.627 E5.08586 ; external perimeter
+G1 X90.239 Y81.283 E5.12827 ; external perimeter
+G1 X91.357 Y81.069 E5.17082 ; external perimeter
+G1 X92.489 Y80.973 E5.21336 ; external perimeter
+G1 X93.618 Y80.971 E5.25559 ; external perimeter
+G1 X94.727 Y81.039 E5.29717 ; external perimeter
+G1 X95.807 Y81.149 E5.33778 ; external perimeter
+G1 X96.852 Y81.272 E5.37717 ; external perimeter
+G1 X97.866 Y81.384 E5.41532 ; external perimeter
+G1 X98.853 Y81.464 E5.45239 ; external perimeter
+G1 X99.825 Y81.499 E5.48879 ; external perimeter
+G1 X100.795 Y81.483 E5.52509 ; external perimeter
+G1 X101.776 Y81.418 E5.56186 ; external perimeter
+G1 X102.779 Y81.315 E5.59959 ; external perimeter
+G1 X103.812 Y81.193 E5.63853 ; external perimeter
+G1 X104.880 Y81.075 E5.67872 ; external perimeter
+G1 X105.979 Y80.989 E5.71998 ; external perimeter
+G1 X107.102 Y80.962 E5.76202 ; external perimeter
+G1 X108.236 Y81.022 E5.80448 ; external perimeter
+G1 X109.361 Y81.191 E5.84706 ; external perimeter
+G1 X110.457 Y81.487 E5.88953 ; external perimeter
+G1 X111.501 Y81.919 E5.93180 ; external perimeter
+G1 X112.472 Y82.489 E5.97393 ; external perimeter
+G1 X113.351 Y83.191 E6.01603 ; external perimeter
+G1 X114.124 Y84.012 E6.05824 ; external perimeter
+G1 X114.785 Y84.933 E6.10065 ; external perimeter
+G1 X115.333 Y85.930 E6.14320 ; external perimeter
+G1 X115.775 Y86.977 E6.18574 ; external perimeter
+G1 X116.126 Y88.050 E6.22797 ; external perimeter
+G1 X116.404 Y89.126 E6.26955 ; external perimeter
+G1 X116.633 Y90.186 E6.31016 ; external perimeter
+G1 X116.839 Y91.219 E6.34955 ; external perimeter
+G1 X117.045 Y92.217 E6.38770 ; external perimeter
+G1 X117.274 Y93.181 E6.42477 ; external perimeter
+G1 X117.541 Y94.117 E6.46118 ; external perimeter
+G1 X117.857 Y95.034 E6.49747 ; external perimeter
+G1 X118.222 Y95.947 E6.53425 ; external perimeter
+G1 X118.629 Y96.869 E6.57197 ; external perimeter
+G1 X119.065 Y97.814 E6.61091 ; external perimeter
+G1 X119.507 Y98.793 E6.65110 ; external perimeter
+G1 X119.928 Y99.812 E6.69236 ; external perimeter
+G1 X120.301 Y100.872 E6.73440 ; external perimeter
+G1 X120.594 Y101.968 E6.77686 ; external perimeter
+G1 X120.781 Y103.091 E6.81944 ; external perimeter
+G1 X120.838 Y104.224 E6.86191 ; external perimeter
+G1 E4.86191 F2400.00000 ; retract
+G92 E0 ; reset extrusion distance
+G1 X120.397 Y104.135 F7800.000 ; move to first perimeter point
+G1 E2.00000 F2400.00000 ; unretract
+G1 X120.303 Y105.316 E2.04435 F1800.000 ; perimeter
+G1 X120.032 Y106.466 E2.08853 ; perimeter
+G1 X119.587 Y107.559 E2.13270 ; perimeter
+G1 X118.980 Y108.576 E2.17703 ; perimeter
+G1 X118.232 Y109.503 E2.22160 ; perimeter
+G1 X117.373 Y110.334 E2.26631 ; perimeter
+G1 X116.436 Y111.069 E2.31088 ; perimeter
+G1 X115.455 Y111.720 E2.35492 ; perimeter
+G1 X114.464 Y112.304 E2.39798 ; perimeter
+G1 X113.488 Y112.846 E2.43973 ; perimeter
+G1 X112.548 Y113.369 E2.48002 ; perimeter
+G1 X111.652 Y113.902 E2.51899 ; perimeter
+G1 X110.803 Y114.464 E2.55711 ; perimeter
+G1 X109.992 Y115.073 E2.59505 ; perimeter
+G1 X109.205 Y115.736 E2.63355 ; perimeter
+G1 X108.422 Y116.448 E2.67318 ; perimeter
+G1 X107.621 Y117.199 E2.71424 ; perimeter
+G1 X106.782 Y117.964 E2.75672 ; perimeter
+G1 X105.890 Y118.715 E2.80035 ; perimeter
+G1 X104.933 Y119.415 E2.84473 ; perimeter
+G1 X103.908 Y120.028 E2.88942 ; perimeter
+G1 X102.821 Y120.521 E2.93407 ; perimeter
+G1 X101.683 Y120.862 E2.97852 ; perimeter
+G1 X100.513 Y121.033 E3.02275 ; perimeter
+G1 X99.333 Y121.021 E3.06690 ; perimeter
+G1 X98.167 Y120.827 E3.11116 ; perimeter
+G1 X97.035 Y120.464 E3.15563 ; perimeter
+G1 X95.955 Y119.955 E3.20031 ; perimeter
+G1 X94.939 Y119.328 E3.24498 ; perimeter
+G1 X93.991 Y118.619 E3.28928 ; perimeter
+G1 X93.106 Y117.865 E3.33278 ; perimeter
+G1 X92.273 Y117.100 E3.37509 ; perimeter
+G1 X91.476 Y116.353 E3.41596 ; perimeter
+G1 X90.693 Y115.646 E3.45542 ; perimeter
+G1 X89.904 Y114.991 E3.49381 ; perimeter
+G1 X89.089 Y114.389 E3.53173 ; perimeter
+G1 X88.234 Y113.831 E3.56992 ; perimeter
+G1 X87.333 Y113.301 E3.60905 ; perimeter
+G1 X86.386 Y112.777 E3.64952 ; perimeter
+G1 X85.407 Y112.231 E3.69146 ; perimeter
+G1 X84.416 Y111.640 E3.73467 ; perimeter
+G1 X83.439 Y110.978 E3.77880 ; perimeter
+G1 X82.510 Y110.231 E3.82341 ; perimeter
+G1 X81.663 Y109.388 E3.86811 ; perimeter
+G1 X80.932 Y108.449 E3.91266 ; perimeter
+G1 X80.345 Y107.421 E3.95696 ; perimeter
+G1 X79.922 Y106.319 E4.00112 ; perimeter
+G1 X79.675 Y105.164 E4.04531 ; perimeter
+G1 X79.603 Y103.980 E4.08970 ; perimeter
+G1 X79.694 Y102.791 E4.13431 ; perimeter
+G1 X79.928 Y101.619 E4.17902 ; perimeter
+G1 X80.273 Y100.481 E4.22351 ; perimeter
+G1 X80.696 Y99.388 E4.26739 ; perimeter
+G1 X81.160 Y98.342 E4.31021 ; perimeter
+G1 X81.630 Y97.338 E4.35167 ; perimeter
+G1 X82.077 Y96.367 E4.39168 ; perimeter
+G1 X82.478 Y95.412 E4.43043 ; perimeter
+G1 X82.822 Y94.456 E4.46845 ; perimeter
+G1 X83.109 Y93.482 E4.50645 ; perimeter
+G1 X83.349 Y92.476 E4.54514 ; perimeter
+G1 X83.560 Y91.431 E4.58504 ; perimeter
+G1 X83.768 Y90.345 E4.62640 ; perimeter
+G1 X84.005 Y89.228 E4.66914 ; perimeter
+G1 X84.300 Y88.095 E4.71295 ; perimeter
+G1 X84.682 Y86.969 E4.75742 ; perimeter
+G1 X85.174 Y85.880 E4.80212 ; perimeter
+G1 X85.790 Y84.859 E4.84675 ; perimeter
+G1 X86.535 Y83.936 E4.89115 ; perimeter
+G1 X87.406 Y83.137 E4.93535 ; perimeter
+G1 X88.388 Y82.484 E4.97951 ; perimeter
+G1 X89.462 Y81.986 E5.02380 ; perimeter
+G1 X90.602 Y81.645 E5.06832 ; perimeter
+G1 X91.781 Y81.451 E5.11302 ; perimeter
+G1 X92.972 Y81.384 E5.15765 ; perimeter
+G1 X94.152 Y81.418 E5.20183 ; perimeter
+G1 X95.305 Y81.519 E5.24512 ; perimeter
+G1 X96.420 Y81.652 E5.28715 ; perimeter
+G1 X97.496 Y81.785 E5.32773 ; perimeter
+G1 X98.539 Y81.889 E5.36694 ; perimeter
+G1 X99.559 Y81.944 E5.40517 ; perimeter
+G1 X100.573 Y81.940 E5.44309 ; perimeter
+G1 X101.595 Y81.878 E5.48142 ; perimeter
+G1 X102.642 Y81.769 E5.52079 ; perimeter
+G1 X103.723 Y81.634 E5.56156 ; perimeter
+G1 X104.843 Y81.503 E5.60377 ; perimeter
+G1 X106.000 Y81.409 E5.64720 ; perimeter
+G1 X107.183 Y81.387 E5.69146 ; perimeter
+G1 X108.374 Y81.468 E5.73612 ; perimeter
+G1 X109.549 Y81.681 E5.78081 ; perimeter
+G1 X110.682 Y82.042 E5.82530 ; perimeter
+G1 X111.745 Y82.560 E5.86957 ; perimeter
+G1 X112.714 Y83.233 E5.91372 ; perimeter
+G1 X113.569 Y84.049 E5.95794 ; perimeter
+G1 X114.298 Y84.987 E6.00237 ; perimeter
+G1 X114.897 Y86.019 E6.04702 ; perimeter
+G1 X115.373 Y87.114 E6.09171 ; perimeter
+G1 X115.743 Y88.242 E6.13612 ; perimeter
+G1 X116.029 Y89.375 E6.17982 ; perimeter
+G1 X116.260 Y90.489 E6.22239 ; perimeter
+G1 X116.467 Y91.569 E6.26355 ; perimeter
+G1 X116.680 Y92.609 E6.30328 ; perimeter
+G1 X116.925 Y93.610 E6.34184 ; perimeter
+G1 X117.219 Y94.581 E6.37980 ; perimeter
+G1 X117.571 Y95.536 E6.41788 ; perimeter
+G1 X117.979 Y96.492 E6.45677 ; perimeter
+G1 X118.430 Y97.467 E6.49696 ; perimeter
+G1 X118.901 Y98.475 E6.53861 ; perimeter
+G1 X119.362 Y99.527 E6.58159 ; perimeter
+G1 X119.777 Y100.627 E6.62557 ; perimeter
+G1 X120.110 Y101.770 E6.67012 ; perimeter
+G1 X120.326 Y102.945 E6.71483 ; perimeter
+G1 X120.397 Y104.135 E6.75942 ; perimeter
+G1 E4.75942 F2400.00000 ; retract
+G92 E0 ; reset extrusion distance
+G1 X119.956 Y104.045 F7800.000 ; move to first perimeter point
+G1 E2.00000 F2400.00000 ; unretract
+G1 X119.857 Y105.267 E2.04586 F1800.000 ; perimeter
+G1 X119.563 Y106.452 E2.09153 ; perimeter
+G1 X119.077 Y107.572 E2.13722 ; perimeter
+G1 X118.414 Y108.604 E2.18312 ; perimeter
+G1 X117.603 Y109.534 E2.22930 ; perimeter
+G1 X116.679 Y110.356 E2.27558 ; perimeter
+G1 X115.683 Y111.077 E2.32158 ; perimeter
+G1 X114.655 Y111.711 E2.36679 ; perimeter
+G1 X113.629 Y112.283 E2.41072 ; perimeter
+G1 X112.635 Y112.822 E2.45305 ; perimeter
+G1 X111.688 Y113.360 E2.49378 ; perimeter
+G1 X110.795 Y113.924 E2.53331 ; perimeter
+G1 X109.949 Y114.536 E2.57238 ; perimeter
+G1 X109.136 Y115.208 E2.61186 ; perimeter
+G1 X108.332 Y115.939 E2.65252 ; perimeter
+G1 X107.513 Y116.717 E2.69477 ; perimeter
+G1 X106.655 Y117.515 E2.73862 ; perimeter
+G1 X105.738 Y118.299 E2.78378 ; perimeter
+G1 X104.749 Y119.028 E2.82975 ; perimeter
+G1 X103.685 Y119.659 E2.87602 ; perimeter
+G1 X102.553 Y120.151 E2.92221 ; perimeter
+G1 X101.368 Y120.472 E2.96813 ; perimeter
+G1 X100.154 Y120.598 E3.01382 ; perimeter
+G1 X98.936 Y120.522 E3.05949 ; perimeter
+G1 X97.741 Y120.249 E3.10534 ; perimeter
+G1 X96.594 Y119.797 E3.15146 ; perimeter
+G1 X95.512 Y119.198 E3.19775 ; perimeter
+G1 X94.504 Y118.489 E3.24384 ; perimeter
+G1 X93.570 Y117.715 E3.28925 ; perimeter
+G1 X92.698 Y116.917 E3.33347 ; perimeter
+G1 X91.872 Y116.131 E3.37614 ; perimeter
+G1 X91.067 Y115.387 E3.41717 ; perimeter
+G1 X90.258 Y114.699 E3.45689 ; perimeter
+G1 X89.422 Y114.073 E3.49598 ; perimeter
+G1 X88.542 Y113.498 E3.53531 ; perimeter
+G1 X87.609 Y112.956 E3.57569 ; perimeter
+G1 X86.625 Y112.420 E3.61760 ; perimeter
+G1 X85.605 Y111.859 E3.66115 ; perimeter
+G1 X84.574 Y111.244 E3.70608 ; perimeter
+G1 X83.566 Y110.547 E3.75193 ; perimeter
+G1 X82.620 Y109.751 E3.79819 ; perimeter
+G1 X81.777 Y108.848 E3.84441 ; perimeter
+G1 X81.074 Y107.841 E3.89039 ; perimeter
+G1 X80.541 Y106.741 E3.93611 ; perimeter
+G1 X80.198 Y105.570 E3.98176 ; perimeter
+G1 X80.051 Y104.355 E4.02756 ; perimeter
+G1 X80.091 Y103.124 E4.07364 ; perimeter
+G1 X80.297 Y101.905 E4.11991 ; perimeter
+G1 X80.637 Y100.719 E4.16608 ; perimeter
+G1 X81.071 Y99.580 E4.21167 ; perimeter
+G1 X81.555 Y98.494 E4.25617 ; perimeter
+G1 X82.050 Y97.457 E4.29916 ; perimeter
+G1 X82.518 Y96.456 E4.34050 ; perimeter
+G1 X82.934 Y95.473 E4.38044 ; perimeter
+G1 X83.285 Y94.488 E4.41959 ; perimeter
+G1 X83.571 Y93.480 E4.45880 ; perimeter
+G1 X83.806 Y92.433 E4.49892 ; perimeter
+G1 X84.013 Y91.342 E4.54051 ; perimeter
+G1 X84.226 Y90.206 E4.58374 ; perimeter
+G1 X84.481 Y89.039 E4.62842 ; perimeter
+G1 X84.813 Y87.863 E4.67413 ; perimeter
+G1 X85.252 Y86.709 E4.72035 ; perimeter
+G1 X85.823 Y85.613 E4.76660 ; perimeter
+G1 X86.535 Y84.610 E4.81264 ; perimeter
+G1 X87.389 Y83.734 E4.85840 ; perimeter
+G1 X88.373 Y83.013 E4.90405 ; perimeter
+G1 X89.465 Y82.462 E4.94980 ; perimeter
+G1 X90.636 Y82.085 E4.99582 ; perimeter
+G1 X91.853 Y81.874 E5.04207 ; perimeter
+G1 X93.087 Y81.806 E5.08829 ; perimeter
+G1 X94.309 Y81.849 E5.13404 ; perimeter
+G1 X95.499 Y81.965 E5.17880 ; perimeter
+G1 X96.647 Y82.113 E5.22211 ; perimeter
+G1 X97.752 Y82.254 E5.26378 ; perimeter
+G1 X98.821 Y82.357 E5.30396 ; perimeter
+G1 X99.869 Y82.399 E5.34320 ; perimeter
+G1 X100.914 Y82.374 E5.38233 ; perimeter
+G1 X101.976 Y82.284 E5.42221 ; perimeter
+G1 X103.071 Y82.150 E5.46348 ; perimeter
+G1 X104.208 Y82.000 E5.50638 ; perimeter
+G1 X105.388 Y81.873 E5.55081 ; perimeter
+G1 X106.603 Y81.807 E5.59635 ; perimeter
+G1 X107.836 Y81.844 E5.64251 ; perimeter
+G1 X109.061 Y82.017 E5.68878 ; perimeter
+G1 X110.247 Y82.351 E5.73487 ; perimeter
+G1 X111.361 Y82.858 E5.78068 ; perimeter
+G1 X112.375 Y83.537 E5.82634 ; perimeter
+G1 X113.263 Y84.376 E5.87205 ; perimeter
+G1 X114.012 Y85.350 E5.91801 ; perimeter
+G1 X114.617 Y86.426 E5.96423 ; perimeter
+G1 X115.088 Y87.569 E6.01049 ; perimeter
+G1 X115.444 Y88.743 E6.05637 ; perimeter
+G1 X115.715 Y89.914 E6.10137 ; perimeter
+G1 X115.935 Y91.059 E6.14500 ; perimeter
+G1 X116.140 Y92.163 E6.18699 ; perimeter
+G1 X116.366 Y93.220 E6.22744 ; perimeter
+G1 X116.637 Y94.237 E6.26681 ; perimeter
+G1 X116.971 Y95.226 E6.30589 ; perimeter
+G1 X117.372 Y96.208 E6.34556 ; perimeter
+G1 X117.829 Y97.202 E6.38651 ; perimeter
+G1 X118.319 Y98.229 E6.42909 ; perimeter
+G1 X118.810 Y99.302 E6.47324 ; perimeter
+G1 X119.261 Y100.427 E6.51860 ; perimeter
+G1 X119.629 Y101.602 E6.56467 ; perimeter
+G1 X119.872 Y102.815 E6.61096 ; perimeter
+G1 X119.956 Y104.045 E6.65710 ; perimeter
+G1 E4.65710 F2400.00000 ; retract
+G92 E0 ; reset extrusion distance
+G1 X83.173 Y92.786 F7800.000 ; move to first infill point
+G1 X92.786 Y83.173 E0.50867 F2400.000 ; infill
+G1 X98.298 Y81.903 F7800.000 ; move to first infill point
+G1 X81.903 Y98.298 E1.37627 F2400.000 ; infill
+G1 X82.058 Y102.386 F7800.000 ; move to first infill point
+G1 X102.386 Y82.058 E2.45199 F2400.000 ; infill
+G1 X105.785 Y82.902 F7800.000 ; move to first infill point
+G1 X82.902 Y105.785 E3.66288 F2400.000 ; infill
+G1 X84.223 Y108.706 F7800.000 ; move to first infill point
+G1 X108.706 Y84.223 E4.95840 F2400.000 ; infill
+G1 X111.237 Y85.935 F7800.000 ; move to first infill point
+G1 X85.935 Y111.237 E6.29732 F2400.000 ; infill
+G1 X87.998 Y113.416 F7800.000 ; move to first infill point
+G1 X113.416 Y87.998 E7.64233 F2400.000 ; infill
+G1 X115.247 Y90.410 F7800.000 ; move to first infill point
+G1 X90.410 Y115.247 E8.95662 F2400.000 ; infill
+G1 X93.194 Y116.705 F7800.000 ; move to first infill point
+G1 X116.705 Y93.194 E10.20072 F2400.000 ; infill
+G1 X117.723 Y96.419 F7800.000 ; move to first infill point
+G1 X96.419 Y117.723 E11.32807 F2400.000 ; infill
+G1 X100.239 Y118.146 F7800.000 ; move to first infill point
+G1 X118.146 Y100.239 E12.27567 F2400.000 ; infill
+G1 X117.527 Y105.100 F7800.000 ; move to first infill point
+G1 X105.100 Y117.527 E12.93325 F2400.000 ; infill
+; layer 4, z = 0.900
+G1 Z0.900 F7800.000 ; move to next layer (3)
+G92 E0 ; reset extrusion distance
+G1 X120.536 Y106.353 F7800.000 ; move to first perimeter point
+G1 E2.00000 F2400.00000 ; unretract
+G1 X120.153 Y107.411 E2.04210 F1800.000 ; external perimeter
+G1 X119.624 Y108.406 E2.08429 ; external perimeter
+G1 X118.964 Y109.327 E2.12668 ; external perimeter
+G1 X118.194 Y110.163 E2.16923 ; external perimeter
+G1 X117.340 Y110.915 E2.21178 ; external perimeter
+G1 X116.432 Y111.587 E2.25405 ; external perimeter
+G1 X115.496 Y112.189 E2.29570 ; external perimeter
+G1 X114.557 Y112.739 E2.33641 ; external perimeter
+G1 X113.636 Y113.255 E2.37592 ; external perimeter
+G1 X112.747 Y113.760 E2.41417 ; external perimeter
+G1 X111.897 Y114.274 E2.45133 ; external perimeter
+G1 X111.087 Y114.814 E2.48777 ; external perimeter
+G1 X110.310 Y115.394 E2.52405 ; external perimeter
+G1 X109.553 Y116.019 E2.56076 ; external perimeter
+G1 X108.803 Y116.688 E2.59839 ; external perimeter
+G1 X108.040 Y117.391 E2.63721 ; external perimeter
+G1 X107.249 Y118.114 E2.67729 ; external perimeter
+G1 X106.415 Y118.831 E2.71847 ; external perimeter
+G1 X105.527 Y119.517 E2.76045 ; external perimeter
+G1 X104.580 Y120.142 E2.80289 ; external perimeter
+G1 X103.576 Y120.676 E2.84547 ; external perimeter
+G1 X102.519 Y121.093 E2.88795 ; external perimeter
+G1 X101.424 Y121.370 E2.93025 ; external perimeter
+G1 X100.304 Y121.494 E2.97238 ; external perimeter
+G1 X99.180 Y121.457 E3.01448 ; external perimeter
+G1 X98.069 Y121.261 E3.05668 ; external perimeter
+G1 X96.990 Y120.918 E3.09906 ; external perimeter
+G1 X95.956 Y120.444 E3.14161 ; external perimeter
+G1 X94.978 Y119.865 E3.18416 ; external perimeter
+G1 X94.058 Y119.208 E3.22643 ; external perimeter
+G1 X93.196 Y118.504 E3.26809 ; external perimeter
+G1 X92.383 Y117.781 E3.30879 ; external perimeter
+G1 X91.607 Y117.065 E3.34830 ; external perimeter
+G1 X90.852 Y116.375 E3.38655 ; external perimeter
+G1 X90.101 Y115.726 E3.42371 ; external perimeter
+G1 X89.337 Y115.122 E3.46015 ; external perimeter
+G1 X88.545 Y114.562 E3.49643 ; external perimeter
+G1 X87.717 Y114.036 E3.53314 ; external perimeter
+G1 X86.849 Y113.529 E3.57077 ; external perimeter
+G1 X85.944 Y113.021 E3.60959 ; external perimeter
+G1 X85.013 Y112.492 E3.64967 ; external perimeter
+G1 X84.073 Y111.920 E3.69085 ; external perimeter
+G1 X83.146 Y111.288 E3.73283 ; external perimeter
+G1 X82.259 Y110.580 E3.77527 ; external perimeter
+G1 X81.441 Y109.790 E3.81785 ; external perimeter
+G1 X80.718 Y108.914 E3.86033 ; external perimeter
+G1 X80.115 Y107.958 E3.90263 ; external perimeter
+G1 X79.652 Y106.932 E3.94476 ; external perimeter
+G1 X79.340 Y105.851 E3.98686 ; external perimeter
+G1 X79.183 Y104.734 E4.02906 ; external perimeter
+G1 X79.176 Y103.601 E4.07144 ; external perimeter
+G1 X79.307 Y102.472 E4.11399 ; external perimeter
+G1 X79.556 Y101.362 E4.15654 ; external perimeter
+G1 X79.896 Y100.285 E4.19881 ; external perimeter
+G1 X80.299 Y99.247 E4.24047 ; external perimeter
+G1 X80.735 Y98.251 E4.28117 ; external perimeter
+G1 X81.177 Y97.291 E4.32068 ; external perimeter
+G1 X81.599 Y96.360 E4.35894 ; external perimeter
+G1 X81.985 Y95.445 E4.39609 ; external perimeter
+G1 X82.323 Y94.532 E4.43253 ; external perimeter
+G1 X82.611 Y93.606 E4.46882 ; external perimeter
+G1 X82.856 Y92.656 E4.50552 ; external perimeter
+G1 X83.070 Y91.673 E4.54315 ; external perimeter
+G1 X83.273 Y90.656 E4.58197 ; external perimeter
+G1 X83.489 Y89.607 E4.62205 ; external perimeter
+G1 X83.742 Y88.536 E4.66323 ; external perimeter
+G1 X84.057 Y87.459 E4.70521 ; external perimeter
+G1 X84.455 Y86.397 E4.74765 ; external perimeter
+G1 X84.954 Y85.374 E4.79023 ; external perimeter
+G1 X85.564 Y84.416 E4.83271 ; external perimeter
+G1 X86.287 Y83.548 E4.87501 ; external perimeter
+G1 X87.120 Y82.790 E4.91715 ; external perimeter
+G1 X88.051 Y82.159 E4.95924 ; external perimeter
+G1 X89.065 Y81.664 E5.00144 ; external perimeter
+G1 X90.140 Y81.308 E5.04383 ; external perimeter
+G1 X91.255 Y81.084 E5.08637 ; external perimeter
+G1 X92.387 Y80.977 E5.12892 ; external perimeter
+G1 X93.517 Y80.968 E5.17120 ; external perimeter
+G1 X94.628 Y81.031 E5.21285 ; external perimeter
+G1 X95.711 Y81.138 E5.25355 ; external perimeter
+G1 X96.759 Y81.261 E5.29306 ; external perimeter
+G1 X97.775 Y81.375 E5.33132 ; external perimeter
+G1 X98.765 Y81.459 E5.36847 ; external perimeter
+G1 X99.738 Y81.498 E5.40492 ; external perimeter
+G1 X100.708 Y81.486 E5.44120 ; external perimeter
+G1 X101.687 Y81.425 E5.47791 ; external perimeter
+G1 X102.687 Y81.325 E5.51553 ; external perimeter
+G1 X103.718 Y81.204 E5.55436 ; external perimeter
+G1 X104.782 Y81.085 E5.59444 ; external perimeter
+G1 X105.879 Y80.995 E5.63561 ; external perimeter
+G1 X107.001 Y80.962 E5.67759 ; external perimeter
+G1 X108.134 Y81.013 E5.72003 ; external perimeter
+G1 X109.260 Y81.171 E5.76261 ; external perimeter
+G1 X110.360 Y81.455 E5.80510 ; external perimeter
+G1 X111.409 Y81.874 E5.84739 ; external perimeter
+G1 X112.388 Y82.432 E5.88953 ; external perimeter
+G1 X113.276 Y83.123 E5.93162 ; external perimeter
+G1 X114.059 Y83.934 E5.97382 ; external perimeter
+G1 X114.730 Y84.847 E6.01621 ; external perimeter
+G1 X115.288 Y85.837 E6.05875 ; external perimeter
+G1 X115.739 Y86.881 E6.10130 ; external perimeter
+G1 X116.097 Y87.953 E6.14358 ; external perimeter
+G1 X116.381 Y89.029 E6.18523 ; external perimeter
+G1 X116.614 Y90.092 E6.22593 ; external perimeter
+G1 X116.820 Y91.127 E6.26545 ; external perimeter
+G1 X117.026 Y92.129 E6.30370 ; external perimeter
+G1 X117.252 Y93.096 E6.34085 ; external perimeter
+G1 X117.515 Y94.033 E6.37730 ; external perimeter
+G1 X117.826 Y94.952 E6.41358 ; external perimeter
+G1 X118.187 Y95.864 E6.45029 ; external perimeter
+G1 X118.591 Y96.785 E6.48791 ; external perimeter
+G1 X119.025 Y97.728 E6.52674 ; external perimeter
+G1 X119.467 Y98.703 E6.56682 ; external perimeter
+G1 X119.892 Y99.718 E6.60799 ; external perimeter
+G1 X120.270 Y100.775 E6.64998 ; external perimeter
+G1 X120.572 Y101.868 E6.69242 ; external perimeter
+G1 X120.769 Y102.989 E6.73499 ; external perimeter
+G1 X120.839 Y104.122 E6.77748 ; external perimeter
+G1 X120.764 Y105.250 E6.81977 ; external perimeter
+G1 X120.536 Y106.353 E6.86191 ; external perimeter
+G1 E4.86191 F2400.00000 ; retract
+G92 E0 ; reset extrusion distance
+G1 X120.106 Y106.220 F7800.000 ; move to first perimeter point
+G1 E2.00000 F2400.00000 ; unretract
+G1 X119.699 Y107.327 E2.04416 F1800.000 ; perimeter
+G1 X119.125 Y108.362 E2.08844 ; perimeter
+G1 X118.405 Y109.310 E2.13297 ; perimeter
+G1 X117.568 Y110.161 E2.17766 ; perimeter
+G1 X116.645 Y110.917 E2.22229 ; perimeter
+G1 X115.671 Y111.585 E2.26648 ; perimeter
+G1 X114.679 Y112.182 E2.30979 ; perimeter
+G1 X113.698 Y112.730 E2.35185 ; perimeter
+G1 X112.748 Y113.256 E2.39245 ; perimeter
+G1 X111.843 Y113.784 E2.43168 ; perimeter
+G1 X110.984 Y114.338 E2.46993 ; perimeter
+G1 X110.166 Y114.936 E2.50785 ; perimeter
+G1 X109.375 Y115.587 E2.54617 ; perimeter
+G1 X108.593 Y116.290 E2.58552 ; perimeter
+G1 X107.797 Y117.033 E2.62626 ; perimeter
+G1 X106.969 Y117.798 E2.66845 ; perimeter
+G1 X106.089 Y118.554 E2.71186 ; perimeter
+G1 X105.146 Y119.269 E2.75611 ; perimeter
+G1 X104.136 Y119.904 E2.80076 ; perimeter
+G1 X103.062 Y120.425 E2.84545 ; perimeter
+G1 X101.934 Y120.802 E2.88995 ; perimeter
+G1 X100.769 Y121.011 E2.93422 ; perimeter
+G1 X99.590 Y121.039 E2.97837 ; perimeter
+G1 X98.418 Y120.884 E3.02259 ; perimeter
+G1 X97.277 Y120.557 E3.06701 ; perimeter
+G1 X96.185 Y120.077 E3.11166 ; perimeter
+G1 X95.154 Y119.472 E3.15635 ; perimeter
+G1 X94.191 Y118.778 E3.20077 ; perimeter
+G1 X93.293 Y118.031 E3.24448 ; perimeter
+G1 X92.451 Y117.265 E3.28708 ; perimeter
+G1 X91.647 Y116.513 E3.32827 ; perimeter
+G1 X90.863 Y115.796 E3.36802 ; perimeter
+G1 X90.077 Y115.129 E3.40660 ; perimeter
+G1 X89.269 Y114.515 E3.44456 ; perimeter
+G1 X88.424 Y113.949 E3.48263 ; perimeter
+G1 X87.533 Y113.415 E3.52151 ; perimeter
+G1 X86.596 Y112.892 E3.56167 ; perimeter
+G1 X85.622 Y112.353 E3.60329 ; perimeter
+G1 X84.631 Y111.773 E3.64625 ; perimeter
+G1 X83.648 Y111.129 E3.69022 ; perimeter
+G1 X82.706 Y110.402 E3.73476 ; perimeter
+G1 X81.839 Y109.580 E3.77947 ; perimeter
+G1 X81.080 Y108.661 E3.82406 ; perimeter
+G1 X80.459 Y107.651 E3.86842 ; perimeter
+G1 X80.000 Y106.564 E3.91260 ; perimeter
+G1 X79.714 Y105.418 E3.95676 ; perimeter
+G1 X79.604 Y104.239 E4.00110 ; perimeter
+G1 X79.661 Y103.049 E4.04566 ; perimeter
+G1 X79.866 Y101.872 E4.09037 ; perimeter
+G1 X80.190 Y100.725 E4.13495 ; perimeter
+G1 X80.600 Y99.622 E4.17900 ; perimeter
+G1 X81.058 Y98.565 E4.22208 ; perimeter
+G1 X81.529 Y97.553 E4.26385 ; perimeter
+G1 X81.983 Y96.576 E4.30417 ; perimeter
+G1 X82.395 Y95.619 E4.34316 ; perimeter
+G1 X82.753 Y94.665 E4.38129 ; perimeter
+G1 X83.052 Y93.696 E4.41922 ; perimeter
+G1 X83.300 Y92.698 E4.45771 ; perimeter
+G1 X83.515 Y91.661 E4.49731 ; perimeter
+G1 X83.722 Y90.584 E4.53835 ; perimeter
+G1 X83.950 Y89.473 E4.58081 ; perimeter
+G1 X84.229 Y88.341 E4.62442 ; perimeter
+G1 X84.591 Y87.212 E4.66879 ; perimeter
+G1 X85.057 Y86.113 E4.71347 ; perimeter
+G1 X85.645 Y85.074 E4.75813 ; perimeter
+G1 X86.362 Y84.127 E4.80258 ; perimeter
+G1 X87.206 Y83.299 E4.84682 ; perimeter
+G1 X88.166 Y82.613 E4.89097 ; perimeter
+G1 X89.222 Y82.081 E4.93522 ; perimeter
+G1 X90.350 Y81.706 E4.97969 ; perimeter
+G1 X91.523 Y81.481 E5.02437 ; perimeter
+G1 X92.713 Y81.389 E5.06904 ; perimeter
+G1 X93.897 Y81.404 E5.11335 ; perimeter
+G1 X95.057 Y81.493 E5.15687 ; perimeter
+G1 X96.181 Y81.622 E5.19920 ; perimeter
+G1 X97.265 Y81.757 E5.24010 ; perimeter
+G1 X98.315 Y81.870 E5.27958 ; perimeter
+G1 X99.339 Y81.937 E5.31798 ; perimeter
+G1 X100.352 Y81.946 E5.35591 ; perimeter
+G1 X101.371 Y81.896 E5.39409 ; perimeter
+G1 X102.412 Y81.795 E5.43319 ; perimeter
+G1 X103.485 Y81.664 E5.47364 ; perimeter
+G1 X104.596 Y81.530 E5.51555 ; perimeter
+G1 X105.746 Y81.425 E5.55875 ; perimeter
+G1 X106.924 Y81.384 E5.60286 ; perimeter
+G1 X108.115 Y81.440 E5.64747 ; perimeter
+G1 X109.296 Y81.622 E5.69217 ; perimeter
+G1 X110.440 Y81.950 E5.73672 ; perimeter
+G1 X111.521 Y82.434 E5.78103 ; perimeter
+G1 X112.513 Y83.074 E5.82519 ; perimeter
+G1 X113.394 Y83.861 E5.86938 ; perimeter
+G1 X114.150 Y84.774 E5.91376 ; perimeter
+G1 X114.777 Y85.788 E5.95837 ; perimeter
+G1 X115.279 Y86.872 E6.00307 ; perimeter
+G1 X115.670 Y87.996 E6.04758 ; perimeter
+G1 X115.972 Y89.129 E6.09147 ; perimeter
+G1 X116.212 Y90.249 E6.13431 ; perimeter
+G1 X116.422 Y91.337 E6.17580 ; perimeter
+G1 X116.632 Y92.386 E6.21583 ; perimeter
+G1 X116.868 Y93.395 E6.25460 ; perimeter
+G1 X117.150 Y94.372 E6.29263 ; perimeter
+G1 X117.490 Y95.329 E6.33062 ; perimeter
+G1 X117.886 Y96.283 E6.36929 ; perimeter
+G1 X118.329 Y97.252 E6.40917 ; perimeter
+G1 X118.798 Y98.252 E6.45050 ; perimeter
+G1 X119.264 Y99.295 E6.49322 ; perimeter
+G1 X119.692 Y100.384 E6.53702 ; perimeter
+G1 X120.046 Y101.518 E6.58148 ; perimeter
+G1 X120.291 Y102.688 E6.62618 ; perimeter
+G1 X120.395 Y103.876 E6.67081 ; perimeter
+G1 X120.338 Y105.061 E6.71521 ; perimeter
+G1 X120.106 Y106.220 E6.75942 ; perimeter
+G1 E4.75942 F2400.00000 ; retract
+G92 E0 ; reset extrusion distance
+G1 X119.676 Y106.087 F7800.000 ; move to first perimeter point
+G1 E2.00000 F2400.00000 ; unretract
+G1 X119.249 Y107.230 E2.04565 F1800.000 ; perimeter
+G1 X118.639 Y108.291 E2.09147 ; perimeter
+G1 X117.871 Y109.255 E2.13757 ; perimeter
+G1 X116.978 Y110.110 E2.18385 ; perimeter
+G1 X116.000 Y110.861 E2.22999 ; perimeter
+G1 X114.978 Y111.520 E2.27551 ; perimeter
+G1 X113.948 Y112.109 E2.31988 ; perimeter
+G1 X112.941 Y112.655 E2.36273 ; perimeter
+G1 X111.979 Y113.190 E2.40394 ; perimeter
+G1 X111.069 Y113.743 E2.44378 ; perimeter
+G1 X110.210 Y114.338 E2.48290 ; perimeter
+G1 X109.388 Y114.991 E2.52216 ; perimeter
+G1 X108.584 Y115.705 E2.56239 ; perimeter
+G1 X107.773 Y116.470 E2.60412 ; perimeter
+G1 X106.929 Y117.265 E2.64749 ; perimeter
+G1 X106.032 Y118.057 E2.69228 ; perimeter
+G1 X105.066 Y118.808 E2.73806 ; perimeter
+G1 X104.026 Y119.474 E2.78429 ; perimeter
+G1 X102.914 Y120.014 E2.83053 ; perimeter
+G1 X101.743 Y120.391 E2.87654 ; perimeter
+G1 X100.536 Y120.580 E2.92229 ; perimeter
+G1 X99.316 Y120.568 E2.96794 ; perimeter
+G1 X98.111 Y120.355 E3.01371 ; perimeter
+G1 X96.947 Y119.956 E3.05975 ; perimeter
+G1 X95.843 Y119.399 E3.10601 ; perimeter
+G1 X94.812 Y118.720 E3.15222 ; perimeter
+G1 X93.855 Y117.962 E3.19790 ; perimeter
+G1 X92.965 Y117.167 E3.24254 ; perimeter
+G1 X92.127 Y116.374 E3.28572 ; perimeter
+G1 X91.318 Y115.614 E3.32724 ; perimeter
+G1 X90.513 Y114.908 E3.36732 ; perimeter
+G1 X89.688 Y114.263 E3.40651 ; perimeter
+G1 X88.823 Y113.673 E3.44568 ; perimeter
+G1 X87.906 Y113.124 E3.48566 ; perimeter
+G1 X86.938 Y112.589 E3.52706 ; perimeter
+G1 X85.927 Y112.040 E3.57011 ; perimeter
+G1 X84.896 Y111.444 E3.61465 ; perimeter
+G1 X83.877 Y110.775 E3.66027 ; perimeter
+G1 X82.907 Y110.012 E3.70645 ; perimeter
+G1 X82.028 Y109.142 E3.75272 ; perimeter
+G1 X81.277 Y108.167 E3.79878 ; perimeter
+G1 X80.688 Y107.094 E3.84457 ; perimeter
+G1 X80.285 Y105.942 E3.89022 ; perimeter
+G1 X80.076 Y104.738 E3.93595 ; perimeter
+G1 X80.059 Y103.509 E3.98194 ; perimeter
+G1 X80.216 Y102.284 E4.02817 ; perimeter
+G1 X80.518 Y101.085 E4.07442 ; perimeter
+G1 X80.927 Y99.931 E4.12025 ; perimeter
+G1 X81.401 Y98.829 E4.16514 ; perimeter
+G1 X81.896 Y97.777 E4.20863 ; perimeter
+G1 X82.376 Y96.767 E4.25049 ; perimeter
+G1 X82.810 Y95.780 E4.29081 ; perimeter
+G1 X83.182 Y94.798 E4.33012 ; perimeter
+G1 X83.488 Y93.799 E4.36922 ; perimeter
+G1 X83.737 Y92.766 E4.40898 ; perimeter
+G1 X83.950 Y91.688 E4.45007 ; perimeter
+G1 X84.157 Y90.566 E4.49279 ; perimeter
+G1 X84.394 Y89.406 E4.53706 ; perimeter
+G1 X84.698 Y88.231 E4.58250 ; perimeter
+G1 X85.101 Y87.066 E4.62861 ; perimeter
+G1 X85.629 Y85.947 E4.67489 ; perimeter
+G1 X86.297 Y84.911 E4.72101 ; perimeter
+G1 X87.107 Y83.993 E4.76685 ; perimeter
+G1 X88.052 Y83.221 E4.81251 ; perimeter
+G1 X89.113 Y82.616 E4.85821 ; perimeter
+G1 X90.263 Y82.185 E4.90414 ; perimeter
+G1 X91.469 Y81.923 E4.95033 ; perimeter
+G1 X92.701 Y81.813 E4.99661 ; perimeter
+G1 X93.929 Y81.825 E5.04256 ; perimeter
+G1 X95.131 Y81.923 E5.08768 ; perimeter
+G1 X96.293 Y82.065 E5.13148 ; perimeter
+G1 X97.410 Y82.212 E5.17367 ; perimeter
+G1 X98.489 Y82.330 E5.21427 ; perimeter
+G1 X99.542 Y82.393 E5.25373 ; perimeter
+G1 X100.586 Y82.389 E5.29280 ; perimeter
+G1 X101.641 Y82.318 E5.33236 ; perimeter
+G1 X102.724 Y82.195 E5.37314 ; perimeter
+G1 X103.847 Y82.047 E5.41553 ; perimeter
+G1 X105.014 Y81.908 E5.45951 ; perimeter
+G1 X106.220 Y81.819 E5.50476 ; perimeter
+G1 X107.450 Y81.820 E5.55078 ; perimeter
+G1 X108.680 Y81.947 E5.59706 ; perimeter
+G1 X109.882 Y82.228 E5.64323 ; perimeter
+G1 X111.022 Y82.680 E5.68912 ; perimeter
+G1 X112.070 Y83.306 E5.73480 ; perimeter
+G1 X112.999 Y84.098 E5.78048 ; perimeter
+G1 X113.793 Y85.032 E5.82635 ; perimeter
+G1 X114.443 Y86.080 E5.87250 ; perimeter
+G1 X114.954 Y87.207 E5.91878 ; perimeter
+G1 X115.343 Y88.374 E5.96484 ; perimeter
+G1 X115.637 Y89.550 E6.01017 ; perimeter
+G1 X115.869 Y90.705 E6.05426 ; perimeter
+G1 X116.075 Y91.822 E6.09678 ; perimeter
+G1 X116.291 Y92.894 E6.13768 ; perimeter
+G1 X116.546 Y93.922 E6.17731 ; perimeter
+G1 X116.859 Y94.918 E6.21639 ; perimeter
+G1 X117.240 Y95.900 E6.25579 ; perimeter
+G1 X117.681 Y96.888 E6.29628 ; perimeter
+G1 X118.164 Y97.903 E6.33834 ; perimeter
+G1 X118.659 Y98.961 E6.38202 ; perimeter
+G1 X119.127 Y100.069 E6.42705 ; perimeter
+G1 X119.525 Y101.230 E6.47296 ; perimeter
+G1 X119.812 Y102.433 E6.51922 ; perimeter
+G1 X119.949 Y103.660 E6.56544 ; perimeter
+G1 X119.909 Y104.887 E6.61139 ; perimeter
+G1 X119.676 Y106.087 E6.65710 ; perimeter
+G1 E4.65710 F2400.00000 ; retract
+G92 E0 ; reset extrusion distance
+G1 X107.824 Y83.429 F7800.000 ; move to first infill point
+G1 X116.571 Y92.176 E0.46285 F2400.000 ; infill
+G1 X117.972 Y97.112 F7800.000 ; move to first infill point
+G1 X102.888 Y82.028 E1.26107 F2400.000 ; infill
+G1 X99.213 Y81.889 F7800.000 ; move to first infill point
+G1 X118.111 Y100.787 E2.26110 F2400.000 ; infill
+G1 X117.658 Y103.869 F7800.000 ; move to first infill point
+G1 X96.131 Y82.342 E3.40026 F2400.000 ; infill
+G1 X93.445 Y83.192 F7800.000 ; move to first infill point
+G1 X116.808 Y106.555 E4.63656 F2400.000 ; infill
+G1 X115.648 Y108.931 F7800.000 ; move to first infill point
+G1 X91.069 Y84.352 E5.93718 F2400.000 ; infill
+G1 X88.960 Y85.778 F7800.000 ; move to first infill point
+G1 X114.222 Y111.040 E7.27394 F2400.000 ; infill
+G1 X112.550 Y112.904 F7800.000 ; move to first infill point
+G1 X87.096 Y87.450 E8.62085 F2400.000 ; infill
+G1 X85.473 Y89.362 F7800.000 ; move to first infill point
+G1 X110.638 Y114.527 E9.95250 F2400.000 ; infill
+G1 X108.478 Y115.902 F7800.000 ; move to first infill point
+G1 X84.098 Y91.522 E11.24262 F2400.000 ; infill
+G1 X82.995 Y93.955 F7800.000 ; move to first infill point
+G1 X106.045 Y117.005 E12.46232 F2400.000 ; infill
+G1 X103.289 Y117.784 F7800.000 ; move to first infill point
+G1 X82.216 Y96.711 E13.57743 F2400.000 ; infill
+G1 X81.859 Y99.891 F7800.000 ; move to first infill point
+G1 X100.109 Y118.141 E14.54316 F2400.000 ; infill
+G1 X96.269 Y117.835 F7800.000 ; move to first infill point
+G1 X82.165 Y103.731 E15.28951 F2400.000 ; infill
+G1 X84.115 Y109.218 F7800.000 ; move to first infill point
+G1 X90.782 Y115.885 E15.64229 F2400.000 ; infill
+M107
+M104 S0 ; turn off temperature
+G28 X0  ; home X axis
+M84     ; disable motors
+
+; filament used = 2915.7mm (7.0cm3)
+
+; avoid_crossing_perimeters = 0.4
+; bed_shape = 2
+; bed_temperature = marlin
+; before_layer_gcode = #FFFFFF
+; bridge_acceleration = 0x0,200x0,200x200,0x200
+; bridge_fan_speed = #FFFFFF
+; brim_width = marlin
+; complete_objects = 2
+; cooling = 1
+; default_acceleration = 1
+; disable_fan_first_layers = 1
+; duplicate_distance = 1
+; end_filament_gcode = 40%
+; end_gcode = 0
+; extruder_clearance_height = 2
+; extruder_clearance_radius = 2
+; extruder_colour = 2
+; extruder_offset = 0.4
+; extrusion_axis = 60
+; extrusion_multiplier = [input_filename_base].gcode
+; fan_always_on = 60
+; fan_below_layer_time = #FFFFFF
+; filament_colour = 60
+; filament_cost = marlin
+; filament_density = 40%
+; filament_diameter = 60
+; filament_max_volumetric_speed = 0x0,200x0,200x200,0x200
+; filament_notes = [input_filename_base].gcode
+; filament_soluble = 40%
+; first_layer_acceleration = 1
+; first_layer_bed_temperature = [input_filename_base].gcode
+; first_layer_extrusion_width = #FFFFFF
+; first_layer_speed = 60
+; first_layer_temperature = 40%
+; gcode_arcs = [input_filename_base].gcode
+; gcode_comments = 1
+; gcode_flavor = 0
+; infill_acceleration = marlin
+; infill_first = 0.4
+; layer_gcode = 0x0,200x0,200x200,0x200
+; max_fan_speed = 60
+; max_print_height = 0.4
+; max_print_speed = 60
+; max_volumetric_speed = marlin
+; min_fan_speed = marlin
+; min_print_speed = 0.4
+; min_skirt_length = [input_filename_base].gcode
+; notes = 2
+; nozzle_diameter = 0x0,200x0,200x200,0x200
+; only_retract_when_crossing_perimeters = 0.4
+; ooze_prevention = 2
+; output_filename_format = 0x0,200x0,200x200,0x200
+; perimeter_acceleration = 0x0,200x0,200x200,0x200
+; post_process = 0
+; printer_notes = #FFFFFF
+; resolution = #FFFFFF
+; retract_before_travel = 40%
+; retract_before_wipe = 1
+; retract_layer_change = 1
+; retract_length = 2
+; retract_length_toolchange = 2
+; retract_lift = 0x0,200x0,200x200,0x200
+; retract_lift_above = 40%
+; retract_lift_below = 0.4
+; retract_restart_extra = #FFFFFF
+; retract_restart_extra_toolchange = 0
+; retract_speed = 0
+; skirt_distance = marlin
+; skirt_height = 0
+; skirts = 40%
+; slowdown_below_layer_time = 1
+; spiral_vase = 2
+; standby_temperature_delta = #FFFFFF
+; start_filament_gcode = 1
+; start_gcode = 1
+; temperature = 60
+; threads = 0
+; toolchange_gcode = [input_filename_base].gcode
+; travel_speed = 1
+; use_firmware_retraction = #FFFFFF
+; use_relative_e_distances = #FFFFFF
+; use_set_and_wait_bed = 0
+; use_set_and_wait_extruder = 0.4
+; use_volumetric_e = 2
+; variable_layer_height = #FFFFFF
+; wipe = [input_filename_base].gcode
+; z_offset = [input_filename_base].gcode
@@ -0,0 +1,1551 @@
+;FLAVOR:Marlin
+;TIME:1843
+;Filament used: 2.91573m
+;Layer height: 0.2
+;MINX:78.5
+;MINY:78.5
+;MINZ:0.3
+;MAXX:121.5
+;MAXY:121.5
+;MAXZ:2.1
+;Generated with Cura_SteamEngine 4.8.0
+M140 S60
+M105
+M190 S60
+M104 S210
+M105
+M109 S210
+M82 ;absolute extrusion mode
+G28 ;Home
+G1 Z15.0 F6000 ;Move the platform down 15mm
+;Prime the extruder
+G92 E0
+G1 F200 E3
+G92 E0
+G92 E0
+G92 E0
+G1 F2700 E-5
+;LAYER_COUNT:10
+;LAYER:0
+M107
+G0 F3600 X120.000 Y100.000 Z0.3
+G1 F2700 E0.00000
+;TYPE:WALL-OUTER
+G1 F1800 X120.360 Y101.067 E0.04214
+G1 X120.636 Y102.169 E0.08465
+G1 X120.801 Y103.295 E0.12722
+G1 X120.834 Y104.428 E0.16965
+G1 X120.718 Y105.551 E0.21190
+G1 X120.448 Y106.644 E0.25401
+G1 X120.024 Y107.687 E0.29612
+G1 X119.458 Y108.663 E0.33836
+G1 X118.765 Y109.561 E0.38080
+G1 X117.970 Y110.375 E0.42337
+G1 X117.099 Y111.104 E0.46588
+G1 X116.180 Y111.756 E0.50802
+G1 X115.241 Y112.342 E0.54944
+G1 X114.306 Y112.881 E0.58984
+G1 X113.392 Y113.392 E0.62901
+G1 X112.513 Y113.898 E0.66694
+G1 X111.675 Y114.417 E0.70386
+G1 X110.874 Y114.967 E0.74020
+G1 X110.104 Y115.558 E0.77654
+G1 X109.350 Y116.196 E0.81346
+G1 X108.598 Y116.875 E0.85139
+G1 X107.830 Y117.586 E0.89056
+G1 X107.028 Y118.309 E0.93095
+G1 X106.180 Y119.021 E0.97238
+G1 X105.277 Y119.694 E1.01452
+G1 X104.314 Y120.297 E1.05703
+G1 X103.295 Y120.801 E1.09960
+G1 X102.226 Y121.182 E1.14204
+G1 X101.123 Y121.419 E1.18428
+G1 X100.000 Y121.500 E1.22639
+G1 X98.877 Y121.419 E1.26850
+G1 X97.774 Y121.182 E1.31075
+G1 X96.705 Y120.801 E1.35318
+G1 X95.686 Y120.297 E1.39575
+G1 X94.723 Y119.694 E1.43826
+G1 X93.820 Y119.021 E1.48040
+G1 X92.972 Y118.309 E1.52183
+G1 X92.170 Y117.586 E1.56222
+G1 X91.402 Y116.875 E1.60139
+G1 X90.650 Y116.196 E1.63932
+G1 X89.896 Y115.558 E1.67624
+G1 X89.126 Y114.967 E1.71258
+G1 X88.325 Y114.417 E1.74892
+G1 X87.487 Y113.898 E1.78584
+G1 X86.608 Y113.392 E1.82377
+G1 X85.694 Y112.881 E1.86294
+G1 X84.759 Y112.342 E1.90334
+G1 X83.820 Y111.756 E1.94476
+G1 X82.901 Y111.104 E1.98690
+G1 X82.030 Y110.375 E2.02941
+G1 X81.235 Y109.561 E2.07198
+G1 X80.542 Y108.663 E2.11442
+G1 X79.976 Y107.687 E2.15666
+G1 X79.552 Y106.644 E2.19877
+G1 X79.282 Y105.551 E2.24088
+G1 X79.166 Y104.428 E2.28313
+G1 X79.199 Y103.295 E2.32556
+G1 X79.364 Y102.169 E2.36813
+G1 X79.640 Y101.067 E2.41064
+G1 X80.000 Y100.000 E2.45278
+G1 X80.415 Y98.974 E2.49421
+G1 X80.855 Y97.988 E2.53461
+G1 X81.294 Y97.037 E2.57378
+G1 X81.708 Y96.112 E2.61171
+G1 X82.081 Y95.199 E2.64862
+G1 X82.405 Y94.283 E2.68496
+G1 X82.681 Y93.352 E2.72130
+G1 X82.916 Y92.394 E2.75822
+G1 X83.125 Y91.402 E2.79615
+G1 X83.329 Y90.375 E2.83532
+G1 X83.552 Y89.319 E2.87572
+G1 X83.820 Y88.244 E2.91715
+G1 X84.155 Y87.169 E2.95929
+G1 X84.580 Y86.116 E3.00179
+G1 X85.108 Y85.108 E3.04436
+G1 X85.748 Y84.172 E3.08680
+G1 X86.502 Y83.331 E3.12904
+G1 X87.363 Y82.606 E3.17115
+G1 X88.318 Y82.011 E3.21326
+G1 X89.350 Y81.554 E3.25551
+G1 X90.439 Y81.235 E3.29795
+G1 X91.560 Y81.044 E3.34052
+G1 X92.694 Y80.966 E3.38302
+G1 X93.820 Y80.979 E3.42516
+G1 X94.924 Y81.056 E3.46659
+G1 X95.998 Y81.171 E3.50699
+G1 X97.037 Y81.294 E3.54616
+G1 X98.045 Y81.401 E3.58409
+G1 X99.029 Y81.474 E3.62100
+G1 X100.000 Y81.500 E3.65734
+G1 X100.971 Y81.474 E3.69369
+G1 X101.955 Y81.401 E3.73060
+G1 X102.963 Y81.294 E3.76853
+G1 X104.002 Y81.171 E3.80770
+G1 X105.076 Y81.056 E3.84810
+G1 X106.180 Y80.979 E3.88953
+G1 X107.306 Y80.966 E3.93167
+G1 X108.440 Y81.044 E3.97417
+G1 X109.561 Y81.235 E4.01674
+G1 X110.650 Y81.554 E4.05918
+G1 X111.682 Y82.011 E4.10142
+G1 X112.637 Y82.606 E4.14354
+G1 X113.498 Y83.331 E4.18565
+G1 X114.252 Y84.172 E4.22789
+G1 X114.892 Y85.108 E4.27033
+G1 X115.420 Y86.116 E4.31290
+G1 X115.845 Y87.169 E4.35540
+G1 X116.180 Y88.244 E4.39754
+G1 X116.448 Y89.319 E4.43897
+G1 X116.671 Y90.375 E4.47937
+G1 X116.875 Y91.402 E4.51854
+G1 X117.084 Y92.394 E4.55647
+G1 X117.319 Y93.352 E4.59339
+G1 X117.595 Y94.283 E4.62973
+G1 X117.919 Y95.199 E4.66607
+G1 X118.292 Y96.112 E4.70298
+G1 X118.706 Y97.037 E4.74091
+G1 X119.145 Y97.988 E4.78008
+G1 X119.585 Y98.974 E4.82048
+G1 X120.000 Y100.000 E4.86191
+G0 F3600 X119.550 Y100.000
+;TYPE:WALL-INNER
+G1 F1800 X119.934 Y101.119 E4.90619
+G1 X120.220 Y102.278 E4.95085
+G1 X120.376 Y103.462 E4.99553
+G1 X120.377 Y104.651 E5.04002
+G1 X120.207 Y105.822 E5.08428
+G1 X119.860 Y106.949 E5.12843
+G1 X119.342 Y108.012 E5.17266
+G1 X118.671 Y108.991 E5.21709
+G1 X117.870 Y109.877 E5.26175
+G1 X116.973 Y110.665 E5.30644
+G1 X116.013 Y111.362 E5.35083
+G1 X115.024 Y111.981 E5.39449
+G1 X114.036 Y112.544 E5.43702
+G1 X113.074 Y113.074 E5.47813
+G1 X112.152 Y113.598 E5.51781
+G1 X111.277 Y114.141 E5.55634
+G1 X110.446 Y114.723 E5.59429
+G1 X109.648 Y115.355 E5.63239
+G1 X108.865 Y116.040 E5.67132
+G1 X108.077 Y116.771 E5.71156
+G1 X107.262 Y117.532 E5.75326
+G1 X106.401 Y118.294 E5.79628
+G1 X105.482 Y119.027 E5.84029
+G1 X104.495 Y119.694 E5.88485
+G1 X103.442 Y120.259 E5.92956
+G1 X102.331 Y120.689 E5.97414
+G1 X101.177 Y120.958 E6.01848
+G1 X100.000 Y121.050 E6.06266
+G1 X98.823 Y120.958 E6.10683
+G1 X97.669 Y120.689 E6.15117
+G1 X96.558 Y120.259 E6.19575
+G1 X95.505 Y119.694 E6.24046
+G1 X94.518 Y119.027 E6.28502
+G1 X93.599 Y118.294 E6.32903
+G1 X92.738 Y117.532 E6.37205
+G1 X91.923 Y116.771 E6.41375
+G1 X91.135 Y116.040 E6.45399
+G1 X90.352 Y115.355 E6.49292
+G1 X89.554 Y114.723 E6.53102
+G1 X88.723 Y114.141 E6.56897
+G1 X87.848 Y113.598 E6.60750
+G1 X86.926 Y113.074 E6.64718
+G1 X85.964 Y112.544 E6.68829
+G1 X84.976 Y111.981 E6.73082
+G1 X83.987 Y111.362 E6.77448
+G1 X83.027 Y110.665 E6.81887
+G1 X82.130 Y109.877 E6.86356
+G1 X81.329 Y108.991 E6.90822
+G1 X80.658 Y108.012 E6.95265
+G1 X80.140 Y106.949 E6.99688
+G1 X79.793 Y105.822 E7.04103
+G1 X79.623 Y104.651 E7.08529
+G1 X79.624 Y103.462 E7.12978
+G1 X79.780 Y102.278 E7.17446
+G1 X80.066 Y101.119 E7.21912
+G1 X80.450 Y100.000 E7.26340
+G1 X80.895 Y98.927 E7.30687
+G1 X81.366 Y97.900 E7.34913
+G1 X81.829 Y96.913 E7.38995
+G1 X82.258 Y95.950 E7.42936
+G1 X82.635 Y94.997 E7.46772
+G1 X82.954 Y94.035 E7.50564
+G1 X83.218 Y93.049 E7.54386
+G1 X83.443 Y92.026 E7.58302
+G1 X83.649 Y90.963 E7.62355
+G1 X83.866 Y89.862 E7.66553
+G1 X84.124 Y88.736 E7.70879
+G1 X84.454 Y87.603 E7.75294
+G1 X84.882 Y86.489 E7.79756
+G1 X85.426 Y85.426 E7.84226
+G1 X86.098 Y84.444 E7.88679
+G1 X86.899 Y83.572 E7.93109
+G1 X87.820 Y82.834 E7.97525
+G1 X88.846 Y82.248 E8.01945
+G1 X89.952 Y81.819 E8.06384
+G1 X91.112 Y81.543 E8.10845
+G1 X92.299 Y81.408 E8.15316
+G1 X93.488 Y81.389 E8.19765
+G1 X94.657 Y81.456 E8.24149
+G1 X95.795 Y81.575 E8.28427
+G1 X96.893 Y81.712 E8.32568
+G1 X97.953 Y81.835 E8.36563
+G1 X98.985 Y81.920 E8.40435
+G1 X100.000 Y81.950 E8.44236
+G1 X101.015 Y81.920 E8.48037
+G1 X102.047 Y81.835 E8.51909
+G1 X103.107 Y81.712 E8.55905
+G1 X104.205 Y81.575 E8.60045
+G1 X105.343 Y81.456 E8.64324
+G1 X106.512 Y81.389 E8.68708
+G1 X107.701 Y81.408 E8.73156
+G1 X108.888 Y81.543 E8.77627
+G1 X110.048 Y81.819 E8.82089
+G1 X111.154 Y82.248 E8.86528
+G1 X112.180 Y82.834 E8.90948
+G1 X113.101 Y83.572 E8.95363
+G1 X113.902 Y84.444 E8.99793
+G1 X114.574 Y85.426 E9.04247
+G1 X115.118 Y86.489 E9.08717
+G1 X115.546 Y87.603 E9.13179
+G1 X115.876 Y88.736 E9.17594
+G1 X116.134 Y89.862 E9.21919
+G1 X116.351 Y90.963 E9.26118
+G1 X116.557 Y92.026 E9.30170
+G1 X116.782 Y93.049 E9.34087
+G1 X117.046 Y94.035 E9.37908
+G1 X117.365 Y94.997 E9.41700
+G1 X117.742 Y95.950 E9.45536
+G1 X118.171 Y96.913 E9.49478
+G1 X118.634 Y97.900 E9.53560
+G1 X119.105 Y98.927 E9.57786
+G1 X119.550 Y100.000 E9.62132
+G0 F3600 X119.100 Y100.000
+;TYPE:WALL-INNER
+G1 F1800 X119.504 Y101.157 E9.66719
+G1 X119.798 Y102.358 E9.71345
+G1 X119.945 Y103.585 E9.75967
+G1 X119.917 Y104.813 E9.80564
+G1 X119.696 Y106.015 E9.85136
+G1 X119.281 Y107.162 E9.89701
+G1 X118.681 Y108.229 E9.94282
+G1 X117.922 Y109.199 E9.98890
+G1 X117.036 Y110.061 E10.03517
+G1 X116.062 Y110.818 E10.08133
+G1 X115.041 Y111.482 E10.12690
+G1 X114.010 Y112.074 E10.17136
+G1 X113.002 Y112.622 E10.21431
+G1 X112.036 Y113.157 E10.25562
+G1 X111.123 Y113.708 E10.29553
+G1 X110.261 Y114.300 E10.33466
+G1 X109.437 Y114.949 E10.37389
+G1 X108.633 Y115.659 E10.41404
+G1 X107.823 Y116.422 E10.45567
+G1 X106.982 Y117.216 E10.49894
+G1 X106.089 Y118.010 E10.54366
+G1 X105.127 Y118.764 E10.58939
+G1 X104.091 Y119.437 E10.63561
+G1 X102.983 Y119.985 E10.68186
+G1 X101.816 Y120.373 E10.72789
+G1 X100.610 Y120.575 E10.77365
+G1 X99.390 Y120.575 E10.81929
+G1 X98.184 Y120.373 E10.86505
+G1 X97.017 Y119.985 E10.91108
+G1 X95.909 Y119.437 E10.95733
+G1 X94.873 Y118.764 E11.00355
+G1 X93.911 Y118.010 E11.04928
+G1 X93.018 Y117.216 E11.09400
+G1 X92.177 Y116.422 E11.13727
+G1 X91.367 Y115.659 E11.17890
+G1 X90.563 Y114.949 E11.21905
+G1 X89.739 Y114.300 E11.25828
+G1 X88.877 Y113.708 E11.29742
+G1 X87.964 Y113.157 E11.33732
+G1 X86.998 Y112.622 E11.37863
+G1 X85.990 Y112.074 E11.42158
+G1 X84.959 Y111.482 E11.46604
+G1 X83.938 Y110.818 E11.51161
+G1 X82.964 Y110.061 E11.55777
+G1 X82.078 Y109.199 E11.60404
+G1 X81.319 Y108.229 E11.65013
+G1 X80.719 Y107.162 E11.69593
+G1 X80.304 Y106.015 E11.74158
+G1 X80.083 Y104.813 E11.78730
+G1 X80.055 Y103.585 E11.83327
+G1 X80.202 Y102.358 E11.87949
+G1 X80.496 Y101.157 E11.92575
+G1 X80.900 Y100.000 E11.97162
+G1 X81.371 Y98.894 E12.01658
+G1 X81.866 Y97.840 E12.06017
+G1 X82.348 Y96.827 E12.10212
+G1 X82.786 Y95.840 E12.14254
+G1 X83.162 Y94.858 E12.18189
+G1 X83.471 Y93.860 E12.22097
+G1 X83.723 Y92.830 E12.26067
+G1 X83.937 Y91.755 E12.30166
+G1 X84.144 Y90.635 E12.34428
+G1 X84.378 Y89.478 E12.38846
+G1 X84.677 Y88.302 E12.43385
+G1 X85.073 Y87.136 E12.47993
+G1 X85.593 Y86.014 E12.52622
+G1 X86.252 Y84.972 E12.57235
+G1 X87.054 Y84.045 E12.61821
+G1 X87.991 Y83.263 E12.66387
+G1 X89.045 Y82.648 E12.70956
+G1 X90.190 Y82.206 E12.75547
+G1 X91.394 Y81.935 E12.80165
+G1 X92.625 Y81.816 E12.84793
+G1 X93.854 Y81.822 E12.89392
+G1 X95.058 Y81.915 E12.93910
+G1 X96.223 Y82.056 E12.98300
+G1 X97.343 Y82.204 E13.02528
+G1 X98.424 Y82.324 E13.06598
+G1 X99.478 Y82.391 E13.10549
+G1 X100.522 Y82.391 E13.14455
+G1 X101.576 Y82.324 E13.18406
+G1 X102.657 Y82.204 E13.22475
+G1 X103.777 Y82.056 E13.26704
+G1 X104.942 Y81.915 E13.31093
+G1 X106.146 Y81.822 E13.35612
+G1 X107.375 Y81.816 E13.40211
+G1 X108.606 Y81.935 E13.44838
+G1 X109.810 Y82.206 E13.49456
+G1 X110.955 Y82.648 E13.54048
+G1 X112.009 Y83.263 E13.58616
+G1 X112.946 Y84.045 E13.63183
+G1 X113.748 Y84.972 E13.67769
+G1 X114.407 Y86.014 E13.72382
+G1 X114.927 Y87.136 E13.77010
+G1 X115.323 Y88.302 E13.81619
+G1 X115.622 Y89.478 E13.86158
+G1 X115.856 Y90.635 E13.90576
+G1 X116.063 Y91.755 E13.94838
+G1 X116.277 Y92.830 E13.98937
+G1 X116.529 Y93.860 E14.02907
+G1 X116.838 Y94.858 E14.06815
+G1 X117.214 Y95.840 E14.10750
+G1 X117.652 Y96.827 E14.14791
+G1 X118.134 Y97.840 E14.18987
+G1 X118.629 Y98.894 E14.23346
+G1 X119.100 Y100.000 E14.27842
+;TYPE:FILL
+G0 F7200 X83.173 Y92.786
+G1 F2400 X92.786 Y83.173 E14.78709
+G0 F7200 X98.298 Y81.903
+G1 F2400 X81.903 Y98.298 E15.65469
+G0 F7200 X82.058 Y102.386
+G1 F2400 X102.386 Y82.058 E16.73041
+G0 F7200 X105.785 Y82.902
+G1 F2400 X82.902 Y105.785 E17.94130
+G0 F7200 X84.223 Y108.706
+G1 F2400 X108.706 Y84.223 E19.23682
+G0 F7200 X111.237 Y85.935
+G1 F2400 X85.935 Y111.237 E20.57574
+G0 F7200 X87.998 Y113.416
+G1 F2400 X113.416 Y87.998 E21.92075
+G0 F7200 X115.247 Y90.410
+G1 F2400 X90.410 Y115.247 E23.23504
+G0 F7200 X93.194 Y116.705
+G1 F2400 X116.705 Y93.194 E24.47914
+G0 F7200 X117.723 Y96.419
+G1 F2400 X96.419 Y117.723 E25.60649
+G0 F7200 X100.239 Y118.146
+G1 F2400 X118.146 Y100.239 E26.55409
+G0 F7200 X117.527 Y105.100
+G1 F2400 X105.100 Y117.527 E27.21167
+G1 F2700 E22.21167
+;TIME_ELAPSED:180.123000
+;LAYER:1
+G0 F7200 X120.616 Y102.068 Z0.5
+G1 F2700 E27.21167
+;TYPE:WALL-OUTER
+G1 F1800 X120.792 Y103.193 E27.25424
+G1 X120.837 Y104.326 E27.29670
+G1 X120.735 Y105.451 E27.33896
+G1 X120.478 Y106.547 E27.38108
+G1 X120.069 Y107.595 E27.42318
+G1 X119.514 Y108.578 E27.46541
+G1 X118.832 Y109.484 E27.50783
+G1 X118.045 Y110.305 E27.55039
+G1 X117.180 Y111.042 E27.59292
+G1 X116.264 Y111.700 E27.63510
+G1 X115.326 Y112.291 E27.67661
+G1 X114.389 Y112.834 E27.71711
+G1 X113.473 Y113.347 E27.75639
+G1 X112.591 Y113.852 E27.79443
+G1 X111.749 Y114.369 E27.83142
+G1 X110.945 Y114.916 E27.86779
+G1 X110.172 Y115.503 E27.90411
+G1 X109.418 Y116.136 E27.94095
+G1 X108.666 Y116.812 E27.97878
+G1 X107.900 Y117.521 E28.01783
+G1 X107.102 Y118.244 E28.05813
+G1 X106.259 Y118.958 E28.09947
+G1 X105.361 Y119.635 E28.14157
+G1 X104.403 Y120.246 E28.18405
+G1 X103.389 Y120.761 E28.22663
+G1 X102.324 Y121.154 E28.26908
+G1 X101.223 Y121.404 E28.31134
+G1 X100.101 Y121.499 E28.35346
+G1 X98.978 Y121.433 E28.39556
+G1 X97.872 Y121.210 E28.43779
+G1 X96.800 Y120.841 E28.48021
+G1 X95.775 Y120.347 E28.52278
+G1 X94.807 Y119.751 E28.56530
+G1 X93.899 Y119.084 E28.60749
+G1 X93.046 Y118.374 E28.64899
+G1 X92.241 Y117.651 E28.68949
+G1 X91.470 Y116.938 E28.72878
+G1 X90.717 Y116.255 E28.76681
+G1 X89.965 Y115.614 E28.80381
+G1 X89.196 Y115.018 E28.84018
+G1 X88.399 Y114.465 E28.87649
+G1 X87.564 Y113.943 E28.91334
+G1 X86.689 Y113.438 E28.95116
+G1 X85.778 Y112.928 E28.99022
+G1 X84.844 Y112.392 E29.03051
+G1 X83.904 Y111.811 E29.07186
+G1 X82.982 Y111.166 E29.11395
+G1 X82.106 Y110.444 E29.15643
+G1 X81.303 Y109.638 E29.19901
+G1 X80.600 Y108.747 E29.24146
+G1 X80.021 Y107.778 E29.28372
+G1 X79.584 Y106.740 E29.32584
+G1 X79.300 Y105.651 E29.36794
+G1 X79.171 Y104.530 E29.41017
+G1 X79.190 Y103.397 E29.45259
+G1 X79.344 Y102.270 E29.49516
+G1 X79.611 Y101.165 E29.53768
+G1 X79.965 Y100.095 E29.57987
+G1 X80.376 Y99.064 E29.62137
+G1 X80.815 Y98.075 E29.66187
+G1 X81.255 Y97.122 E29.70116
+G1 X81.672 Y96.195 E29.73920
+G1 X82.049 Y95.281 E29.77619
+G1 X82.378 Y94.366 E29.81256
+G1 X82.658 Y93.437 E29.84887
+G1 X82.896 Y92.481 E29.88572
+G1 X83.107 Y91.493 E29.92354
+G1 X83.310 Y90.469 E29.96260
+G1 X83.531 Y89.415 E30.00289
+G1 X83.793 Y88.341 E30.04424
+G1 X84.122 Y87.266 E30.08633
+G1 X84.537 Y86.209 E30.12881
+G1 X85.056 Y85.196 E30.17139
+G1 X85.686 Y84.253 E30.21384
+G1 X86.429 Y83.402 E30.25610
+G1 X87.281 Y82.666 E30.29822
+G1 X88.229 Y82.059 E30.34033
+G1 X89.255 Y81.590 E30.38255
+G1 X90.339 Y81.258 E30.42498
+G1 X91.458 Y81.056 E30.46754
+G1 X92.591 Y80.969 E30.51006
+G1 X93.719 Y80.975 E30.55225
+G1 X94.826 Y81.048 E30.59376
+G1 X95.902 Y81.160 E30.63426
+G1 X96.945 Y81.283 E30.67354
+G1 X97.955 Y81.393 E30.71158
+G1 X98.941 Y81.470 E30.74857
+G1 X99.913 Y81.500 E30.78494
+G1 X100.883 Y81.479 E30.82126
+G1 X101.865 Y81.410 E30.85810
+G1 X102.871 Y81.305 E30.89593
+G1 X103.907 Y81.182 E30.93498
+G1 X104.978 Y81.066 E30.97527
+G1 X106.080 Y80.984 E31.01662
+G1 X107.204 Y80.964 E31.05871
+G1 X108.338 Y81.033 E31.10120
+G1 X109.461 Y81.213 E31.14377
+G1 X110.553 Y81.520 E31.18622
+G1 X111.592 Y81.965 E31.22849
+G1 X112.555 Y82.547 E31.27060
+G1 X113.425 Y83.261 E31.31271
+G1 X114.189 Y84.092 E31.35494
+G1 X114.839 Y85.020 E31.39736
+G1 X115.377 Y86.022 E31.43992
+G1 X115.810 Y87.073 E31.48244
+G1 X116.153 Y88.147 E31.52463
+G1 X116.426 Y89.222 E31.56614
+G1 X116.652 Y90.281 E31.60664
+G1 X116.857 Y91.311 E31.64592
+G1 X117.065 Y92.306 E31.68396
+G1 X117.296 Y93.267 E31.72095
+G1 X117.568 Y94.200 E31.75732
+G1 X117.888 Y95.116 E31.79364
+G1 X118.257 Y96.029 E31.83048
+G1 X118.668 Y96.953 E31.86831
+G1 X119.105 Y97.901 E31.90736
+G1 X119.546 Y98.883 E31.94765
+G1 X119.964 Y99.906 E31.98900
+G1 X120.331 Y100.969 E32.03109
+G1 X120.616 Y102.068 E32.07358
+G0 F7200 X120.168 Y102.024
+;TYPE:WALL-INNER
+G1 F1800 X120.355 Y103.203 E32.11828
+G1 X120.391 Y104.393 E32.16282
+G1 X120.259 Y105.570 E32.20712
+G1 X119.950 Y106.709 E32.25128
+G1 X119.469 Y107.787 E32.29547
+G1 X118.829 Y108.786 E32.33986
+G1 X118.054 Y109.692 E32.38447
+G1 X117.175 Y110.501 E32.42918
+G1 X116.225 Y111.217 E32.47367
+G1 X115.240 Y111.852 E32.51753
+G1 X114.250 Y112.425 E32.56034
+G1 X113.280 Y112.960 E32.60177
+G1 X112.349 Y113.484 E32.64175
+G1 X111.464 Y114.021 E32.68049
+G1 X110.624 Y114.592 E32.71850
+G1 X109.820 Y115.213 E32.75650
+G1 X109.035 Y115.887 E32.79521
+G1 X108.250 Y116.609 E32.83514
+G1 X107.442 Y117.365 E32.87652
+G1 X106.593 Y118.130 E32.91928
+G1 X105.687 Y118.872 E32.96311
+G1 X104.715 Y119.557 E33.00759
+G1 X103.676 Y120.147 E33.05229
+G1 X102.577 Y120.609 E33.09691
+G1 X101.431 Y120.915 E33.14131
+G1 X100.257 Y121.046 E33.18551
+G1 X99.078 Y120.994 E33.22966
+G1 X97.917 Y120.762 E33.27396
+G1 X96.795 Y120.365 E33.31849
+G1 X95.728 Y119.827 E33.36319
+G1 X94.727 Y119.179 E33.40781
+G1 X93.793 Y118.458 E33.45198
+G1 X92.921 Y117.698 E33.49525
+G1 X92.098 Y116.935 E33.53726
+G1 X91.305 Y116.196 E33.57781
+G1 X90.523 Y115.499 E33.61700
+G1 X89.730 Y114.856 E33.65522
+G1 X88.907 Y114.264 E33.69314
+G1 X88.042 Y113.714 E33.73149
+G1 X87.130 Y113.188 E33.77088
+G1 X86.176 Y112.661 E33.81167
+G1 X85.192 Y112.107 E33.85391
+G1 X84.201 Y111.502 E33.89736
+G1 X83.232 Y110.824 E33.94163
+G1 X82.318 Y110.056 E33.98629
+G1 X81.494 Y109.192 E34.03097
+G1 X80.792 Y108.232 E34.07546
+G1 X80.239 Y107.187 E34.11972
+G1 X79.854 Y106.071 E34.16388
+G1 X79.645 Y104.908 E34.20810
+G1 X79.609 Y103.721 E34.25253
+G1 X79.734 Y102.534 E34.29718
+G1 X79.994 Y101.369 E34.34188
+G1 X80.360 Y100.240 E34.38628
+G1 X80.795 Y99.156 E34.42996
+G1 X81.263 Y98.120 E34.47251
+G1 X81.730 Y97.125 E34.51365
+G1 X82.168 Y96.158 E34.55335
+G1 X82.558 Y95.205 E34.59189
+G1 X82.890 Y94.246 E34.62985
+G1 X83.165 Y93.266 E34.66794
+G1 X83.396 Y92.252 E34.70685
+G1 X83.604 Y91.198 E34.74706
+G1 X83.816 Y90.104 E34.78873
+G1 X84.063 Y88.982 E34.83174
+G1 X84.375 Y87.848 E34.87573
+G1 X84.779 Y86.728 E34.92029
+G1 X85.297 Y85.651 E34.96500
+G1 X85.941 Y84.649 E35.00958
+G1 X86.714 Y83.751 E35.05393
+G1 X87.610 Y82.982 E35.09810
+G1 X88.615 Y82.362 E35.14227
+G1 X89.705 Y81.899 E35.18661
+G1 X90.856 Y81.591 E35.23119
+G1 X92.040 Y81.426 E35.27590
+G1 X93.230 Y81.384 E35.32046
+G1 X94.405 Y81.435 E35.36448
+G1 X95.550 Y81.546 E35.40753
+G1 X96.657 Y81.682 E35.44925
+G1 X97.726 Y81.811 E35.48951
+G1 X98.762 Y81.906 E35.52847
+G1 X99.780 Y81.949 E35.56657
+G1 X100.794 Y81.931 E35.60452
+G1 X101.820 Y81.857 E35.64303
+G1 X102.874 Y81.741 E35.68269
+G1 X103.963 Y81.604 E35.72378
+G1 X105.092 Y81.478 E35.76628
+G1 X106.256 Y81.397 E35.80993
+G1 X107.442 Y81.395 E35.85431
+G1 X108.631 Y81.503 E35.89900
+G1 X109.800 Y81.746 E35.94365
+G1 X110.920 Y82.141 E35.98810
+G1 X111.965 Y82.694 E36.03232
+G1 X112.910 Y83.399 E36.07648
+G1 X113.739 Y84.244 E36.12073
+G1 X114.439 Y85.204 E36.16521
+G1 X115.010 Y86.253 E36.20989
+G1 X115.462 Y87.358 E36.25456
+G1 X115.811 Y88.489 E36.29885
+G1 X116.082 Y89.619 E36.34233
+G1 X116.306 Y90.727 E36.38462
+G1 X116.512 Y91.799 E36.42546
+G1 X116.730 Y92.830 E36.46490
+G1 X116.984 Y93.823 E36.50327
+G1 X117.291 Y94.789 E36.54120
+G1 X117.655 Y95.743 E36.57940
+G1 X118.074 Y96.702 E36.61854
+G1 X118.532 Y97.683 E36.65905
+G1 X119.003 Y98.700 E36.70100
+G1 X119.457 Y99.763 E36.74424
+G1 X119.857 Y100.872 E36.78838
+G1 X120.168 Y102.024 E36.83299
+G0 F7200 X119.720 Y101.979
+;TYPE:WALL-INNER
+G1 F1800 X119.917 Y103.199 E36.87926
+G1 X119.946 Y104.430 E36.92532
+G1 X119.786 Y105.643 E36.97110
+G1 X119.431 Y106.810 E37.01675
+G1 X118.888 Y107.905 E37.06249
+G1 X118.175 Y108.907 E37.10848
+G1 X117.324 Y109.803 E37.15472
+G1 X116.373 Y110.592 E37.20096
+G1 X115.363 Y111.283 E37.24677
+G1 X114.332 Y111.895 E37.29163
+G1 X113.314 Y112.453 E37.33508
+G1 X112.333 Y112.989 E37.37689
+G1 X111.403 Y113.532 E37.41719
+G1 X110.526 Y114.109 E37.45648
+G1 X109.692 Y114.740 E37.49559
+G1 X108.884 Y115.431 E37.53537
+G1 X108.078 Y116.178 E37.57650
+G1 X107.250 Y116.966 E37.61926
+G1 X106.375 Y117.764 E37.66357
+G1 X105.436 Y118.535 E37.70904
+G1 X104.424 Y119.238 E37.75516
+G1 X103.337 Y119.829 E37.80144
+G1 X102.187 Y120.271 E37.84755
+G1 X100.990 Y120.533 E37.89338
+G1 X99.772 Y120.596 E37.93904
+G1 X98.558 Y120.457 E37.98474
+G1 X97.376 Y120.125 E38.03068
+G1 X96.248 Y119.624 E38.07688
+G1 X95.189 Y118.986 E38.12315
+G1 X94.204 Y118.252 E38.16909
+G1 X93.291 Y117.466 E38.21418
+G1 X92.436 Y116.668 E38.25794
+G1 X91.619 Y115.893 E38.30008
+G1 X90.815 Y115.165 E38.34065
+G1 X90.000 Y114.497 E38.38009
+G1 X89.152 Y113.888 E38.41916
+G1 X88.256 Y113.326 E38.45874
+G1 X87.306 Y112.789 E38.49956
+G1 X86.309 Y112.249 E38.54200
+G1 X85.282 Y111.674 E38.58602
+G1 X84.255 Y111.035 E38.63129
+G1 X83.262 Y110.309 E38.67732
+G1 X82.344 Y109.480 E38.72361
+G1 X81.540 Y108.544 E38.76977
+G1 X80.888 Y107.505 E38.81566
+G1 X80.413 Y106.381 E38.86133
+G1 X80.131 Y105.193 E38.90701
+G1 X80.044 Y103.970 E38.95289
+G1 X80.139 Y102.740 E38.99904
+G1 X80.390 Y101.529 E39.04533
+G1 X80.764 Y100.357 E39.09137
+G1 X81.219 Y99.235 E39.13667
+G1 X81.711 Y98.165 E39.18073
+G1 X82.200 Y97.141 E39.22321
+G1 X82.655 Y96.148 E39.26407
+G1 X83.051 Y95.166 E39.30368
+G1 X83.381 Y94.175 E39.34275
+G1 X83.649 Y93.157 E39.38216
+G1 X83.872 Y92.097 E39.42270
+G1 X84.078 Y90.991 E39.46480
+G1 X84.300 Y89.843 E39.50852
+G1 X84.575 Y88.671 E39.55358
+G1 X84.937 Y87.498 E39.59950
+G1 X85.416 Y86.358 E39.64577
+G1 X86.030 Y85.287 E39.69198
+G1 X86.787 Y84.320 E39.73792
+G1 X87.684 Y83.491 E39.78362
+G1 X88.704 Y82.822 E39.82928
+G1 X89.824 Y82.326 E39.87511
+G1 X91.013 Y82.002 E39.92121
+G1 X92.239 Y81.838 E39.96749
+G1 X93.472 Y81.809 E40.01362
+G1 X94.685 Y81.879 E40.05911
+G1 X95.863 Y82.009 E40.10346
+G1 X96.997 Y82.159 E40.14626
+G1 X98.090 Y82.291 E40.18743
+G1 X99.150 Y82.377 E40.22724
+G1 X100.195 Y82.399 E40.26635
+G1 X101.244 Y82.352 E40.30563
+G1 X102.315 Y82.246 E40.34589
+G1 X103.422 Y82.103 E40.38766
+G1 X104.573 Y81.956 E40.43107
+G1 X105.765 Y81.844 E40.47590
+G1 X106.989 Y81.806 E40.52169
+G1 X108.222 Y81.882 E40.56793
+G1 X109.438 Y82.104 E40.61417
+G1 X110.605 Y82.491 E40.66017
+G1 X111.690 Y83.052 E40.70591
+G1 X112.667 Y83.783 E40.75156
+G1 X113.513 Y84.668 E40.79734
+G1 X114.216 Y85.677 E40.84339
+G1 X114.778 Y86.779 E40.88965
+G1 X115.211 Y87.935 E40.93585
+G1 X115.537 Y89.111 E40.98151
+G1 X115.787 Y90.276 E41.02612
+G1 X115.999 Y91.410 E41.06925
+G1 X116.207 Y92.499 E41.11074
+G1 X116.445 Y93.542 E41.15078
+G1 X116.734 Y94.548 E41.18997
+G1 X117.090 Y95.533 E41.22914
+G1 X117.510 Y96.517 E41.26915
+G1 X117.980 Y97.519 E41.31059
+G1 X118.475 Y98.559 E41.35368
+G1 X118.958 Y99.648 E41.39826
+G1 X119.387 Y100.790 E41.44390
+G1 X119.720 Y101.979 E41.49009
+;TYPE:FILL
+G0 F7200 X107.824 Y83.429
+G1 F2400 X116.571 Y92.176 E41.95294
+G0 F7200 X117.972 Y97.112
+G1 F2400 X102.888 Y82.028 E42.75116
+G0 F7200 X99.213 Y81.889
+G1 F2400 X118.111 Y100.787 E43.75119
+G0 F7200 X117.658 Y103.869
+G1 F2400 X96.131 Y82.342 E44.89035
+G0 F7200 X93.445 Y83.192
+G1 F2400 X116.808 Y106.555 E46.12665
+G0 F7200 X115.648 Y108.931
+G1 F2400 X91.069 Y84.352 E47.42727
+G0 F7200 X88.960 Y85.778
+G1 F2400 X114.222 Y111.040 E48.76403
+G0 F7200 X112.550 Y112.904
+G1 F2400 X87.096 Y87.450 E50.11094
+G0 F7200 X85.473 Y89.362
+G1 F2400 X110.638 Y114.527 E51.44259
+G0 F7200 X108.478 Y115.902
+G1 F2400 X84.098 Y91.522 E52.73271
+G0 F7200 X82.995 Y93.955
+G1 F2400 X106.045 Y117.005 E53.95241
+G0 F7200 X103.289 Y117.784
+G1 F2400 X82.216 Y96.711 E55.06752
+G0 F7200 X81.859 Y99.891
+G1 F2400 X100.109 Y118.141 E56.03325
+G0 F7200 X96.269 Y117.835
+G1 F2400 X82.165 Y103.731 E56.77960
+G0 F7200 X84.115 Y109.218
+G1 F2400 X90.782 Y115.885 E57.13238
+G1 F2700 E52.13238
+;TIME_ELAPSED:360.246000
+;LAYER:2
+M106 S255
+G0 F7200 X120.838 Y104.224 Z0.7
+G1 F2700 E57.13238
+;TYPE:WALL-OUTER
+G1 F1800 X120.750 Y105.351 E57.17466
+G1 X120.508 Y106.450 E57.21679
+G1 X120.112 Y107.503 E57.25889
+G1 X119.570 Y108.493 E57.30110
+G1 X118.898 Y109.406 E57.34350
+G1 X118.120 Y110.235 E57.38606
+G1 X117.260 Y110.979 E57.42860
+G1 X116.348 Y111.644 E57.47083
+G1 X115.411 Y112.240 E57.51241
+G1 X114.473 Y112.786 E57.55301
+G1 X113.555 Y113.301 E57.59241
+G1 X112.669 Y113.806 E57.63056
+G1 X111.823 Y114.321 E57.66763
+G1 X111.016 Y114.865 E57.70403
+G1 X110.241 Y115.448 E57.74033
+G1 X109.486 Y116.077 E57.77710
+G1 X108.735 Y116.750 E57.81483
+G1 X107.970 Y117.456 E57.85377
+G1 X107.176 Y118.179 E57.89395
+G1 X106.337 Y118.895 E57.93522
+G1 X105.444 Y119.577 E57.97725
+G1 X104.492 Y120.194 E58.01972
+G1 X103.482 Y120.719 E58.06229
+G1 X102.422 Y121.124 E58.10476
+G1 X101.323 Y121.388 E58.14704
+G1 X100.203 Y121.497 E58.18917
+G1 X99.079 Y121.446 E58.23127
+G1 X97.970 Y121.236 E58.27348
+G1 X96.895 Y120.880 E58.31589
+G1 X95.866 Y120.396 E58.35844
+G1 X94.892 Y119.808 E58.40098
+G1 X93.978 Y119.146 E58.44321
+G1 X93.121 Y118.439 E58.48479
+G1 X92.312 Y117.716 E58.52539
+G1 X91.539 Y117.001 E58.56479
+G1 X90.785 Y116.315 E58.60294
+G1 X90.033 Y115.670 E58.64001
+G1 X89.267 Y115.070 E58.67641
+G1 X88.472 Y114.513 E58.71271
+G1 X87.641 Y113.990 E58.74948
+G1 X86.769 Y113.483 E58.78721
+G1 X85.861 Y112.974 E58.82615
+G1 X84.928 Y112.442 E58.86634
+G1 X83.988 Y111.866 E58.90760
+G1 X83.064 Y111.227 E58.94964
+G1 X82.182 Y110.513 E58.99210
+G1 X81.371 Y109.714 E59.03468
+G1 X80.659 Y108.831 E59.07715
+G1 X80.068 Y107.868 E59.11942
+G1 X79.617 Y106.836 E59.16155
+G1 X79.319 Y105.751 E59.20365
+G1 X79.176 Y104.632 E59.24586
+G1 X79.182 Y103.499 E59.28827
+G1 X79.325 Y102.371 E59.33082
+G1 X79.583 Y101.263 E59.37336
+G1 X79.930 Y100.189 E59.41559
+G1 X80.338 Y99.156 E59.45717
+G1 X80.775 Y98.163 E59.49778
+G1 X81.216 Y97.206 E59.53717
+G1 X81.636 Y96.277 E59.57532
+G1 X82.017 Y95.363 E59.61239
+G1 X82.351 Y94.449 E59.64880
+G1 X82.635 Y93.521 E59.68509
+G1 X82.876 Y92.569 E59.72187
+G1 X83.088 Y91.583 E59.75959
+G1 X83.292 Y90.563 E59.79853
+G1 X83.509 Y89.511 E59.83872
+G1 X83.767 Y88.439 E59.87998
+G1 X84.089 Y87.362 E59.92202
+G1 X84.496 Y86.303 E59.96448
+G1 X85.005 Y85.285 E60.00706
+G1 X85.624 Y84.334 E60.04953
+G1 X86.358 Y83.475 E60.09181
+G1 X87.200 Y82.728 E60.13393
+G1 X88.140 Y82.109 E60.17603
+G1 X89.160 Y81.627 E60.21825
+G1 X90.239 Y81.283 E60.26065
+G1 X91.357 Y81.069 E60.30321
+G1 X92.489 Y80.973 E60.34574
+G1 X93.618 Y80.971 E60.38797
+G1 X94.727 Y81.039 E60.42956
+G1 X95.807 Y81.149 E60.47016
+G1 X96.852 Y81.272 E60.50956
+G1 X97.866 Y81.384 E60.54770
+G1 X98.853 Y81.464 E60.58477
+G1 X99.825 Y81.499 E60.62118
+G1 X100.795 Y81.483 E60.65747
+G1 X101.776 Y81.418 E60.69425
+G1 X102.779 Y81.315 E60.73197
+G1 X103.812 Y81.193 E60.77091
+G1 X104.880 Y81.075 E60.81110
+G1 X105.979 Y80.989 E60.85236
+G1 X107.102 Y80.962 E60.89440
+G1 X108.236 Y81.022 E60.93686
+G1 X109.361 Y81.191 E60.97944
+G1 X110.457 Y81.487 E61.02191
+G1 X111.501 Y81.919 E61.06419
+G1 X112.472 Y82.489 E61.10631
+G1 X113.351 Y83.191 E61.14841
+G1 X114.124 Y84.012 E61.19063
+G1 X114.785 Y84.933 E61.23303
+G1 X115.333 Y85.930 E61.27559
+G1 X115.775 Y86.977 E61.31812
+G1 X116.126 Y88.050 E61.36036
+G1 X116.404 Y89.126 E61.40194
+G1 X116.633 Y90.186 E61.44254
+G1 X116.839 Y91.219 E61.48194
+G1 X117.045 Y92.217 E61.52008
+G1 X117.274 Y93.181 E61.55715
+G1 X117.541 Y94.117 E61.59356
+G1 X117.857 Y95.034 E61.62986
+G1 X118.222 Y95.947 E61.66663
+G1 X118.629 Y96.869 E61.70435
+G1 X119.065 Y97.814 E61.74329
+G1 X119.507 Y98.793 E61.78348
+G1 X119.928 Y99.812 E61.82474
+G1 X120.301 Y100.872 E61.86678
+G1 X120.594 Y101.968 E61.90925
+G1 X120.781 Y103.091 E61.95182
+G1 X120.838 Y104.224 E61.99429
+G0 F7200 X120.397 Y104.135
+;TYPE:WALL-INNER
+G1 F1800 X120.303 Y105.316 E62.03864
+G1 X120.032 Y106.466 E62.08282
+G1 X119.587 Y107.559 E62.12699
+G1 X118.980 Y108.576 E62.17133
+G1 X118.232 Y109.503 E62.21590
+G1 X117.373 Y110.334 E62.26060
+G1 X116.436 Y111.069 E62.30518
+G1 X115.455 Y111.720 E62.34921
+G1 X114.464 Y112.304 E62.39228
+G1 X113.488 Y112.846 E62.43402
+G1 X112.548 Y113.369 E62.47431
+G1 X111.652 Y113.902 E62.51329
+G1 X110.803 Y114.464 E62.55140
+G1 X109.992 Y115.073 E62.58934
+G1 X109.205 Y115.736 E62.62784
+G1 X108.422 Y116.448 E62.66747
+G1 X107.621 Y117.199 E62.70854
+G1 X106.782 Y117.964 E62.75102
+G1 X105.890 Y118.715 E62.79465
+G1 X104.933 Y119.415 E62.83902
+G1 X103.908 Y120.028 E62.88371
+G1 X102.821 Y120.521 E62.92837
+G1 X101.683 Y120.862 E62.97281
+G1 X100.513 Y121.033 E63.01704
+G1 X99.333 Y121.021 E63.06119
+G1 X98.167 Y120.827 E63.10545
+G1 X97.035 Y120.464 E63.14993
+G1 X95.955 Y119.955 E63.19460
+G1 X94.939 Y119.328 E63.23927
+G1 X93.991 Y118.619 E63.28357
+G1 X93.106 Y117.865 E63.32708
+G1 X92.273 Y117.100 E63.36938
+G1 X91.476 Y116.353 E63.41025
+G1 X90.693 Y115.646 E63.44971
+G1 X89.904 Y114.991 E63.48810
+G1 X89.089 Y114.389 E63.52602
+G1 X88.234 Y113.831 E63.56422
+G1 X87.333 Y113.301 E63.60334
+G1 X86.386 Y112.777 E63.64382
+G1 X85.407 Y112.231 E63.68575
+G1 X84.416 Y111.640 E63.72896
+G1 X83.439 Y110.978 E63.77309
+G1 X82.510 Y110.231 E63.81770
+G1 X81.663 Y109.388 E63.86241
+G1 X80.932 Y108.449 E63.90695
+G1 X80.345 Y107.421 E63.95125
+G1 X79.922 Y106.319 E63.99541
+G1 X79.675 Y105.164 E64.03961
+G1 X79.603 Y103.980 E64.08399
+G1 X79.694 Y102.791 E64.12860
+G1 X79.928 Y101.619 E64.17331
+G1 X80.273 Y100.481 E64.21781
+G1 X80.696 Y99.388 E64.26168
+G1 X81.160 Y98.342 E64.30451
+G1 X81.630 Y97.338 E64.34596
+G1 X82.077 Y96.367 E64.38597
+G1 X82.478 Y95.412 E64.42472
+G1 X82.822 Y94.456 E64.46275
+G1 X83.109 Y93.482 E64.50074
+G1 X83.349 Y92.476 E64.53943
+G1 X83.560 Y91.431 E64.57933
+G1 X83.768 Y90.345 E64.62069
+G1 X84.005 Y89.228 E64.66343
+G1 X84.300 Y88.095 E64.70724
+G1 X84.682 Y86.969 E64.75171
+G1 X85.174 Y85.880 E64.79642
+G1 X85.790 Y84.859 E64.84104
+G1 X86.535 Y83.936 E64.88544
+G1 X87.406 Y83.137 E64.92964
+G1 X88.388 Y82.484 E64.97380
+G1 X89.462 Y81.986 E65.01809
+G1 X90.602 Y81.645 E65.06262
+G1 X91.781 Y81.451 E65.10731
+G1 X92.972 Y81.384 E65.15194
+G1 X94.152 Y81.418 E65.19612
+G1 X95.305 Y81.519 E65.23941
+G1 X96.420 Y81.652 E65.28144
+G1 X97.496 Y81.785 E65.32202
+G1 X98.539 Y81.889 E65.36123
+G1 X99.559 Y81.944 E65.39947
+G1 X100.573 Y81.940 E65.43738
+G1 X101.595 Y81.878 E65.47571
+G1 X102.642 Y81.769 E65.51509
+G1 X103.723 Y81.634 E65.55585
+G1 X104.843 Y81.503 E65.59807
+G1 X106.000 Y81.409 E65.64150
+G1 X107.183 Y81.387 E65.68576
+G1 X108.374 Y81.468 E65.73041
+G1 X109.549 Y81.681 E65.77510
+G1 X110.682 Y82.042 E65.81959
+G1 X111.745 Y82.560 E65.86386
+G1 X112.714 Y83.233 E65.90801
+G1 X113.569 Y84.049 E65.95223
+G1 X114.298 Y84.987 E65.99666
+G1 X114.897 Y86.019 E66.04131
+G1 X115.373 Y87.114 E66.08600
+G1 X115.743 Y88.242 E66.13041
+G1 X116.029 Y89.375 E66.17411
+G1 X116.260 Y90.489 E66.21668
+G1 X116.467 Y91.569 E66.25785
+G1 X116.680 Y92.609 E66.29757
+G1 X116.925 Y93.610 E66.33613
+G1 X117.219 Y94.581 E66.37409
+G1 X117.571 Y95.536 E66.41217
+G1 X117.979 Y96.492 E66.45107
+G1 X118.430 Y97.467 E66.49125
+G1 X118.901 Y98.475 E66.53290
+G1 X119.362 Y99.527 E66.57588
+G1 X119.777 Y100.627 E66.61986
+G1 X120.110 Y101.770 E66.66441
+G1 X120.326 Y102.945 E66.70912
+G1 X120.397 Y104.135 E66.75371
+G0 F7200 X119.956 Y104.045
+;TYPE:WALL-INNER
+G1 F1800 X119.857 Y105.267 E66.79957
+G1 X119.563 Y106.452 E66.84524
+G1 X119.077 Y107.572 E66.89092
+G1 X118.414 Y108.604 E66.93683
+G1 X117.603 Y109.534 E66.98300
+G1 X116.679 Y110.356 E67.02928
+G1 X115.683 Y111.077 E67.07528
+G1 X114.655 Y111.711 E67.12050
+G1 X113.629 Y112.283 E67.16443
+G1 X112.635 Y112.822 E67.20676
+G1 X111.688 Y113.360 E67.24749
+G1 X110.795 Y113.924 E67.28702
+G1 X109.949 Y114.536 E67.32609
+G1 X109.136 Y115.208 E67.36557
+G1 X108.332 Y115.939 E67.40623
+G1 X107.513 Y116.717 E67.44847
+G1 X106.655 Y117.515 E67.49233
+G1 X105.738 Y118.299 E67.53748
+G1 X104.749 Y119.028 E67.58346
+G1 X103.685 Y119.659 E67.62973
+G1 X102.553 Y120.151 E67.67592
+G1 X101.368 Y120.472 E67.72184
+G1 X100.154 Y120.598 E67.76753
+G1 X98.936 Y120.522 E67.81319
+G1 X97.741 Y120.249 E67.85904
+G1 X96.594 Y119.797 E67.90517
+G1 X95.512 Y119.198 E67.95145
+G1 X94.504 Y118.489 E67.99755
+G1 X93.570 Y117.715 E68.04296
+G1 X92.698 Y116.917 E68.08718
+G1 X91.872 Y116.131 E68.12984
+G1 X91.067 Y115.387 E68.17088
+G1 X90.258 Y114.699 E68.21060
+G1 X89.422 Y114.073 E68.24969
+G1 X88.542 Y113.498 E68.28902
+G1 X87.609 Y112.956 E68.32940
+G1 X86.625 Y112.420 E68.37131
+G1 X85.605 Y111.859 E68.41486
+G1 X84.574 Y111.244 E68.45979
+G1 X83.566 Y110.547 E68.50564
+G1 X82.620 Y109.751 E68.55189
+G1 X81.777 Y108.848 E68.59812
+G1 X81.074 Y107.841 E68.64410
+G1 X80.541 Y106.741 E68.68982
+G1 X80.198 Y105.570 E68.73547
+G1 X80.051 Y104.355 E68.78127
+G1 X80.091 Y103.124 E68.82734
+G1 X80.297 Y101.905 E68.87362
+G1 X80.637 Y100.719 E68.91979
+G1 X81.071 Y99.580 E68.96538
+G1 X81.555 Y98.494 E69.00987
+G1 X82.050 Y97.457 E69.05286
+G1 X82.518 Y96.456 E69.09421
+G1 X82.934 Y95.473 E69.13415
+G1 X83.285 Y94.488 E69.17330
+G1 X83.571 Y93.480 E69.21251
+G1 X83.806 Y92.433 E69.25263
+G1 X84.013 Y91.342 E69.29421
+G1 X84.226 Y90.206 E69.33744
+G1 X84.481 Y89.039 E69.38213
+G1 X84.813 Y87.863 E69.42784
+G1 X85.252 Y86.709 E69.47405
+G1 X85.823 Y85.613 E69.52031
+G1 X86.535 Y84.610 E69.56634
+G1 X87.389 Y83.734 E69.61211
+G1 X88.373 Y83.013 E69.65775
+G1 X89.465 Y82.462 E69.70351
+G1 X90.636 Y82.085 E69.74953
+G1 X91.853 Y81.874 E69.79578
+G1 X93.087 Y81.806 E69.84200
+G1 X94.309 Y81.849 E69.88775
+G1 X95.499 Y81.965 E69.93250
+G1 X96.647 Y82.113 E69.97582
+G1 X97.752 Y82.254 E70.01749
+G1 X98.821 Y82.357 E70.05767
+G1 X99.869 Y82.399 E70.09691
+G1 X100.914 Y82.374 E70.13604
+G1 X101.976 Y82.284 E70.17592
+G1 X103.071 Y82.150 E70.21718
+G1 X104.208 Y82.000 E70.26009
+G1 X105.388 Y81.873 E70.30452
+G1 X106.603 Y81.807 E70.35006
+G1 X107.836 Y81.844 E70.39621
+G1 X109.061 Y82.017 E70.44249
+G1 X110.247 Y82.351 E70.48858
+G1 X111.361 Y82.858 E70.53439
+G1 X112.375 Y83.537 E70.58004
+G1 X113.263 Y84.376 E70.62576
+G1 X114.012 Y85.350 E70.67172
+G1 X114.617 Y86.426 E70.71794
+G1 X115.088 Y87.569 E70.76420
+G1 X115.444 Y88.743 E70.81008
+G1 X115.715 Y89.914 E70.85507
+G1 X115.935 Y91.059 E70.89870
+G1 X116.140 Y92.163 E70.94070
+G1 X116.366 Y93.220 E70.98115
+G1 X116.637 Y94.237 E71.02052
+G1 X116.971 Y95.226 E71.05960
+G1 X117.372 Y96.208 E71.09927
+G1 X117.829 Y97.202 E71.14022
+G1 X118.319 Y98.229 E71.18280
+G1 X118.810 Y99.302 E71.22694
+G1 X119.261 Y100.427 E71.27231
+G1 X119.629 Y101.602 E71.31838
+G1 X119.872 Y102.815 E71.36466
+G1 X119.956 Y104.045 E71.41080
+;TYPE:FILL
+G0 F7200 X83.173 Y92.786
+G1 F2400 X92.786 Y83.173 E71.91948
+G0 F7200 X98.298 Y81.903
+G1 F2400 X81.903 Y98.298 E72.78707
+G0 F7200 X82.058 Y102.386
+G1 F2400 X102.386 Y82.058 E73.86279
+G0 F7200 X105.785 Y82.902
+G1 F2400 X82.902 Y105.785 E75.07369
+G0 F7200 X84.223 Y108.706
+G1 F2400 X108.706 Y84.223 E76.36920
+G0 F7200 X111.237 Y85.935
+G1 F2400 X85.935 Y111.237 E77.70812
+G0 F7200 X87.998 Y113.416
+G1 F2400 X113.416 Y87.998 E79.05313
+G0 F7200 X115.247 Y90.410
+G1 F2400 X90.410 Y115.247 E80.36742
+G0 F7200 X93.194 Y116.705
+G1 F2400 X116.705 Y93.194 E81.61152
+G0 F7200 X117.723 Y96.419
+G1 F2400 X96.419 Y117.723 E82.73887
+G0 F7200 X100.239 Y118.146
+G1 F2400 X118.146 Y100.239 E83.68647
+G0 F7200 X117.527 Y105.100
+G1 F2400 X105.100 Y117.527 E84.34405
+G1 F2700 E79.34405
+;TIME_ELAPSED:540.369000
+;LAYER:3
+G0 F7200 X120.536 Y106.353 Z0.9
+G1 F2700 E84.34405
+;TYPE:WALL-OUTER
+G1 F1800 X120.153 Y107.411 E84.38615
+G1 X119.624 Y108.406 E84.42835
+G1 X118.964 Y109.327 E84.47073
+G1 X118.194 Y110.163 E84.51328
+G1 X117.340 Y110.915 E84.55583
+G1 X116.432 Y111.587 E84.59810
+G1 X115.496 Y112.189 E84.63976
+G1 X114.557 Y112.739 E84.68046
+G1 X113.636 Y113.255 E84.71997
+G1 X112.747 Y113.760 E84.75823
+G1 X111.897 Y114.274 E84.79538
+G1 X111.087 Y114.814 E84.83182
+G1 X110.310 Y115.394 E84.86810
+G1 X109.553 Y116.019 E84.90481
+G1 X108.803 Y116.688 E84.94244
+G1 X108.040 Y117.391 E84.98126
+G1 X107.249 Y118.114 E85.02134
+G1 X106.415 Y118.831 E85.06252
+G1 X105.527 Y119.517 E85.10450
+G1 X104.580 Y120.142 E85.14694
+G1 X103.576 Y120.676 E85.18952
+G1 X102.519 Y121.093 E85.23200
+G1 X101.424 Y121.370 E85.27430
+G1 X100.304 Y121.494 E85.31643
+G1 X99.180 Y121.457 E85.35853
+G1 X98.069 Y121.261 E85.40073
+G1 X96.990 Y120.918 E85.44312
+G1 X95.956 Y120.444 E85.48566
+G1 X94.978 Y119.865 E85.52821
+G1 X94.058 Y119.208 E85.57048
+G1 X93.196 Y118.504 E85.61214
+G1 X92.383 Y117.781 E85.65284
+G1 X91.607 Y117.065 E85.69235
+G1 X90.852 Y116.375 E85.73061
+G1 X90.101 Y115.726 E85.76776
+G1 X89.337 Y115.122 E85.80420
+G1 X88.545 Y114.562 E85.84049
+G1 X87.717 Y114.036 E85.87720
+G1 X86.849 Y113.529 E85.91482
+G1 X85.944 Y113.021 E85.95365
+G1 X85.013 Y112.492 E85.99372
+G1 X84.073 Y111.920 E86.03490
+G1 X83.146 Y111.288 E86.07688
+G1 X82.259 Y110.580 E86.11932
+G1 X81.441 Y109.790 E86.16190
+G1 X80.718 Y108.914 E86.20439
+G1 X80.115 Y107.958 E86.24668
+G1 X79.652 Y106.932 E86.28882
+G1 X79.340 Y105.851 E86.33091
+G1 X79.183 Y104.734 E86.37311
+G1 X79.176 Y103.601 E86.41550
+G1 X79.307 Y102.472 E86.45804
+G1 X79.556 Y101.362 E86.50059
+G1 X79.896 Y100.285 E86.54287
+G1 X80.299 Y99.247 E86.58452
+G1 X80.735 Y98.251 E86.62522
+G1 X81.177 Y97.291 E86.66473
+G1 X81.599 Y96.360 E86.70299
+G1 X81.985 Y95.445 E86.74014
+G1 X82.323 Y94.532 E86.77659
+G1 X82.611 Y93.606 E86.81287
+G1 X82.856 Y92.656 E86.84958
+G1 X83.070 Y91.673 E86.88720
+G1 X83.273 Y90.656 E86.92603
+G1 X83.489 Y89.607 E86.96611
+G1 X83.742 Y88.536 E87.00728
+G1 X84.057 Y87.459 E87.04927
+G1 X84.455 Y86.397 E87.09171
+G1 X84.954 Y85.374 E87.13428
+G1 X85.564 Y84.416 E87.17677
+G1 X86.287 Y83.548 E87.21906
+G1 X87.120 Y82.790 E87.26120
+G1 X88.051 Y82.159 E87.30329
+G1 X89.065 Y81.664 E87.34549
+G1 X90.140 Y81.308 E87.38788
+G1 X91.255 Y81.084 E87.43043
+G1 X92.387 Y80.977 E87.47298
+G1 X93.517 Y80.968 E87.51525
+G1 X94.628 Y81.031 E87.55690
+G1 X95.711 Y81.138 E87.59761
+G1 X96.759 Y81.261 E87.63712
+G1 X97.775 Y81.375 E87.67537
+G1 X98.765 Y81.459 E87.71252
+G1 X99.738 Y81.498 E87.74897
+G1 X100.708 Y81.486 E87.78525
+G1 X101.687 Y81.425 E87.82196
+G1 X102.687 Y81.325 E87.85958
+G1 X103.718 Y81.204 E87.89841
+G1 X104.782 Y81.085 E87.93849
+G1 X105.879 Y80.995 E87.97967
+G1 X107.001 Y80.962 E88.02165
+G1 X108.134 Y81.013 E88.06409
+G1 X109.260 Y81.171 E88.10666
+G1 X110.360 Y81.455 E88.14915
+G1 X111.409 Y81.874 E88.19144
+G1 X112.388 Y82.432 E88.23358
+G1 X113.276 Y83.123 E88.27568
+G1 X114.059 Y83.934 E88.31787
+G1 X114.730 Y84.847 E88.36026
+G1 X115.288 Y85.837 E88.40281
+G1 X115.739 Y86.881 E88.44536
+G1 X116.097 Y87.953 E88.48763
+G1 X116.381 Y89.029 E88.52928
+G1 X116.614 Y90.092 E88.56999
+G1 X116.820 Y91.127 E88.60950
+G1 X117.026 Y92.129 E88.64775
+G1 X117.252 Y93.096 E88.68491
+G1 X117.515 Y94.033 E88.72135
+G1 X117.826 Y94.952 E88.75763
+G1 X118.187 Y95.864 E88.79434
+G1 X118.591 Y96.785 E88.83197
+G1 X119.025 Y97.728 E88.87079
+G1 X119.467 Y98.703 E88.91087
+G1 X119.892 Y99.718 E88.95205
+G1 X120.270 Y100.775 E88.99403
+G1 X120.572 Y101.868 E89.03647
+G1 X120.769 Y102.989 E89.07905
+G1 X120.839 Y104.122 E89.12153
+G1 X120.764 Y105.250 E89.16383
+G1 X120.536 Y106.353 E89.20596
+G0 F7200 X120.106 Y106.220
+;TYPE:WALL-INNER
+G1 F1800 X119.699 Y107.327 E89.25012
+G1 X119.125 Y108.362 E89.29441
+G1 X118.405 Y109.310 E89.33893
+G1 X117.568 Y110.161 E89.38362
+G1 X116.645 Y110.917 E89.42826
+G1 X115.671 Y111.585 E89.47244
+G1 X114.679 Y112.182 E89.51575
+G1 X113.698 Y112.730 E89.55781
+G1 X112.748 Y113.256 E89.59841
+G1 X111.843 Y113.784 E89.63764
+G1 X110.984 Y114.338 E89.67589
+G1 X110.166 Y114.936 E89.71381
+G1 X109.375 Y115.587 E89.75213
+G1 X108.593 Y116.290 E89.79148
+G1 X107.797 Y117.033 E89.83222
+G1 X106.969 Y117.798 E89.87441
+G1 X106.089 Y118.554 E89.91782
+G1 X105.146 Y119.269 E89.96207
+G1 X104.136 Y119.904 E90.00672
+G1 X103.062 Y120.425 E90.05141
+G1 X101.934 Y120.802 E90.09591
+G1 X100.769 Y121.011 E90.14018
+G1 X99.590 Y121.039 E90.18433
+G1 X98.418 Y120.884 E90.22855
+G1 X97.277 Y120.557 E90.27297
+G1 X96.185 Y120.077 E90.31762
+G1 X95.154 Y119.472 E90.36232
+G1 X94.191 Y118.778 E90.40673
+G1 X93.293 Y118.031 E90.45045
+G1 X92.451 Y117.265 E90.49304
+G1 X91.647 Y116.513 E90.53423
+G1 X90.863 Y115.796 E90.57398
+G1 X90.077 Y115.129 E90.61256
+G1 X89.269 Y114.515 E90.65052
+G1 X88.424 Y113.949 E90.68859
+G1 X87.533 Y113.415 E90.72747
+G1 X86.596 Y112.892 E90.76763
+G1 X85.622 Y112.353 E90.80925
+G1 X84.631 Y111.773 E90.85221
+G1 X83.648 Y111.129 E90.89618
+G1 X82.706 Y110.402 E90.94072
+G1 X81.839 Y109.580 E90.98543
+G1 X81.080 Y108.661 E91.03002
+G1 X80.459 Y107.651 E91.07438
+G1 X80.000 Y106.564 E91.11856
+G1 X79.714 Y105.418 E91.16273
+G1 X79.604 Y104.239 E91.20706
+G1 X79.661 Y103.049 E91.25162
+G1 X79.866 Y101.872 E91.29633
+G1 X80.190 Y100.725 E91.34091
+G1 X80.600 Y99.622 E91.38496
+G1 X81.058 Y98.565 E91.42804
+G1 X81.529 Y97.553 E91.46982
+G1 X81.983 Y96.576 E91.51013
+G1 X82.395 Y95.619 E91.54912
+G1 X82.753 Y94.665 E91.58725
+G1 X83.052 Y93.696 E91.62519
+G1 X83.300 Y92.698 E91.66367
+G1 X83.515 Y91.661 E91.70328
+G1 X83.722 Y90.584 E91.74431
+G1 X83.950 Y89.473 E91.78677
+G1 X84.229 Y88.341 E91.83038
+G1 X84.591 Y87.212 E91.87475
+G1 X85.057 Y86.113 E91.91943
+G1 X85.645 Y85.074 E91.96410
+G1 X86.362 Y84.127 E92.00855
+G1 X87.206 Y83.299 E92.05278
+G1 X88.166 Y82.613 E92.09693
+G1 X89.222 Y82.081 E92.14118
+G1 X90.350 Y81.706 E92.18565
+G1 X91.523 Y81.481 E92.23033
+G1 X92.713 Y81.389 E92.27500
+G1 X93.897 Y81.404 E92.31931
+G1 X95.057 Y81.493 E92.36283
+G1 X96.181 Y81.622 E92.40516
+G1 X97.265 Y81.757 E92.44606
+G1 X98.315 Y81.870 E92.48554
+G1 X99.339 Y81.937 E92.52394
+G1 X100.352 Y81.946 E92.56187
+G1 X101.371 Y81.896 E92.60005
+G1 X102.412 Y81.795 E92.63915
+G1 X103.485 Y81.664 E92.67960
+G1 X104.596 Y81.530 E92.72151
+G1 X105.746 Y81.425 E92.76471
+G1 X106.924 Y81.384 E92.80882
+G1 X108.115 Y81.440 E92.85343
+G1 X109.296 Y81.622 E92.89813
+G1 X110.440 Y81.950 E92.94268
+G1 X111.521 Y82.434 E92.98699
+G1 X112.513 Y83.074 E93.03115
+G1 X113.394 Y83.861 E93.07534
+G1 X114.150 Y84.774 E93.11972
+G1 X114.777 Y85.788 E93.16433
+G1 X115.279 Y86.872 E93.20904
+G1 X115.670 Y87.996 E93.25354
+G1 X115.972 Y89.129 E93.29743
+G1 X116.212 Y90.249 E93.34028
+G1 X116.422 Y91.337 E93.38176
+G1 X116.632 Y92.386 E93.42179
+G1 X116.868 Y93.395 E93.46056
+G1 X117.150 Y94.372 E93.49859
+G1 X117.490 Y95.329 E93.53658
+G1 X117.886 Y96.283 E93.57525
+G1 X118.329 Y97.252 E93.61513
+G1 X118.798 Y98.252 E93.65646
+G1 X119.264 Y99.295 E93.69918
+G1 X119.692 Y100.384 E93.74298
+G1 X120.046 Y101.518 E93.78744
+G1 X120.291 Y102.688 E93.83214
+G1 X120.395 Y103.876 E93.87677
+G1 X120.338 Y105.061 E93.92117
+G1 X120.106 Y106.220 E93.96538
+G0 F7200 X119.676 Y106.087
+;TYPE:WALL-INNER
+G1 F1800 X119.249 Y107.230 E94.01103
+G1 X118.639 Y108.291 E94.05685
+G1 X117.871 Y109.255 E94.10295
+G1 X116.978 Y110.110 E94.14923
+G1 X116.000 Y110.861 E94.19537
+G1 X114.978 Y111.520 E94.24088
+G1 X113.948 Y112.109 E94.28526
+G1 X112.941 Y112.655 E94.32811
+G1 X111.979 Y113.190 E94.36932
+G1 X111.069 Y113.743 E94.40916
+G1 X110.210 Y114.338 E94.44828
+G1 X109.388 Y114.991 E94.48754
+G1 X108.584 Y115.705 E94.52777
+G1 X107.773 Y116.470 E94.56949
+G1 X106.929 Y117.265 E94.61286
+G1 X106.032 Y118.057 E94.65766
+G1 X105.066 Y118.808 E94.70343
+G1 X104.026 Y119.474 E94.74967
+G1 X102.914 Y120.014 E94.79591
+G1 X101.743 Y120.391 E94.84192
+G1 X100.536 Y120.580 E94.88767
+G1 X99.316 Y120.568 E94.93331
+G1 X98.111 Y120.355 E94.97909
+G1 X96.947 Y119.956 E95.02513
+G1 X95.843 Y119.399 E95.07139
+G1 X94.812 Y118.720 E95.11759
+G1 X93.855 Y117.962 E95.16328
+G1 X92.965 Y117.167 E95.20792
+G1 X92.127 Y116.374 E95.25109
+G1 X91.318 Y115.614 E95.29262
+G1 X90.513 Y114.908 E95.33269
+G1 X89.688 Y114.263 E95.37189
+G1 X88.823 Y113.673 E95.41105
+G1 X87.906 Y113.124 E95.45103
+G1 X86.938 Y112.589 E95.49243
+G1 X85.927 Y112.040 E95.53548
+G1 X84.896 Y111.444 E95.58003
+G1 X83.877 Y110.775 E95.62565
+G1 X82.907 Y110.012 E95.67183
+G1 X82.028 Y109.142 E95.71810
+G1 X81.277 Y108.167 E95.76416
+G1 X80.688 Y107.094 E95.80995
+G1 X80.285 Y105.942 E95.85560
+G1 X80.076 Y104.738 E95.90133
+G1 X80.059 Y103.509 E95.94732
+G1 X80.216 Y102.284 E95.99355
+G1 X80.518 Y101.085 E96.03980
+G1 X80.927 Y99.931 E96.08562
+G1 X81.401 Y98.829 E96.13052
+G1 X81.896 Y97.777 E96.17401
+G1 X82.376 Y96.767 E96.21586
+G1 X82.810 Y95.780 E96.25619
+G1 X83.182 Y94.798 E96.29550
+G1 X83.488 Y93.799 E96.33460
+G1 X83.737 Y92.766 E96.37436
+G1 X83.950 Y91.688 E96.41544
+G1 X84.157 Y90.566 E96.45816
+G1 X84.394 Y89.406 E96.50243
+G1 X84.698 Y88.231 E96.54788
+G1 X85.101 Y87.066 E96.59399
+G1 X85.629 Y85.947 E96.64027
+G1 X86.297 Y84.911 E96.68639
+G1 X87.107 Y83.993 E96.73223
+G1 X88.052 Y83.221 E96.77789
+G1 X89.113 Y82.616 E96.82359
+G1 X90.263 Y82.185 E96.86952
+G1 X91.469 Y81.923 E96.91571
+G1 X92.701 Y81.813 E96.96198
+G1 X93.929 Y81.825 E97.00794
+G1 X95.131 Y81.923 E97.05306
+G1 X96.293 Y82.065 E97.09686
+G1 X97.410 Y82.212 E97.13904
+G1 X98.489 Y82.330 E97.17965
+G1 X99.542 Y82.393 E97.21910
+G1 X100.586 Y82.389 E97.25817
+G1 X101.641 Y82.318 E97.29773
+G1 X102.724 Y82.195 E97.33852
+G1 X103.847 Y82.047 E97.38091
+G1 X105.014 Y81.908 E97.42489
+G1 X106.220 Y81.819 E97.47014
+G1 X107.450 Y81.820 E97.51616
+G1 X108.680 Y81.947 E97.56244
+G1 X109.882 Y82.228 E97.60861
+G1 X111.022 Y82.680 E97.65450
+G1 X112.070 Y83.306 E97.70018
+G1 X112.999 Y84.098 E97.74585
+G1 X113.793 Y85.032 E97.79173
+G1 X114.443 Y86.080 E97.83788
+G1 X114.954 Y87.207 E97.88416
+G1 X115.343 Y88.374 E97.93021
+G1 X115.637 Y89.550 E97.97554
+G1 X115.869 Y90.705 E98.01964
+G1 X116.075 Y91.822 E98.06216
+G1 X116.291 Y92.894 E98.10306
+G1 X116.546 Y93.922 E98.14269
+G1 X116.859 Y94.918 E98.18177
+G1 X117.240 Y95.900 E98.22116
+G1 X117.681 Y96.888 E98.26166
+G1 X118.164 Y97.903 E98.30372
+G1 X118.659 Y98.961 E98.34740
+G1 X119.127 Y100.069 E98.39243
+G1 X119.525 Y101.230 E98.43834
+G1 X119.812 Y102.433 E98.48460
+G1 X119.949 Y103.660 E98.53081
+G1 X119.909 Y104.887 E98.57676
+G1 X119.676 Y106.087 E98.62247
+;TYPE:FILL
+G0 F7200 X107.824 Y83.429
+G1 F2400 X116.571 Y92.176 E99.08532
+G0 F7200 X117.972 Y97.112
+G1 F2400 X102.888 Y82.028 E99.88354
+G0 F7200 X99.213 Y81.889
+G1 F2400 X118.111 Y100.787 E100.88358
+G0 F7200 X117.658 Y103.869
+G1 F2400 X96.131 Y82.342 E102.02273
+G0 F7200 X93.445 Y83.192
+G1 F2400 X116.808 Y106.555 E103.25903
+G0 F7200 X115.648 Y108.931
+G1 F2400 X91.069 Y84.352 E104.55965
+G0 F7200 X88.960 Y85.778
+G1 F2400 X114.222 Y111.040 E105.89641
+G0 F7200 X112.550 Y112.904
+G1 F2400 X87.096 Y87.450 E107.24332
+G0 F7200 X85.473 Y89.362
+G1 F2400 X110.638 Y114.527 E108.57497
+G0 F7200 X108.478 Y115.902
+G1 F2400 X84.098 Y91.522 E109.86509
+G0 F7200 X82.995 Y93.955
+G1 F2400 X106.045 Y117.005 E111.08479
+G0 F7200 X103.289 Y117.784
+G1 F2400 X82.216 Y96.711 E112.19990
+G0 F7200 X81.859 Y99.891
+G1 F2400 X100.109 Y118.141 E113.16563
+G0 F7200 X96.269 Y117.835
+G1 F2400 X82.165 Y103.731 E113.91198
+G0 F7200 X84.115 Y109.218
+G1 F2400 X90.782 Y115.885 E114.26477
+G1 F2700 E109.26477
+;TIME_ELAPSED:720.492000
+G1 F2700 E108.26477
+M140 S0
+M107
+G91 ;Relative positioning
+G1 E-2 F2700 ;Retract a bit
+G1 E-2 Z0.2 F2400 ;Retract and raise Z
+G1 X5 Y5 F3000 ;Wipe out
+G1 Z10 ;Raise Z more
+G90 ;Absolute positionning
+G1 X0 Y200 ;Present print
+M106 S0 ;Turn-off fan
+M104 S0 ;Turn-off hotend
+M140 S0 ;Turn-off bed
+M84 X Y E ;Disable all steppers but Z
+M82 ;absolute extrusion mode
+M104 S0
+;End of Gcode
@@ -0,0 +1,1697 @@
+; generated by PrusaSlicer 2.3.0+linux64 on 2021-01-11 at 19:52:27 UTC
+
+;
+
+; external perimeters extrusion width = 0.45mm
+; perimeters extrusion width = 0.45mm
+; infill extrusion width = 0.45mm
+; solid infill extrusion width = 0.45mm
+; top infill extrusion width = 0.40mm
+; first layer extrusion width = 0.42mm
+
+M73 P0 R30
+M201 X1000 Y1000 Z200 E5000 ; sets maximum accelerations, mm/sec^2
+M203 X200 Y200 Z12 E120 ; sets maximum feedrates, mm/sec
+M204 P1250 R1250 T1250 ; sets acceleration (P, T) and retract acceleration (R), mm/sec^2
+M205 X8.00 Y8.00 Z0.40 E4.50 ; sets the jerk limits, mm/sec
+M205 S0 T0 ; sets the minimum extruding and travel feed rate, mm/sec
+M107
+G90 ; use absolute coordinates
+M83 ; extruder relative mode
+M104 S215 ; set extruder temp
+M140 S60 ; set bed temp
+M190 S60 ; wait for bed temp
+M109 S215 ; wait for extruder temp
+G28 W ; home all without mesh bed level
+G1 Y-3.0 F1000.0 ; go outside print area
+G92 E0.0
+G1 X60.0 E9.0 F1000.0 ; intro line
+G1 X100.0 E12.5 F1000.0 ; intro line
+G92 E0.0
+M221 S95
+G21 ; set units to millimeters
+G90 ; use absolute coordinates
+M83 ; use relative distances for extrusion
+M900 K0.05 ; Filament gcode
+;BEFORE_LAYER_CHANGE
+G92 E0.0
+;0.2
+
+
+G1 E-.8 F2100
+;AFTER_LAYER_CHANGE
+;.3
+G1 Z.3 F10800
+M73 P0 R30
+G1 X120 Y100
+G1 E.8 F2100
+;TYPE:External perimeter
+;WIDTH:0.45
+G1 F1200
+G1 X120.36 Y101.067 E.04214
+G1 X120.636 Y102.169 E.04251
+G1 X120.801 Y103.295 E.04257
+G1 X120.834 Y104.428 E.04244
+G1 X120.718 Y105.551 E.04224
+G1 X120.448 Y106.644 E.04211
+G1 X120.024 Y107.687 E.04211
+G1 X119.458 Y108.663 E.04224
+G1 X118.765 Y109.561 E.04244
+G1 X117.97 Y110.375 E.04257
+G1 X117.099 Y111.104 E.04251
+G1 X116.18 Y111.756 E.04214
+G1 X115.241 Y112.342 E.04143
+G1 X114.306 Y112.881 E.0404
+G1 X113.392 Y113.392 E.03917
+G1 X112.513 Y113.898 E.03793
+G1 X111.675 Y114.417 E.03692
+G1 X110.874 Y114.967 E.03634
+G1 X110.104 Y115.558 E.03634
+G1 X109.35 Y116.196 E.03692
+G1 X108.598 Y116.875 E.03793
+G1 X107.83 Y117.586 E.03917
+G1 X107.028 Y118.309 E.0404
+G1 X106.18 Y119.021 E.04143
+G1 X105.277 Y119.694 E.04214
+G1 X104.314 Y120.297 E.04251
+G1 X103.295 Y120.801 E.04257
+G1 X102.226 Y121.182 E.04244
+G1 X101.123 Y121.419 E.04224
+G1 X100 Y121.5 E.04211
+G1 X98.877 Y121.419 E.04211
+G1 X97.774 Y121.182 E.04224
+G1 X96.705 Y120.801 E.04244
+G1 X95.686 Y120.297 E.04257
+G1 X94.723 Y119.694 E.04251
+G1 X93.82 Y119.021 E.04214
+G1 X92.972 Y118.309 E.04143
+G1 X92.17 Y117.586 E.0404
+G1 X91.402 Y116.875 E.03917
+G1 X90.65 Y116.196 E.03793
+G1 X89.896 Y115.558 E.03692
+G1 X89.126 Y114.967 E.03634
+G1 X88.325 Y114.417 E.03634
+G1 X87.487 Y113.898 E.03692
+G1 X86.608 Y113.392 E.03793
+G1 X85.694 Y112.881 E.03917
+G1 X84.759 Y112.342 E.0404
+G1 X83.82 Y111.756 E.04143
+G1 X82.901 Y111.104 E.04214
+G1 X82.03 Y110.375 E.04251
+G1 X81.235 Y109.561 E.04257
+G1 X80.542 Y108.663 E.04244
+G1 X79.976 Y107.687 E.04224
+G1 X79.552 Y106.644 E.04211
+G1 X79.282 Y105.551 E.04211
+G1 X79.166 Y104.428 E.04224
+G1 X79.199 Y103.295 E.04244
+G1 X79.364 Y102.169 E.04257
+G1 X79.64 Y101.067 E.04251
+G1 X80 Y100 E.04214
+G1 X80.415 Y98.974 E.04143
+G1 X80.855 Y97.988 E.0404
+G1 X81.294 Y97.037 E.03917
+G1 X81.708 Y96.112 E.03793
+G1 X82.081 Y95.199 E.03692
+G1 X82.405 Y94.283 E.03634
+G1 X82.681 Y93.352 E.03634
+G1 X82.916 Y92.394 E.03692
+G1 X83.125 Y91.402 E.03793
+G1 X83.329 Y90.375 E.03917
+G1 X83.552 Y89.319 E.0404
+G1 X83.82 Y88.244 E.04143
+G1 X84.155 Y87.169 E.04214
+G1 X84.58 Y86.116 E.04251
+G1 X85.108 Y85.108 E.04257
+G1 X85.748 Y84.172 E.04244
+G1 X86.502 Y83.331 E.04224
+G1 X87.363 Y82.606 E.04211
+G1 X88.318 Y82.011 E.04211
+G1 X89.35 Y81.554 E.04224
+G1 X90.439 Y81.235 E.04244
+G1 X91.56 Y81.044 E.04257
+G1 X92.694 Y80.966 E.04251
+G1 X93.82 Y80.979 E.04214
+G1 X94.924 Y81.056 E.04143
+G1 X95.998 Y81.171 E.0404
+G1 X97.037 Y81.294 E.03917
+G1 X98.045 Y81.401 E.03793
+G1 X99.029 Y81.474 E.03692
+G1 X100 Y81.5 E.03634
+G1 X100.971 Y81.474 E.03634
+G1 X101.955 Y81.401 E.03692
+G1 X102.963 Y81.294 E.03793
+G1 X104.002 Y81.171 E.03917
+G1 X105.076 Y81.056 E.0404
+G1 X106.18 Y80.979 E.04143
+G1 X107.306 Y80.966 E.04214
+G1 X108.44 Y81.044 E.04251
+G1 X109.561 Y81.235 E.04257
+G1 X110.65 Y81.554 E.04244
+G1 X111.682 Y82.011 E.04224
+G1 X112.637 Y82.606 E.04211
+G1 X113.498 Y83.331 E.04211
+G1 X114.252 Y84.172 E.04224
+G1 X114.892 Y85.108 E.04244
+G1 X115.42 Y86.116 E.04257
+G1 X115.845 Y87.169 E.04251
+G1 X116.18 Y88.244 E.04214
+G1 X116.448 Y89.319 E.04143
+G1 X116.671 Y90.375 E.0404
+G1 X116.875 Y91.402 E.03917
+G1 X117.084 Y92.394 E.03793
+G1 X117.319 Y93.352 E.03692
+G1 X117.595 Y94.283 E.03634
+G1 X117.919 Y95.199 E.03634
+G1 X118.292 Y96.112 E.03692
+G1 X118.706 Y97.037 E.03793
+G1 X119.145 Y97.988 E.03917
+G1 X119.585 Y98.974 E.0404
+G1 X120 Y100 E.04143
+G1 X120.36 Y101.067 F10800
+G1 E-.8 F2100
+G1 X119.55 Y100
+G1 E.8 F2100
+;TYPE:Perimeter
+;WIDTH:0.45
+G1 F1200
+G1 X119.934 Y101.119 E.04428
+G1 X120.22 Y102.278 E.04466
+G1 X120.376 Y103.462 E.04468
+G1 X120.377 Y104.651 E.04449
+G1 X120.207 Y105.822 E.04426
+G1 X119.86 Y106.949 E.04415
+G1 X119.342 Y108.012 E.04422
+G1 X118.671 Y108.991 E.04444
+G1 X117.87 Y109.877 E.04465
+G1 X116.973 Y110.665 E.04469
+G1 X116.013 Y111.362 E.04439
+G1 X115.024 Y111.981 E.04366
+G1 X114.036 Y112.544 E.04253
+G1 X113.074 Y113.074 E.04111
+G1 X112.152 Y113.598 E.03968
+G1 X111.277 Y114.141 E.03853
+G1 X110.446 Y114.723 E.03795
+G1 X109.648 Y115.355 E.0381
+G1 X108.865 Y116.04 E.03893
+G1 X108.077 Y116.771 E.04024
+G1 X107.262 Y117.532 E.0417
+G1 X106.401 Y118.294 E.04302
+G1 X105.482 Y119.027 E.04401
+G1 X104.495 Y119.694 E.04456
+G1 X103.442 Y120.259 E.04471
+G1 X102.331 Y120.689 E.04458
+G1 X101.177 Y120.958 E.04434
+G1 X100 Y121.05 E.04417
+G1 X98.823 Y120.958 E.04417
+G1 X97.669 Y120.689 E.04434
+G1 X96.558 Y120.259 E.04458
+G1 X95.505 Y119.694 E.04471
+G1 X94.518 Y119.027 E.04456
+G1 X93.599 Y118.294 E.04401
+G1 X92.738 Y117.532 E.04302
+G1 X91.923 Y116.771 E.0417
+G1 X91.135 Y116.04 E.04024
+G1 X90.352 Y115.355 E.03893
+G1 X89.554 Y114.723 E.0381
+G1 X88.723 Y114.141 E.03795
+G1 X87.848 Y113.598 E.03853
+G1 X86.926 Y113.074 E.03968
+G1 X85.964 Y112.544 E.04111
+G1 X84.976 Y111.981 E.04253
+G1 X83.987 Y111.362 E.04366
+G1 X83.027 Y110.665 E.04439
+G1 X82.13 Y109.877 E.04469
+G1 X81.329 Y108.991 E.04465
+G1 X80.658 Y108.012 E.04444
+G1 X80.14 Y106.949 E.04422
+G1 X79.793 Y105.822 E.04415
+G1 X79.623 Y104.651 E.04426
+G1 X79.624 Y103.462 E.04449
+G1 X79.78 Y102.278 E.04468
+G1 X80.066 Y101.119 E.04466
+G1 X80.45 Y100 E.04428
+G1 X80.895 Y98.927 E.04347
+G1 X81.366 Y97.9 E.04226
+G1 X81.829 Y96.913 E.04082
+G1 X82.258 Y95.95 E.03942
+G1 X82.635 Y94.997 E.03836
+G1 X82.954 Y94.035 E.03792
+G1 X83.218 Y93.049 E.03822
+G1 X83.443 Y92.026 E.03917
+G1 X83.649 Y90.963 E.04053
+G1 X83.866 Y89.862 E.04198
+G1 X84.124 Y88.736 E.04325
+G1 X84.454 Y87.603 E.04415
+G1 X84.882 Y86.489 E.04462
+G1 X85.426 Y85.426 E.0447
+G1 X86.098 Y84.444 E.04453
+G1 X86.899 Y83.572 E.0443
+G1 X87.82 Y82.834 E.04416
+G1 X88.846 Y82.248 E.0442
+G1 X89.952 Y81.819 E.04439
+G1 X91.112 Y81.543 E.04462
+G1 X92.299 Y81.408 E.04471
+G1 X93.488 Y81.389 E.04448
+G1 X94.657 Y81.456 E.04384
+G1 X95.795 Y81.575 E.04278
+G1 X96.893 Y81.712 E.04141
+G1 X97.953 Y81.835 E.03995
+G1 X98.985 Y81.92 E.03872
+G1 X100 Y81.95 E.03801
+G1 X101.015 Y81.92 E.03801
+G1 X102.047 Y81.835 E.03872
+G1 X103.107 Y81.712 E.03995
+G1 X104.205 Y81.575 E.04141
+G1 X105.343 Y81.456 E.04278
+G1 X106.512 Y81.389 E.04384
+G1 X107.701 Y81.408 E.04448
+G1 X108.888 Y81.543 E.04471
+G1 X110.048 Y81.819 E.04462
+G1 X111.154 Y82.248 E.04439
+G1 X112.18 Y82.834 E.0442
+G1 X113.101 Y83.572 E.04416
+G1 X113.902 Y84.444 E.0443
+G1 X114.574 Y85.426 E.04453
+G1 X115.118 Y86.489 E.0447
+G1 X115.546 Y87.603 E.04462
+G1 X115.876 Y88.736 E.04415
+G1 X116.134 Y89.862 E.04325
+G1 X116.351 Y90.963 E.04198
+G1 X116.557 Y92.026 E.04053
+G1 X116.782 Y93.049 E.03917
+G1 X117.046 Y94.035 E.03822
+G1 X117.365 Y94.997 E.03792
+G1 X117.742 Y95.95 E.03836
+G1 X118.171 Y96.913 E.03942
+G1 X118.634 Y97.9 E.04082
+G1 X119.105 Y98.927 E.04226
+G1 X119.55 Y100 E.04347
+G1 X119.934 Y101.119 F10800
+G1 E-.8 F2100
+G1 X119.1 Y100
+G1 E.8 F2100
+;TYPE:Perimeter
+;WIDTH:0.45
+G1 F1200
+G1 X119.504 Y101.157 E.04587
+G1 X119.798 Y102.358 E.04626
+G1 X119.945 Y103.585 E.04622
+G1 X119.917 Y104.813 E.04597
+G1 X119.696 Y106.015 E.04572
+G1 X119.281 Y107.162 E.04565
+G1 X118.681 Y108.229 E.04581
+G1 X117.922 Y109.199 E.04608
+G1 X117.036 Y110.061 E.04628
+G1 X116.062 Y110.818 E.04616
+G1 X115.041 Y111.482 E.04557
+G1 X114.01 Y112.074 E.04446
+G1 X113.002 Y112.622 E.04295
+G1 X112.036 Y113.157 E.04131
+G1 X111.123 Y113.708 E.03991
+G1 X110.261 Y114.3 E.03914
+G1 X109.437 Y114.949 E.03923
+G1 X108.633 Y115.659 E.04015
+G1 X107.823 Y116.422 E.04163
+G1 X106.982 Y117.216 E.04327
+G1 X106.089 Y118.01 E.04472
+G1 X105.127 Y118.764 E.04573
+G1 X104.091 Y119.437 E.04622
+G1 X102.983 Y119.985 E.04625
+G1 X101.816 Y120.373 E.04603
+G1 X100.61 Y120.575 E.04576
+G1 X99.39 Y120.575 E.04565
+G1 X98.184 Y120.373 E.04576
+G1 X97.017 Y119.985 E.04603
+G1 X95.909 Y119.437 E.04625
+G1 X94.873 Y118.764 E.04622
+G1 X93.911 Y118.01 E.04573
+G1 X93.018 Y117.216 E.04472
+G1 X92.177 Y116.422 E.04327
+G1 X91.367 Y115.659 E.04163
+G1 X90.563 Y114.949 E.04015
+G1 X89.739 Y114.3 E.03923
+G1 X88.877 Y113.708 E.03914
+G1 X87.964 Y113.157 E.03991
+G1 X86.998 Y112.622 E.04131
+G1 X85.99 Y112.074 E.04295
+G1 X84.959 Y111.482 E.04446
+G1 X83.938 Y110.818 E.04557
+G1 X82.964 Y110.061 E.04616
+G1 X82.078 Y109.199 E.04628
+G1 X81.319 Y108.229 E.04608
+G1 X80.719 Y107.162 E.04581
+G1 X80.304 Y106.015 E.04565
+G1 X80.083 Y104.813 E.04572
+G1 X80.055 Y103.585 E.04597
+G1 X80.202 Y102.358 E.04622
+G1 X80.496 Y101.157 E.04626
+G1 X80.9 Y100 E.04587
+G1 X81.371 Y98.894 E.04496
+G1 X81.866 Y97.84 E.04359
+G1 X82.348 Y96.827 E.04196
+G1 X82.786 Y95.84 E.04041
+G1 X83.162 Y94.858 E.03935
+G1 X83.471 Y93.86 E.03908
+G1 X83.723 Y92.83 E.03969
+G1 X83.937 Y91.755 E.04099
+G1 X84.144 Y90.635 E.04262
+G1 X84.378 Y89.478 E.04418
+G1 X84.677 Y88.302 E.04539
+G1 X85.073 Y87.136 E.04608
+G1 X85.593 Y86.014 E.04628
+G1 X86.252 Y84.972 E.04613
+G1 X87.054 Y84.045 E.04586
+G1 X87.991 Y83.263 E.04567
+G1 X89.045 Y82.648 E.04569
+G1 X90.19 Y82.206 E.04591
+G1 X91.394 Y81.935 E.04618
+G1 X92.625 Y81.816 E.04628
+G1 X93.854 Y81.822 E.04599
+G1 X95.058 Y81.915 E.04519
+G1 X96.223 Y82.056 E.04389
+G1 X97.343 Y82.204 E.04229
+G1 X98.424 Y82.324 E.04069
+G1 X99.478 Y82.391 E.03951
+G1 X100.522 Y82.391 E.03907
+G1 X101.576 Y82.324 E.03951
+G1 X102.657 Y82.204 E.04069
+G1 X103.777 Y82.056 E.04229
+G1 X104.942 Y81.915 E.04389
+G1 X106.146 Y81.822 E.04519
+G1 X107.375 Y81.816 E.04599
+G1 X108.606 Y81.935 E.04628
+G1 X109.81 Y82.206 E.04618
+G1 X110.955 Y82.648 E.04591
+G1 X112.009 Y83.263 E.04569
+G1 X112.946 Y84.045 E.04567
+G1 X113.748 Y84.972 E.04586
+G1 X114.407 Y86.014 E.04613
+G1 X114.927 Y87.136 E.04628
+G1 X115.323 Y88.302 E.04608
+G1 X115.622 Y89.478 E.04539
+G1 X115.856 Y90.635 E.04418
+G1 X116.063 Y91.755 E.04262
+G1 X116.277 Y92.83 E.04099
+G1 X116.529 Y93.86 E.03969
+G1 X116.838 Y94.858 E.03908
+G1 X117.214 Y95.84 E.03935
+G1 X117.652 Y96.827 E.04041
+G1 X118.134 Y97.84 E.04196
+G1 X118.629 Y98.894 E.04359
+G1 X119.1 Y100 E.04496
+G1 X119.504 Y101.157 F10800
+G1 E-.8 F2100
+;TYPE:Internal infill
+;WIDTH:0.45
+G1 X83.173 Y92.786 F10800
+G1 F3600
+G1 X92.786 Y83.173 E.50867
+G1 X98.298 Y81.903 F10800
+G1 F3600
+G1 X81.903 Y98.298 E.86759
+G1 X82.058 Y102.386 F10800
+G1 F3600
+G1 X102.386 Y82.058 E1.07572
+G1 X105.785 Y82.902 F10800
+G1 F3600
+G1 X82.902 Y105.785 E1.2109
+G1 X84.223 Y108.706 F10800
+G1 F3600
+G1 X108.706 Y84.223 E1.29551
+G1 X111.237 Y85.935 F10800
+G1 F3600
+G1 X85.935 Y111.237 E1.33892
+G1 X87.998 Y113.416 F10800
+G1 F3600
+G1 X113.416 Y87.998 E1.34501
+G1 X115.247 Y90.41 F10800
+G1 F3600
+G1 X90.41 Y115.247 E1.31429
+G1 X93.194 Y116.705 F10800
+G1 F3600
+G1 X116.705 Y93.194 E1.2441
+G1 X117.723 Y96.419 F10800
+G1 F3600
+G1 X96.419 Y117.723 E1.12735
+G1 X100.239 Y118.146 F10800
+G1 F3600
+G1 X118.146 Y100.239 E.9476
+G1 X117.527 Y105.1 F10800
+G1 F3600
+G1 X105.1 Y117.527 E.65758
+;BEFORE_LAYER_CHANGE
+G92 E0.0
+;.5
+
+
+G1 E-.8 F2100
+;AFTER_LAYER_CHANGE
+;.5
+G1 Z.5 F10800
+M73 P10 R27
+G1 X120.616 Y102.068
+G1 E.8 F2100
+;TYPE:External perimeter
+;WIDTH:0.45
+G1 F2100
+G1 X120.792 Y103.193 E.04257
+G1 X120.837 Y104.326 E.04245
+G1 X120.735 Y105.451 E.04226
+G1 X120.478 Y106.547 E.04212
+G1 X120.069 Y107.595 E.0421
+G1 X119.514 Y108.578 E.04223
+G1 X118.832 Y109.484 E.04242
+G1 X118.045 Y110.305 E.04256
+G1 X117.18 Y111.042 E.04252
+G1 X116.264 Y111.7 E.04219
+G1 X115.326 Y112.291 E.04151
+G1 X114.389 Y112.834 E.0405
+G1 X113.473 Y113.347 E.03928
+G1 X112.591 Y113.852 E.03804
+G1 X111.749 Y114.369 E.03699
+G1 X110.945 Y114.916 E.03637
+G1 X110.172 Y115.503 E.03632
+G1 X109.418 Y116.136 E.03684
+G1 X108.666 Y116.812 E.03783
+G1 X107.9 Y117.521 E.03905
+G1 X107.102 Y118.244 E.04029
+G1 X106.259 Y118.958 E.04135
+G1 X105.361 Y119.635 E.04209
+G1 X104.403 Y120.246 E.04249
+G1 X103.389 Y120.761 E.04257
+G1 X102.324 Y121.154 E.04245
+G1 X101.223 Y121.404 E.04226
+G1 X100.101 Y121.499 E.04212
+G1 X98.978 Y121.433 E.0421
+G1 X97.872 Y121.21 E.04223
+G1 X96.8 Y120.841 E.04242
+G1 X95.775 Y120.347 E.04256
+G1 X94.807 Y119.751 E.04252
+G1 X93.899 Y119.084 E.04219
+G1 X93.046 Y118.374 E.04151
+G1 X92.241 Y117.651 E.0405
+G1 X91.47 Y116.938 E.03928
+G1 X90.717 Y116.255 E.03804
+G1 X89.965 Y115.614 E.03699
+G1 X89.196 Y115.018 E.03637
+G1 X88.399 Y114.465 E.03632
+G1 X87.564 Y113.943 E.03684
+G1 X86.689 Y113.438 E.03783
+G1 X85.778 Y112.928 E.03905
+G1 X84.844 Y112.392 E.04029
+G1 X83.904 Y111.811 E.04135
+G1 X82.982 Y111.166 E.04209
+G1 X82.106 Y110.444 E.04249
+G1 X81.303 Y109.638 E.04257
+G1 X80.6 Y108.747 E.04245
+G1 X80.021 Y107.778 E.04226
+G1 X79.584 Y106.74 E.04212
+G1 X79.3 Y105.651 E.0421
+G1 X79.171 Y104.53 E.04223
+G1 X79.19 Y103.397 E.04242
+G1 X79.344 Y102.27 E.04256
+G1 X79.611 Y101.165 E.04252
+G1 X79.965 Y100.095 E.04219
+G1 X80.376 Y99.064 E.04151
+G1 X80.815 Y98.075 E.0405
+G1 X81.255 Y97.122 E.03928
+G1 X81.672 Y96.195 E.03804
+G1 X82.049 Y95.281 E.03699
+G1 X82.378 Y94.366 E.03637
+G1 X82.658 Y93.437 E.03632
+G1 X82.896 Y92.481 E.03684
+G1 X83.107 Y91.493 E.03783
+G1 X83.31 Y90.469 E.03905
+G1 X83.531 Y89.415 E.04029
+G1 X83.793 Y88.341 E.04135
+G1 X84.122 Y87.266 E.04209
+G1 X84.537 Y86.209 E.04249
+G1 X85.056 Y85.196 E.04257
+G1 X85.686 Y84.253 E.04245
+G1 X86.429 Y83.402 E.04226
+G1 X87.281 Y82.666 E.04212
+G1 X88.229 Y82.059 E.0421
+G1 X89.255 Y81.59 E.04223
+G1 X90.339 Y81.258 E.04242
+G1 X91.458 Y81.056 E.04256
+G1 X92.591 Y80.969 E.04252
+G1 X93.719 Y80.975 E.04219
+G1 X94.826 Y81.048 E.04151
+G1 X95.902 Y81.16 E.0405
+G1 X96.945 Y81.283 E.03928
+G1 X97.955 Y81.393 E.03804
+G1 X98.941 Y81.47 E.03699
+G1 X99.913 Y81.5 E.03637
+G1 X100.883 Y81.479 E.03632
+G1 X101.865 Y81.41 E.03684
+G1 X102.871 Y81.305 E.03783
+G1 X103.907 Y81.182 E.03905
+G1 X104.978 Y81.066 E.04029
+G1 X106.08 Y80.984 E.04135
+G1 X107.204 Y80.964 E.04209
+G1 X108.338 Y81.033 E.04249
+G1 X109.461 Y81.213 E.04257
+G1 X110.553 Y81.52 E.04245
+G1 X111.592 Y81.965 E.04226
+G1 X112.555 Y82.547 E.04212
+G1 X113.425 Y83.261 E.0421
+G1 X114.189 Y84.092 E.04223
+G1 X114.839 Y85.02 E.04242
+G1 X115.377 Y86.022 E.04256
+G1 X115.81 Y87.073 E.04252
+G1 X116.153 Y88.147 E.04219
+G1 X116.426 Y89.222 E.04151
+G1 X116.652 Y90.281 E.0405
+G1 X116.857 Y91.311 E.03928
+G1 X117.065 Y92.306 E.03804
+G1 X117.296 Y93.267 E.03699
+G1 X117.568 Y94.2 E.03637
+G1 X117.888 Y95.116 E.03632
+G1 X118.257 Y96.029 E.03684
+G1 X118.668 Y96.953 E.03783
+G1 X119.105 Y97.901 E.03905
+G1 X119.546 Y98.883 E.04029
+G1 X119.964 Y99.906 E.04135
+G1 X120.331 Y100.969 E.04209
+G1 X120.616 Y102.068 E.04249
+G1 X120.792 Y103.193 F10800
+G1 E-.8 F2100
+G1 X120.168 Y102.024
+G1 E.8 F2100
+;TYPE:Perimeter
+;WIDTH:0.45
+G1 F2100
+G1 X120.355 Y103.203 E.0447
+G1 X120.391 Y104.393 E.04454
+G1 X120.259 Y105.57 E.0443
+G1 X119.95 Y106.709 E.04416
+G1 X119.469 Y107.787 E.04419
+G1 X118.829 Y108.786 E.04439
+G1 X118.054 Y109.692 E.04462
+G1 X117.175 Y110.501 E.04471
+G1 X116.225 Y111.217 E.04449
+G1 X115.24 Y111.852 E.04386
+G1 X114.25 Y112.425 E.0428
+G1 X113.28 Y112.96 E.04143
+G1 X112.349 Y113.484 E.03998
+G1 X111.464 Y114.021 E.03874
+G1 X110.624 Y114.592 E.03802
+G1 X109.82 Y115.213 E.038
+G1 X109.035 Y115.887 E.0387
+G1 X108.25 Y116.609 E.03993
+G1 X107.442 Y117.365 E.04138
+G1 X106.593 Y118.13 E.04276
+G1 X105.687 Y118.872 E.04383
+G1 X104.715 Y119.557 E.04448
+G1 X103.676 Y120.147 E.04471
+G1 X102.577 Y120.609 E.04462
+G1 X101.431 Y120.915 E.04439
+G1 X100.257 Y121.046 E.0442
+G1 X99.078 Y120.994 E.04416
+G1 X97.917 Y120.762 E.0443
+G1 X96.795 Y120.365 E.04453
+G1 X95.728 Y119.827 E.0447
+G1 X94.727 Y119.179 E.04462
+G1 X93.793 Y118.458 E.04417
+G1 X92.921 Y117.698 E.04327
+G1 X92.098 Y116.935 E.04201
+G1 X91.305 Y116.196 E.04055
+G1 X90.523 Y115.499 E.03919
+G1 X89.73 Y114.856 E.03823
+G1 X88.907 Y114.264 E.03792
+G1 X88.042 Y113.714 E.03835
+G1 X87.13 Y113.188 E.03939
+G1 X86.176 Y112.661 E.04079
+G1 X85.192 Y112.107 E.04223
+G1 X84.201 Y111.502 E.04345
+G1 X83.232 Y110.824 E.04427
+G1 X82.318 Y110.056 E.04466
+G1 X81.494 Y109.192 E.04468
+G1 X80.792 Y108.232 E.04449
+G1 X80.239 Y107.187 E.04426
+G1 X79.854 Y106.071 E.04415
+G1 X79.645 Y104.908 E.04422
+G1 X79.609 Y103.721 E.04443
+G1 X79.734 Y102.534 E.04465
+G1 X79.994 Y101.369 E.04469
+G1 X80.36 Y100.24 E.0444
+G1 X80.795 Y99.156 E.04368
+G1 X81.263 Y98.12 E.04255
+G1 X81.73 Y97.125 E.04114
+G1 X82.168 Y96.158 E.0397
+G1 X82.558 Y95.205 E.03854
+G1 X82.89 Y94.246 E.03795
+G1 X83.165 Y93.266 E.03809
+G1 X83.396 Y92.252 E.03891
+G1 X83.604 Y91.198 E.04021
+G1 X83.816 Y90.104 E.04167
+G1 X84.063 Y88.982 E.043
+G1 X84.375 Y87.848 E.04399
+G1 X84.779 Y86.728 E.04455
+G1 X85.297 Y85.651 E.04471
+G1 X85.941 Y84.649 E.04458
+G1 X86.714 Y83.751 E.04435
+G1 X87.61 Y82.982 E.04418
+G1 X88.615 Y82.362 E.04417
+G1 X89.705 Y81.899 E.04434
+G1 X90.856 Y81.591 E.04457
+G1 X92.04 Y81.426 E.04471
+G1 X93.23 Y81.384 E.04457
+G1 X94.405 Y81.435 E.04402
+G1 X95.55 Y81.546 E.04304
+G1 X96.657 Y81.682 E.04172
+G1 X97.726 Y81.811 E.04026
+G1 X98.762 Y81.906 E.03895
+G1 X99.78 Y81.949 E.03811
+G1 X100.794 Y81.931 E.03795
+G1 X101.82 Y81.857 E.03851
+G1 X102.874 Y81.741 E.03966
+G1 X103.963 Y81.604 E.04109
+G1 X105.092 Y81.478 E.0425
+G1 X106.256 Y81.397 E.04365
+G1 X107.442 Y81.395 E.04438
+G1 X108.631 Y81.503 E.04469
+G1 X109.8 Y81.746 E.04466
+G1 X110.92 Y82.141 E.04444
+G1 X111.965 Y82.694 E.04423
+G1 X112.91 Y83.399 E.04415
+G1 X113.739 Y84.244 E.04426
+G1 X114.439 Y85.204 E.04448
+G1 X115.01 Y86.253 E.04468
+G1 X115.462 Y87.358 E.04467
+G1 X115.811 Y88.489 E.04429
+G1 X116.082 Y89.619 E.04348
+G1 X116.306 Y90.727 E.04228
+G1 X116.512 Y91.799 E.04085
+G1 X116.73 Y92.83 E.03944
+G1 X116.984 Y93.823 E.03837
+G1 X117.291 Y94.789 E.03792
+G1 X117.655 Y95.743 E.0382
+G1 X118.074 Y96.702 E.03915
+G1 X118.532 Y97.683 E.0405
+G1 X119.003 Y98.7 E.04196
+G1 X119.457 Y99.763 E.04323
+G1 X119.857 Y100.872 E.04414
+G1 X120.168 Y102.024 E.04461
+G1 X120.355 Y103.203 F10800
+G1 E-.8 F2100
+G1 X119.72 Y101.979
+G1 E.8 F2100
+;TYPE:Perimeter
+;WIDTH:0.45
+G1 F2100
+G1 X119.917 Y103.199 E.04627
+G1 X119.946 Y104.43 E.04606
+G1 X119.786 Y105.643 E.04578
+G1 X119.431 Y106.81 E.04565
+G1 X118.888 Y107.905 E.04574
+G1 X118.175 Y108.907 E.04599
+G1 X117.324 Y109.803 E.04624
+G1 X116.373 Y110.592 E.04624
+G1 X115.363 Y111.283 E.04581
+G1 X114.332 Y111.895 E.04486
+G1 X113.314 Y112.453 E.04345
+G1 X112.333 Y112.989 E.04181
+G1 X111.403 Y113.532 E.04029
+G1 X110.526 Y114.109 E.03929
+G1 X109.692 Y114.74 E.0391
+G1 X108.884 Y115.431 E.03978
+G1 X108.078 Y116.178 E.04113
+G1 X107.25 Y116.966 E.04276
+G1 X106.375 Y117.764 E.04431
+G1 X105.436 Y118.535 E.04547
+G1 X104.424 Y119.238 E.04612
+G1 X103.337 Y119.829 E.04628
+G1 X102.187 Y120.271 E.04611
+G1 X100.99 Y120.533 E.04583
+G1 X99.772 Y120.596 E.04566
+G1 X98.558 Y120.457 E.0457
+G1 X97.376 Y120.125 E.04594
+G1 X96.248 Y119.624 E.0462
+G1 X95.189 Y118.986 E.04627
+G1 X94.204 Y118.252 E.04594
+G1 X93.291 Y117.466 E.04509
+G1 X92.436 Y116.668 E.04376
+G1 X91.619 Y115.893 E.04214
+G1 X90.815 Y115.165 E.04057
+G1 X90 Y114.497 E.03944
+G1 X89.152 Y113.888 E.03907
+G1 X88.256 Y113.326 E.03958
+G1 X87.306 Y112.789 E.04082
+G1 X86.309 Y112.249 E.04243
+G1 X85.282 Y111.674 E.04402
+G1 X84.255 Y111.035 E.04528
+G1 X83.262 Y110.309 E.04603
+G1 X82.344 Y109.48 E.04628
+G1 X81.54 Y108.544 E.04616
+G1 X80.888 Y107.505 E.04589
+G1 X80.413 Y106.381 E.04568
+G1 X80.131 Y105.193 E.04567
+G1 X80.044 Y103.97 E.04588
+G1 X80.139 Y102.74 E.04616
+G1 X80.39 Y101.529 E.04628
+G1 X80.764 Y100.357 E.04604
+G1 X81.219 Y99.235 E.0453
+G1 X81.711 Y98.165 E.04406
+G1 X82.2 Y97.141 E.04248
+G1 X82.655 Y96.148 E.04086
+G1 X83.051 Y95.166 E.03961
+G1 X83.381 Y94.175 E.03907
+G1 X83.649 Y93.157 E.03942
+G1 X83.872 Y92.097 E.04053
+G1 X84.078 Y90.991 E.0421
+G1 X84.3 Y89.843 E.04372
+G1 X84.575 Y88.671 E.04506
+G1 X84.937 Y87.498 E.04592
+G1 X85.416 Y86.358 E.04627
+G1 X86.03 Y85.287 E.04621
+G1 X86.787 Y84.32 E.04594
+G1 X87.684 Y83.491 E.04571
+G1 X88.704 Y82.822 E.04566
+G1 X89.824 Y82.326 E.04583
+G1 X91.013 Y82.002 E.0461
+G1 X92.239 Y81.838 E.04628
+G1 X93.472 Y81.809 E.04613
+G1 X94.685 Y81.879 E.04549
+G1 X95.863 Y82.009 E.04434
+G1 X96.997 Y82.159 E.04281
+G1 X98.09 Y82.291 E.04117
+G1 X99.15 Y82.377 E.03981
+G1 X100.195 Y82.399 E.03911
+G1 X101.244 Y82.352 E.03928
+G1 X102.315 Y82.246 E.04026
+G1 X103.422 Y82.103 E.04177
+G1 X104.573 Y81.956 E.04341
+G1 X105.765 Y81.844 E.04483
+G1 X106.989 Y81.806 E.04579
+G1 X108.222 Y81.882 E.04624
+G1 X109.438 Y82.104 E.04624
+G1 X110.605 Y82.491 E.046
+G1 X111.69 Y83.052 E.04574
+G1 X112.667 Y83.783 E.04565
+G1 X113.513 Y84.668 E.04578
+G1 X114.216 Y85.677 E.04605
+G1 X114.778 Y86.779 E.04626
+G1 X115.211 Y87.935 E.04619
+G1 X115.537 Y89.111 E.04566
+G1 X115.787 Y90.276 E.04461
+G1 X115.999 Y91.41 E.04313
+G1 X116.207 Y92.499 E.04149
+G1 X116.445 Y93.542 E.04004
+G1 X116.734 Y94.548 E.03918
+G1 X117.09 Y95.533 E.03917
+G1 X117.51 Y96.517 E.04001
+G1 X117.98 Y97.519 E.04144
+G1 X118.475 Y98.559 E.04309
+G1 X118.958 Y99.648 E.04458
+G1 X119.387 Y100.79 E.04564
+G1 X119.72 Y101.979 E.04619
+G1 X119.917 Y103.199 F10800
+G1 E-.8 F2100
+;TYPE:Internal infill
+;WIDTH:0.45
+G1 X107.824 Y83.429 F10800
+G1 F3600
+G1 X116.571 Y92.176 E.46285
+G1 X117.972 Y97.112 F10800
+G1 F3600
+G1 X102.888 Y82.028 E.79822
+G1 X99.213 Y81.889 F10800
+G1 F3600
+G1 X118.111 Y100.787 E1.00004
+G1 X117.658 Y103.869 F10800
+G1 F3600
+G1 X96.131 Y82.342 E1.13916
+G1 X93.445 Y83.192 F10800
+G1 F3600
+G1 X116.808 Y106.555 E1.23629
+G1 X115.648 Y108.931 F10800
+G1 F3600
+G1 X91.069 Y84.352 E1.30062
+G1 X88.96 Y85.778 F10800
+G1 F3600
+G1 X114.222 Y111.04 E1.33676
+G1 X112.55 Y112.904 F10800
+G1 F3600
+G1 X87.096 Y87.45 E1.34691
+G1 X85.473 Y89.362 F10800
+G1 F3600
+G1 X110.638 Y114.527 E1.33165
+G1 X108.478 Y115.902 F10800
+G1 F3600
+G1 X84.098 Y91.522 E1.29012
+G1 X82.995 Y93.955 F10800
+G1 F3600
+G1 X106.045 Y117.005 E1.2197
+G1 X103.289 Y117.784 F10800
+G1 F3600
+G1 X82.216 Y96.711 E1.11511
+G1 X81.859 Y99.891 F10800
+G1 F3600
+G1 X100.109 Y118.141 E.96573
+G1 X96.269 Y117.835 F10800
+G1 F3600
+G1 X82.165 Y103.731 E.74635
+G1 X84.115 Y109.218 F10800
+G1 F3600
+G1 X90.782 Y115.885 E.35279
+M106 S255
+;BEFORE_LAYER_CHANGE
+G92 E0.0
+;.7
+
+
+G1 E-.8 F2100
+;AFTER_LAYER_CHANGE
+;.7
+G1 Z.7 F10800
+M73 P20 R24
+G1 X120.838 Y104.224
+G1 E.8 F2100
+;TYPE:External perimeter
+;WIDTH:0.45
+G1 F2100
+G1 X120.75 Y105.351 E.04228
+G1 X120.508 Y106.45 E.04213
+G1 X120.112 Y107.503 E.0421
+G1 X119.57 Y108.493 E.04221
+G1 X118.898 Y109.406 E.0424
+G1 X118.12 Y110.235 E.04256
+G1 X117.26 Y110.979 E.04254
+G1 X116.348 Y111.644 E.04223
+G1 X115.411 Y112.24 E.04158
+G1 X114.473 Y112.786 E.0406
+G1 X113.555 Y113.301 E.0394
+G1 X112.669 Y113.806 E.03814
+G1 X111.823 Y114.321 E.03707
+G1 X111.016 Y114.865 E.0364
+G1 X110.241 Y115.448 E.0363
+G1 X109.486 Y116.077 E.03677
+G1 X108.735 Y116.75 E.03772
+G1 X107.97 Y117.456 E.03894
+G1 X107.176 Y118.179 E.04019
+G1 X106.337 Y118.895 E.04126
+G1 X105.444 Y119.577 E.04204
+G1 X104.492 Y120.194 E.04246
+G1 X103.482 Y120.719 E.04258
+G1 X102.422 Y121.124 E.04247
+G1 X101.323 Y121.388 E.04228
+G1 X100.203 Y121.497 E.04213
+G1 X99.079 Y121.446 E.0421
+G1 X97.97 Y121.236 E.04221
+G1 X96.895 Y120.88 E.0424
+G1 X95.866 Y120.396 E.04256
+G1 X94.892 Y119.808 E.04254
+G1 X93.978 Y119.146 E.04223
+G1 X93.121 Y118.439 E.04158
+G1 X92.312 Y117.716 E.0406
+G1 X91.539 Y117.001 E.0394
+G1 X90.785 Y116.315 E.03814
+G1 X90.033 Y115.67 E.03707
+G1 X89.267 Y115.07 E.0364
+G1 X88.472 Y114.513 E.0363
+G1 X87.641 Y113.99 E.03677
+G1 X86.769 Y113.483 E.03772
+G1 X85.861 Y112.974 E.03894
+G1 X84.928 Y112.442 E.04019
+G1 X83.988 Y111.866 E.04126
+G1 X83.064 Y111.227 E.04204
+G1 X82.182 Y110.513 E.04246
+G1 X81.371 Y109.714 E.04258
+G1 X80.659 Y108.831 E.04247
+G1 X80.068 Y107.868 E.04228
+G1 X79.617 Y106.836 E.04213
+G1 X79.319 Y105.751 E.0421
+G1 X79.176 Y104.632 E.04221
+G1 X79.182 Y103.499 E.0424
+G1 X79.325 Y102.371 E.04256
+G1 X79.583 Y101.263 E.04254
+G1 X79.93 Y100.189 E.04223
+G1 X80.338 Y99.156 E.04158
+G1 X80.775 Y98.163 E.0406
+G1 X81.216 Y97.206 E.0394
+G1 X81.636 Y96.277 E.03814
+G1 X82.017 Y95.363 E.03707
+G1 X82.351 Y94.449 E.0364
+G1 X82.635 Y93.521 E.0363
+G1 X82.876 Y92.569 E.03677
+G1 X83.088 Y91.583 E.03772
+G1 X83.292 Y90.563 E.03894
+G1 X83.509 Y89.511 E.04019
+G1 X83.767 Y88.439 E.04126
+G1 X84.089 Y87.362 E.04204
+G1 X84.496 Y86.303 E.04246
+G1 X85.005 Y85.285 E.04258
+G1 X85.624 Y84.334 E.04247
+G1 X86.358 Y83.475 E.04228
+G1 X87.2 Y82.728 E.04213
+G1 X88.14 Y82.109 E.0421
+G1 X89.16 Y81.627 E.04221
+G1 X90.239 Y81.283 E.0424
+G1 X91.357 Y81.069 E.04256
+G1 X92.489 Y80.973 E.04254
+G1 X93.618 Y80.971 E.04223
+G1 X94.727 Y81.039 E.04158
+G1 X95.807 Y81.149 E.0406
+G1 X96.852 Y81.272 E.0394
+G1 X97.866 Y81.384 E.03814
+G1 X98.853 Y81.464 E.03707
+G1 X99.825 Y81.499 E.0364
+G1 X100.795 Y81.483 E.0363
+G1 X101.776 Y81.418 E.03677
+G1 X102.779 Y81.315 E.03772
+G1 X103.812 Y81.193 E.03894
+G1 X104.88 Y81.075 E.04019
+G1 X105.979 Y80.989 E.04126
+G1 X107.102 Y80.962 E.04204
+G1 X108.236 Y81.022 E.04246
+G1 X109.361 Y81.191 E.04258
+G1 X110.457 Y81.487 E.04247
+G1 X111.501 Y81.919 E.04228
+G1 X112.472 Y82.489 E.04213
+G1 X113.351 Y83.191 E.0421
+G1 X114.124 Y84.012 E.04221
+G1 X114.785 Y84.933 E.0424
+G1 X115.333 Y85.93 E.04256
+G1 X115.775 Y86.977 E.04254
+G1 X116.126 Y88.05 E.04223
+G1 X116.404 Y89.126 E.04158
+G1 X116.633 Y90.186 E.0406
+G1 X116.839 Y91.219 E.0394
+G1 X117.045 Y92.217 E.03814
+G1 X117.274 Y93.181 E.03707
+G1 X117.541 Y94.117 E.0364
+G1 X117.857 Y95.034 E.0363
+G1 X118.222 Y95.947 E.03677
+G1 X118.629 Y96.869 E.03772
+G1 X119.065 Y97.814 E.03894
+G1 X119.507 Y98.793 E.04019
+G1 X119.928 Y99.812 E.04126
+G1 X120.301 Y100.872 E.04204
+G1 X120.594 Y101.968 E.04246
+G1 X120.781 Y103.091 E.04258
+G1 X120.838 Y104.224 E.04247
+G1 X120.75 Y105.351 F10800
+G1 E-.8 F2100
+G1 X120.397 Y104.135
+G1 E.8 F2100
+;TYPE:Perimeter
+;WIDTH:0.45
+G1 F2100
+G1 X120.303 Y105.316 E.04435
+G1 X120.032 Y106.466 E.04418
+G1 X119.587 Y107.559 E.04417
+G1 X118.98 Y108.576 E.04434
+G1 X118.232 Y109.503 E.04457
+G1 X117.373 Y110.334 E.04471
+G1 X116.436 Y111.069 E.04457
+G1 X115.455 Y111.72 E.04403
+G1 X114.464 Y112.304 E.04307
+G1 X113.488 Y112.846 E.04175
+G1 X112.548 Y113.369 E.04029
+G1 X111.652 Y113.902 E.03897
+G1 X110.803 Y114.464 E.03812
+G1 X109.992 Y115.073 E.03794
+G1 X109.205 Y115.736 E.0385
+G1 X108.422 Y116.448 E.03963
+G1 X107.621 Y117.199 E.04106
+G1 X106.782 Y117.964 E.04248
+G1 X105.89 Y118.715 E.04363
+G1 X104.933 Y119.415 E.04437
+G1 X103.908 Y120.028 E.04469
+G1 X102.821 Y120.521 E.04466
+G1 X101.683 Y120.862 E.04445
+G1 X100.513 Y121.033 E.04423
+G1 X99.333 Y121.021 E.04415
+G1 X98.167 Y120.827 E.04425
+G1 X97.035 Y120.464 E.04448
+G1 X95.955 Y119.955 E.04468
+G1 X94.939 Y119.328 E.04467
+G1 X93.991 Y118.619 E.0443
+G1 X93.106 Y117.865 E.0435
+G1 X92.273 Y117.1 E.04231
+G1 X91.476 Y116.353 E.04087
+G1 X90.693 Y115.646 E.03946
+G1 X89.904 Y114.991 E.03839
+G1 X89.089 Y114.389 E.03792
+G1 X88.234 Y113.831 E.03819
+G1 X87.333 Y113.301 E.03912
+G1 X86.386 Y112.777 E.04048
+G1 X85.407 Y112.231 E.04193
+G1 X84.416 Y111.64 E.04321
+G1 X83.439 Y110.978 E.04413
+G1 X82.51 Y110.231 E.04461
+G1 X81.663 Y109.388 E.0447
+G1 X80.932 Y108.449 E.04454
+G1 X80.345 Y107.421 E.04431
+G1 X79.922 Y106.319 E.04416
+G1 X79.675 Y105.164 E.04419
+G1 X79.603 Y103.98 E.04438
+G1 X79.694 Y102.791 E.04461
+G1 X79.928 Y101.619 E.04471
+G1 X80.273 Y100.481 E.0445
+G1 X80.696 Y99.388 E.04387
+G1 X81.16 Y98.342 E.04282
+G1 X81.63 Y97.338 E.04146
+G1 X82.077 Y96.367 E.04
+G1 X82.478 Y95.412 E.03876
+G1 X82.822 Y94.456 E.03802
+G1 X83.109 Y93.482 E.038
+G1 X83.349 Y92.476 E.03869
+G1 X83.56 Y91.431 E.0399
+G1 X83.768 Y90.345 E.04136
+G1 X84.005 Y89.228 E.04274
+G1 X84.3 Y88.095 E.04381
+G1 X84.682 Y86.969 E.04447
+G1 X85.174 Y85.88 E.0447
+G1 X85.79 Y84.859 E.04463
+G1 X86.535 Y83.936 E.0444
+G1 X87.406 Y83.137 E.0442
+G1 X88.388 Y82.484 E.04416
+G1 X89.462 Y81.986 E.04429
+G1 X90.602 Y81.645 E.04453
+G1 X91.781 Y81.451 E.0447
+G1 X92.972 Y81.384 E.04463
+G1 X94.152 Y81.418 E.04418
+G1 X95.305 Y81.519 E.04329
+G1 X96.42 Y81.652 E.04203
+G1 X97.496 Y81.785 E.04058
+G1 X98.539 Y81.889 E.03921
+G1 X99.559 Y81.944 E.03824
+G1 X100.573 Y81.94 E.03792
+G1 X101.595 Y81.878 E.03833
+G1 X102.642 Y81.769 E.03937
+G1 X103.723 Y81.634 E.04077
+G1 X104.843 Y81.503 E.04221
+G1 X106 Y81.409 E.04343
+G1 X107.183 Y81.387 E.04426
+G1 X108.374 Y81.468 E.04466
+G1 X109.549 Y81.681 E.04468
+G1 X110.682 Y82.042 E.04449
+G1 X111.745 Y82.56 E.04427
+G1 X112.714 Y83.233 E.04415
+G1 X113.569 Y84.049 E.04422
+G1 X114.298 Y84.987 E.04443
+G1 X114.897 Y86.019 E.04465
+G1 X115.373 Y87.114 E.0447
+G1 X115.743 Y88.242 E.04441
+G1 X116.029 Y89.375 E.0437
+G1 X116.26 Y90.489 E.04257
+G1 X116.467 Y91.569 E.04117
+G1 X116.68 Y92.609 E.03973
+G1 X116.925 Y93.61 E.03856
+G1 X117.219 Y94.581 E.03796
+G1 X117.571 Y95.536 E.03808
+G1 X117.979 Y96.492 E.0389
+G1 X118.43 Y97.467 E.04019
+G1 X118.901 Y98.475 E.04165
+G1 X119.362 Y99.527 E.04298
+G1 X119.777 Y100.627 E.04398
+G1 X120.11 Y101.77 E.04455
+G1 X120.326 Y102.945 E.04471
+G1 X120.397 Y104.135 E.04459
+G1 X120.303 Y105.316 F10800
+G1 E-.8 F2100
+G1 X119.956 Y104.045
+G1 E.8 F2100
+;TYPE:Perimeter
+;WIDTH:0.45
+G1 F2100
+G1 X119.857 Y105.267 E.04586
+G1 X119.563 Y106.452 E.04567
+G1 X119.077 Y107.572 E.04569
+G1 X118.414 Y108.604 E.0459
+G1 X117.603 Y109.534 E.04618
+G1 X116.679 Y110.356 E.04628
+G1 X115.683 Y111.077 E.046
+G1 X114.655 Y111.711 E.04521
+G1 X113.629 Y112.283 E.04393
+G1 X112.635 Y112.822 E.04233
+G1 X111.688 Y113.36 E.04073
+G1 X110.795 Y113.924 E.03953
+G1 X109.949 Y114.536 E.03907
+G1 X109.136 Y115.208 E.03949
+G1 X108.332 Y115.939 E.04066
+G1 X107.513 Y116.717 E.04224
+G1 X106.655 Y117.515 E.04385
+G1 X105.738 Y118.299 E.04516
+G1 X104.749 Y119.028 E.04597
+G1 X103.685 Y119.659 E.04628
+G1 X102.553 Y120.151 E.04619
+G1 X101.368 Y120.472 E.04592
+G1 X100.154 Y120.598 E.04569
+G1 X98.936 Y120.522 E.04566
+G1 X97.741 Y120.249 E.04585
+G1 X96.594 Y119.797 E.04613
+G1 X95.512 Y119.198 E.04628
+G1 X94.504 Y118.489 E.04609
+G1 X93.57 Y117.715 E.04541
+G1 X92.698 Y116.917 E.04422
+G1 X91.872 Y116.131 E.04266
+G1 X91.067 Y115.387 E.04103
+G1 X90.258 Y114.699 E.03972
+G1 X89.422 Y114.073 E.03909
+G1 X88.542 Y113.498 E.03933
+G1 X87.609 Y112.956 E.04038
+G1 X86.625 Y112.42 E.04191
+G1 X85.605 Y111.859 E.04355
+G1 X84.574 Y111.244 E.04493
+G1 X83.566 Y110.547 E.04585
+G1 X82.62 Y109.751 E.04625
+G1 X81.777 Y108.848 E.04623
+G1 X81.074 Y107.841 E.04598
+G1 X80.541 Y106.741 E.04573
+G1 X80.198 Y105.57 E.04565
+G1 X80.051 Y104.355 E.0458
+G1 X80.091 Y103.124 E.04607
+G1 X80.297 Y101.905 E.04627
+G1 X80.637 Y100.719 E.04617
+G1 X81.071 Y99.58 E.04559
+G1 X81.555 Y98.494 E.0445
+G1 X82.05 Y97.457 E.04299
+G1 X82.518 Y96.456 E.04135
+G1 X82.934 Y95.473 E.03994
+G1 X83.285 Y94.488 E.03915
+G1 X83.571 Y93.48 E.03921
+G1 X83.806 Y92.433 E.04012
+G1 X84.013 Y91.342 E.04159
+G1 X84.226 Y90.206 E.04323
+G1 X84.481 Y89.039 E.04469
+G1 X84.813 Y87.863 E.04571
+G1 X85.252 Y86.709 E.04621
+G1 X85.823 Y85.613 E.04626
+G1 X86.535 Y84.61 E.04603
+G1 X87.389 Y83.734 E.04577
+G1 X88.373 Y83.013 E.04565
+G1 X89.465 Y82.462 E.04575
+G1 X90.636 Y82.085 E.04602
+G1 X91.853 Y81.874 E.04625
+G1 X93.087 Y81.806 E.04622
+G1 X94.309 Y81.849 E.04575
+G1 X95.499 Y81.965 E.04475
+G1 X96.647 Y82.113 E.04331
+G1 X97.752 Y82.254 E.04167
+G1 X98.821 Y82.357 E.04018
+G1 X99.869 Y82.399 E.03924
+G1 X100.914 Y82.374 E.03913
+G1 X101.976 Y82.284 E.03988
+G1 X103.071 Y82.15 E.04126
+G1 X104.208 Y82 E.04291
+G1 X105.388 Y81.873 E.04443
+G1 X106.603 Y81.807 E.04555
+G1 X107.836 Y81.844 E.04615
+G1 X109.061 Y82.017 E.04628
+G1 X110.247 Y82.351 E.04609
+G1 X111.361 Y82.858 E.04581
+G1 X112.375 Y83.537 E.04565
+G1 X113.263 Y84.376 E.04572
+G1 X114.012 Y85.35 E.04596
+G1 X114.617 Y86.426 E.04622
+G1 X115.088 Y87.569 E.04626
+G1 X115.444 Y88.743 E.04589
+G1 X115.715 Y89.914 E.04499
+G1 X115.935 Y91.059 E.04363
+G1 X116.14 Y92.163 E.042
+G1 X116.366 Y93.22 E.04045
+G1 X116.637 Y94.237 E.03937
+G1 X116.971 Y95.226 E.03908
+G1 X117.372 Y96.208 E.03967
+G1 X117.829 Y97.202 E.04095
+G1 X118.319 Y98.229 E.04258
+G1 X118.81 Y99.302 E.04415
+G1 X119.261 Y100.427 E.04536
+G1 X119.629 Y101.602 E.04607
+G1 X119.872 Y102.815 E.04628
+G1 X119.956 Y104.045 E.04614
+G1 X119.857 Y105.267 F10800
+G1 E-.8 F2100
+;TYPE:Internal infill
+;WIDTH:0.45
+G1 X83.173 Y92.786 F10800
+G1 F3600
+G1 X92.786 Y83.173 E.50867
+G1 X98.298 Y81.903 F10800
+G1 F3600
+G1 X81.903 Y98.298 E.86759
+G1 X82.058 Y102.386 F10800
+G1 F3600
+G1 X102.386 Y82.058 E1.07572
+G1 X105.785 Y82.902 F10800
+G1 F3600
+G1 X82.902 Y105.785 E1.2109
+G1 X84.223 Y108.706 F10800
+G1 F3600
+G1 X108.706 Y84.223 E1.29551
+G1 X111.237 Y85.935 F10800
+G1 F3600
+G1 X85.935 Y111.237 E1.33892
+G1 X87.998 Y113.416 F10800
+G1 F3600
+G1 X113.416 Y87.998 E1.34501
+G1 X115.247 Y90.41 F10800
+G1 F3600
+G1 X90.41 Y115.247 E1.31429
+G1 X93.194 Y116.705 F10800
+G1 F3600
+G1 X116.705 Y93.194 E1.2441
+G1 X117.723 Y96.419 F10800
+G1 F3600
+G1 X96.419 Y117.723 E1.12735
+G1 X100.239 Y118.146 F10800
+G1 F3600
+G1 X118.146 Y100.239 E.9476
+G1 X117.527 Y105.1 F10800
+G1 F3600
+G1 X105.1 Y117.527 E.65758
+;BEFORE_LAYER_CHANGE
+G92 E0.0
+;.9
+
+
+G1 E-.8 F2100
+;AFTER_LAYER_CHANGE
+;.9
+G1 Z.9 F10800
+M73 P30 R21
+G1 X120.536 Y106.353
+G1 E.8 F2100
+;TYPE:External perimeter
+;WIDTH:0.45
+G1 F2100
+G1 X120.153 Y107.411 E.0421
+G1 X119.624 Y108.406 E.0422
+G1 X118.964 Y109.327 E.04239
+G1 X118.194 Y110.163 E.04255
+G1 X117.34 Y110.915 E.04255
+G1 X116.432 Y111.587 E.04227
+G1 X115.496 Y112.189 E.04165
+G1 X114.557 Y112.739 E.0407
+G1 X113.636 Y113.255 E.03951
+G1 X112.747 Y113.76 E.03825
+G1 X111.897 Y114.274 E.03715
+G1 X111.087 Y114.814 E.03644
+G1 X110.31 Y115.394 E.03628
+G1 X109.553 Y116.019 E.03671
+G1 X108.803 Y116.688 E.03762
+G1 X108.04 Y117.391 E.03883
+G1 X107.249 Y118.114 E.04008
+G1 X106.415 Y118.831 E.04118
+G1 X105.527 Y119.517 E.04198
+G1 X104.58 Y120.142 E.04244
+G1 X103.576 Y120.676 E.04258
+G1 X102.519 Y121.093 E.04249
+G1 X101.424 Y121.37 E.0423
+G1 X100.304 Y121.494 E.04214
+G1 X99.18 Y121.457 E.0421
+G1 X98.069 Y121.261 E.0422
+G1 X96.99 Y120.918 E.04239
+G1 X95.956 Y120.444 E.04255
+G1 X94.978 Y119.865 E.04255
+G1 X94.058 Y119.208 E.04227
+G1 X93.196 Y118.504 E.04165
+G1 X92.383 Y117.781 E.0407
+G1 X91.607 Y117.065 E.03951
+G1 X90.852 Y116.375 E.03825
+G1 X90.101 Y115.726 E.03715
+G1 X89.337 Y115.122 E.03644
+G1 X88.545 Y114.562 E.03628
+G1 X87.717 Y114.036 E.03671
+G1 X86.849 Y113.529 E.03762
+G1 X85.944 Y113.021 E.03883
+G1 X85.013 Y112.492 E.04008
+G1 X84.073 Y111.92 E.04118
+G1 X83.146 Y111.288 E.04198
+G1 X82.259 Y110.58 E.04244
+G1 X81.441 Y109.79 E.04258
+G1 X80.718 Y108.914 E.04249
+G1 X80.115 Y107.958 E.0423
+G1 X79.652 Y106.932 E.04214
+G1 X79.34 Y105.851 E.0421
+G1 X79.183 Y104.734 E.0422
+G1 X79.176 Y103.601 E.04239
+G1 X79.307 Y102.472 E.04255
+G1 X79.556 Y101.362 E.04255
+G1 X79.896 Y100.285 E.04227
+G1 X80.299 Y99.247 E.04165
+G1 X80.735 Y98.251 E.0407
+G1 X81.177 Y97.291 E.03951
+G1 X81.599 Y96.36 E.03825
+G1 X81.985 Y95.445 E.03715
+G1 X82.323 Y94.532 E.03644
+G1 X82.611 Y93.606 E.03628
+G1 X82.856 Y92.656 E.03671
+G1 X83.07 Y91.673 E.03762
+G1 X83.273 Y90.656 E.03883
+G1 X83.489 Y89.607 E.04008
+G1 X83.742 Y88.536 E.04118
+G1 X84.057 Y87.459 E.04198
+G1 X84.455 Y86.397 E.04244
+G1 X84.954 Y85.374 E.04258
+G1 X85.564 Y84.416 E.04249
+G1 X86.287 Y83.548 E.0423
+G1 X87.12 Y82.79 E.04214
+G1 X88.051 Y82.159 E.0421
+G1 X89.065 Y81.664 E.0422
+G1 X90.14 Y81.308 E.04239
+G1 X91.255 Y81.084 E.04255
+G1 X92.387 Y80.977 E.04255
+G1 X93.517 Y80.968 E.04227
+G1 X94.628 Y81.031 E.04165
+G1 X95.711 Y81.138 E.0407
+G1 X96.759 Y81.261 E.03951
+G1 X97.775 Y81.375 E.03825
+G1 X98.765 Y81.459 E.03715
+G1 X99.738 Y81.498 E.03644
+G1 X100.708 Y81.486 E.03628
+G1 X101.687 Y81.425 E.03671
+G1 X102.687 Y81.325 E.03762
+G1 X103.718 Y81.204 E.03883
+G1 X104.782 Y81.085 E.04008
+G1 X105.879 Y80.995 E.04118
+G1 X107.001 Y80.962 E.04198
+G1 X108.134 Y81.013 E.04244
+G1 X109.26 Y81.171 E.04258
+G1 X110.36 Y81.455 E.04249
+G1 X111.409 Y81.874 E.0423
+G1 X112.388 Y82.432 E.04214
+G1 X113.276 Y83.123 E.0421
+G1 X114.059 Y83.934 E.0422
+G1 X114.73 Y84.847 E.04239
+G1 X115.288 Y85.837 E.04255
+G1 X115.739 Y86.881 E.04255
+G1 X116.097 Y87.953 E.04227
+G1 X116.381 Y89.029 E.04165
+G1 X116.614 Y90.092 E.0407
+G1 X116.82 Y91.127 E.03951
+G1 X117.026 Y92.129 E.03825
+G1 X117.252 Y93.096 E.03715
+G1 X117.515 Y94.033 E.03644
+G1 X117.826 Y94.952 E.03628
+G1 X118.187 Y95.864 E.03671
+G1 X118.591 Y96.785 E.03762
+G1 X119.025 Y97.728 E.03883
+G1 X119.467 Y98.703 E.04008
+G1 X119.892 Y99.718 E.04118
+G1 X120.27 Y100.775 E.04198
+G1 X120.572 Y101.868 E.04244
+G1 X120.769 Y102.989 E.04258
+G1 X120.839 Y104.122 E.04249
+G1 X120.764 Y105.25 E.0423
+G1 X120.536 Y106.353 E.04214
+G1 X120.153 Y107.411 F10800
+G1 E-.8 F2100
+G1 X120.106 Y106.22
+G1 E.8 F2100
+;TYPE:Perimeter
+;WIDTH:0.45
+G1 F2100
+G1 X119.699 Y107.327 E.04416
+G1 X119.125 Y108.362 E.04429
+G1 X118.405 Y109.31 E.04452
+G1 X117.568 Y110.161 E.0447
+G1 X116.645 Y110.917 E.04463
+G1 X115.671 Y111.585 E.04419
+G1 X114.679 Y112.182 E.04331
+G1 X113.698 Y112.73 E.04206
+G1 X112.748 Y113.256 E.0406
+G1 X111.843 Y113.784 E.03923
+G1 X110.984 Y114.338 E.03825
+G1 X110.166 Y114.936 E.03792
+G1 X109.375 Y115.587 E.03832
+G1 X108.593 Y116.29 E.03935
+G1 X107.797 Y117.033 E.04074
+G1 X106.969 Y117.798 E.04219
+G1 X106.089 Y118.554 E.04341
+G1 X105.146 Y119.269 E.04425
+G1 X104.136 Y119.904 E.04465
+G1 X103.062 Y120.425 E.04469
+G1 X101.934 Y120.802 E.0445
+G1 X100.769 Y121.011 E.04427
+G1 X99.59 Y121.039 E.04415
+G1 X98.418 Y120.884 E.04422
+G1 X97.277 Y120.557 E.04443
+G1 X96.185 Y120.077 E.04464
+G1 X95.154 Y119.472 E.0447
+G1 X94.191 Y118.778 E.04442
+G1 X93.293 Y118.031 E.04371
+G1 X92.451 Y117.265 E.04259
+G1 X91.647 Y116.513 E.04119
+G1 X90.863 Y115.796 E.03975
+G1 X90.077 Y115.129 E.03858
+G1 X89.269 Y114.515 E.03796
+G1 X88.424 Y113.949 E.03807
+G1 X87.533 Y113.415 E.03888
+G1 X86.596 Y112.892 E.04016
+G1 X85.622 Y112.353 E.04162
+G1 X84.631 Y111.773 E.04296
+G1 X83.648 Y111.129 E.04397
+G1 X82.706 Y110.402 E.04454
+G1 X81.839 Y109.58 E.04471
+G1 X81.08 Y108.661 E.04459
+G1 X80.459 Y107.651 E.04436
+G1 X80 Y106.564 E.04418
+G1 X79.714 Y105.418 E.04417
+G1 X79.604 Y104.239 E.04433
+G1 X79.661 Y103.049 E.04457
+G1 X79.866 Y101.872 E.04471
+G1 X80.19 Y100.725 E.04458
+G1 X80.6 Y99.622 E.04405
+G1 X81.058 Y98.565 E.04309
+G1 X81.529 Y97.553 E.04177
+G1 X81.983 Y96.576 E.04031
+G1 X82.395 Y95.619 E.03899
+G1 X82.753 Y94.665 E.03813
+G1 X83.052 Y93.696 E.03794
+G1 X83.3 Y92.698 E.03848
+G1 X83.515 Y91.661 E.03961
+G1 X83.722 Y90.584 E.04104
+G1 X83.95 Y89.473 E.04246
+G1 X84.229 Y88.341 E.04361
+G1 X84.591 Y87.212 E.04436
+G1 X85.057 Y86.113 E.04469
+G1 X85.645 Y85.074 E.04466
+G1 X86.362 Y84.127 E.04445
+G1 X87.206 Y83.299 E.04423
+G1 X88.166 Y82.613 E.04415
+G1 X89.222 Y82.081 E.04425
+G1 X90.35 Y81.706 E.04447
+G1 X91.523 Y81.481 E.04467
+G1 X92.713 Y81.389 E.04467
+G1 X93.897 Y81.404 E.04431
+G1 X95.057 Y81.493 E.04352
+G1 X96.181 Y81.622 E.04233
+G1 X97.265 Y81.757 E.0409
+G1 X98.315 Y81.87 E.03948
+G1 X99.339 Y81.937 E.0384
+G1 X100.352 Y81.946 E.03792
+G1 X101.371 Y81.896 E.03818
+G1 X102.412 Y81.795 E.0391
+G1 X103.485 Y81.664 E.04045
+G1 X104.596 Y81.53 E.04191
+G1 X105.746 Y81.425 E.04319
+G1 X106.924 Y81.384 E.04412
+G1 X108.115 Y81.44 E.04461
+G1 X109.296 Y81.622 E.0447
+G1 X110.44 Y81.95 E.04455
+G1 X111.521 Y82.434 E.04431
+G1 X112.513 Y83.074 E.04416
+G1 X113.394 Y83.861 E.04419
+G1 X114.15 Y84.774 E.04438
+G1 X114.777 Y85.788 E.04461
+G1 X115.279 Y86.872 E.04471
+G1 X115.67 Y87.996 E.04451
+G1 X115.972 Y89.129 E.04389
+G1 X116.212 Y90.249 E.04285
+G1 X116.422 Y91.337 E.04148
+G1 X116.632 Y92.386 E.04003
+G1 X116.868 Y93.395 E.03877
+G1 X117.15 Y94.372 E.03803
+G1 X117.49 Y95.329 E.03799
+G1 X117.886 Y96.283 E.03867
+G1 X118.329 Y97.252 E.03988
+G1 X118.798 Y98.252 E.04133
+G1 X119.264 Y99.295 E.04272
+G1 X119.692 Y100.384 E.0438
+G1 X120.046 Y101.518 E.04446
+G1 X120.291 Y102.688 E.0447
+G1 X120.395 Y103.876 E.04463
+G1 X120.338 Y105.061 E.0444
+G1 X120.106 Y106.22 E.0442
+G1 X119.699 Y107.327 F10800
+G1 E-.8 F2100
+G1 X119.676 Y106.087
+G1 E.8 F2100
+;TYPE:Perimeter
+;WIDTH:0.45
+G1 F2100
+G1 X119.249 Y107.23 E.04565
+G1 X118.639 Y108.291 E.04582
+G1 X117.871 Y109.255 E.0461
+G1 X116.978 Y110.11 E.04628
+G1 X116 Y110.861 E.04614
+G1 X114.978 Y111.52 E.04552
+G1 X113.948 Y112.109 E.04438
+G1 X112.941 Y112.655 E.04285
+G1 X111.979 Y113.19 E.04121
+G1 X111.069 Y113.743 E.03984
+G1 X110.21 Y114.338 E.03912
+G1 X109.388 Y114.991 E.03926
+G1 X108.584 Y115.705 E.04023
+G1 X107.773 Y116.47 E.04173
+G1 X106.929 Y117.265 E.04337
+G1 X106.032 Y118.057 E.0448
+G1 X105.066 Y118.808 E.04577
+G1 X104.026 Y119.474 E.04623
+G1 X102.914 Y120.014 E.04625
+G1 X101.743 Y120.391 E.04601
+G1 X100.536 Y120.58 E.04575
+G1 X99.316 Y120.568 E.04565
+G1 X98.111 Y120.355 E.04577
+G1 X96.947 Y119.956 E.04604
+G1 X95.843 Y119.399 E.04626
+G1 X94.812 Y118.72 E.0462
+G1 X93.855 Y117.962 E.04568
+G1 X92.965 Y117.167 E.04464
+G1 X92.127 Y116.374 E.04317
+G1 X91.318 Y115.614 E.04153
+G1 X90.513 Y114.908 E.04007
+G1 X89.688 Y114.263 E.0392
+G1 X88.823 Y113.673 E.03916
+G1 X87.906 Y113.124 E.03998
+G1 X86.938 Y112.589 E.0414
+G1 X85.927 Y112.04 E.04305
+G1 X84.896 Y111.444 E.04454
+G1 X83.877 Y110.775 E.04562
+G1 X82.907 Y110.012 E.04618
+G1 X82.028 Y109.142 E.04627
+G1 X81.277 Y108.167 E.04606
+G1 X80.688 Y107.094 E.04579
+G1 X80.285 Y105.942 E.04565
+G1 X80.076 Y104.738 E.04573
+G1 X80.059 Y103.509 E.04599
+G1 X80.216 Y102.284 E.04623
+G1 X80.518 Y101.085 E.04625
+G1 X80.927 Y99.931 E.04583
+G1 X81.401 Y98.829 E.04489
+G1 X81.896 Y97.777 E.04349
+G1 X82.376 Y96.767 E.04185
+G1 X82.81 Y95.78 E.04033
+G1 X83.182 Y94.798 E.03931
+G1 X83.488 Y93.799 E.0391
+G1 X83.737 Y92.766 E.03976
+G1 X83.95 Y91.688 E.04109
+G1 X84.157 Y90.566 E.04272
+G1 X84.394 Y89.406 E.04427
+G1 X84.698 Y88.231 E.04545
+G1 X85.101 Y87.066 E.04611
+G1 X85.629 Y85.947 E.04628
+G1 X86.297 Y84.911 E.04612
+G1 X87.107 Y83.993 E.04584
+G1 X88.052 Y83.221 E.04566
+G1 X89.113 Y82.616 E.0457
+G1 X90.263 Y82.185 E.04593
+G1 X91.469 Y81.923 E.0462
+G1 X92.701 Y81.813 E.04627
+G1 X93.929 Y81.825 E.04595
+G1 X95.131 Y81.923 E.04512
+G1 X96.293 Y82.065 E.0438
+G1 X97.41 Y82.212 E.04219
+G1 X98.489 Y82.33 E.04061
+G1 X99.542 Y82.393 E.03946
+G1 X100.586 Y82.389 E.03907
+G1 X101.641 Y82.318 E.03956
+G1 X102.724 Y82.195 E.04078
+G1 X103.847 Y82.047 E.04239
+G1 X105.014 Y81.908 E.04398
+G1 X106.22 Y81.819 E.04525
+G1 X107.45 Y81.82 E.04602
+G1 X108.68 Y81.947 E.04628
+G1 X109.882 Y82.228 E.04617
+G1 X111.022 Y82.68 E.04589
+G1 X112.07 Y83.306 E.04568
+G1 X112.999 Y84.098 E.04567
+G1 X113.793 Y85.032 E.04587
+G1 X114.443 Y86.08 E.04615
+G1 X114.954 Y87.207 E.04628
+G1 X115.343 Y88.374 E.04606
+G1 X115.637 Y89.55 E.04533
+G1 X115.869 Y90.705 E.0441
+G1 X116.075 Y91.822 E.04252
+G1 X116.291 Y92.894 E.0409
+G1 X116.546 Y93.922 E.03963
+G1 X116.859 Y94.918 E.03908
+G1 X117.24 Y95.9 E.0394
+G1 X117.681 Y96.888 E.0405
+G1 X118.164 Y97.903 E.04206
+G1 X118.659 Y98.961 E.04368
+G1 X119.127 Y100.069 E.04503
+G1 X119.525 Y101.23 E.04591
+G1 X119.812 Y102.433 E.04626
+G1 X119.949 Y103.66 E.04621
+G1 X119.909 Y104.887 E.04595
+G1 X119.676 Y106.087 E.04571
+G1 X119.249 Y107.23 F10800
+G1 E-.8 F2100
+;TYPE:Internal infill
+;WIDTH:0.45
+G1 X107.824 Y83.429 F10800
+G1 F3600
+G1 X116.571 Y92.176 E.46285
+G1 X117.972 Y97.112 F10800
+G1 F3600
+G1 X102.888 Y82.028 E.79822
+G1 X99.213 Y81.889 F10800
+G1 F3600
+G1 X118.111 Y100.787 E1.00004
+G1 X117.658 Y103.869 F10800
+G1 F3600
+G1 X96.131 Y82.342 E1.13916
+G1 X93.445 Y83.192 F10800
+G1 F3600
+G1 X116.808 Y106.555 E1.23629
+G1 X115.648 Y108.931 F10800
+G1 F3600
+G1 X91.069 Y84.352 E1.30062
+G1 X88.96 Y85.778 F10800
+G1 F3600
+G1 X114.222 Y111.04 E1.33676
+G1 X112.55 Y112.904 F10800
+G1 F3600
+G1 X87.096 Y87.45 E1.34691
+G1 X85.473 Y89.362 F10800
+G1 F3600
+G1 X110.638 Y114.527 E1.33165
+G1 X108.478 Y115.902 F10800
+G1 F3600
+G1 X84.098 Y91.522 E1.29012
+G1 X82.995 Y93.955 F10800
+G1 F3600
+G1 X106.045 Y117.005 E1.2197
+G1 X103.289 Y117.784 F10800
+G1 F3600
+G1 X82.216 Y96.711 E1.11511
+G1 X81.859 Y99.891 F10800
+G1 F3600
+G1 X100.109 Y118.141 E.96573
+G1 X96.269 Y117.835 F10800
+G1 F3600
+G1 X82.165 Y103.731 E.74635
+G1 X84.115 Y109.218 F10800
+G1 F3600
+G1 X90.782 Y115.885 E.35279
+M107
+;TYPE:Custom
+; Filament-specific end gcode
+G4 ; wait
+M221 S100
+M104 S0 ; turn off temperature
+M140 S0 ; turn off heatbed
+M107 ; turn off fan
+G1 Z30.5 ; Move print head up
+G1 X0 Y200 F3000 ; home X axis
+M84 ; disable motors
+M73 P100 R0
+; filament used [mm] = 2915.73
+; filament used [cm3] = 7.01
+; estimated printing time (normal mode) = 30m 12s
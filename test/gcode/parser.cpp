@@ -0,0 +1,197 @@
+/**
+ * Equivalence and fuzz test of the number parsing of GCodeParser.
+ *
+ * value_float(), value_long(), value_ulong() and value_fixed() are compared
+ * with the C library (strtof, strtol and strtoul with 32-bit longs like on
+ * AVR) and with an exact decimal rounding, on values printed like slicers
+ * do and on random strings of digits. value_float() may differ by one ULP
+ * from strtof (its mantissa is rounded to 31 bits, then scaled), or two
+ * with more than 10 decimals. The other results must be identical.
+ *
+ * The exit status is not 0 if a value differs.
+ */
+#include <ctype.h>
+#include <errno.h>
+#include <limits.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <random>
+#include <string>
+
+#include "../../Marlin/gcode.h"
+
+namespace
+{
+    const unsigned NB_VALUES = 1000000;
+
+    std::mt19937_64 rng{20171016};
+    unsigned nb_values = 0;
+    unsigned nb_failures = 0;
+    unsigned nb_float_ulp = 0;
+
+    int random(int min, int max) { return std::uniform_int_distribution<int>{min, max}(rng); }
+
+    //! Distance between two floats in ULPs.
+    int64_t ulps(float a, float b)
+    {
+        int32_t ia, ib;
+        memcpy(&ia, &a, sizeof(ia));
+        memcpy(&ib, &b, sizeof(ib));
+        if(ia < 0) ia = INT32_MIN - ia;
+        if(ib < 0) ib = INT32_MIN - ib;
+        return llabs(static_cast<int64_t>(ia) - ib);
+    }
+
+    //! strtol with a 32-bit long.
+    int32_t reference_long(const char* text)
+    {
+        long long value = strtoll(text, nullptr, 10);
+        return value > INT32_MAX ? INT32_MAX : value < INT32_MIN ? INT32_MIN : static_cast<int32_t>(value);
+    }
+
+    //! strtoul with a 32-bit long.
+    uint32_t reference_ulong(const char* text)
+    {
+        const char* digits = text + (*text == '-' || *text == '+');
+        unsigned long long magnitude = strtoull(digits, nullptr, 10);
+        if(magnitude > UINT32_MAX || (magnitude == ULLONG_MAX && errno == ERANGE))
+            return UINT32_MAX;
+        return static_cast<uint32_t>(*text == '-' ? -magnitude : magnitude);
+    }
+
+    //! Exact fixed-point value, rounded half away from zero. Return false if it does not fit in 32 bits.
+    bool reference_fixed(const char* text, uint8_t decimals, int32_t& result)
+    {
+        const bool negative = *text == '-';
+        text += (*text == '-' || *text == '+');
+
+        __int128 value = 0;
+        int nb_decimals = -1;
+        for(; isdigit(*text) || (*text == '.' && nb_decimals < 0); ++text)
+        {
+            if(*text == '.') { nb_decimals = 0; continue; }
+            if(nb_decimals >= decimals)
+            {
+                value += *text >= '5';
+                break;
+            }
+            value = value * 10 + (*text - '0');
+            if(value > INT64_MAX)
+                return false;
+            if(nb_decimals >= 0)
+                ++nb_decimals;
+        }
+        for(nb_decimals = nb_decimals < 0 ? 0 : nb_decimals; nb_decimals < decimals; ++nb_decimals)
+            value *= 10;
+
+        if(negative)
+            value = -value;
+        if(value > INT32_MAX || value < INT32_MIN)
+            return false;
+        result = static_cast<int32_t>(value);
+        return true;
+    }
+
+    void failure(const char* text, const char* what, double value, double expected)
+    {
+        if(++nb_failures <= 20)
+            printf("    FAILED: \"%s\" %s %.10g, expected %.10g\n", text, what, value, expected);
+    }
+
+    //! Parse "G1 X<value>" and compare the results with the references.
+    void check(const std::string& value)
+    {
+        char line[MAX_CMD_SIZE];
+        snprintf(line, sizeof(line), "G1 X%s", value.c_str());
+        parser.parse(line);
+        if(!parser.seen('X'))
+        {
+            failure(line, "not seen", 0, 0);
+            return;
+        }
+        ++nb_values;
+
+        const char* text = value.c_str();
+
+        // More than 10 decimals are scaled in two steps, so one more rounding
+        const char* point = strchr(text, '.');
+        const int64_t max_distance = point != nullptr && strlen(point + 1) > 10 ? 2 : 1;
+
+        float expected_float = strtof(text, nullptr);
+        float parsed_float = parser.value_float();
+        int64_t distance = ulps(parsed_float, expected_float);
+        if(distance > max_distance)
+            failure(text, "value_float", parsed_float, expected_float);
+        else if(distance == 1)
+            ++nb_float_ulp;
+
+        if(parser.value_long() != reference_long(text))
+            failure(text, "value_long", parser.value_long(), reference_long(text));
+        if(parser.value_ulong() != reference_ulong(text))
+            failure(text, "value_ulong", parser.value_ulong(), reference_ulong(text));
+
+        for(uint8_t decimals: {0, 3, 5})
+        {
+            int32_t expected;
+            if(reference_fixed(text, decimals, expected) && parser.value_fixed(decimals) != expected)
+                failure(text, decimals == 0 ? "value_fixed(0)" : decimals == 3 ? "value_fixed(3)" : "value_fixed(5)",
+                        parser.value_fixed(decimals), expected);
+        }
+    }
+
+    //! A value as printed by a slicer: fixed number of decimals, trailing zeros removed or not.
+    std::string slicer_value()
+    {
+        static const char* formats[] = {"%.3f", "%.5f", "%.4f", "%.2f", "%.0f"};
+        const double magnitude = pow(10, random(-3, 5));
+        const double value = std::uniform_real_distribution<double>{-magnitude, magnitude}(rng);
+
+        char text[32];
+        snprintf(text, sizeof(text), formats[random(0, 4)], value);
+        std::string result = text;
+        if(result.find('.') != std::string::npos && random(0, 1))
+        {
+            result.erase(result.find_last_not_of('0') + 1);
+            if(result.back() == '.')
+                result.pop_back();
+        }
+        return result;
+    }
+
+    //! Random digits with an optional sign and fractional part, up to 25 digits.
+    std::string random_value()
+    {
+        static const char* signs[] = {"", "", "-", "+"};
+        std::string result = signs[random(0, 3)];
+        for(int nb = random(0, 12); nb > 0; --nb)
+            result += static_cast<char>('0' + random(0, 9));
+        if(random(0, 2) > 0)
+        {
+            result += '.';
+            for(int nb = random(0, 13); nb > 0; --nb)
+                result += static_cast<char>('0' + random(0, 9));
+        }
+        if(result.find_first_of("0123456789") == std::string::npos)
+            result += '0';
+        return result;
+    }
+}
+
+int main()
+{
+    // Limits and rounding
+    for(const char* value: {"0", "-0", "+0", "1", "-1", "2147483647", "2147483648", "-2147483648", "-2147483649",
+                            "4294967295", "4294967296", "-4294967295", "-4294967296", "99999999999999999999",
+                            "0.0005", "-0.0005", "0.00049999999999", "1.99999", "21474.83647", "21474.836475",
+                            "-21474.83648", "123456789.123456789", "1234567.891", "0.000000000012345", ".5", "-.5",
+                            "5.", "00000000000000123.25"})
+        check(value);
+
+    for(unsigned index = 0; index < NB_VALUES; ++index)
+        check(index % 2 ? slicer_value() : random_value());
+
+    printf("%u values, %u floats at one ULP from strtof, %u failures\n", nb_values, nb_float_ulp, nb_failures);
+    return nb_failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,39 @@
+/**
+ * Host build of Marlin: serial ports of the Arduino core.
+ *
+ * The ports forward to the USARTs emulated by the host (see host.h).
+ */
+#ifndef HOST_HARDWARE_SERIAL_H
+#define HOST_HARDWARE_SERIAL_H
+
+#include "Print.h"
+
+#define SERIAL_TX_BUFFER_SIZE 64
+#define SERIAL_RX_BUFFER_SIZE 64
+
+class HardwareSerial: public Stream
+{
+public:
+    explicit HardwareSerial(uint8_t port): port_(port) {}
+
+    void begin(unsigned long baudrate);
+    void end();
+    int available() override;
+    int peek() override;
+    int read() override;
+    int availableForWrite();
+    void flush() override;
+    size_t write(uint8_t value) override;
+    using Print::write;
+    operator bool() { return true; }
+
+private:
+    uint8_t port_;
+};
+
+extern HardwareSerial Serial;
+extern HardwareSerial Serial1;
+extern HardwareSerial Serial2;
+extern HardwareSerial Serial3;
+
+#endif // HOST_HARDWARE_SERIAL_H
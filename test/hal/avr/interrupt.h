@@ -0,0 +1,21 @@
+/**
+ * Host build of Marlin: interrupts.
+ *
+ * The global interrupt flag is bit 7 of SREG, as on the AVR. Interrupt
+ * service routines are plain functions called by the host (see host.h).
+ */
+#ifndef HOST_AVR_INTERRUPT_H
+#define HOST_AVR_INTERRUPT_H
+
+#include <avr/io.h>
+
+#define sei() (SREG |= 0x80)
+#define cli() (SREG &= 0x7F)
+
+#define ISR(vector, ...) extern "C" void vector(void)
+#define SIGNAL(vector) ISR(vector)
+#define ISR_BLOCK
+#define ISR_NOBLOCK
+#define ISR_NAKED
+
+#endif // HOST_AVR_INTERRUPT_H
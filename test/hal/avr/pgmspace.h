@@ -0,0 +1,46 @@
+/**
+ * Host build of Marlin: program memory.
+ *
+ * There is only one address space on the host: PROGMEM data are ordinary
+ * constants and the _P functions are the standard ones.
+ */
+#ifndef HOST_AVR_PGMSPACE_H
+#define HOST_AVR_PGMSPACE_H
+
+#include <stdint.h>
+#include <string.h>
+#include <stdio.h>
+
+#define PROGMEM
+#define PGM_P const char*
+#define PSTR(s) (s)
+
+typedef char prog_char;
+typedef uint8_t prog_uchar;
+
+template<typename T> inline T pgm_read(const void* address) { T value; memcpy(&value, address, sizeof(value)); return value; }
+
+#define pgm_read_byte(address) pgm_read<uint8_t>(reinterpret_cast<const void*>(address))
+#define pgm_read_word(address) pgm_read<uint16_t>(reinterpret_cast<const void*>(address))
+#define pgm_read_dword(address) pgm_read<uint32_t>(reinterpret_cast<const void*>(address))
+#define pgm_read_float(address) pgm_read<float>(reinterpret_cast<const void*>(address))
+#define pgm_read_ptr(address) pgm_read<void*>(reinterpret_cast<const void*>(address))
+#define pgm_read_byte_near(address) pgm_read_byte(address)
+#define pgm_read_word_near(address) pgm_read_word(address)
+#define pgm_read_dword_near(address) pgm_read_dword(address)
+#define pgm_read_float_near(address) pgm_read_float(address)
+
+#define memcpy_P memcpy
+#define strcat_P strcat
+#define strchr_P strchr
+#define strcmp_P strcmp
+#define strcpy_P strcpy
+#define strlen_P strlen
+#define strncmp_P strncmp
+#define strncpy_P strncpy
+#define strstr_P strstr
+#define sprintf_P sprintf
+#define snprintf_P snprintf
+#define vsnprintf_P vsnprintf
+
+#endif // HOST_AVR_PGMSPACE_H
@@ -0,0 +1,16 @@
+/**
+ * Host build of Marlin: watchdog. It never resets the host.
+ */
+#ifndef HOST_AVR_WDT_H
+#define HOST_AVR_WDT_H
+
+#define WDTO_15MS 0
+#define WDTO_1S 6
+#define WDTO_4S 8
+#define WDTO_8S 9
+
+void wdt_enable(int timeout);
+void wdt_disable();
+void wdt_reset();
+
+#endif // HOST_AVR_WDT_H
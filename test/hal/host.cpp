@@ -0,0 +1,606 @@
+/**
+ * Host build of Marlin: emulated hardware and Arduino core (see host.h).
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "host.h"
+#include <Arduino.h>
+#include <avr/io.h>
+#include <avr/eeprom.h>
+#include <avr/wdt.h>
+#include <util/delay.h>
+
+namespace host {
+
+namespace {
+
+    //! Rough cost of the calls on a 16 MHz ATmega2560. It also makes the polling loops progress.
+    const Time MILLIS_COST = 2 * US;
+    const Time MICROS_COST = 4 * US;
+    const Time SERIAL_COST = 2 * US;
+    const Time WATCHDOG_COST = 125; // 2 cycles
+
+    const size_t MAX_PERIPHERALS = 16;
+
+    Time now_ = 0;
+    Peripheral* peripherals_[MAX_PERIPHERALS];
+    size_t nb_peripherals_ = 0;
+    bool in_event_ = false;
+
+    Uart uarts_[4];
+    bool uarts_attached_ = false;
+
+    SpiDevice* spi_device_ = nullptr;
+
+    uint8_t eeprom_[EEPROM_SIZE];
+    bool eeprom_erased_ = false;
+
+    void attach_uarts()
+    {
+        if(uarts_attached_)
+            return;
+        uarts_attached_ = true;
+        for(auto& uart: uarts_)
+            attach(uart);
+    }
+
+}
+
+//! Add a peripheral. Its events are processed when the time advances.
+void attach(Peripheral& peripheral)
+{
+    if(nb_peripherals_ >= MAX_PERIPHERALS)
+    {
+        fprintf(stderr, "host: too many peripherals\n");
+        abort();
+    }
+    peripherals_[nb_peripherals_++] = &peripheral;
+}
+
+//! Current virtual time.
+Time now()
+{
+    return now_;
+}
+
+//! Let the time pass. The events of the peripherals are processed in order, each at its own time.
+//! Peripherals (and the interrupt service routines they call) do not make the time pass.
+void advance(Time duration)
+{
+    attach_uarts();
+    if(in_event_)
+        return;
+
+    const Time end = now_ + duration;
+    in_event_ = true;
+    for(;;)
+    {
+        Peripheral* next = nullptr;
+        Time next_time = NEVER;
+        for(size_t index = 0; index < nb_peripherals_; ++index)
+        {
+            Time time = peripherals_[index]->next_event();
+            if(time < next_time)
+            {
+                next_time = time;
+                next = peripherals_[index];
+            }
+        }
+        if(next == nullptr || next_time > end)
+            break;
+        if(next_time > now_)
+            now_ = next_time;
+        next->run();
+    }
+    now_ = end;
+    in_event_ = false;
+}
+
+//! Time spent by the firmware itself (cost of a call).
+void charge(Time duration)
+{
+    advance(duration);
+}
+
+// --------------------------------------------------------------------
+// Uart
+// --------------------------------------------------------------------
+
+//! Connect a device to this port.
+//! @param device       The device, or nullptr to disconnect
+//! @param baudrate     Baudrate of the device
+void Uart::connect(SerialDevice* device, uint32_t baudrate)
+{
+    device_ = device;
+    device_baudrate_ = baudrate;
+}
+
+//! Send bytes from the device to the firmware. They are sent one after the other after the bytes already on the line.
+//! @param data         Bytes to send
+//! @param size         Number of bytes
+//! @param start        Time of the start of the transmission (not before now)
+void Uart::send(const uint8_t* data, size_t size, Time start)
+{
+    attach_uarts();
+    Time time = start > now_ ? start : now_;
+    if(wire_free_time_ > time)
+        time = wire_free_time_;
+
+    for(size_t index = 0; index < size; ++index)
+    {
+        size_t next = (wire_head_ + 1) % WIRE_SIZE;
+        if(next == wire_tail_)
+        {
+            fprintf(stderr, "host: too many bytes sent to the firmware\n");
+            abort();
+        }
+        time += byte_time(device_baudrate_);
+        wire_[wire_head_] = WireByte{data[index], time};
+        wire_head_ = next;
+    }
+    wire_free_time_ = time;
+}
+
+void Uart::reset_statistics()
+{
+    statistics_ = Statistics{};
+}
+
+void Uart::begin(uint32_t baudrate)
+{
+    attach_uarts();
+    flush();
+    baudrate_ = baudrate;
+    rx_head_ = rx_tail_ = 0;
+}
+
+void Uart::end()
+{
+    flush();
+    baudrate_ = 0;
+}
+
+int Uart::available()
+{
+    charge(SERIAL_COST);
+    return static_cast<uint8_t>(BUFFER_SIZE + rx_head_ - rx_tail_) % BUFFER_SIZE;
+}
+
+int Uart::peek()
+{
+    charge(SERIAL_COST);
+    return rx_head_ == rx_tail_ ? -1 : rx_buffer_[rx_tail_];
+}
+
+int Uart::read()
+{
+    charge(SERIAL_COST);
+    if(rx_head_ == rx_tail_)
+        return -1;
+
+    uint8_t byte = rx_buffer_[rx_tail_];
+    rx_tail_ = (rx_tail_ + 1) % BUFFER_SIZE;
+    if(device_ != nullptr)
+        device_->consumed(++nb_read_, now_);
+    return byte;
+}
+
+int Uart::available_for_write()
+{
+    charge(SERIAL_COST);
+    return BUFFER_SIZE - 1 - static_cast<uint8_t>(BUFFER_SIZE + tx_head_ - tx_tail_) % BUFFER_SIZE;
+}
+
+//! Write a byte. If the transmit buffer is full, wait (as the Arduino core) for some room.
+size_t Uart::write(uint8_t byte)
+{
+    charge(SERIAL_COST);
+
+    if(!shifting_)
+    {
+        shifting_ = true;
+        shifted_byte_ = byte;
+        shifted_time_ = now_ + (baudrate_ > 0 ? byte_time(baudrate_) : 0);
+        return 1;
+    }
+
+    uint8_t next = (tx_head_ + 1) % BUFFER_SIZE;
+    if(next == tx_tail_)
+    {
+        // The time does not pass inside an interrupt service routine: the byte is lost
+        if(in_event_)
+            return 0;
+        Time start = now_;
+        advance(shifted_time_ - now_);
+        statistics_.write_blocking += now_ - start;
+    }
+
+    tx_buffer_[tx_head_] = byte;
+    tx_head_ = next;
+    return 1;
+}
+
+//! Wait until all the bytes are transmitted.
+void Uart::flush()
+{
+    if(!shifting_ || in_event_)
+        return;
+
+    Time start = now_;
+    while(shifting_)
+        advance(shifted_time_ - now_);
+    statistics_.flush_blocking += now_ - start;
+}
+
+Time Uart::next_event() const
+{
+    Time tx = shifting_ ? shifted_time_ : NEVER;
+    Time rx = wire_head_ != wire_tail_ ? wire_[wire_tail_].time : NEVER;
+    return tx < rx ? tx : rx;
+}
+
+void Uart::run()
+{
+    Time tx = shifting_ ? shifted_time_ : NEVER;
+    Time rx = wire_head_ != wire_tail_ ? wire_[wire_tail_].time : NEVER;
+
+    if(tx <= rx)
+    {
+        // End of the transmission of a byte to the device, start the next one
+        uint8_t byte = shifted_byte_;
+        if(tx_head_ != tx_tail_)
+        {
+            shifted_byte_ = tx_buffer_[tx_tail_];
+            tx_tail_ = (tx_tail_ + 1) % BUFFER_SIZE;
+            shifted_time_ += byte_time(baudrate_);
+        }
+        else
+            shifting_ = false;
+
+        if(device_ == nullptr)
+            return;
+        if(baudrate_ != device_baudrate_)
+        {
+            ++statistics_.framing_errors;
+            return;
+        }
+        ++statistics_.bytes_to_device;
+        device_->received(byte, tx);
+        return;
+    }
+
+    // Reception of a byte from the device
+    uint8_t byte = wire_[wire_tail_].byte;
+    wire_tail_ = (wire_tail_ + 1) % WIRE_SIZE;
+    ++statistics_.bytes_from_device;
+    if(baudrate_ != device_baudrate_)
+    {
+        ++statistics_.framing_errors;
+        return;
+    }
+
+    uint8_t next = (rx_head_ + 1) % BUFFER_SIZE;
+    if(next == rx_tail_)
+    {
+        ++statistics_.overruns;
+        return;
+    }
+    rx_buffer_[rx_head_] = byte;
+    rx_head_ = next;
+}
+
+//! Serial port of the microcontroller.
+//! @param port     Index of the port (0 to 3)
+Uart& uart(uint8_t port)
+{
+    attach_uarts();
+    return uarts_[port];
+}
+
+// --------------------------------------------------------------------
+// SPI bus
+// --------------------------------------------------------------------
+
+//! Connect a device to the SPI bus (nullptr to disconnect it).
+void connect_spi(SpiDevice* device)
+{
+    spi_device_ = device;
+}
+
+//! Transfer a byte (write of SPDR), at the clock rate set by SPCR and SPSR. Without a device, MISO is pulled up.
+uint8_t spi_transfer(uint8_t byte)
+{
+    static const Time DIVIDERS[] = {4, 16, 64, 128};
+    const Time divider = DIVIDERS[SPCR & (_BV(SPR1) | _BV(SPR0))] / ((SPSR & _BV(SPI2X)) ? 2 : 1);
+    charge(8 * divider * SECOND / F_CPU);
+    return spi_device_ != nullptr ? spi_device_->transfer(byte) : 0xFF;
+}
+
+// --------------------------------------------------------------------
+// EEPROM
+// --------------------------------------------------------------------
+
+//! Content of the EEPROM. It is erased (0xFF) at the start.
+uint8_t* eeprom()
+{
+    if(!eeprom_erased_)
+    {
+        memset(eeprom_, 0xFF, sizeof(eeprom_));
+        eeprom_erased_ = true;
+    }
+    return eeprom_;
+}
+
+}
+
+// --------------------------------------------------------------------
+// Arduino core
+// --------------------------------------------------------------------
+
+using host::Time;
+using host::US;
+using host::MS;
+
+namespace {
+
+    const uint8_t NB_PINS = NUM_DIGITAL_PINS;
+    uint8_t pin_modes[NB_PINS];
+    uint8_t pin_values[NB_PINS];
+
+    size_t eeprom_offset(const void* address)
+    {
+        size_t offset = reinterpret_cast<size_t>(address);
+        if(offset >= host::EEPROM_SIZE)
+        {
+            fprintf(stderr, "host: EEPROM address %zu out of range\n", offset);
+            abort();
+        }
+        return offset;
+    }
+
+}
+
+unsigned long millis()
+{
+    host::charge(host::MILLIS_COST);
+    return static_cast<uint32_t>(host::now() / MS);
+}
+
+unsigned long micros()
+{
+    host::charge(host::MICROS_COST);
+    return static_cast<uint32_t>(host::now() / US);
+}
+
+void delay(unsigned long ms)
+{
+    host::advance(ms * MS);
+}
+
+void delayMicroseconds(unsigned int us)
+{
+    host::advance(us * US);
+}
+
+void _delay_ms(double ms)
+{
+    host::advance(static_cast<Time>(ms * MS));
+}
+
+void _delay_us(double us)
+{
+    host::advance(static_cast<Time>(us * US));
+}
+
+void pinMode(uint8_t pin, uint8_t mode)
+{
+    if(pin < NB_PINS)
+        pin_modes[pin] = mode;
+}
+
+void digitalWrite(uint8_t pin, uint8_t value)
+{
+    if(pin < NB_PINS)
+        pin_values[pin] = value ? HIGH : LOW;
+}
+
+int digitalRead(uint8_t pin)
+{
+    return pin < NB_PINS ? pin_values[pin] : LOW;
+}
+
+int analogRead(uint8_t)
+{
+    return 0;
+}
+
+void analogWrite(uint8_t pin, int value)
+{
+    digitalWrite(pin, value >= 128 ? HIGH : LOW);
+}
+
+void attachInterrupt(uint8_t, void (*)(), int) {}
+void detachInterrupt(uint8_t) {}
+void tone(uint8_t, unsigned int, unsigned long) {}
+void noTone(uint8_t) {}
+
+long random(long howbig)
+{
+    return howbig > 0 ? ::random() % howbig : 0;
+}
+
+long random(long howsmall, long howbig)
+{
+    return howsmall >= howbig ? howsmall : howsmall + random(howbig - howsmall);
+}
+
+void randomSeed(unsigned long seed)
+{
+    srandom(seed);
+}
+
+void wdt_enable(int) {}
+void wdt_disable() {}
+void wdt_reset() { host::charge(host::WATCHDOG_COST); }
+
+uint8_t eeprom_read_byte(const uint8_t* address)
+{
+    return host::eeprom()[eeprom_offset(address)];
+}
+
+uint16_t eeprom_read_word(const uint16_t* address)
+{
+    uint16_t value;
+    eeprom_read_block(&value, address, sizeof(value));
+    return value;
+}
+
+void eeprom_read_block(void* destination, const void* source, size_t size)
+{
+    eeprom_offset(static_cast<const uint8_t*>(source) + size - 1);
+    memcpy(destination, host::eeprom() + eeprom_offset(source), size);
+}
+
+void eeprom_write_byte(uint8_t* address, uint8_t value)
+{
+    host::eeprom()[eeprom_offset(address)] = value;
+}
+
+void eeprom_update_byte(uint8_t* address, uint8_t value)
+{
+    eeprom_write_byte(address, value);
+}
+
+void eeprom_write_block(const void* source, void* destination, size_t size)
+{
+    eeprom_offset(static_cast<uint8_t*>(destination) + size - 1);
+    memcpy(host::eeprom() + eeprom_offset(destination), source, size);
+}
+
+void eeprom_update_block(const void* source, void* destination, size_t size)
+{
+    eeprom_write_block(source, destination, size);
+}
+
+// --------------------------------------------------------------------
+// Serial ports
+// --------------------------------------------------------------------
+
+HardwareSerial Serial(0);
+HardwareSerial Serial1(1);
+HardwareSerial Serial2(2);
+HardwareSerial Serial3(3);
+
+void HardwareSerial::begin(unsigned long baudrate) { host::uart(port_).begin(baudrate); }
+void HardwareSerial::end() { host::uart(port_).end(); }
+int HardwareSerial::available() { return host::uart(port_).available(); }
+int HardwareSerial::peek() { return host::uart(port_).peek(); }
+int HardwareSerial::read() { return host::uart(port_).read(); }
+int HardwareSerial::availableForWrite() { return host::uart(port_).available_for_write(); }
+void HardwareSerial::flush() { host::uart(port_).flush(); }
+size_t HardwareSerial::write(uint8_t value) { return host::uart(port_).write(value); }
+
+// --------------------------------------------------------------------
+// Print (same output as the Arduino core)
+// --------------------------------------------------------------------
+
+size_t Print::write(const uint8_t* buffer, size_t size)
+{
+    size_t n = 0;
+    while(size--)
+        n += write(*buffer++);
+    return n;
+}
+
+size_t Print::print(const __FlashStringHelper* str) { return print(reinterpret_cast<const char*>(str)); }
+size_t Print::print(const char str[]) { return write(str); }
+size_t Print::print(char c) { return write(static_cast<uint8_t>(c)); }
+size_t Print::print(unsigned char value, int base) { return print(static_cast<unsigned long>(value), base); }
+size_t Print::print(int value, int base) { return print(static_cast<long>(value), base); }
+size_t Print::print(unsigned int value, int base) { return print(static_cast<unsigned long>(value), base); }
+
+size_t Print::print(long value, int base)
+{
+    if(base == 0)
+        return write(static_cast<uint8_t>(value));
+    if(base == 10 && value < 0)
+        return print('-') + printNumber(static_cast<unsigned long>(-value), 10);
+    return printNumber(static_cast<unsigned long>(value), base);
+}
+
+size_t Print::print(unsigned long value, int base)
+{
+    if(base == 0)
+        return write(static_cast<uint8_t>(value));
+    return printNumber(value, base);
+}
+
+size_t Print::print(double value, int digits) { return printFloat(value, digits); }
+
+size_t Print::println(const __FlashStringHelper* str) { return print(str) + println(); }
+size_t Print::println(const char str[]) { return print(str) + println(); }
+size_t Print::println(char c) { return print(c) + println(); }
+size_t Print::println(unsigned char value, int base) { return print(value, base) + println(); }
+size_t Print::println(int value, int base) { return print(value, base) + println(); }
+size_t Print::println(unsigned int value, int base) { return print(value, base) + println(); }
+size_t Print::println(long value, int base) { return print(value, base) + println(); }
+size_t Print::println(unsigned long value, int base) { return print(value, base) + println(); }
+size_t Print::println(double value, int digits) { return print(value, digits) + println(); }
+size_t Print::println() { return write("\r\n"); }
+
+size_t Print::printNumber(unsigned long value, uint8_t base)
+{
+    char buffer[8 * sizeof(long) + 1];
+    char* str = &buffer[sizeof(buffer) - 1];
+    *str = '\0';
+
+    if(base < 2)
+        base = 10;
+    do
+    {
+        char c = value % base;
+        value /= base;
+        *--str = c < 10 ? c + '0' : c + 'A' - 10;
+    }
+    while(value);
+
+    return write(str);
+}
+
+size_t Print::printFloat(double value, uint8_t digits)
+{
+    if(isnan(value)) return print("nan");
+    if(isinf(value)) return print("inf");
+    if(value > 4294967040.0) return print("ovf");
+    if(value < -4294967040.0) return print("ovf");
+
+    size_t n = 0;
+    if(value < 0.0)
+    {
+        n += print('-');
+        value = -value;
+    }
+
+    double rounding = 0.5;
+    for(uint8_t i = 0; i < digits; ++i)
+        rounding /= 10.0;
+    value += rounding;
+
+    unsigned long int_part = static_cast<uint32_t>(value);
+    double remainder = value - static_cast<double>(int_part);
+    n += print(int_part);
+
+    if(digits > 0)
+        n += print('.');
+    while(digits-- > 0)
+    {
+        remainder *= 10.0;
+        unsigned int digit = static_cast<unsigned int>(remainder);
+        n += print(digit);
+        remainder -= digit;
+    }
+    return n;
+}
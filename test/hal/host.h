@@ -0,0 +1,148 @@
+/**
+ * Host build of Marlin: emulated hardware.
+ *
+ * The firmware runs on a virtual clock (in nanoseconds). Time passes when
+ * the firmware waits (delay, full transmit buffer, flush...), when it calls
+ * the Arduino API (each call has a cost, see host.cpp) and when a test lets
+ * it pass with advance(). The peripherals (serial ports...) are updated at
+ * the exact time of each of their events, so the results do not depend on
+ * the speed of the host.
+ */
+#ifndef HOST_HOST_H
+#define HOST_HOST_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+namespace host {
+
+typedef uint64_t Time; //!< Virtual time in nanoseconds
+
+const Time US = 1000;
+const Time MS = 1000 * US;
+const Time SECOND = 1000 * MS;
+const Time NEVER = ~Time(0);
+
+//! Part of the emulated hardware with events in time (end of the transmission of a byte...).
+class Peripheral
+{
+public:
+    virtual ~Peripheral() {}
+    virtual Time next_event() const = 0;  //!< Time of the next event, NEVER if there is none
+    virtual void run() = 0;               //!< Process the events due now
+};
+
+void attach(Peripheral& peripheral);
+
+Time now();
+void advance(Time duration);
+void charge(Time duration);
+
+// --------------------------------------------------------------------
+// Serial ports
+// --------------------------------------------------------------------
+
+//! A device connected to a serial port (the host computer, the LCD panel...).
+class SerialDevice
+{
+public:
+    virtual ~SerialDevice() {}
+    //! A byte sent by the firmware was received (at the end of its stop bit).
+    virtual void received(uint8_t byte, Time time) = 0;
+    //! The firmware read a byte sent by the device. count is the number of bytes read since the connection.
+    virtual void consumed(uint32_t count, Time time) {}
+};
+
+//! A USART of the microcontroller with the buffers of the Arduino HardwareSerial class.
+//! Bytes are transmitted at the baudrate (10 bits per byte) in both directions. If the baudrates of the
+//! firmware and of the device do not match, the bytes are lost (framing errors).
+class Uart: public Peripheral
+{
+public:
+    static const uint8_t BUFFER_SIZE = 64; //!< Size of the buffers, one byte is never used (ring)
+
+    struct Statistics
+    {
+        uint32_t bytes_to_device;       //!< Bytes sent by the firmware
+        uint32_t bytes_from_device;     //!< Bytes sent by the device
+        uint32_t overruns;              //!< Bytes lost because the receive buffer was full
+        uint32_t framing_errors;        //!< Bytes lost because of a baudrate mismatch
+        Time write_blocking;            //!< Total time the firmware waited for room in the transmit buffer
+        Time flush_blocking;            //!< Total time the firmware waited in flush()
+    };
+
+    // Device side
+    void connect(SerialDevice* device, uint32_t baudrate);
+    void send(const uint8_t* data, size_t size, Time start = 0);
+    const Statistics& statistics() const { return statistics_; }
+    void reset_statistics();
+
+    // Firmware side
+    void begin(uint32_t baudrate);
+    void end();
+    int available();
+    int peek();
+    int read();
+    int available_for_write();
+    size_t write(uint8_t byte);
+    void flush();
+
+    Time next_event() const override;
+    void run() override;
+
+private:
+    Time byte_time(uint32_t baudrate) const { return baudrate > 0 ? 10 * SECOND / baudrate : 0; }
+
+private:
+    SerialDevice* device_ = nullptr;
+    uint32_t device_baudrate_ = 0;
+    uint32_t baudrate_ = 0;
+
+    // Firmware to device
+    uint8_t tx_buffer_[BUFFER_SIZE] = {};
+    uint8_t tx_head_ = 0, tx_tail_ = 0;
+    bool shifting_ = false;             //!< A byte is on the line
+    uint8_t shifted_byte_ = 0;
+    Time shifted_time_ = 0;             //!< End of the transmission of shifted_byte_
+
+    // Device to firmware
+    struct WireByte { uint8_t byte; Time time; };
+    static const size_t WIRE_SIZE = 4096;
+    WireByte wire_[WIRE_SIZE] = {};     //!< Bytes on the line, with the time they arrive
+    size_t wire_head_ = 0, wire_tail_ = 0;
+    Time wire_free_time_ = 0;           //!< End of the transmission of the last byte on the line
+    uint8_t rx_buffer_[BUFFER_SIZE] = {};
+    uint8_t rx_head_ = 0, rx_tail_ = 0;
+    uint32_t nb_read_ = 0;
+
+    Statistics statistics_ = {};
+};
+
+Uart& uart(uint8_t port);
+
+// --------------------------------------------------------------------
+// SPI bus
+// --------------------------------------------------------------------
+
+//! A device on the SPI bus of the microcontroller (the SD card).
+class SpiDevice
+{
+public:
+    virtual ~SpiDevice() {}
+    //! Exchange a byte: the byte sent by the firmware (MOSI) for the byte of the device (MISO).
+    virtual uint8_t transfer(uint8_t byte) = 0;
+};
+
+void connect_spi(SpiDevice* device);
+uint8_t spi_transfer(uint8_t byte);
+
+// --------------------------------------------------------------------
+// EEPROM
+// --------------------------------------------------------------------
+
+const size_t EEPROM_SIZE = 4096;
+uint8_t* eeprom();
+
+}
+
+#endif // HOST_HOST_H
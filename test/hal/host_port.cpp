@@ -0,0 +1,62 @@
+/**
+ * Host build of Marlin: the host computer on the serial port of the firmware (see host_port.h).
+ */
+#include "host_port.h"
+
+namespace host {
+
+HostPort::HostPort(uint8_t port, uint32_t baudrate)
+: port_{port}
+{
+    uart(port).connect(this, baudrate);
+}
+
+//! Send bytes to the firmware. They are put on the wire as the firmware reads the previous ones.
+void HostPort::send(const uint8_t* data, size_t size)
+{
+    queue_.insert(queue_.end(), data, data + size);
+    fill_wire();
+}
+
+void HostPort::send(const std::string& data)
+{
+    send(reinterpret_cast<const uint8_t*>(data.data()), data.size());
+}
+
+void HostPort::received(uint8_t byte, Time time)
+{
+    if(byte == '\n')
+    {
+        lines_.push_back(line_);
+        line_.clear();
+    }
+    else if(byte != '\r')
+        line_ += static_cast<char>(byte);
+}
+
+void HostPort::consumed(uint32_t count, Time time)
+{
+    nb_consumed_ = count;
+    fill_wire();
+}
+
+void HostPort::fill_wire()
+{
+    size_t size = queue_.size() - queue_sent_;
+    const size_t room = WIRE_MAX - (nb_sent_ - nb_consumed_);
+    if(size > room)
+        size = room;
+    if(size == 0)
+        return;
+
+    uart(port_).send(queue_.data() + queue_sent_, size);
+    queue_sent_ += size;
+    nb_sent_ += size;
+    if(queue_sent_ == queue_.size())
+    {
+        queue_.clear();
+        queue_sent_ = 0;
+    }
+}
+
+}
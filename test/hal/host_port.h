@@ -0,0 +1,51 @@
+/**
+ * Host build of Marlin: the host computer on the serial port of the firmware.
+ *
+ * Bytes are sent like a host would do (pronterface, OctoPrint...) and the
+ * lines of the firmware are collected. Only a few lines are in flight at a
+ * time: the bytes are put on the wire when the firmware consumes the
+ * previous ones, so the wire of the emulated UART never overflows.
+ */
+#ifndef HOST_HOST_PORT_H
+#define HOST_HOST_PORT_H
+
+#include <string>
+#include <vector>
+
+#include "host.h"
+
+namespace host {
+
+class HostPort: public SerialDevice
+{
+public:
+    HostPort(uint8_t port, uint32_t baudrate);
+
+    void send(const std::string& data);
+    void send(const uint8_t* data, size_t size);
+    size_t pending() const { return queue_.size() - queue_sent_; } //!< Bytes not yet on the wire
+
+    const std::vector<std::string>& lines() const { return lines_; }
+    void clear_lines() { lines_.clear(); }
+
+    void received(uint8_t byte, Time time) override;
+    void consumed(uint32_t count, Time time) override;
+
+private:
+    void fill_wire();
+
+private:
+    static const size_t WIRE_MAX = 512; //!< Maximum number of bytes on the wire, not yet read by the firmware
+
+    uint8_t port_;
+    std::vector<uint8_t> queue_;        //!< Bytes to send
+    size_t queue_sent_ = 0;             //!< Bytes of queue_ put on the wire
+    uint32_t nb_sent_ = 0;              //!< Bytes put on the wire since the connection
+    uint32_t nb_consumed_ = 0;          //!< Bytes read by the firmware since the connection
+    std::string line_;
+    std::vector<std::string> lines_;
+};
+
+}
+
+#endif // HOST_HOST_PORT_H
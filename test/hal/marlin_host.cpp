@@ -0,0 +1,16 @@
+/**
+ * Host build of Marlin: functions of the firmware that are only needed on
+ * the host, where int is 32-bit and no longer the same type as uint16_t.
+ */
+#include "../../Marlin/serial.h"
+
+void serial_echopair_P(const char* s_P, unsigned int v) { serial_echopair_P(s_P, (unsigned long)v); }
+
+// Symbols of avr-libc and of the linker script used by M100_Free_Mem_Chk.cpp
+char* __brkval = nullptr;
+char __bss_end;
+
+// Linked with --wrap by the builds of the whole firmware: the distance between the stack and the heap is
+// meaningless on the host and changes at each run (address randomization), so is the length of the
+// messages with the free memory. Report a fixed amount, as an ATmega2560 would.
+extern "C" int __wrap__ZN9SdFatUtil7FreeRamEv() { return 2048; }
@@ -0,0 +1,9 @@
+/**
+ * Host build of Marlin: pins of the Arduino Mega (see Arduino.h).
+ */
+#ifndef HOST_PINS_ARDUINO_H
+#define HOST_PINS_ARDUINO_H
+
+#include <Arduino.h>
+
+#endif // HOST_PINS_ARDUINO_H
@@ -0,0 +1,21 @@
+/**
+ * Host build of Marlin: AVR registers of the ATmega2560 (see avr/io.h).
+ */
+#include <avr/io.h>
+
+volatile uint8_t DDRA, DDRB, DDRC, DDRD, DDRE, DDRF, DDRG, DDRH, DDRJ, DDRK, DDRL, PINA, PINB, PINC,
+                 PIND, PINE, PINF, PING, PINH, PINJ, PINK, PINL, PORTA, PORTB, PORTC, PORTD, PORTE,
+                 PORTF, PORTG, PORTH, PORTJ, PORTK, PORTL, ADCSRA, ADCSRB, ADMUX, DIDR0, DIDR1,
+                 DIDR2, MCUSR, OCR0A, OCR0B, OCR2A, OCR2B, PCICR, PCIFR, PCMSK0, PCMSK1, PCMSK2,
+                 SPCR, SREG, TCCR0A, TCCR0B, TCCR1A, TCCR1B, TCCR1C, TCCR2A, TCCR2B,
+                 TCCR3A, TCCR3B, TCCR3C, TCCR4A, TCCR4B, TCCR4C, TCCR5A, TCCR5B, TCCR5C, TCNT0,
+                 TCNT2, TIFR0, TIFR1, TIFR2, TIFR3, TIFR4, TIFR5, TIMSK0, TIMSK1, TIMSK2, TIMSK3,
+                 TIMSK4, TIMSK5, TWBR, TWCR, TWDR, TWSR, UBRR0H, UBRR1H, UBRR2H, UBRR3H, UBRR0L,
+                 UBRR1L, UBRR2L, UBRR3L, UDR0, UDR1, UDR2, UDR3, UCSR0A, UCSR0B, UCSR0C, UCSR1A,
+                 UCSR1B, UCSR1C, UCSR2A, UCSR2B, UCSR2C, UCSR3A, UCSR3B, UCSR3C, EIMSK, EICRA,
+                 EICRB, EIFR, GTCCR, ASSR, WDTCSR, ADCL, ADCH, MCUCR, SMCR;
+volatile uint16_t ADC, OCR1A, OCR1B, OCR1C, OCR3A, OCR3B, OCR3C, OCR4A, OCR4B, OCR4C, OCR5A, OCR5B,
+                  OCR5C, TCNT1, TCNT3, TCNT4, TCNT5, ICR1, ICR3, ICR4, ICR5, UBRR0, UBRR1, UBRR2,
+                  UBRR3;
+volatile SpiStatusRegister SPSR;
+volatile SpiDataRegister SPDR;
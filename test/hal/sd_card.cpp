@@ -0,0 +1,292 @@
+/**
+ * Host build of Marlin: an SDHC card on the SPI bus (see sd_card.h).
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+#include "sd_card.h"
+
+namespace host {
+
+namespace {
+
+    const size_t BLOCK_SIZE = 512;
+
+    // FAT16 volume without partition table ("super floppy"), one block per cluster
+    const uint32_t RESERVED_BLOCKS = 1;
+    const uint32_t NB_FATS = 2;
+    const uint32_t ROOT_ENTRIES = 512;
+    const uint32_t ROOT_BLOCKS = ROOT_ENTRIES * 32 / BLOCK_SIZE;
+    const uint32_t MIN_CLUSTERS = 4085;     //!< Fewer clusters make a FAT12 volume
+    const uint32_t MAX_CLUSTERS = 65524;
+    const uint16_t FILE_DATE = ((2017 - 1980) << 9) | (10 << 5) | 10;
+
+    // R1 responses
+    const uint8_t R1_READY = 0x00;
+    const uint8_t R1_IDLE = 0x01;
+    const uint8_t R1_ILLEGAL_COMMAND = 0x04;
+    const uint8_t R1_PARAMETER_ERROR = 0x40;
+    const uint8_t DATA_START_BLOCK = 0xFE;
+
+    void put16(std::vector<uint8_t>& image, size_t offset, uint16_t value)
+    {
+        image[offset] = value & 0xFF;
+        image[offset + 1] = value >> 8;
+    }
+
+    void put32(std::vector<uint8_t>& image, size_t offset, uint32_t value)
+    {
+        put16(image, offset, value & 0xFFFF);
+        put16(image, offset + 2, value >> 16);
+    }
+
+    //! Directory name of a file: 8.3, upper case, padded with spaces.
+    std::string short_name(const std::string& name)
+    {
+        const size_t dot = name.find('.');
+        const std::string base = name.substr(0, dot);
+        const std::string extension = dot != std::string::npos ? name.substr(dot + 1) : "";
+        if(base.empty() || base.size() > 8 || extension.size() > 3)
+        {
+            fprintf(stderr, "host: %s is not a 8.3 file name\n", name.c_str());
+            abort();
+        }
+        std::string directory_name = base + std::string(8 - base.size(), ' ') + extension + std::string(3 - extension.size(), ' ');
+        for(auto& c: directory_name)
+            c = static_cast<char>(toupper(c));
+        return directory_name;
+    }
+
+    //! CRC16 (CCITT) of the data blocks.
+    uint16_t crc16(const uint8_t* data, size_t size)
+    {
+        uint16_t crc = 0;
+        while(size--)
+        {
+            crc ^= static_cast<uint16_t>(*data++) << 8;
+            for(int bit = 0; bit < 8; ++bit)
+                crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+        }
+        return crc;
+    }
+
+}
+
+//! Add a file in the root directory. The volume is made when the card is inserted.
+void SdCard::add_file(const std::string& name, const std::string& content)
+{
+    files_.push_back(File{short_name(name), content});
+}
+
+//! Insert the card in the slot: connect it to the SPI bus.
+void SdCard::insert()
+{
+    format();
+    command_size_ = 0;
+    application_command_ = false;
+    idle_ = true;
+    response_.clear();
+    data_.clear();
+    connect_spi(this);
+}
+
+//! Remove the card from the slot.
+void SdCard::remove()
+{
+    connect_spi(nullptr);
+}
+
+//! Make the FAT16 volume with the files, each one in contiguous clusters.
+void SdCard::format()
+{
+    uint32_t file_clusters = 0;
+    for(auto& file: files_)
+        file_clusters += (file.content.size() + BLOCK_SIZE - 1) / BLOCK_SIZE;
+    if(files_.size() > ROOT_ENTRIES || file_clusters > MAX_CLUSTERS)
+    {
+        fprintf(stderr, "host: too many files or too large files for the SD card\n");
+        abort();
+    }
+
+    const uint32_t clusters = file_clusters > MIN_CLUSTERS ? file_clusters : MIN_CLUSTERS;
+    const uint32_t fat_blocks = ((clusters + 2) * 2 + BLOCK_SIZE - 1) / BLOCK_SIZE;
+    const uint32_t fat_start = RESERVED_BLOCKS;
+    const uint32_t root_start = fat_start + NB_FATS * fat_blocks;
+    const uint32_t data_start = root_start + ROOT_BLOCKS;
+    const uint32_t nb_blocks = data_start + clusters;
+    image_.assign(nb_blocks * BLOCK_SIZE, 0);
+
+    // Boot sector
+    const uint8_t jump[] = {0xEB, 0x3C, 0x90};
+    memcpy(&image_[0], jump, sizeof(jump));
+    memcpy(&image_[3], "MARLIN  ", 8);
+    put16(image_, 11, BLOCK_SIZE);
+    image_[13] = 1;                                 // Blocks per cluster
+    put16(image_, 14, RESERVED_BLOCKS);
+    image_[16] = NB_FATS;
+    put16(image_, 17, ROOT_ENTRIES);
+    put16(image_, 19, nb_blocks <= 0xFFFF ? nb_blocks : 0);
+    image_[21] = 0xF8;                              // Media: fixed disk
+    put16(image_, 22, fat_blocks);
+    put32(image_, 32, nb_blocks <= 0xFFFF ? 0 : nb_blocks);
+    image_[38] = 0x29;                              // Extended boot signature
+    memcpy(&image_[43], "HOST       FAT16   ", 19);  // Label and file system
+    put16(image_, 510, 0xAA55);
+
+    // Files: directory entries and cluster chains
+    std::vector<uint16_t> fat(clusters + 2, 0);
+    fat[0] = 0xFFF8;
+    fat[1] = 0xFFFF;
+    uint16_t cluster = 2;
+    for(size_t index = 0; index < files_.size(); ++index)
+    {
+        const File& file = files_[index];
+        const size_t entry = root_start * BLOCK_SIZE + index * 32;
+        memcpy(&image_[entry], file.name.data(), 11);
+        image_[entry + 11] = 0x20;                  // Archive
+        put16(image_, entry + 16, FILE_DATE);       // Creation
+        put16(image_, entry + 18, FILE_DATE);       // Last access
+        put16(image_, entry + 24, FILE_DATE);       // Last write
+        put16(image_, entry + 26, file.content.empty() ? 0 : cluster);
+        put32(image_, entry + 28, static_cast<uint32_t>(file.content.size()));
+
+        memcpy(&image_[(data_start + cluster - 2) * BLOCK_SIZE], file.content.data(), file.content.size());
+        const uint16_t nb_clusters = static_cast<uint16_t>((file.content.size() + BLOCK_SIZE - 1) / BLOCK_SIZE);
+        for(uint16_t next = 1; next <= nb_clusters; ++next, ++cluster)
+            fat[cluster] = next < nb_clusters ? cluster + 1 : 0xFFFF;
+    }
+    for(uint32_t copy = 0; copy < NB_FATS; ++copy)
+        for(size_t index = 0; index < fat.size(); ++index)
+            put16(image_, (fat_start + copy * fat_blocks) * BLOCK_SIZE + index * 2, fat[index]);
+}
+
+//! A byte on the SPI bus: receive the commands, send the responses and the data.
+uint8_t SdCard::transfer(uint8_t byte)
+{
+    if(response_.empty() && !data_.empty() && now() >= data_time_)
+    {
+        response_.insert(response_.end(), data_.begin(), data_.end());
+        data_.clear();
+    }
+
+    uint8_t sent = 0xFF;
+    if(!response_.empty())
+    {
+        sent = response_.front();
+        response_.pop_front();
+    }
+
+    // A command starts with 01 (start and transmission bits), then 4 bytes of argument and the CRC
+    if(command_size_ > 0 || (byte & 0xC0) == 0x40)
+    {
+        command_[command_size_++] = byte;
+        if(command_size_ == sizeof(command_))
+        {
+            command_size_ = 0;
+            execute(command_[0] & 0x3F, static_cast<uint32_t>(command_[1]) << 24 | static_cast<uint32_t>(command_[2]) << 16 |
+                                        static_cast<uint32_t>(command_[3]) << 8 | command_[4]);
+        }
+    }
+    return sent;
+}
+
+void SdCard::execute(uint8_t command, uint32_t argument)
+{
+    response_.clear();
+    data_.clear();
+
+    const bool application_command = application_command_;
+    application_command_ = false;
+    const uint8_t idle = idle_ ? R1_IDLE : R1_READY;
+
+    if(application_command && command == 41)
+    {
+        // ACMD41: initialization, done at once
+        idle_ = false;
+        respond(R1_READY);
+        return;
+    }
+
+    switch(command)
+    {
+        case 0: // CMD0: reset
+            idle_ = true;
+            respond(R1_IDLE);
+            break;
+
+        case 8: // CMD8: interface condition, the voltage and the check pattern are echoed
+            respond(idle, {0x00, 0x00, static_cast<uint8_t>((argument >> 8) & 0x0F), static_cast<uint8_t>(argument & 0xFF)});
+            break;
+
+        case 9: // CMD9: CSD version 2 (SDHC), with the size in units of 512 KB
+        {
+            const uint32_t size = static_cast<uint32_t>(image_.size() / BLOCK_SIZE / 1024);
+            const uint32_t c_size = size > 0 ? size - 1 : 0;
+            uint8_t csd[16] = {0x40, 0x0E, 0x00, 0x32, 0x5B, 0x59, 0x00, static_cast<uint8_t>((c_size >> 16) & 0x3F),
+                               static_cast<uint8_t>((c_size >> 8) & 0xFF), static_cast<uint8_t>(c_size & 0xFF),
+                               0x7F, 0x80, 0x0A, 0x40, 0x00, 0x01};
+            respond(R1_READY);
+            send_data(csd, sizeof(csd), now());
+            break;
+        }
+
+        case 10: // CMD10: CID, OEM "MR", product "HOST ", revision 1.0
+        {
+            const uint8_t cid[16] = {0x00, 'M', 'R', 'H', 'O', 'S', 'T', ' ', 0x10};
+            respond(R1_READY);
+            send_data(cid, sizeof(cid), now());
+            break;
+        }
+
+        case 12: // CMD12: stop transmission
+            respond(idle);
+            break;
+
+        case 17: // CMD17: read a block (block address)
+            if((argument + 1) * BLOCK_SIZE > image_.size())
+            {
+                respond(R1_PARAMETER_ERROR);
+                break;
+            }
+            respond(R1_READY);
+            send_data(&image_[argument * BLOCK_SIZE], BLOCK_SIZE, now() + ACCESS_TIME);
+            ++blocks_read_;
+            break;
+
+        case 55: // CMD55: the next command is an application command
+            application_command_ = true;
+            respond(idle);
+            break;
+
+        case 58: // CMD58: OCR, powered up and high capacity
+            respond(idle, {0xC0, 0xFF, 0x80, 0x00});
+            break;
+
+        default:
+            respond(idle | R1_ILLEGAL_COMMAND);
+            break;
+    }
+}
+
+//! Response to a command (after one byte): R1 and the bytes that follow it.
+void SdCard::respond(uint8_t r1, const std::vector<uint8_t>& data)
+{
+    response_.push_back(0xFF);
+    response_.push_back(r1);
+    response_.insert(response_.end(), data.begin(), data.end());
+}
+
+//! Data block after the response: start token, data and CRC, from a time.
+void SdCard::send_data(const uint8_t* data, size_t size, Time time)
+{
+    const uint16_t crc = crc16(data, size);
+    data_.push_back(DATA_START_BLOCK);
+    data_.insert(data_.end(), data, data + size);
+    data_.push_back(crc >> 8);
+    data_.push_back(crc & 0xFF);
+    data_time_ = time;
+}
+
+}
@@ -0,0 +1,57 @@
+/**
+ * Host build of Marlin: an SDHC card on the SPI bus, with a FAT16 volume
+ * made of files of the host.
+ *
+ * The card answers the commands sent by Sd2Card in SPI mode: reset and
+ * initialization (CMD0, CMD8, ACMD41, CMD58), registers (CMD9, CMD10) and
+ * reads of single blocks (CMD17). The data of a block comes after an
+ * access time, the bytes themselves take the time of the SPI clock (see
+ * host.cpp). The card is read-only: the other commands are illegal.
+ */
+#ifndef HOST_SD_CARD_H
+#define HOST_SD_CARD_H
+
+#include <deque>
+#include <string>
+#include <vector>
+
+#include "host.h"
+
+namespace host {
+
+class SdCard: public SpiDevice
+{
+public:
+    static const Time ACCESS_TIME = 500 * US; //!< From a read command to its data
+
+    void add_file(const std::string& name, const std::string& content);
+    void insert();
+    void remove();
+    uint32_t blocks_read() const { return blocks_read_; }
+
+    uint8_t transfer(uint8_t byte) override;
+
+private:
+    struct File { std::string name; std::string content; };
+
+    void format();
+    void execute(uint8_t command, uint32_t argument);
+    void respond(uint8_t r1, const std::vector<uint8_t>& data = {});
+    void send_data(const uint8_t* data, size_t size, Time time);
+
+private:
+    std::vector<File> files_;
+    std::vector<uint8_t> image_;        //!< Blocks of the card
+    uint8_t command_[6] = {};           //!< Command being received
+    size_t command_size_ = 0;
+    bool application_command_ = false;  //!< After CMD55
+    bool idle_ = true;                  //!< Until ACMD41
+    std::deque<uint8_t> response_;      //!< Bytes to send
+    std::vector<uint8_t> data_;         //!< Data block (with its token and CRC) to send after the response
+    Time data_time_ = 0;                //!< Time the data block is ready
+    uint32_t blocks_read_ = 0;
+};
+
+}
+
+#endif // HOST_SD_CARD_H
@@ -0,0 +1,123 @@
+/**
+ * Host build of Marlin: the timers that call the ISRs of the firmware (see timers.h).
+ */
+#include "timers.h"
+#include <avr/io.h>
+
+extern "C" void TIMER1_COMPA_vect();
+extern "C" void TIMER0_COMPB_vect();
+
+namespace host {
+
+namespace {
+
+    const Time TIMER1_TICK = 8 * SECOND / F_CPU;         //!< Prescaler 8
+    const Time TIMER0_PERIOD = 256 * 64 * SECOND / F_CPU; //!< Prescaler 64, 8 bits
+    const Time POLL_TIME = TIMER1_TICK;                 //!< Check of the interrupt flags while an ISR is pending
+
+    InterruptObserver no_observer;
+    InterruptObserver* observer_ = &no_observer;
+    TimerStatistics statistics_ = {};
+
+    bool interrupts_enabled() { return (SREG & 0x80) != 0; }
+
+    //! Call an ISR like the hardware does: with the global interrupt flag cleared, then set again by RETI.
+    void call(Interrupt interrupt, void (*isr)())
+    {
+        observer_->before(interrupt);
+        SREG &= 0x7F;
+        isr();
+        SREG |= 0x80;
+        observer_->after(interrupt);
+    }
+
+    //! Base of the two timers: a periodic compare match, with an ISR pending until enabled.
+    class Timer: public Peripheral
+    {
+    public:
+        Time next_event() const override
+        {
+            return pending_ ? now() + POLL_TIME : match_ + period();
+        }
+
+        void run() override
+        {
+            if(!pending_)
+            {
+                match_ += period();
+                pending_ = true;
+            }
+            if(!interrupts_enabled() || !enabled())
+                return;
+            if(now() > match_)
+                ++statistics_.delayed_isrs;
+            pending_ = false;
+            call_isr();
+        }
+
+        void start() { match_ = now(); }
+
+    protected:
+        virtual Time period() const = 0;
+        virtual bool enabled() const = 0;
+        virtual void call_isr() = 0;
+
+    protected:
+        Time match_ = 0;    //!< Time of the last compare match
+        bool pending_ = false;
+    };
+
+    class StepperTimer: public Timer
+    {
+    protected:
+        Time period() const override { return (static_cast<Time>(OCR1A) + 1) * TIMER1_TICK; }
+        bool enabled() const override { return (TIMSK1 & _BV(OCIE1A)) != 0; }
+
+        void call_isr() override
+        {
+            ++statistics_.stepper_isrs;
+            // Counting since the compare match (0 unless the ISR was delayed)
+            const Time ticks = (now() - match_) / TIMER1_TICK;
+            TCNT1 = ticks < 0xFFFF ? static_cast<uint16_t>(ticks) : 0xFFFF;
+            call(Interrupt::Stepper, TIMER1_COMPA_vect);
+        }
+    };
+
+    class TemperatureTimer: public Timer
+    {
+    protected:
+        Time period() const override { return TIMER0_PERIOD; }
+        bool enabled() const override { return (TIMSK0 & _BV(OCIE0B)) != 0; }
+
+        void call_isr() override
+        {
+            ++statistics_.temperature_isrs;
+            call(Interrupt::Temperature, TIMER0_COMPB_vect);
+        }
+    };
+
+    StepperTimer stepper_timer_;
+    TemperatureTimer temperature_timer_;
+    bool started_ = false;
+
+}
+
+//! Start the timers, once the firmware is initialized (after setup()).
+void start_timers(InterruptObserver* observer)
+{
+    observer_ = observer != nullptr ? observer : &no_observer;
+    stepper_timer_.start();
+    temperature_timer_.start();
+    if(started_)
+        return;
+    started_ = true;
+    attach(stepper_timer_);
+    attach(temperature_timer_);
+}
+
+const TimerStatistics& timer_statistics()
+{
+    return statistics_;
+}
+
+}
@@ -0,0 +1,46 @@
+/**
+ * Host build of Marlin: the timers of the ATmega2560 that call the
+ * interrupt service routines of the firmware.
+ *
+ *  - Timer 1 compare A (stepper): CTC mode, TCNT1 counts at F_CPU / 8 from
+ *    0 to OCR1A, then the ISR is called.
+ *  - Timer 0 compare B (temperature): once per overflow of timer 0, every
+ *    256 * 64 cycles (1.024 ms).
+ *
+ * An ISR is called when its interrupt is enabled (TIMSKn and the global
+ * flag in SREG). Else it is pending and called as soon as it is enabled.
+ * ISRs take no time: TCNT1 is only set when the stepper ISR is called (0
+ * unless it was delayed). Only linked with the whole firmware.
+ */
+#ifndef HOST_TIMERS_H
+#define HOST_TIMERS_H
+
+#include "host.h"
+
+namespace host {
+
+enum class Interrupt { Stepper, Temperature };
+
+//! Notified around the calls of the ISRs (to update the inputs of the firmware, record its outputs...).
+class InterruptObserver
+{
+public:
+    virtual ~InterruptObserver() {}
+    virtual void before(Interrupt interrupt) {}
+    virtual void after(Interrupt interrupt) {}
+};
+
+void start_timers(InterruptObserver* observer = nullptr);
+
+struct TimerStatistics
+{
+    uint32_t stepper_isrs;          //!< Calls of the stepper ISR
+    uint32_t temperature_isrs;      //!< Calls of the temperature ISR
+    uint32_t delayed_isrs;          //!< ISRs called after their time because they were disabled
+};
+
+const TimerStatistics& timer_statistics();
+
+}
+
+#endif // HOST_TIMERS_H
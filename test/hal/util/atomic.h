@@ -0,0 +1,12 @@
+/**
+ * Host build of Marlin: atomic blocks. The firmware is never interrupted
+ * in the middle of a statement on the host.
+ */
+#ifndef HOST_UTIL_ATOMIC_H
+#define HOST_UTIL_ATOMIC_H
+
+#define ATOMIC_BLOCK(type) for (int atomic_done_ = 0; !atomic_done_; atomic_done_ = 1)
+#define ATOMIC_RESTORESTATE 0
+#define ATOMIC_FORCEON 0
+
+#endif // HOST_UTIL_ATOMIC_H
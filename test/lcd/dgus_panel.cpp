@@ -0,0 +1,217 @@
+/**
+ * Emulator of the DGUS LCD panel of the Wanhao Duplicator i3 Plus (see dgus_panel.h).
+ */
+#include "dgus_panel.h"
+
+namespace lcd {
+
+namespace
+{
+    const uint8_t HEADER0 = 0x5A;
+    const uint8_t HEADER1 = 0xA5;
+
+    const uint8_t WRITE_REGISTER = 0x80;
+    const uint8_t READ_REGISTER = 0x81;
+    const uint8_t WRITE_RAM = 0x82;
+    const uint8_t READ_RAM = 0x83;
+    const uint8_t WRITE_CURVE = 0x84;
+
+    const uint8_t REGISTER_VERSION = 0x00;
+    const uint8_t REGISTER_PICTURE_ID = 0x03;
+}
+
+//! Create a panel and connect it to a serial port.
+//! @param port         Serial port of the microcontroller (2 on the i3 Plus)
+//! @param baudrate     Baudrate configured on the panel
+DgusPanel::DgusPanel(uint8_t port, uint32_t baudrate)
+: port_(port), baudrate_(baudrate), ram_(0x10000, 0)
+{
+    registers_[REGISTER_VERSION] = FIRMWARE_VERSION;
+    host::uart(port_).connect(this, baudrate_);
+}
+
+//! Current page (PictureID register).
+uint16_t DgusPanel::page() const
+{
+    return static_cast<uint16_t>(registers_[REGISTER_PICTURE_ID] << 8 | registers_[REGISTER_PICTURE_ID + 1]);
+}
+
+//! Text stored in variables: two characters per word, until the first null character.
+//! @param address      First variable
+//! @param nb_words     Maximal number of words
+std::string DgusPanel::text(uint16_t address, uint16_t nb_words) const
+{
+    std::string text;
+    for(uint16_t index = 0; index < nb_words; ++index)
+    {
+        uint16_t word = ram_[static_cast<uint16_t>(address + index)];
+        for(char c: {static_cast<char>(word >> 8), static_cast<char>(word & 0xFF)})
+        {
+            if(c == 0)
+                return text;
+            text += c;
+        }
+    }
+    return text;
+}
+
+void DgusPanel::reset_statistics()
+{
+    statistics_ = Statistics{};
+}
+
+//! Touch a button returning a key code: the panel stores the key code in the variable and sends it to the firmware.
+//! @param variable     The variable (Action for ADVi3++)
+//! @param key_code     The value of the key (KeyValue for ADVi3++)
+void DgusPanel::touch(uint16_t variable, uint16_t key_code)
+{
+    ram_[variable] = key_code;
+    send({HEADER0, HEADER1, 0x06, READ_RAM,
+          static_cast<uint8_t>(variable >> 8), static_cast<uint8_t>(variable & 0xFF), 0x01,
+          static_cast<uint8_t>(key_code >> 8), static_cast<uint8_t>(key_code & 0xFF)},
+         host::now());
+}
+
+//! Send a frame to the firmware.
+//! @param frame        The complete frame
+//! @param time         When to start the transmission
+void DgusPanel::send(const std::vector<uint8_t>& frame, host::Time time)
+{
+    host::uart(port_).send(frame.data(), frame.size(), time);
+    nb_bytes_sent_ += frame.size();
+    statistics_.bytes_sent += frame.size();
+    statistics_.frames_sent += 1;
+}
+
+//! A byte sent by the firmware arrived: accumulate it in the current frame and execute the frame when it is complete.
+void DgusPanel::received(uint8_t byte, host::Time time)
+{
+    statistics_.bytes_received += 1;
+
+    if(frame_.empty())
+    {
+        if(byte != HEADER0)
+        {
+            statistics_.ignored_bytes += 1;
+            return;
+        }
+        frame_start_ = time - 10 * host::SECOND / baudrate_;
+    }
+    else if(frame_.size() == 1 && byte != HEADER1)
+    {
+        statistics_.ignored_bytes += frame_.size() + 1;
+        frame_.clear();
+        return;
+    }
+
+    frame_.push_back(byte);
+    if(frame_.size() >= 3 && frame_.size() == 3u + frame_[2])
+    {
+        execute(time);
+        frame_.clear();
+    }
+}
+
+//! The firmware read a byte sent by the panel: complete the round trips whose response is entirely read.
+void DgusPanel::consumed(uint32_t count, host::Time time)
+{
+    while(!round_trips_.empty() && count >= round_trips_.front().last_byte)
+    {
+        host::Time duration = time - round_trips_.front().start;
+        round_trips_.pop_front();
+
+        RoundTrips& round_trips = statistics_.round_trips;
+        if(round_trips.count == 0 || duration < round_trips.min)
+            round_trips.min = duration;
+        if(duration > round_trips.max)
+            round_trips.max = duration;
+        round_trips.total += duration;
+        round_trips.count += 1;
+    }
+}
+
+//! Execute a complete frame received from the firmware.
+//! @param time         Time of the end of the frame
+void DgusPanel::execute(host::Time time)
+{
+    const uint8_t length = frame_[2];
+    const uint8_t* data = frame_.data() + 4;
+    const size_t size = length - 1; // Without the command
+    const uint8_t command = length > 0 ? frame_[3] : 0;
+
+    switch(command)
+    {
+        case WRITE_REGISTER:
+            if(size < 2)
+                break;
+            for(size_t index = 1; index < size; ++index)
+                registers_[static_cast<uint8_t>(data[0] + index - 1)] = data[index];
+            if(data[0] <= REGISTER_PICTURE_ID + 1 && data[0] + size - 1 > REGISTER_PICTURE_ID)
+            {
+                pages_.push_back(page());
+                statistics_.page_changes += 1;
+            }
+            statistics_.register_writes += 1;
+            statistics_.frames_received += 1;
+            return;
+
+        case READ_REGISTER:
+        {
+            if(size != 2)
+                break;
+            std::vector<uint8_t> response{HEADER0, HEADER1, static_cast<uint8_t>(3 + data[1]), READ_REGISTER,
+                                          data[0], data[1]};
+            for(uint8_t index = 0; index < data[1]; ++index)
+                response.push_back(registers_[static_cast<uint8_t>(data[0] + index)]);
+            send(response, time + response_delay_);
+            round_trips_.push_back(PendingRoundTrip{nb_bytes_sent_, frame_start_});
+            statistics_.frames_received += 1;
+            return;
+        }
+
+        case WRITE_RAM:
+        {
+            if(size < 4 || size % 2 != 0)
+                break;
+            uint16_t address = static_cast<uint16_t>(data[0] << 8 | data[1]);
+            for(size_t index = 2; index < size; index += 2)
+                ram_[address++] = static_cast<uint16_t>(data[index] << 8 | data[index + 1]);
+            statistics_.ram_writes += 1;
+            statistics_.frames_received += 1;
+            return;
+        }
+
+        case READ_RAM:
+        {
+            if(size != 3)
+                break;
+            uint16_t address = static_cast<uint16_t>(data[0] << 8 | data[1]);
+            std::vector<uint8_t> response{HEADER0, HEADER1, static_cast<uint8_t>(4 + 2 * data[2]), READ_RAM,
+                                          data[0], data[1], data[2]};
+            for(uint8_t index = 0; index < data[2]; ++index)
+            {
+                uint16_t word = ram_[static_cast<uint16_t>(address + index)];
+                response.push_back(static_cast<uint8_t>(word >> 8));
+                response.push_back(static_cast<uint8_t>(word & 0xFF));
+            }
+            send(response, time + response_delay_);
+            round_trips_.push_back(PendingRoundTrip{nb_bytes_sent_, frame_start_});
+            statistics_.frames_received += 1;
+            return;
+        }
+
+        case WRITE_CURVE:
+            if(size < 3 || (size - 1) % 2 != 0)
+                break;
+            statistics_.curve_points += (size - 1) / 2;
+            statistics_.frames_received += 1;
+            return;
+
+        default:
+            break;
+    }
+
+    statistics_.invalid_frames += 1;
+}
+
+}
@@ -0,0 +1,93 @@
+/**
+ * Emulator of the DGUS LCD panel of the Wanhao Duplicator i3 Plus.
+ *
+ * The panel is connected to a serial port of the host build and implements
+ * the DGUS protocol as used by ADVi3++: frames 5A A5 <length> <command>
+ * <data> to write and read its registers and its RAM (variables), to add
+ * points to the curves and, from the panel, to send the key codes of the
+ * touched buttons. Reads are answered after a configurable delay.
+ */
+#ifndef LCD_DGUS_PANEL_H
+#define LCD_DGUS_PANEL_H
+
+#include <stdint.h>
+#include <deque>
+#include <string>
+#include <vector>
+
+#include "../hal/host.h"
+
+namespace lcd {
+
+class DgusPanel: public host::SerialDevice
+{
+public:
+    //! Time from the start of a read request on the wire to the read of the last byte of the response by the firmware.
+    struct RoundTrips
+    {
+        uint32_t count;
+        host::Time min;
+        host::Time max;
+        host::Time total;
+    };
+
+    struct Statistics
+    {
+        uint32_t frames_received;       //!< Valid frames sent by the firmware
+        uint32_t bytes_received;        //!< Bytes sent by the firmware (valid or not)
+        uint32_t invalid_frames;        //!< Frames with an unknown command or an invalid length
+        uint32_t ignored_bytes;         //!< Bytes outside of frames
+        uint32_t frames_sent;           //!< Responses and key codes sent to the firmware
+        uint32_t bytes_sent;
+        uint32_t register_writes;
+        uint32_t ram_writes;
+        uint32_t curve_points;
+        uint32_t page_changes;
+        RoundTrips round_trips;
+    };
+
+    DgusPanel(uint8_t port, uint32_t baudrate);
+
+    void touch(uint16_t variable, uint16_t key_code);
+    void set_response_delay(host::Time delay) { response_delay_ = delay; }
+
+    uint16_t page() const;
+    uint16_t ram(uint16_t address) const { return ram_[address]; }
+    void set_ram(uint16_t address, uint16_t value) { ram_[address] = value; }
+    std::string text(uint16_t address, uint16_t nb_words) const;
+    const std::vector<uint16_t>& pages() const { return pages_; }
+
+    const Statistics& statistics() const { return statistics_; }
+    void reset_statistics();
+
+    static const uint8_t FIRMWARE_VERSION = 0x21;
+
+private:
+    void received(uint8_t byte, host::Time time) override;
+    void consumed(uint32_t count, host::Time time) override;
+    void execute(host::Time time);
+    void send(const std::vector<uint8_t>& frame, host::Time time);
+
+private:
+    struct PendingRoundTrip
+    {
+        uint32_t last_byte;             //!< Index of the last byte of the response
+        host::Time start;               //!< Start of the request on the wire
+    };
+
+    const uint8_t port_;
+    const uint32_t baudrate_;
+    host::Time response_delay_ = 2 * host::MS;
+    uint8_t registers_[256] = {};
+    std::vector<uint16_t> ram_;
+    std::vector<uint16_t> pages_;
+    std::vector<uint8_t> frame_;
+    host::Time frame_start_ = 0;
+    uint32_t nb_bytes_sent_ = 0;
+    std::deque<PendingRoundTrip> round_trips_;
+    Statistics statistics_ = {};
+};
+
+}
+
+#endif // LCD_DGUS_PANEL_H
@@ -0,0 +1,380 @@
+/**
+ * Scripted scenarios of the ADVi3++ layer against the emulated DGUS panel.
+ *
+ * The main loop of Marlin is modeled as in idle(): each iteration executes
+ * the commands (see stubs.h) during LOOP_TIME, then calls
+ * i3PlusPrinter::task(). The panel is touched like a user would do and the
+ * pages and variables it ends with are checked. For each scenario, the
+ * following figures are reported:
+ *
+ *  - round trips: read requests from the start of the request on the wire
+ *    to the read of the last byte of the response by the firmware;
+ *  - frames and bytes on the wire in both directions;
+ *  - the worst duration of task() and the worst time between two calls of
+ *    task(), i.e. the worst time the LCD is not served by the main loop.
+ *
+ * The worst time between two calls of task() must not exceed the limit of
+ * the scenario: a few iterations of the main loop (MAX_GAP). The only known
+ * exceptions are M303 (PID tuning): the autotune of Marlin blocks the main
+ * loop until it finishes and only updates the graphs of the LCD, and M772
+ * (link benchmark) which blocks the main loop while it measures the link.
+ *
+ * The exit status is not 0 if a check failed or if a limit is exceeded.
+ */
+#include <stdio.h>
+#include <algorithm>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "dgus_panel.h"
+#include "stubs.h"
+
+#include "../../Marlin/Marlin.h"
+#include "../../Marlin/temperature.h"
+#include "../../Marlin/planner.h"
+#include "../../Marlin/printcounter.h"
+#include "../../Marlin/adv_i3_plus_plus.h"
+#include "../../Marlin/adv_i3_plus_plus_enums.h"
+#include "../../Marlin/adv_i3_plus_plus_utils.h"
+
+using namespace advi3pp;
+using host::Time;
+using host::MS;
+using host::SECOND;
+
+namespace
+{
+    const uint8_t LCD_PORT = 2;
+    const uint32_t LCD_BAUDRATE = 115200;
+    const Time LOOP_TIME = 1 * MS; // Time spent outside of the LCD layer by each iteration of the main loop
+    const Time MAX_GAP = 5 * LOOP_TIME; // Limit of the time between two calls of task()
+    //! M303 blocks the main loop: heating to 210 °C from the ambient (74 s) and 8 cycles (200 s), see stubs.cpp
+    const Time MAX_GAP_AUTOTUNE = 300 * SECOND;
+    //! M772 blocks the main loop: 100 frames of 18 bytes at 115200 bauds and 10 round trips
+    const Time MAX_GAP_BENCHMARK = 1 * SECOND;
+
+    lcd::DgusPanel panel{LCD_PORT, LCD_BAUDRATE};
+    Time last_task = 0;
+    Time max_task = 0;
+    Time max_gap = 0;
+    unsigned nb_failures = 0;
+
+    //! One iteration of the main loop.
+    void loop()
+    {
+        lcd::model::run(LOOP_TIME);
+
+        Time start = host::now();
+        if(last_task > 0 && start - last_task > max_gap)
+            max_gap = start - last_task;
+        i3PlusPrinter::task();
+        if(host::now() - start > max_task)
+            max_task = host::now() - start;
+        last_task = start;
+    }
+
+    void run_for(Time duration)
+    {
+        const Time end = host::now() + duration;
+        while(host::now() < end)
+            loop();
+    }
+
+    //! Run the main loop until a condition is met. Return false if the timeout expires before.
+    bool run_until(std::function<bool()> condition, Time timeout)
+    {
+        const Time end = host::now() + timeout;
+        while(!condition())
+        {
+            if(host::now() >= end)
+                return false;
+            loop();
+        }
+        return true;
+    }
+
+    void touch(Action action, KeyValue key_value, Time duration = 500 * MS)
+    {
+        panel.touch(static_cast<uint16_t>(action), static_cast<uint16_t>(key_value));
+        run_for(duration);
+    }
+
+    void touch(Action action, uint16_t key_value, Time duration = 500 * MS)
+    {
+        touch(action, static_cast<KeyValue>(key_value), duration);
+    }
+
+    uint16_t ram(Variable variable) { return panel.ram(static_cast<uint16_t>(variable)); }
+    void set_ram(Variable variable, uint16_t value) { panel.set_ram(static_cast<uint16_t>(variable), value); }
+    std::string text(Variable variable) { return panel.text(static_cast<uint16_t>(variable), 13); }
+
+    void check(bool condition, const char* description)
+    {
+        if(condition)
+            return;
+        printf("    FAILED: %s\n", description);
+        ++nb_failures;
+    }
+
+    void check_page(Page page)
+    {
+        char description[64];
+        snprintf(description, sizeof(description), "page %u (current page is %u)",
+                 static_cast<unsigned>(page), static_cast<unsigned>(panel.page()));
+        check(panel.page() == static_cast<uint16_t>(page), description);
+    }
+
+    bool executed(const std::string& command)
+    {
+        for(auto& executed_command: lcd::model::executed())
+            if(executed_command == command)
+                return true;
+        return false;
+    }
+
+    void check_executed(const std::string& command)
+    {
+        check(executed(command), ("command " + command + " executed").c_str());
+    }
+
+    //! A command was executed before another one.
+    bool executed_before(const std::string& first, const std::string& second)
+    {
+        auto& commands = lcd::model::executed();
+        auto first_position = std::find(commands.begin(), commands.end(), first);
+        return first_position != commands.end() && std::find(first_position, commands.end(), second) != commands.end();
+    }
+
+    // ----------------------------------------------------------------
+    // Scenarios
+    // ----------------------------------------------------------------
+
+    //! Boot: detect the baudrate of the panel, read its version and show the boot page.
+    void boot()
+    {
+        i3PlusPrinter::reset_presets(); // As settings.load() does with an empty EEPROM
+        i3PlusPrinter::setup();
+        run_for(1 * SECOND);
+
+        check_page(Page::Boot);
+        check(host::uart(LCD_PORT).statistics().framing_errors > 0, "230400 bauds tried first");
+        check(!panel.text(static_cast<uint16_t>(Variable::LcdFirmwareVersion), 8).empty(), "LCD version shown");
+    }
+
+    //! Preheat: show the presets, change the first one and use it.
+    void preheat()
+    {
+        touch(Action::Preheat, KeyValue::Show);
+        check_page(Page::Preheat);
+        check(ram(Variable::Preset1Bed) == DEFAULT_PREHEAT_PRESET1_HOTEND, "preset 1 hotend shown");
+        check(ram(Variable::Preset1Hotend) == DEFAULT_PREHEAT_PRESET1_BED, "preset 1 bed shown");
+
+        set_ram(Variable::Preset1Bed, 195);
+        set_ram(Variable::Preset1Hotend, 55);
+        unsigned nb_saves = lcd::model::nb_saves();
+        touch(Action::Preheat, 1);
+        check(Temperature::target_temperature[0] == 195, "hotend target set");
+        check(Temperature::target_temperature_bed == 55, "bed target set");
+        check(lcd::model::nb_saves() == nb_saves + 1, "presets saved");
+
+        run_for(60 * SECOND);
+        check(ram(Variable::TargetHotEnd) == 195, "hotend target shown");
+        // The status is sent every 250 ms while heating and the temperatures are truncated
+        check(abs(ram(Variable::HotEnd) - Temperature::current_temperature[0]) <= 2, "hotend temperature shown");
+        check(abs(ram(Variable::Bed) - Temperature::current_temperature_bed) <= 2, "bed temperature shown");
+
+        touch(Action::Cooldown, KeyValue::Show);
+        check(Temperature::target_temperature[0] == 0 && Temperature::target_temperature_bed == 0, "heaters off");
+    }
+
+    //! Fill the transmission queue to the LCD until a frame is dropped. Its frames write "filler" over the first name.
+    void fill_tx_queue()
+    {
+        const uint32_t nb_dropped = TxQueue::nb_dropped_frames();
+        while(TxQueue::nb_dropped_frames() == nb_dropped)
+        {
+            WriteRamDataRequest frame{Variable::FileName1};
+            frame.append("filler", 20);
+            frame.send();
+        }
+    }
+
+    //! SD browse: page through 12 files (once with a full transmission queue), select one, stop the print.
+    void sd_browse()
+    {
+        std::vector<std::string> files;
+        for(int index = 0; index < 12; ++index)
+            files.push_back("part-" + std::to_string(index) + ".gcode");
+        lcd::model::set_files(files);
+
+        touch(Action::SdCard, KeyValue::Show);
+        check_page(Page::SdCard);
+        check(text(Variable::FileName1) == "part-11.gcode", "last file first");
+        check(text(Variable::FileName5) == "part-7.gcode", "fifth file");
+
+        touch(Action::SdCard, KeyValue::Down);
+        check(text(Variable::FileName1) == "part-6.gcode", "next page");
+        touch(Action::SdCard, KeyValue::Down);
+        check(text(Variable::FileName1) == "part-1.gcode", "last page");
+        check(text(Variable::FileName3).empty(), "no more files");
+        touch(Action::SdCard, KeyValue::Up);
+        check(text(Variable::FileName1) == "part-6.gcode", "previous page");
+
+        // The names and the page do not fit in the queue: they are sent again by task()
+        touch(Action::Preheat, KeyValue::Show);
+        panel.touch(static_cast<uint16_t>(Action::SdCard), static_cast<uint16_t>(KeyValue::Show));
+        fill_tx_queue();
+        const uint32_t nb_dropped = TxQueue::nb_dropped_frames();
+        run_for(500 * MS);
+        check(TxQueue::nb_dropped_frames() > nb_dropped, "names dropped by the full queue");
+        check_page(Page::SdCard);
+        check(text(Variable::FileName1) == "part-11.gcode", "names sent again");
+
+        touch(Action::SdCardSelectFile, 2);
+        check_page(Page::Print);
+        check(text(Variable::SelectedFileName) == "part-9.gcode", "selected file shown");
+        check(lcd::model::printing(), "printing");
+
+        touch(Action::PrintStop, KeyValue::Show);
+        check(!lcd::model::printing(), "print stopped");
+    }
+
+    //! Jog: move X when idle, but not during a print from a host or while its moves are planned.
+    void jog()
+    {
+        const float x = current_position[X_AXIS];
+        touch(Action::XPlus, 0);
+        check(current_position[X_AXIS] == x + 5, "jog move when idle");
+
+        // A host prints (M75) and sends a long move
+        print_job_timer.start();
+        touch(Action::XPlus, 0);
+        check(current_position[X_AXIS] == x + 5, "no jog move during a print from a host");
+        print_job_timer.stop();
+
+        enqueue_and_echo_command("G1 X100 F600");
+        run_for(500 * MS);
+        check(planner.blocks_queued() && commands_in_queue == 0, "move of the host planned");
+        touch(Action::XPlus, 0);
+        check(current_position[X_AXIS] == 100, "no jog move while the moves of a host are planned");
+
+        check(run_until([]{ return !planner.blocks_queued(); }, 20 * SECOND), "move of the host finished");
+        touch(Action::XPlus, 0);
+        check(current_position[X_AXIS] == 105, "jog move after the moves of the host");
+    }
+
+    //! Link benchmark (M772): the heaters are managed while the frames are sent. The LCD is not served during the
+    //! benchmark (MAX_GAP_BENCHMARK).
+    void link_benchmark()
+    {
+        lcd::model::reset_heater_management();
+        i3PlusPrinter::benchmark_link(100);
+        run_for(500 * MS);
+        check(lcd::model::max_heater_management_gap() > 0, "heaters managed during the benchmark");
+        check(lcd::model::max_heater_management_gap() <= 10 * MS, "heaters managed every 10 ms");
+        check(panel.statistics().round_trips.count > 0, "page read back");
+    }
+
+    //! PID tuning: set the target temperature and run the (blocking) autotune. The LCD is not served during the
+    //! autotune (MAX_GAP_AUTOTUNE).
+    void pid_tuning()
+    {
+        touch(Action::PidTuning, KeyValue::Show);
+        check_page(Page::AutoPidTuning);
+        check(ram(Variable::TargetTemperature) == 200, "default target temperature shown");
+
+        set_ram(Variable::TargetTemperature, 210);
+        unsigned nb_saves = lcd::model::nb_saves();
+        touch(Action::PidTuning, KeyValue::AutoPid);
+        check(run_until([]{ return panel.page() == static_cast<uint16_t>(Page::AutoPidFinished); }, 600 * SECOND),
+              "autotune finished");
+        run_for(500 * MS);
+
+        check(std::find(panel.pages().begin(), panel.pages().end(), static_cast<uint16_t>(Page::AutoPidGraph))
+              != panel.pages().end(), "graph shown");
+        check_executed("M106 S255");
+        check_executed("M303 S210E0 C8 U1");
+        check_executed("M106 S0");
+        check(panel.statistics().curve_points > 0, "graph updated during the autotune");
+        check(lcd::model::nb_saves() == nb_saves + 1, "PID settings saved");
+    }
+
+    //! Leveling: home, the four corners and finish.
+    void leveling()
+    {
+        touch(Action::Level, KeyValue::LevelStart);
+        check_page(Page::LevelingStart);
+        check(run_until([]{ return panel.page() == static_cast<uint16_t>(Page::Leveling); }, 20 * SECOND),
+              "homed");
+        check_executed("G28");
+
+        const uint16_t steps[] = {1, 2, 3, 4};
+        const float corners[][2] = {{30, 30}, {170, 170}, {170, 30}, {30, 170}};
+        for(auto step: steps)
+        {
+            touch(Action::Level, step, 5 * SECOND);
+            check(current_position[X_AXIS] == corners[step - 1][0] && current_position[Y_AXIS] == corners[step - 1][1] &&
+                  current_position[Z_AXIS] == 0, "corner reached");
+        }
+
+        // A command from the host queued (behind a homing) before the last step runs before it
+        enqueue_and_echo_command("G28");
+        enqueue_and_echo_command("G1 X100 F6000");
+        run_for(100 * MS);
+        touch(Action::Level, KeyValue::LevelFinish, 15 * SECOND);
+        check_page(Page::Tools);
+        check(current_position[Z_AXIS] == 30, "nozzle raised");
+        check(executed_before("G1 X100 F6000", "G1 Z30 F2000"), "commands run in the order they were sent");
+    }
+
+    // ----------------------------------------------------------------
+    // Report
+    // ----------------------------------------------------------------
+
+    double ms(Time time) { return static_cast<double>(time) / MS; }
+
+    //! Run a scenario and report it.
+    //! @param max_gap_allowed  Limit of the time between two calls of task()
+    void run(const char* name, void (*scenario)(), Time max_gap_allowed = MAX_GAP)
+    {
+        printf("%s\n", name);
+
+        unsigned failures = nb_failures;
+        panel.reset_statistics();
+        host::uart(LCD_PORT).reset_statistics();
+        max_task = max_gap = 0;
+
+        scenario();
+
+        auto& stats = panel.statistics();
+        auto& round_trips = stats.round_trips;
+        auto& uart = host::uart(LCD_PORT).statistics();
+        printf("    round trips: %u, avg %.2f ms, min %.2f ms, max %.2f ms\n", round_trips.count,
+               round_trips.count > 0 ? ms(round_trips.total) / round_trips.count : 0.0,
+               ms(round_trips.min), ms(round_trips.max));
+        printf("    to LCD: %u frames, %u bytes (%u invalid frames)\n",
+               stats.frames_received, stats.bytes_received, stats.invalid_frames);
+        printf("    from LCD: %u frames, %u bytes\n", stats.frames_sent, stats.bytes_sent);
+        printf("    lost bytes: %u overruns, %u framing errors\n", uart.overruns, uart.framing_errors);
+        printf("    task(): max %.3f ms, max time between calls %.3f ms (limit %.3f ms)\n", ms(max_task), ms(max_gap),
+               ms(max_gap_allowed));
+        check(max_gap <= max_gap_allowed, "time between calls of task() within the limit");
+        printf("    %s\n", nb_failures == failures ? "OK" : "FAILED");
+    }
+}
+
+int main()
+{
+    lcd::model::reset();
+
+    run("boot", boot);
+    run("preheat", preheat);
+    run("sd browse", sd_browse);
+    run("jog", jog);
+    run("link benchmark", link_benchmark, MAX_GAP_BENCHMARK);
+    run("pid tuning", pid_tuning, MAX_GAP_AUTOTUNE);
+    run("leveling", leveling);
+
+    return nb_failures == 0 ? 0 : 1;
+}
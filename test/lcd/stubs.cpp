@@ -0,0 +1,496 @@
+/**
+ * Stubs of Marlin for the host build of the ADVi3++ layer (see stubs.h).
+ */
+#include <deque>
+#include <string>
+#include <vector>
+
+#include "stubs.h"
+
+#include "../../Marlin/Marlin.h"
+#include "../../Marlin/temperature.h"
+#include "../../Marlin/planner.h"
+#include "../../Marlin/cardreader.h"
+#include "../../Marlin/configuration_store.h"
+#include "../../Marlin/gcode.h"
+#include "../../Marlin/adv_i3_plus_plus.h"
+
+using host::Time;
+using host::MS;
+using host::SECOND;
+
+// --------------------------------------------------------------------
+// Global state of Marlin used by the ADVi3++ layer
+// --------------------------------------------------------------------
+
+uint8_t commands_in_queue = 0;
+int16_t feedrate_percentage = 100;
+bool axis_homed[XYZ] = { false };
+float current_position[NUM_AXIS] = { 0 };
+int16_t fanSpeeds[FAN_COUNT] = { 0 };
+uint8_t active_extruder = 0;
+PrintCounter print_job_timer;
+MarlinSettings settings;
+CardReader card;
+Temperature thermalManager;
+Planner planner;
+
+float Temperature::current_temperature[HOTENDS] = { 0 };
+float Temperature::current_temperature_bed = 0;
+int16_t Temperature::target_temperature[HOTENDS] = { 0 };
+int16_t Temperature::target_temperature_bed = 0;
+float Temperature::Kp = DEFAULT_Kp;
+float Temperature::Ki = (DEFAULT_Ki) * (PID_dT);
+float Temperature::Kd = (DEFAULT_Kd) / (PID_dT);
+
+float Planner::axis_steps_per_mm[XYZE_N] = DEFAULT_AXIS_STEPS_PER_UNIT;
+volatile uint8_t Planner::block_buffer_head = 0;
+volatile uint8_t Planner::block_buffer_tail = 0;
+
+namespace lcd { namespace model {
+
+namespace
+{
+    const float AMBIENT = 25;               // °C
+    const float HOTEND_HEATING_RATE = 2.5;  // °C/s
+    const float BED_HEATING_RATE = 0.5;     // °C/s
+    const float HOTEND_COOLING = 1.0 / 90;  // Fraction of the difference with the ambient lost each second
+    const float BED_COOLING = 1.0 / 600;
+    const Time HOMING_TIME = 6 * SECOND;
+    const Time AUTOTUNE_CYCLE_TIME = 25 * SECOND;
+    const Time AUTOTUNE_SLICE = 10 * MS;    // The autotune loop of Marlin updates the graphs continuously
+    const char axis_codes[XYZE] = { 'X', 'Y', 'Z', 'E' };
+
+    std::deque<std::string> queue;          // Command queue
+    //! Command of a script. The first command of a script waits for the commands queued before it.
+    struct ScriptCommand
+    {
+        std::string command;
+        size_t wait;                        // Commands of the queue to run before it
+    };
+
+    std::deque<ScriptCommand> scripts;      // Commands of the scripts, run after the commands queued before them
+    std::deque<Time> blocks;                // Remaining time of each block of the planner
+    std::vector<std::string> executed_commands;
+    std::vector<std::string> files;
+    std::string command;                    // Command being executed
+    Time command_time = 0;                  // Remaining time of the command being executed
+    bool relative_mode = false;
+    float feedrate = 50;                    // mm/s
+    float planner_position[NUM_AXIS] = { 0 };
+    unsigned saves = 0;
+    uint8_t homing_axes = 0;                // Axes homed by the command being executed
+    Time last_heater_management = 0;        // Last call of manage_heater() by a blocking wait
+    Time max_heater_gap = 0;                // Worst time between two calls of manage_heater()
+
+    //! Value of a parameter of a command, or the default value
+    float parameter(const std::string& command, char letter, float value)
+    {
+        for(size_t index = command.find(' '); index != std::string::npos; index = command.find(' ', index + 1))
+            if(index + 1 < command.size() && command[index + 1] == letter)
+                return strtof(command.c_str() + index + 2, nullptr);
+        return value;
+    }
+
+    bool has_parameter(const std::string& command, char letter)
+    {
+        return command.find(std::string(" ") + letter) != std::string::npos;
+    }
+
+    //! Update the temperatures of the heaters.
+    void heat(Time duration)
+    {
+        const float seconds = static_cast<float>(duration) / SECOND;
+
+        float& hotend = Temperature::current_temperature[0];
+        const float hotend_target = Temperature::target_temperature[0];
+        if(hotend_target > hotend)
+            hotend = min(hotend_target, hotend + HOTEND_HEATING_RATE * seconds);
+        else
+            hotend = max(max(hotend_target, AMBIENT), hotend - (hotend - AMBIENT) * HOTEND_COOLING * seconds);
+
+        float& bed = Temperature::current_temperature_bed;
+        const float bed_target = Temperature::target_temperature_bed;
+        if(bed_target > bed)
+            bed = min(bed_target, bed + BED_HEATING_RATE * seconds);
+        else
+            bed = max(max(bed_target, AMBIENT), bed - (bed - AMBIENT) * BED_COOLING * seconds);
+    }
+
+    //! End of G28: the axes are at their home position.
+    void homed()
+    {
+        for(uint8_t axis = 0; axis < XYZ; ++axis)
+            if(TEST(homing_axes, axis))
+            {
+                axis_homed[axis] = true;
+                current_position[axis] = planner_position[axis] = 0;
+            }
+        homing_axes = 0;
+    }
+
+    //! Execute the blocks of the planner.
+    void move(Time duration)
+    {
+        while(duration > 0 && !blocks.empty())
+        {
+            Time time = min(duration, blocks.front());
+            blocks.front() -= time;
+            duration -= time;
+            if(blocks.front() == 0)
+            {
+                blocks.pop_front();
+                Planner::block_buffer_tail = BLOCK_MOD(Planner::block_buffer_tail + 1);
+            }
+        }
+    }
+
+    //! M303: the autotune loop of Marlin blocks the main loop, it only updates the graphs of the LCD.
+    void autotune(const std::string& command)
+    {
+        const float target = parameter(command, 'S', 200);
+        const int cycles = static_cast<int>(parameter(command, 'C', 5));
+
+        Temperature::target_temperature[0] = target;
+        const float heating_time = max(0.0f, (target - Temperature::current_temperature[0]) / HOTEND_HEATING_RATE);
+        const Time duration = static_cast<Time>(heating_time * SECOND) + cycles * AUTOTUNE_CYCLE_TIME;
+
+        for(Time time = 0; time < duration; time += AUTOTUNE_SLICE)
+        {
+            host::advance(AUTOTUNE_SLICE);
+            heat(AUTOTUNE_SLICE);
+            advi3pp::i3PlusPrinter::update_graph_data();
+        }
+
+        Temperature::target_temperature[0] = 0;
+        if(parameter(command, 'U', 0) > 0)
+        {
+            Temperature::Kp = DEFAULT_Kp * 1.1;
+            Temperature::Ki = (DEFAULT_Ki) * (PID_dT) * 1.1;
+            Temperature::Kd = (DEFAULT_Kd) / (PID_dT) * 1.1;
+        }
+        advi3pp::i3PlusPrinter::auto_pid_finished();
+    }
+
+    //! Start the execution of a command. Return false if it has to wait (planner full or busy).
+    bool start(const std::string& command)
+    {
+        const char letter = command[0];
+        const int code = atoi(command.c_str() + 1);
+
+        if(letter == 'G' && (code == 0 || code == 1))
+        {
+            if(planner.is_full())
+                return false;
+            float destination[NUM_AXIS];
+            for(uint8_t axis = 0; axis < NUM_AXIS; ++axis)
+            {
+                const char name = axis_codes[axis];
+                destination[axis] = has_parameter(command, name)
+                    ? parameter(command, name, 0) + (relative_mode ? current_position[axis] : 0)
+                    : current_position[axis];
+            }
+            if(has_parameter(command, 'F'))
+                feedrate = parameter(command, 'F', 0) / 60;
+            COPY(current_position, destination);
+            planner.buffer_line_kinematic(destination, feedrate, 0);
+        }
+        else if(letter == 'G' && code == 28)
+        {
+            if(planner.blocks_queued())
+                return false;
+            bool all = !has_parameter(command, 'X') && !has_parameter(command, 'Y') && !has_parameter(command, 'Z');
+            for(uint8_t axis = 0; axis < XYZ; ++axis)
+                if(all || has_parameter(command, axis_codes[axis]))
+                    homing_axes |= _BV(axis);
+            command_time = HOMING_TIME;
+        }
+        else if(letter == 'G' && code == 90)
+            relative_mode = false;
+        else if(letter == 'G' && code == 91)
+            relative_mode = true;
+        else if(letter == 'M' && code == 104)
+            thermalManager.setTargetHotend(parameter(command, 'S', 0), 0);
+        else if(letter == 'M' && code == 140)
+            thermalManager.setTargetBed(parameter(command, 'S', 0));
+        else if(letter == 'M' && code == 106)
+            fanSpeeds[0] = parameter(command, 'S', 255);
+        else if(letter == 'M' && code == 107)
+            fanSpeeds[0] = 0;
+        else if(letter == 'M' && code == 303)
+            autotune(command);
+        else if(letter == 'M' && code == 500)
+            settings.save();
+        else if(letter == 'M' && code == 502)
+            advi3pp::i3PlusPrinter::reset_presets();
+
+        executed_commands.push_back(command);
+        return true;
+    }
+
+    //! Decode a command of a script (see GCODE_SCRIPTS in gcode.h) into text.
+    const char* decode_script_command(const char* script, std::string& command)
+    {
+        static const uint8_t sizes[] = {0, 4, 4, 4, 2, 2, 2};
+        static const float scales[] = {1, 1, 1000, 100000, 1, 1000, 100000};
+
+        command = script[0];
+        command += std::to_string(static_cast<uint8_t>(script[1]) | static_cast<uint8_t>(script[2]) << 8);
+        script += 3;
+        while(static_cast<uint8_t>(*script) != 0xFF)
+        {
+            const uint8_t type = static_cast<uint8_t>(*script) >> 5;
+            command += ' ';
+            command += static_cast<char>('A' + (*script & 0x1F));
+            ++script;
+
+            int32_t value = 0;
+            for(uint8_t index = 0; index < sizes[type]; ++index)
+                value |= static_cast<int32_t>(static_cast<uint8_t>(*script++)) << (8 * index);
+            if(sizes[type] == 2)
+                value = static_cast<int16_t>(value);
+            if(sizes[type] > 0)
+            {
+                char buffer[32];
+                snprintf(buffer, sizeof(buffer), "%g", value / scales[type]);
+                command += buffer;
+            }
+        }
+        return script + 1;
+    }
+}
+
+//! Reset the state of the printer: empty queues, cold heaters and no file on the SD card.
+void reset()
+{
+    queue.clear();
+    scripts.clear();
+    blocks.clear();
+    executed_commands.clear();
+    command.clear();
+    command_time = 0;
+    homing_axes = 0;
+    commands_in_queue = 0;
+    Planner::block_buffer_head = Planner::block_buffer_tail = 0;
+    Temperature::current_temperature[0] = Temperature::current_temperature_bed = AMBIENT;
+    Temperature::target_temperature[0] = Temperature::target_temperature_bed = 0;
+}
+
+//! Let the printer run: heaters, planner and execution of the commands.
+//! @param duration     Duration of the run
+void run(Time duration)
+{
+    host::advance(duration);
+    heat(duration);
+    move(duration);
+
+    command_time = command_time > duration ? command_time - duration : 0;
+    if(command_time > 0)
+        return;
+    if(homing_axes)
+        homed();
+    if(!command.empty())
+    {
+        if(!start(command))
+            return;
+        command.clear();
+    }
+
+    while(command_time == 0 && (!scripts.empty() || !queue.empty()))
+    {
+        bool from_queue = scripts.empty() || (scripts.front().wait > 0 && !queue.empty());
+        command = from_queue ? queue.front() : scripts.front().command;
+        if(from_queue)
+        {
+            queue.pop_front();
+            for(auto& script_command: scripts)
+                if(script_command.wait > 0)
+                    --script_command.wait;
+        }
+        else
+            scripts.pop_front();
+        commands_in_queue = queue.size();
+
+        if(!start(command))
+            return;
+        command.clear();
+    }
+}
+
+void set_files(const std::vector<std::string>& names) { files = names; }
+const std::vector<std::string>& executed() { return executed_commands; }
+bool printing() { return card.sdprinting; }
+unsigned nb_saves() { return saves; }
+Time max_heater_management_gap() { return max_heater_gap; }
+
+void reset_heater_management()
+{
+    last_heater_management = max_heater_gap = 0;
+}
+
+}}
+
+using namespace lcd::model;
+
+// --------------------------------------------------------------------
+// Command queue
+// --------------------------------------------------------------------
+
+bool enqueue_and_echo_command(const char* cmd, bool)
+{
+    if(queue.size() >= BUFSIZE)
+        return false;
+    queue.push_back(cmd);
+    commands_in_queue = queue.size();
+    return true;
+}
+
+void enqueue_and_echo_commands_P(const char* const pgcode)
+{
+    std::string commands(pgcode);
+    for(size_t start = 0; start < commands.size();)
+    {
+        size_t end = commands.find('\n', start);
+        if(end == std::string::npos)
+            end = commands.size();
+        queue.push_back(commands.substr(start, end - start));
+        start = end + 1;
+    }
+    commands_in_queue = queue.size();
+}
+
+#if ENABLED(GCODE_SCRIPTS)
+
+bool enqueue_script_P(const char* const script)
+{
+    std::string command;
+    size_t wait = queue.size();
+    for(const char* p = script; *p != 0;)
+    {
+        p = decode_script_command(p, command);
+        scripts.push_back({command, wait});
+        wait = 0;
+    }
+    return true;
+}
+
+bool scripts_running()
+{
+    return !scripts.empty();
+}
+
+void clear_scripts()
+{
+    scripts.clear();
+}
+
+#endif
+
+void clear_command_queue()
+{
+    queue.clear();
+    commands_in_queue = 0;
+}
+
+void quickstop_stepper()
+{
+    blocks.clear();
+    Planner::block_buffer_tail = Planner::block_buffer_head;
+}
+
+void clamp_to_software_endstops(float target[XYZ])
+{
+    NOLESS(target[X_AXIS], X_MIN_POS); NOMORE(target[X_AXIS], X_MAX_POS);
+    NOLESS(target[Y_AXIS], Y_MIN_POS); NOMORE(target[Y_AXIS], Y_MAX_POS);
+    NOLESS(target[Z_AXIS], Z_MIN_POS); NOMORE(target[Z_AXIS], Z_MAX_POS);
+}
+
+// --------------------------------------------------------------------
+// Heaters, planner and settings
+// --------------------------------------------------------------------
+
+Temperature::Temperature() {}
+Planner::Planner() {}
+
+//! The temperatures are updated by run(). The blocking waits of the ADVi3++ layer call this: only record when.
+void Temperature::manage_heater()
+{
+    const Time now = host::now();
+    if(last_heater_management > 0)
+        NOLESS(max_heater_gap, now - last_heater_management);
+    last_heater_management = now;
+}
+
+void Temperature::start_watching_heater(uint8_t) {}
+void Temperature::start_watching_bed() {}
+
+void Temperature::disable_all_heaters()
+{
+    target_temperature[0] = 0;
+    target_temperature_bed = 0;
+}
+
+void Planner::_buffer_line(const float &a, const float &b, const float &c, const float &e, float fr_mm_s, const uint8_t)
+{
+    const float target[NUM_AXIS] = { a, b, c, e };
+    float distance = 0;
+    for(uint8_t axis = 0; axis < NUM_AXIS; ++axis)
+    {
+        distance += sq(target[axis] - planner_position[axis]);
+        planner_position[axis] = target[axis];
+    }
+    distance = sqrt(distance);
+
+    blocks.push_back(static_cast<Time>(distance / max(fr_mm_s, 0.1f) * SECOND) + 1);
+    block_buffer_head = BLOCK_MOD(block_buffer_head + 1);
+}
+
+bool MarlinSettings::save()
+{
+    ++saves;
+    return true;
+}
+
+// --------------------------------------------------------------------
+// SD card
+// --------------------------------------------------------------------
+
+size_t SdFile::write(uint8_t) { return 0; }
+bool SdBaseFile::close() { return true; }
+
+CardReader::CardReader()
+{
+    sdprinting = cardOK = saving = logging = false;
+}
+
+void CardReader::initsd()
+{
+    cardOK = !files.empty();
+}
+
+uint16_t CardReader::getnrfilenames()
+{
+    return files.size();
+}
+
+void CardReader::getfilename(uint16_t nr, const char* const)
+{
+    snprintf(filename, sizeof(filename), "FILE%04u.GCO", static_cast<unsigned>(nr % 10000));
+    snprintf(longFilename, sizeof(longFilename), "%s", nr < files.size() ? files[nr].c_str() : "");
+}
+
+void CardReader::openFile(char* name, bool, bool)
+{
+    executed_commands.push_back(std::string("open ") + name);
+}
+
+void CardReader::startFileprint()
+{
+    if(cardOK)
+        sdprinting = true;
+}
+
+void CardReader::stopSDPrint()
+{
+    sdprinting = false;
+}
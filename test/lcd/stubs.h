@@ -0,0 +1,35 @@
+/**
+ * Stubs of Marlin for the host build of the ADVi3++ layer.
+ *
+ * The command queue, the heaters (thermalManager), the planner and the SD
+ * card (card) are replaced by a simple model of the printer. Commands are
+ * executed one at a time and take time (moves at their feedrate, homing...)
+ * and the temperatures follow their targets.
+ */
+#ifndef LCD_STUBS_H
+#define LCD_STUBS_H
+
+#include <string>
+#include <vector>
+
+#include "../hal/host.h"
+
+namespace lcd {
+
+namespace model {
+
+void reset();
+void run(host::Time duration);
+
+void set_files(const std::vector<std::string>& names);
+const std::vector<std::string>& executed();
+bool printing();
+unsigned nb_saves();
+host::Time max_heater_management_gap();
+void reset_heater_management();
+
+}
+
+}
+
+#endif // LCD_STUBS_H
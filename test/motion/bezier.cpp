@@ -0,0 +1,101 @@
+/**
+ * Accuracy of the S-curve of the stepper ISR (S_CURVE_ACCELERATION).
+ *
+ * Random blocks go through Planner::calculate_trapezoid_for_block(), then
+ * their acceleration and deceleration curves are evaluated by
+ * Stepper::_eval_bezier_curve() along the whole ramp, as the ISR does, and
+ * compared with the exact curve (v1 - v0) * (10t³ - 15t⁴ + 6t⁵). The
+ * rates must stay within 0.04% of the change of rate (plus the rounding
+ * to a step/s) and must never go backwards.
+ *
+ * On the AVR, MultiU24X32toH16 drops the low bytes of the product and may
+ * be off by one more unit of t (1/65536), which is below the tolerance.
+ *
+ * The exit status is not 0 if a rate is out of the tolerance.
+ */
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <random>
+
+#include "../../Marlin/Marlin.h"
+// The curve of the stepper and the trapezoids of the planner are private
+#define private public
+#include "../../Marlin/planner.h"
+#include "../../Marlin/stepper.h"
+#undef private
+
+#if DISABLED(S_CURVE_ACCELERATION)
+    #error "This test evaluates the stepper built with S_CURVE_ACCELERATION"
+#endif
+
+namespace
+{
+    const unsigned NB_BLOCKS = 20000;
+    const unsigned MAX_POINTS = 100;            //!< Evaluations per ramp, evenly spaced
+    const double TOLERANCE = 0.0004;            //!< Of the change of rate
+    const double ROUNDING = 1;                  //!< step/s
+    const uint16_t LARGE_CHANGE = 10000;         //!< step/s, the rounding is not counted in the error
+
+    std::mt19937_64 rng{20171016};
+
+    uint32_t uniform(uint32_t min, uint32_t max) { return std::uniform_int_distribution<uint32_t>{min, max}(rng); }
+
+    unsigned nb_points = 0, nb_ramps = 0, nb_linear_ramps = 0, nb_failures = 0;
+    double max_error = 0;                       //!< Relative to the large changes of rate
+
+    //! Evaluate a ramp of the block along its duration, as the stepper ISR does.
+    void check_ramp(uint16_t delta, uint32_t duration, uint32_t inverse)
+    {
+        if(duration == 0)
+        {
+            ++nb_linear_ramps;
+            return;
+        }
+        ++nb_ramps;
+
+        Stepper::_calc_bezier_curve_coeffs(delta, inverse);
+        const uint32_t stride = duration / MAX_POINTS + 1;
+        uint16_t previous = 0;
+        for(uint32_t time = 0; time < duration; time += stride)
+        {
+            const uint16_t rate = Stepper::_eval_bezier_curve(time);
+            const double t = static_cast<double>(time) / duration,
+                         exact = delta * t * t * t * (10 - 15 * t + 6 * t * t),
+                         error = fabs(rate - exact);
+            ++nb_points;
+            if(delta >= LARGE_CHANGE)
+                max_error = fmax(max_error, error / delta);
+            if((error > delta * TOLERANCE + ROUNDING || rate < previous) && nb_failures++ < 10)
+                printf("    FAILED: change %u in %u ticks, at %u: %u instead of %.1f (previous %u)\n",
+                       delta, duration, time, rate, exact, previous);
+            previous = rate;
+        }
+    }
+}
+
+int main()
+{
+    for(unsigned index = 0; index < NB_BLOCKS; ++index)
+    {
+        block_t block{};
+        block.nominal_rate = uniform(1000, 65535);
+        block.acceleration_steps_per_s2 = uniform(100, 400000);
+        block.acceleration_rate = static_cast<uint32_t>(block.acceleration_steps_per_s2 * 16777216.0 / ((F_CPU) * 0.125));
+        block.step_event_count = uniform(1, uniform(0, 1) ? 200 : 100000);
+        const float entry_factor = uniform(120, block.nominal_rate) / static_cast<float>(block.nominal_rate),
+                    exit_factor = uniform(120, block.nominal_rate) / static_cast<float>(block.nominal_rate);
+        Planner::calculate_trapezoid_for_block(&block, entry_factor, exit_factor);
+
+        check_ramp(block.cruise_rate - block.initial_rate, block.acceleration_time, block.acceleration_time_inverse);
+        check_ramp(block.cruise_rate - block.final_rate, block.deceleration_time, block.deceleration_time_inverse);
+    }
+
+    printf("s-curve: %u ramps (%u linear), %u points, error up to %.4f%% of the changes of %u steps/s or more\n",
+           nb_ramps, nb_linear_ramps, nb_points, max_error * 100, LARGE_CHANGE);
+    printf("    %s\n", nb_failures == 0 ? "OK" : "FAILED");
+
+    // As on the printer, the objects of the firmware are never destroyed (some are cleared with memset)
+    fflush(stdout);
+    _Exit(nb_failures == 0 ? 0 : 1);
+}
@@ -0,0 +1,1923 @@
+; Collinear short segments for the motion replay: 3 layers of a 40 mm square with
+; sides split into 0.1 to 0.4 mm segments, as sliced from the facets of an STL file
+M302 P1 ; no heating
+G21
+G90
+M82
+G28
+G92 E0
+;LAYER:0
+G1 Z0.30 F600
+G0 X80.000 Y80.000 F7800
+G1 F1800
+G1 X80.315 Y79.999 E0.01049
+G1 X80.712 Y80.001 E0.02371
+G1 X80.842 Y79.999 E0.02803
+G1 X81.154 Y80.001 E0.03842
+G1 X81.387 Y80.002 E0.04617
+G1 X81.520 Y80.002 E0.05061
+G1 X81.841 Y79.999 E0.06132
+G1 X82.226 Y80.001 E0.07412
+G1 X82.579 Y79.999 E0.08588
+G1 X82.772 Y79.999 E0.09232
+G1 X83.142 Y79.999 E0.10462
+G1 X83.507 Y79.998 E0.11678
+G1 X83.809 Y80.001 E0.12685
+G1 X84.207 Y79.999 E0.14010
+G1 X84.530 Y79.998 E0.15086
+G1 X84.775 Y79.999 E0.15903
+G1 X85.021 Y80.002 E0.16722
+G1 X85.160 Y80.002 E0.17184
+G1 X85.490 Y79.999 E0.18281
+G1 X85.778 Y80.001 E0.19241
+G1 X86.073 Y80.001 E0.20224
+G1 X86.294 Y80.001 E0.20961
+G1 X86.468 Y80.000 E0.21540
+G1 X86.702 Y79.999 E0.22317
+G1 X86.910 Y80.000 E0.23010
+G1 X87.105 Y80.001 E0.23660
+G1 X87.218 Y80.001 E0.24038
+G1 X87.560 Y80.000 E0.25176
+G1 X87.782 Y79.999 E0.25916
+G1 X87.973 Y79.999 E0.26550
+G1 X88.347 Y80.001 E0.27796
+G1 X88.450 Y80.000 E0.28139
+G1 X88.758 Y80.001 E0.29166
+G1 X89.129 Y80.000 E0.30401
+G1 X89.458 Y80.001 E0.31494
+G1 X89.675 Y80.000 E0.32220
+G1 X89.799 Y80.001 E0.32631
+G1 X90.058 Y79.999 E0.33495
+G1 X90.289 Y79.998 E0.34263
+G1 X90.636 Y80.002 E0.35418
+G1 X90.906 Y79.998 E0.36316
+G1 X91.278 Y79.998 E0.37557
+G1 X91.430 Y80.000 E0.38064
+G1 X91.557 Y80.000 E0.38484
+G1 X91.866 Y80.001 E0.39513
+G1 X92.103 Y80.000 E0.40305
+G1 X92.501 Y80.001 E0.41629
+G1 X92.701 Y79.999 E0.42294
+G1 X92.843 Y79.999 E0.42769
+G1 X93.202 Y80.000 E0.43962
+G1 X93.377 Y80.001 E0.44545
+G1 X93.662 Y79.999 E0.45494
+G1 X93.839 Y79.999 E0.46086
+G1 X94.236 Y80.000 E0.47405
+G1 X94.439 Y80.001 E0.48081
+G1 X94.582 Y79.999 E0.48560
+G1 X94.930 Y79.999 E0.49719
+G1 X95.099 Y80.001 E0.50280
+G1 X95.423 Y79.999 E0.51360
+G1 X95.597 Y80.000 E0.51939
+G1 X95.976 Y80.001 E0.53202
+G1 X96.250 Y79.999 E0.54112
+G1 X96.418 Y80.002 E0.54672
+G1 X96.668 Y79.998 E0.55507
+G1 X96.904 Y79.999 E0.56292
+G1 X97.137 Y79.999 E0.57068
+G1 X97.270 Y80.002 E0.57509
+G1 X97.630 Y80.001 E0.58710
+G1 X97.981 Y79.999 E0.59878
+G1 X98.140 Y80.001 E0.60408
+G1 X98.302 Y79.998 E0.60947
+G1 X98.654 Y80.000 E0.62118
+G1 X98.936 Y79.999 E0.63059
+G1 X99.191 Y80.001 E0.63907
+G1 X99.342 Y79.999 E0.64409
+G1 X99.625 Y79.998 E0.65353
+G1 X99.867 Y80.000 E0.66157
+G1 X100.116 Y80.000 E0.66988
+G1 X100.488 Y80.001 E0.68227
+G1 X100.691 Y80.001 E0.68901
+G1 X100.826 Y79.999 E0.69353
+G1 X101.108 Y80.002 E0.70292
+G1 X101.266 Y80.000 E0.70818
+G1 X101.659 Y80.000 E0.72125
+G1 X101.872 Y80.000 E0.72837
+G1 X102.066 Y80.001 E0.73482
+G1 X102.365 Y80.001 E0.74478
+G1 X102.628 Y79.998 E0.75354
+G1 X102.812 Y80.000 E0.75967
+G1 X103.063 Y80.000 E0.76802
+G1 X103.385 Y80.001 E0.77874
+G1 X103.756 Y79.999 E0.79109
+G1 X103.968 Y80.001 E0.79815
+G1 X104.251 Y79.999 E0.80758
+G1 X104.549 Y79.999 E0.81750
+G1 X104.939 Y80.002 E0.83050
+G1 X105.229 Y80.001 E0.84013
+G1 X105.386 Y80.001 E0.84538
+G1 X105.617 Y80.001 E0.85308
+G1 X105.899 Y80.000 E0.86246
+G1 X106.082 Y79.999 E0.86854
+G1 X106.399 Y79.999 E0.87912
+G1 X106.501 Y79.999 E0.88249
+G1 X106.758 Y79.999 E0.89106
+G1 X106.935 Y80.001 E0.89694
+G1 X107.268 Y79.999 E0.90805
+G1 X107.463 Y80.001 E0.91453
+G1 X107.859 Y80.001 E0.92771
+G1 X108.141 Y79.998 E0.93711
+G1 X108.251 Y80.002 E0.94078
+G1 X108.644 Y80.000 E0.95388
+G1 X109.008 Y80.001 E0.96600
+G1 X109.289 Y80.000 E0.97534
+G1 X109.435 Y79.999 E0.98022
+G1 X109.835 Y79.998 E0.99351
+G1 X110.159 Y80.000 E1.00431
+G1 X110.538 Y80.002 E1.01694
+G1 X110.935 Y79.998 E1.03015
+G1 X111.111 Y80.000 E1.03602
+G1 X111.483 Y80.002 E1.04840
+G1 X111.758 Y79.998 E1.05756
+G1 X111.964 Y80.001 E1.06443
+G1 X112.269 Y80.001 E1.07457
+G1 X112.473 Y80.002 E1.08138
+G1 X112.775 Y80.002 E1.09144
+G1 X113.135 Y80.002 E1.10344
+G1 X113.352 Y80.000 E1.11063
+G1 X113.577 Y79.998 E1.11815
+G1 X113.946 Y80.000 E1.13041
+G1 X114.326 Y80.000 E1.14309
+G1 X114.726 Y79.999 E1.15641
+G1 X115.014 Y80.001 E1.16600
+G1 X115.293 Y80.001 E1.17528
+G1 X115.423 Y80.001 E1.17961
+G1 X115.788 Y79.999 E1.19177
+G1 X116.108 Y80.000 E1.20242
+G1 X116.279 Y79.999 E1.20811
+G1 X116.526 Y80.001 E1.21634
+G1 X116.686 Y80.002 E1.22169
+G1 X116.904 Y80.001 E1.22892
+G1 X117.102 Y80.002 E1.23551
+G1 X117.322 Y79.999 E1.24284
+G1 X117.721 Y80.000 E1.25614
+G1 X117.896 Y79.999 E1.26195
+G1 X118.015 Y80.000 E1.26592
+G1 X118.327 Y80.001 E1.27633
+G1 X118.468 Y79.999 E1.28103
+G1 X118.657 Y80.000 E1.28729
+G1 X119.010 Y79.999 E1.29906
+G1 X119.289 Y80.002 E1.30836
+G1 X119.421 Y79.998 E1.31276
+G1 X119.613 Y79.998 E1.31914
+G1 X119.896 Y79.999 E1.32856
+G1 X120.000 Y80.000 E1.33203
+G1 X120.002 Y80.318 E1.34264
+G1 X120.000 Y80.605 E1.35218
+G1 X119.998 Y80.743 E1.35677
+G1 X119.999 Y80.927 E1.36291
+G1 X120.001 Y81.073 E1.36775
+G1 X119.998 Y81.281 E1.37470
+G1 X120.002 Y81.478 E1.38126
+G1 X120.000 Y81.757 E1.39053
+G1 X119.998 Y82.109 E1.40226
+G1 X120.001 Y82.428 E1.41290
+G1 X120.001 Y82.827 E1.42618
+G1 X120.001 Y82.995 E1.43176
+G1 X119.998 Y83.278 E1.44120
+G1 X120.000 Y83.554 E1.45037
+G1 X119.998 Y83.887 E1.46149
+G1 X120.001 Y83.991 E1.46492
+G1 X120.001 Y84.094 E1.46836
+G1 X120.001 Y84.303 E1.47533
+G1 X120.002 Y84.654 E1.48703
+G1 X119.998 Y84.826 E1.49274
+G1 X120.002 Y85.106 E1.50207
+G1 X119.999 Y85.422 E1.51261
+G1 X120.001 Y85.649 E1.52017
+G1 X120.000 Y86.042 E1.53325
+G1 X120.001 Y86.402 E1.54521
+G1 X120.001 Y86.637 E1.55304
+G1 X120.000 Y86.895 E1.56165
+G1 X119.999 Y87.102 E1.56853
+G1 X119.999 Y87.397 E1.57835
+G1 X120.000 Y87.616 E1.58565
+G1 X120.001 Y87.909 E1.59541
+G1 X120.001 Y88.030 E1.59944
+G1 X120.002 Y88.229 E1.60607
+G1 X120.001 Y88.365 E1.61060
+G1 X119.998 Y88.661 E1.62046
+G1 X120.000 Y88.944 E1.62988
+G1 X119.999 Y89.068 E1.63402
+G1 X119.998 Y89.435 E1.64623
+G1 X120.000 Y89.819 E1.65901
+G1 X120.002 Y90.104 E1.66849
+G1 X119.999 Y90.421 E1.67907
+G1 X120.000 Y90.630 E1.68601
+G1 X119.998 Y90.775 E1.69086
+G1 X120.001 Y91.070 E1.70068
+G1 X120.000 Y91.385 E1.71117
+G1 X119.999 Y91.772 E1.72405
+G1 X119.999 Y91.926 E1.72918
+G1 X119.999 Y92.116 E1.73550
+G1 X120.001 Y92.412 E1.74535
+G1 X120.001 Y92.784 E1.75776
+G1 X119.999 Y93.158 E1.77022
+G1 X120.000 Y93.433 E1.77936
+G1 X120.001 Y93.563 E1.78370
+G1 X120.001 Y93.768 E1.79051
+G1 X120.000 Y93.904 E1.79505
+G1 X119.999 Y94.170 E1.80392
+G1 X120.001 Y94.548 E1.81651
+G1 X120.001 Y94.725 E1.82237
+G1 X120.000 Y94.863 E1.82699
+G1 X120.000 Y95.192 E1.83795
+G1 X120.001 Y95.558 E1.85013
+G1 X119.998 Y95.890 E1.86119
+G1 X120.000 Y96.252 E1.87325
+G1 X120.002 Y96.420 E1.87882
+G1 X120.002 Y96.818 E1.89210
+G1 X119.999 Y97.176 E1.90402
+G1 X120.000 Y97.290 E1.90782
+G1 X120.002 Y97.473 E1.91391
+G1 X120.001 Y97.588 E1.91774
+G1 X120.000 Y97.972 E1.93051
+G1 X120.000 Y98.303 E1.94153
+G1 X120.000 Y98.554 E1.94989
+G1 X119.999 Y98.838 E1.95935
+G1 X119.998 Y98.954 E1.96320
+G1 X120.002 Y99.171 E1.97043
+G1 X120.001 Y99.519 E1.98204
+G1 X120.001 Y99.872 E1.99379
+G1 X120.001 Y100.119 E2.00200
+G1 X119.998 Y100.296 E2.00791
+G1 X119.999 Y100.431 E2.01240
+G1 X120.002 Y100.743 E2.02280
+G1 X120.000 Y101.054 E2.03316
+G1 X120.000 Y101.373 E2.04379
+G1 X120.002 Y101.725 E2.05550
+G1 X119.999 Y101.832 E2.05907
+G1 X119.999 Y102.081 E2.06736
+G1 X119.998 Y102.315 E2.07515
+G1 X120.002 Y102.685 E2.08746
+G1 X120.000 Y102.837 E2.09252
+G1 X119.998 Y102.996 E2.09782
+G1 X119.999 Y103.316 E2.10846
+G1 X119.999 Y103.563 E2.11669
+G1 X119.999 Y103.808 E2.12487
+G1 X119.999 Y104.059 E2.13323
+G1 X120.002 Y104.268 E2.14019
+G1 X119.999 Y104.605 E2.15138
+G1 X120.001 Y104.956 E2.16310
+G1 X119.999 Y105.325 E2.17539
+G1 X120.001 Y105.684 E2.18732
+G1 X120.001 Y105.885 E2.19401
+G1 X119.999 Y106.198 E2.20445
+G1 X119.998 Y106.539 E2.21580
+G1 X120.001 Y106.931 E2.22885
+G1 X120.001 Y107.051 E2.23286
+G1 X120.001 Y107.217 E2.23839
+G1 X120.001 Y107.615 E2.25163
+G1 X119.999 Y107.728 E2.25539
+G1 X119.999 Y107.910 E2.26147
+G1 X120.001 Y108.229 E2.27208
+G1 X120.000 Y108.480 E2.28044
+G1 X119.999 Y108.807 E2.29132
+G1 X120.002 Y108.999 E2.29772
+G1 X120.002 Y109.238 E2.30568
+G1 X119.999 Y109.585 E2.31723
+G1 X120.001 Y109.732 E2.32213
+G1 X120.000 Y110.105 E2.33454
+G1 X119.999 Y110.287 E2.34061
+G1 X119.999 Y110.528 E2.34863
+G1 X119.998 Y110.862 E2.35976
+G1 X120.000 Y111.242 E2.37242
+G1 X120.001 Y111.516 E2.38153
+G1 X120.000 Y111.809 E2.39129
+G1 X120.002 Y111.945 E2.39583
+G1 X119.999 Y112.077 E2.40022
+G1 X120.001 Y112.288 E2.40726
+G1 X120.000 Y112.467 E2.41320
+G1 X120.000 Y112.736 E2.42218
+G1 X120.001 Y112.970 E2.42996
+G1 X120.001 Y113.368 E2.44321
+G1 X120.002 Y113.659 E2.45292
+G1 X120.000 Y113.851 E2.45929
+G1 X119.999 Y114.082 E2.46699
+G1 X119.998 Y114.477 E2.48013
+G1 X119.999 Y114.767 E2.48979
+G1 X120.001 Y114.872 E2.49331
+G1 X120.001 Y115.152 E2.50263
+G1 X120.002 Y115.357 E2.50945
+G1 X119.998 Y115.520 E2.51489
+G1 X120.000 Y115.684 E2.52035
+G1 X120.000 Y115.819 E2.52485
+G1 X120.002 Y116.044 E2.53231
+G1 X120.001 Y116.341 E2.54222
+G1 X120.002 Y116.568 E2.54976
+G1 X120.001 Y116.950 E2.56248
+G1 X120.000 Y117.052 E2.56590
+G1 X119.998 Y117.285 E2.57367
+G1 X120.001 Y117.570 E2.58315
+G1 X120.000 Y117.882 E2.59353
+G1 X120.000 Y118.049 E2.59911
+G1 X120.000 Y118.406 E2.61097
+G1 X120.001 Y118.726 E2.62163
+G1 X119.998 Y119.103 E2.63420
+G1 X120.001 Y119.469 E2.64639
+G1 X119.998 Y119.659 E2.65271
+G1 X120.002 Y119.793 E2.65717
+G1 X120.000 Y120.000 E2.66407
+G1 X119.885 Y120.000 E2.66789
+G1 X119.548 Y119.998 E2.67913
+G1 X119.358 Y119.999 E2.68546
+G1 X119.148 Y120.001 E2.69246
+G1 X118.917 Y120.000 E2.70013
+G1 X118.636 Y119.999 E2.70948
+G1 X118.520 Y120.001 E2.71336
+G1 X118.155 Y120.000 E2.72551
+G1 X117.901 Y120.000 E2.73397
+G1 X117.626 Y119.998 E2.74314
+G1 X117.476 Y120.000 E2.74814
+G1 X117.244 Y120.002 E2.75586
+G1 X117.037 Y120.000 E2.76273
+G1 X116.807 Y120.000 E2.77041
+G1 X116.497 Y120.001 E2.78073
+G1 X116.329 Y120.000 E2.78632
+G1 X116.048 Y119.999 E2.79567
+G1 X115.858 Y120.000 E2.80199
+G1 X115.730 Y120.000 E2.80626
+G1 X115.461 Y120.000 E2.81521
+G1 X115.096 Y119.999 E2.82738
+G1 X114.987 Y120.000 E2.83102
+G1 X114.694 Y119.998 E2.84075
+G1 X114.460 Y119.999 E2.84856
+G1 X114.142 Y120.001 E2.85914
+G1 X113.849 Y120.000 E2.86890
+G1 X113.656 Y120.002 E2.87533
+G1 X113.514 Y119.999 E2.88007
+G1 X113.245 Y120.000 E2.88902
+G1 X112.936 Y120.000 E2.89930
+G1 X112.660 Y119.998 E2.90849
+G1 X112.338 Y120.002 E2.91923
+G1 X111.976 Y120.002 E2.93128
+G1 X111.773 Y119.999 E2.93804
+G1 X111.496 Y119.999 E2.94727
+G1 X111.320 Y120.000 E2.95312
+G1 X111.046 Y120.002 E2.96224
+G1 X110.679 Y119.999 E2.97447
+G1 X110.566 Y119.998 E2.97822
+G1 X110.411 Y120.002 E2.98339
+G1 X110.155 Y120.001 E2.99191
+G1 X110.016 Y120.000 E2.99653
+G1 X109.779 Y119.998 E3.00442
+G1 X109.486 Y120.000 E3.01420
+G1 X109.283 Y120.000 E3.02096
+G1 X108.924 Y119.998 E3.03292
+G1 X108.781 Y119.998 E3.03766
+G1 X108.482 Y120.001 E3.04763
+G1 X108.216 Y120.002 E3.05649
+G1 X108.013 Y119.998 E3.06324
+G1 X107.898 Y120.001 E3.06706
+G1 X107.749 Y120.001 E3.07203
+G1 X107.370 Y120.000 E3.08466
+G1 X107.090 Y120.002 E3.09398
+G1 X106.933 Y120.002 E3.09920
+G1 X106.656 Y120.000 E3.10842
+G1 X106.334 Y120.000 E3.11916
+G1 X106.213 Y119.999 E3.12317
+G1 X106.022 Y120.000 E3.12955
+G1 X105.799 Y120.000 E3.13698
+G1 X105.695 Y120.001 E3.14043
+G1 X105.344 Y120.000 E3.15214
+G1 X105.047 Y120.000 E3.16200
+G1 X104.772 Y119.999 E3.17117
+G1 X104.666 Y120.000 E3.17472
+G1 X104.497 Y120.000 E3.18032
+G1 X104.372 Y120.002 E3.18450
+G1 X104.077 Y120.001 E3.19432
+G1 X103.935 Y119.999 E3.19903
+G1 X103.762 Y120.000 E3.20479
+G1 X103.539 Y119.998 E3.21224
+G1 X103.398 Y119.999 E3.21691
+G1 X103.288 Y120.000 E3.22060
+G1 X103.013 Y119.999 E3.22975
+G1 X102.707 Y119.999 E3.23993
+G1 X102.571 Y119.998 E3.24446
+G1 X102.413 Y120.001 E3.24973
+G1 X102.268 Y120.001 E3.25457
+G1 X101.995 Y120.002 E3.26365
+G1 X101.726 Y120.002 E3.27262
+G1 X101.392 Y120.000 E3.28373
+G1 X100.995 Y119.999 E3.29696
+G1 X100.875 Y120.001 E3.30093
+G1 X100.660 Y120.000 E3.30811
+G1 X100.555 Y119.998 E3.31159
+G1 X100.168 Y120.000 E3.32450
+G1 X99.924 Y120.002 E3.33261
+G1 X99.601 Y119.999 E3.34336
+G1 X99.424 Y120.000 E3.34927
+G1 X99.296 Y120.002 E3.35354
+G1 X99.190 Y119.999 E3.35706
+G1 X98.953 Y120.000 E3.36496
+G1 X98.695 Y119.999 E3.37353
+G1 X98.553 Y119.998 E3.37827
+G1 X98.187 Y119.999 E3.39047
+G1 X97.880 Y120.002 E3.40069
+G1 X97.680 Y119.998 E3.40734
+G1 X97.429 Y120.001 E3.41570
+G1 X97.077 Y119.998 E3.42741
+G1 X96.881 Y119.999 E3.43395
+G1 X96.708 Y120.001 E3.43971
+G1 X96.447 Y120.001 E3.44842
+G1 X96.199 Y119.999 E3.45665
+G1 X96.042 Y120.000 E3.46189
+G1 X95.730 Y119.999 E3.47229
+G1 X95.462 Y119.999 E3.48121
+G1 X95.186 Y120.001 E3.49039
+G1 X94.839 Y120.000 E3.50195
+G1 X94.568 Y120.002 E3.51099
+G1 X94.361 Y120.001 E3.51786
+G1 X94.082 Y120.000 E3.52715
+G1 X93.695 Y119.998 E3.54004
+G1 X93.497 Y119.999 E3.54664
+G1 X93.323 Y119.999 E3.55244
+G1 X93.020 Y119.999 E3.56252
+G1 X92.679 Y120.001 E3.57389
+G1 X92.364 Y120.000 E3.58436
+G1 X92.010 Y119.999 E3.59616
+G1 X91.611 Y120.000 E3.60943
+G1 X91.450 Y120.000 E3.61481
+G1 X91.215 Y120.001 E3.62263
+G1 X90.826 Y119.999 E3.63558
+G1 X90.438 Y120.001 E3.64852
+G1 X90.216 Y120.002 E3.65590
+G1 X90.015 Y119.999 E3.66259
+G1 X89.643 Y119.998 E3.67497
+G1 X89.474 Y119.999 E3.68060
+G1 X89.326 Y120.000 E3.68553
+G1 X89.037 Y119.999 E3.69515
+G1 X88.799 Y120.000 E3.70308
+G1 X88.477 Y120.001 E3.71380
+G1 X88.259 Y120.000 E3.72108
+G1 X87.869 Y119.998 E3.73407
+G1 X87.618 Y120.001 E3.74242
+G1 X87.261 Y119.999 E3.75430
+G1 X86.872 Y119.998 E3.76727
+G1 X86.659 Y120.002 E3.77435
+G1 X86.379 Y119.998 E3.78368
+G1 X86.186 Y119.999 E3.79011
+G1 X86.068 Y119.998 E3.79404
+G1 X85.956 Y120.000 E3.79777
+G1 X85.666 Y119.999 E3.80743
+G1 X85.382 Y120.002 E3.81688
+G1 X85.095 Y119.999 E3.82642
+G1 X84.933 Y120.000 E3.83183
+G1 X84.564 Y120.002 E3.84412
+G1 X84.387 Y120.002 E3.85003
+G1 X83.993 Y119.999 E3.86315
+G1 X83.780 Y120.000 E3.87021
+G1 X83.462 Y119.999 E3.88082
+G1 X83.224 Y120.002 E3.88874
+G1 X83.004 Y120.001 E3.89607
+G1 X82.648 Y119.999 E3.90793
+G1 X82.251 Y120.001 E3.92115
+G1 X81.977 Y120.000 E3.93025
+G1 X81.660 Y119.998 E3.94084
+G1 X81.349 Y119.998 E3.95119
+G1 X81.064 Y120.001 E3.96068
+G1 X80.738 Y119.999 E3.97153
+G1 X80.403 Y120.000 E3.98267
+G1 X80.000 Y120.000 E3.99610
+G1 X80.001 Y119.611 E4.00905
+G1 X79.998 Y119.383 E4.01666
+G1 X80.000 Y119.048 E4.02780
+G1 X80.000 Y118.799 E4.03609
+G1 X80.000 Y118.563 E4.04397
+G1 X79.999 Y118.329 E4.05173
+G1 X80.002 Y118.140 E4.05804
+G1 X80.002 Y117.784 E4.06988
+G1 X80.000 Y117.565 E4.07719
+G1 X80.000 Y117.343 E4.08459
+G1 X80.000 Y117.031 E4.09496
+G1 X79.999 Y116.694 E4.10620
+G1 X80.000 Y116.543 E4.11121
+G1 X80.002 Y116.335 E4.11814
+G1 X80.002 Y115.937 E4.13140
+G1 X80.001 Y115.588 E4.14304
+G1 X80.002 Y115.217 E4.15539
+G1 X80.001 Y114.880 E4.16661
+G1 X79.999 Y114.515 E4.17875
+G1 X80.000 Y114.257 E4.18734
+G1 X80.002 Y114.011 E4.19555
+G1 X80.001 Y113.732 E4.20483
+G1 X79.999 Y113.367 E4.21698
+G1 X79.998 Y113.091 E4.22617
+G1 X80.001 Y112.920 E4.23187
+G1 X79.999 Y112.713 E4.23876
+G1 X80.000 Y112.577 E4.24329
+G1 X80.000 Y112.277 E4.25327
+G1 X79.999 Y111.880 E4.26651
+G1 X79.999 Y111.586 E4.27629
+G1 X80.001 Y111.225 E4.28832
+G1 X79.999 Y111.117 E4.29192
+G1 X80.000 Y110.870 E4.30012
+G1 X80.000 Y110.484 E4.31300
+G1 X80.002 Y110.143 E4.32435
+G1 X80.000 Y109.843 E4.33434
+G1 X80.000 Y109.473 E4.34665
+G1 X80.000 Y109.086 E4.35956
+G1 X79.999 Y108.973 E4.36330
+G1 X79.999 Y108.761 E4.37037
+G1 X80.000 Y108.544 E4.37760
+G1 X80.000 Y108.367 E4.38349
+G1 X79.998 Y108.082 E4.39296
+G1 X79.998 Y107.966 E4.39684
+G1 X79.999 Y107.778 E4.40311
+G1 X80.002 Y107.560 E4.41037
+G1 X80.001 Y107.312 E4.41861
+G1 X80.001 Y107.186 E4.42281
+G1 X80.002 Y106.963 E4.43024
+G1 X80.000 Y106.836 E4.43448
+G1 X79.999 Y106.510 E4.44534
+G1 X80.000 Y106.369 E4.45001
+G1 X80.001 Y106.092 E4.45924
+G1 X80.002 Y105.955 E4.46382
+G1 X80.001 Y105.827 E4.46808
+G1 X79.999 Y105.703 E4.47221
+G1 X80.001 Y105.355 E4.48378
+G1 X79.998 Y105.185 E4.48944
+G1 X79.999 Y104.984 E4.49615
+G1 X79.999 Y104.830 E4.50127
+G1 X79.999 Y104.630 E4.50794
+G1 X80.000 Y104.361 E4.51690
+G1 X80.001 Y104.233 E4.52116
+G1 X80.002 Y104.121 E4.52488
+G1 X79.999 Y103.846 E4.53405
+G1 X80.000 Y103.528 E4.54462
+G1 X80.001 Y103.363 E4.55014
+G1 X80.002 Y103.057 E4.56031
+G1 X80.001 Y102.789 E4.56923
+G1 X80.001 Y102.558 E4.57691
+G1 X80.000 Y102.298 E4.58557
+G1 X80.001 Y102.041 E4.59413
+G1 X80.000 Y101.779 E4.60287
+G1 X80.001 Y101.403 E4.61540
+G1 X80.002 Y101.276 E4.61961
+G1 X80.001 Y101.048 E4.62722
+G1 X80.000 Y100.767 E4.63657
+G1 X79.999 Y100.406 E4.64859
+G1 X79.999 Y100.297 E4.65224
+G1 X79.999 Y100.162 E4.65672
+G1 X80.001 Y99.829 E4.66781
+G1 X80.002 Y99.564 E4.67662
+G1 X80.000 Y99.411 E4.68174
+G1 X80.001 Y99.213 E4.68831
+G1 X79.999 Y98.852 E4.70034
+G1 X80.002 Y98.534 E4.71092
+G1 X80.001 Y98.162 E4.72332
+G1 X80.000 Y97.982 E4.72931
+G1 X79.998 Y97.680 E4.73938
+G1 X80.001 Y97.330 E4.75103
+G1 X79.999 Y96.937 E4.76413
+G1 X80.002 Y96.710 E4.77168
+G1 X79.999 Y96.524 E4.77787
+G1 X80.001 Y96.332 E4.78427
+G1 X79.999 Y96.004 E4.79518
+G1 X80.001 Y95.760 E4.80331
+G1 X79.998 Y95.382 E4.81591
+G1 X80.000 Y95.087 E4.82572
+G1 X80.000 Y94.826 E4.83441
+G1 X80.001 Y94.599 E4.84196
+G1 X79.998 Y94.251 E4.85357
+G1 X79.999 Y93.985 E4.86242
+G1 X79.999 Y93.685 E4.87240
+G1 X80.000 Y93.323 E4.88446
+G1 X79.998 Y92.932 E4.89747
+G1 X79.999 Y92.788 E4.90228
+G1 X79.998 Y92.551 E4.91018
+G1 X79.999 Y92.280 E4.91921
+G1 X79.999 Y91.914 E4.93139
+G1 X80.000 Y91.585 E4.94233
+G1 X80.002 Y91.387 E4.94892
+G1 X79.999 Y91.008 E4.96156
+G1 X79.999 Y90.615 E4.97463
+G1 X80.001 Y90.393 E4.98203
+G1 X79.999 Y90.266 E4.98627
+G1 X80.002 Y90.053 E4.99335
+G1 X80.001 Y89.871 E4.99940
+G1 X79.998 Y89.650 E5.00677
+G1 X80.001 Y89.407 E5.01485
+G1 X80.001 Y89.308 E5.01816
+G1 X80.002 Y89.195 E5.02192
+G1 X80.001 Y88.943 E5.03031
+G1 X79.999 Y88.633 E5.04065
+G1 X80.002 Y88.329 E5.05076
+G1 X79.999 Y88.151 E5.05671
+G1 X79.998 Y87.813 E5.06796
+G1 X80.002 Y87.423 E5.08094
+G1 X80.002 Y87.224 E5.08757
+G1 X80.000 Y87.088 E5.09208
+G1 X80.001 Y86.934 E5.09722
+G1 X79.998 Y86.579 E5.10905
+G1 X79.998 Y86.339 E5.11703
+G1 X80.000 Y85.968 E5.12938
+G1 X80.001 Y85.726 E5.13745
+G1 X80.000 Y85.459 E5.14634
+G1 X80.002 Y85.316 E5.15111
+G1 X80.000 Y85.115 E5.15781
+G1 X79.999 Y84.837 E5.16705
+G1 X80.001 Y84.575 E5.17577
+G1 X80.000 Y84.262 E5.18620
+G1 X79.999 Y83.906 E5.19807
+G1 X79.998 Y83.726 E5.20406
+G1 X80.002 Y83.603 E5.20815
+G1 X80.000 Y83.416 E5.21437
+G1 X79.998 Y83.153 E5.22312
+G1 X80.000 Y82.867 E5.23266
+G1 X80.002 Y82.695 E5.23840
+G1 X80.001 Y82.309 E5.25124
+G1 X80.000 Y82.089 E5.25856
+G1 X80.000 Y81.894 E5.26507
+G1 X80.000 Y81.777 E5.26895
+G1 X80.000 Y81.599 E5.27488
+G1 X80.000 Y81.440 E5.28018
+G1 X80.001 Y81.186 E5.28862
+G1 X79.999 Y80.971 E5.29580
+G1 X80.000 Y80.796 E5.30163
+G1 X79.998 Y80.595 E5.30830
+G1 X80.002 Y80.332 E5.31707
+G1 X80.000 Y80.000 E5.32813
+;LAYER:1
+G1 Z0.50 F600
+G0 X80.000 Y80.000 F7800
+G1 F1800
+G1 X80.146 Y79.999 E5.33298
+G1 X80.269 Y80.001 E5.33709
+G1 X80.438 Y79.999 E5.34272
+G1 X80.667 Y79.998 E5.35035
+G1 X81.038 Y79.999 E5.36271
+G1 X81.393 Y80.001 E5.37453
+G1 X81.640 Y80.000 E5.38275
+G1 X81.780 Y80.000 E5.38740
+G1 X82.039 Y80.002 E5.39603
+G1 X82.373 Y79.999 E5.40716
+G1 X82.494 Y80.000 E5.41119
+G1 X82.669 Y80.000 E5.41701
+G1 X82.968 Y80.001 E5.42696
+G1 X83.248 Y79.999 E5.43628
+G1 X83.643 Y80.000 E5.44943
+G1 X83.857 Y80.001 E5.45657
+G1 X84.188 Y79.999 E5.46758
+G1 X84.469 Y80.001 E5.47694
+G1 X84.683 Y79.998 E5.48406
+G1 X84.932 Y79.998 E5.49239
+G1 X85.113 Y80.002 E5.49841
+G1 X85.234 Y80.000 E5.50243
+G1 X85.615 Y80.000 E5.51511
+G1 X85.966 Y80.000 E5.52682
+G1 X86.361 Y79.999 E5.53996
+G1 X86.656 Y80.001 E5.54978
+G1 X86.952 Y79.999 E5.55963
+G1 X87.129 Y80.001 E5.56554
+G1 X87.415 Y79.998 E5.57505
+G1 X87.775 Y80.001 E5.58704
+G1 X88.106 Y79.999 E5.59808
+G1 X88.447 Y80.001 E5.60942
+G1 X88.555 Y80.002 E5.61303
+G1 X88.783 Y80.000 E5.62063
+G1 X89.176 Y80.002 E5.63370
+G1 X89.335 Y80.002 E5.63898
+G1 X89.598 Y80.002 E5.64776
+G1 X89.942 Y79.999 E5.65919
+G1 X90.262 Y79.999 E5.66987
+G1 X90.536 Y80.001 E5.67900
+G1 X90.883 Y80.001 E5.69054
+G1 X91.016 Y80.001 E5.69498
+G1 X91.385 Y80.000 E5.70727
+G1 X91.589 Y80.001 E5.71404
+G1 X91.903 Y79.998 E5.72450
+G1 X92.251 Y80.002 E5.73611
+G1 X92.360 Y79.998 E5.73971
+G1 X92.501 Y80.001 E5.74444
+G1 X92.887 Y79.999 E5.75729
+G1 X93.078 Y80.002 E5.76364
+G1 X93.451 Y80.000 E5.77606
+G1 X93.639 Y79.999 E5.78234
+G1 X93.840 Y80.000 E5.78901
+G1 X93.997 Y80.000 E5.79423
+G1 X94.169 Y79.999 E5.79996
+G1 X94.392 Y80.000 E5.80740
+G1 X94.518 Y79.998 E5.81159
+G1 X94.848 Y79.998 E5.82258
+G1 X95.157 Y80.001 E5.83288
+G1 X95.397 Y80.002 E5.84085
+G1 X95.571 Y80.001 E5.84665
+G1 X95.769 Y80.001 E5.85325
+G1 X95.975 Y80.000 E5.86013
+G1 X96.159 Y79.998 E5.86625
+G1 X96.304 Y80.000 E5.87105
+G1 X96.705 Y79.999 E5.88441
+G1 X96.806 Y79.999 E5.88778
+G1 X96.962 Y80.000 E5.89298
+G1 X97.194 Y80.001 E5.90072
+G1 X97.321 Y80.000 E5.90494
+G1 X97.430 Y80.001 E5.90858
+G1 X97.658 Y80.000 E5.91617
+G1 X97.856 Y79.999 E5.92276
+G1 X97.981 Y80.000 E5.92691
+G1 X98.370 Y79.999 E5.93987
+G1 X98.528 Y80.000 E5.94514
+G1 X98.800 Y79.999 E5.95419
+G1 X99.120 Y80.000 E5.96484
+G1 X99.379 Y80.000 E5.97346
+G1 X99.563 Y80.000 E5.97960
+G1 X99.811 Y79.999 E5.98785
+G1 X99.986 Y79.999 E5.99368
+G1 X100.179 Y80.002 E6.00012
+G1 X100.305 Y79.999 E6.00429
+G1 X100.433 Y80.002 E6.00857
+G1 X100.627 Y80.002 E6.01504
+G1 X100.862 Y79.999 E6.02285
+G1 X101.015 Y80.001 E6.02796
+G1 X101.253 Y80.000 E6.03589
+G1 X101.453 Y79.999 E6.04255
+G1 X101.574 Y80.002 E6.04658
+G1 X101.786 Y80.000 E6.05362
+G1 X101.895 Y80.000 E6.05726
+G1 X102.161 Y80.002 E6.06611
+G1 X102.557 Y80.000 E6.07931
+G1 X102.805 Y80.002 E6.08756
+G1 X103.149 Y80.001 E6.09902
+G1 X103.302 Y80.001 E6.10412
+G1 X103.698 Y80.001 E6.11728
+G1 X103.919 Y79.999 E6.12466
+G1 X104.025 Y79.999 E6.12819
+G1 X104.251 Y80.001 E6.13573
+G1 X104.616 Y80.000 E6.14788
+G1 X104.948 Y80.001 E6.15892
+G1 X105.275 Y80.001 E6.16980
+G1 X105.533 Y79.999 E6.17842
+G1 X105.784 Y80.000 E6.18677
+G1 X106.150 Y79.999 E6.19896
+G1 X106.502 Y79.998 E6.21069
+G1 X106.781 Y80.002 E6.21998
+G1 X107.108 Y80.001 E6.23084
+G1 X107.402 Y80.002 E6.24065
+G1 X107.649 Y80.001 E6.24886
+G1 X107.992 Y80.001 E6.26028
+G1 X108.286 Y79.998 E6.27010
+G1 X108.650 Y80.000 E6.28222
+G1 X108.864 Y80.001 E6.28934
+G1 X109.209 Y80.000 E6.30082
+G1 X109.336 Y79.998 E6.30505
+G1 X109.577 Y80.000 E6.31307
+G1 X109.764 Y80.001 E6.31929
+G1 X109.999 Y79.998 E6.32712
+G1 X110.128 Y80.000 E6.33142
+G1 X110.380 Y79.999 E6.33982
+G1 X110.502 Y80.002 E6.34388
+G1 X110.900 Y80.001 E6.35712
+G1 X111.068 Y80.001 E6.36271
+G1 X111.394 Y79.999 E6.37358
+G1 X111.779 Y80.001 E6.38639
+G1 X112.049 Y79.999 E6.39540
+G1 X112.313 Y80.002 E6.40419
+G1 X112.458 Y80.002 E6.40903
+G1 X112.652 Y80.001 E6.41547
+G1 X113.000 Y80.000 E6.42707
+G1 X113.340 Y80.000 E6.43838
+G1 X113.609 Y80.002 E6.44733
+G1 X113.920 Y80.000 E6.45769
+G1 X114.315 Y80.002 E6.47085
+G1 X114.519 Y79.998 E6.47764
+G1 X114.819 Y80.001 E6.48765
+G1 X115.192 Y79.999 E6.50006
+G1 X115.555 Y80.002 E6.51213
+G1 X115.699 Y80.000 E6.51694
+G1 X115.917 Y79.998 E6.52420
+G1 X116.105 Y80.000 E6.53045
+G1 X116.217 Y80.001 E6.53419
+G1 X116.518 Y80.001 E6.54421
+G1 X116.813 Y80.002 E6.55405
+G1 X117.087 Y80.000 E6.56317
+G1 X117.266 Y79.999 E6.56913
+G1 X117.589 Y80.002 E6.57987
+G1 X117.830 Y80.000 E6.58791
+G1 X118.111 Y80.000 E6.59725
+G1 X118.300 Y80.001 E6.60356
+G1 X118.548 Y80.001 E6.61181
+G1 X118.653 Y80.000 E6.61533
+G1 X118.947 Y79.999 E6.62509
+G1 X119.098 Y79.998 E6.63013
+G1 X119.294 Y80.001 E6.63667
+G1 X119.641 Y80.002 E6.64821
+G1 X119.920 Y79.998 E6.65750
+G1 X120.000 Y80.000 E6.66017
+G1 X120.002 Y80.266 E6.66904
+G1 X120.000 Y80.470 E6.67581
+G1 X119.999 Y80.781 E6.68617
+G1 X120.000 Y80.910 E6.69046
+G1 X120.001 Y81.028 E6.69441
+G1 X120.000 Y81.232 E6.70120
+G1 X120.000 Y81.432 E6.70784
+G1 X120.000 Y81.597 E6.71336
+G1 X120.000 Y81.933 E6.72454
+G1 X120.000 Y82.221 E6.73412
+G1 X120.000 Y82.472 E6.74249
+G1 X119.999 Y82.815 E6.75390
+G1 X119.998 Y83.069 E6.76236
+G1 X120.000 Y83.402 E6.77345
+G1 X120.002 Y83.594 E6.77985
+G1 X120.000 Y83.891 E6.78973
+G1 X120.000 Y84.157 E6.79861
+G1 X120.000 Y84.467 E6.80891
+G1 X120.001 Y84.596 E6.81320
+G1 X120.002 Y84.750 E6.81835
+G1 X120.000 Y85.025 E6.82749
+G1 X120.000 Y85.310 E6.83700
+G1 X119.999 Y85.603 E6.84676
+G1 X120.001 Y85.815 E6.85381
+G1 X120.000 Y86.084 E6.86276
+G1 X119.999 Y86.371 E6.87234
+G1 X120.001 Y86.704 E6.88342
+G1 X120.001 Y86.858 E6.88853
+G1 X119.998 Y87.187 E6.89951
+G1 X120.000 Y87.432 E6.90765
+G1 X120.002 Y87.785 E6.91943
+G1 X120.002 Y87.969 E6.92553
+G1 X120.002 Y88.294 E6.93637
+G1 X120.001 Y88.646 E6.94809
+G1 X120.001 Y88.795 E6.95303
+G1 X120.002 Y88.924 E6.95734
+G1 X120.000 Y89.132 E6.96427
+G1 X120.000 Y89.326 E6.97072
+G1 X119.999 Y89.497 E6.97642
+G1 X120.001 Y89.665 E6.98203
+G1 X120.001 Y89.892 E6.98957
+G1 X119.999 Y90.286 E7.00269
+G1 X120.002 Y90.435 E7.00767
+G1 X120.000 Y90.655 E7.01497
+G1 X120.000 Y90.960 E7.02513
+G1 X119.998 Y91.321 E7.03716
+G1 X119.998 Y91.468 E7.04207
+G1 X119.999 Y91.773 E7.05222
+G1 X119.999 Y91.933 E7.05756
+G1 X120.001 Y92.249 E7.06806
+G1 X119.998 Y92.626 E7.08064
+G1 X120.001 Y92.952 E7.09147
+G1 X120.002 Y93.292 E7.10279
+G1 X119.998 Y93.653 E7.11482
+G1 X120.001 Y93.794 E7.11952
+G1 X120.000 Y94.117 E7.13026
+G1 X120.001 Y94.414 E7.14016
+G1 X120.001 Y94.671 E7.14872
+G1 X120.001 Y94.809 E7.15330
+G1 X120.000 Y95.001 E7.15970
+G1 X120.002 Y95.159 E7.16496
+G1 X120.002 Y95.389 E7.17262
+G1 X119.998 Y95.516 E7.17685
+G1 X120.002 Y95.766 E7.18520
+G1 X120.000 Y96.038 E7.19424
+G1 X120.001 Y96.334 E7.20409
+G1 X120.001 Y96.580 E7.21228
+G1 X120.001 Y96.857 E7.22152
+G1 X119.998 Y97.159 E7.23158
+G1 X119.999 Y97.382 E7.23900
+G1 X120.000 Y97.623 E7.24701
+G1 X120.001 Y97.885 E7.25574
+G1 X119.999 Y98.205 E7.26640
+G1 X120.001 Y98.359 E7.27153
+G1 X119.999 Y98.513 E7.27665
+G1 X119.998 Y98.799 E7.28618
+G1 X120.002 Y98.908 E7.28983
+G1 X119.999 Y99.159 E7.29818
+G1 X120.000 Y99.293 E7.30264
+G1 X120.000 Y99.541 E7.31091
+G1 X120.001 Y99.828 E7.32045
+G1 X119.999 Y99.978 E7.32544
+G1 X119.998 Y100.076 E7.32870
+G1 X120.001 Y100.326 E7.33703
+G1 X119.999 Y100.519 E7.34347
+G1 X119.998 Y100.656 E7.34805
+G1 X120.001 Y100.793 E7.35260
+G1 X119.999 Y100.961 E7.35818
+G1 X119.998 Y101.231 E7.36718
+G1 X120.000 Y101.570 E7.37847
+G1 X120.002 Y101.956 E7.39132
+G1 X120.001 Y102.247 E7.40101
+G1 X120.000 Y102.469 E7.40842
+G1 X119.999 Y102.770 E7.41843
+G1 X119.999 Y102.984 E7.42554
+G1 X120.001 Y103.264 E7.43487
+G1 X120.001 Y103.571 E7.44511
+G1 X120.001 Y103.930 E7.45706
+G1 X120.001 Y104.050 E7.46104
+G1 X119.998 Y104.175 E7.46521
+G1 X120.001 Y104.486 E7.47556
+G1 X120.001 Y104.598 E7.47931
+G1 X120.001 Y104.914 E7.48982
+G1 X120.002 Y105.162 E7.49809
+G1 X120.001 Y105.318 E7.50329
+G1 X120.001 Y105.693 E7.51575
+G1 X120.001 Y106.085 E7.52882
+G1 X120.000 Y106.266 E7.53486
+G1 X119.998 Y106.398 E7.53924
+G1 X120.000 Y106.534 E7.54376
+G1 X119.999 Y106.720 E7.54997
+G1 X120.002 Y106.871 E7.55499
+G1 X120.000 Y107.171 E7.56498
+G1 X120.001 Y107.563 E7.57802
+G1 X119.999 Y107.667 E7.58150
+G1 X120.000 Y107.960 E7.59127
+G1 X120.001 Y108.314 E7.60304
+G1 X120.002 Y108.570 E7.61157
+G1 X119.999 Y108.807 E7.61948
+G1 X120.000 Y108.978 E7.62517
+G1 X119.999 Y109.128 E7.63017
+G1 X120.001 Y109.512 E7.64295
+G1 X120.002 Y109.885 E7.65535
+G1 X120.000 Y110.101 E7.66255
+G1 X120.000 Y110.479 E7.67513
+G1 X119.999 Y110.822 E7.68655
+G1 X120.002 Y111.192 E7.69890
+G1 X119.998 Y111.529 E7.71009
+G1 X120.002 Y111.670 E7.71480
+G1 X120.001 Y111.945 E7.72395
+G1 X119.999 Y112.215 E7.73296
+G1 X120.001 Y112.450 E7.74077
+G1 X120.000 Y112.594 E7.74557
+G1 X120.000 Y112.913 E7.75619
+G1 X120.000 Y113.189 E7.76539
+G1 X119.998 Y113.563 E7.77784
+G1 X120.000 Y113.799 E7.78569
+G1 X119.999 Y114.162 E7.79780
+G1 X119.998 Y114.316 E7.80291
+G1 X120.002 Y114.616 E7.81292
+G1 X120.001 Y114.868 E7.82131
+G1 X120.001 Y115.136 E7.83022
+G1 X120.000 Y115.376 E7.83823
+G1 X119.998 Y115.721 E7.84970
+G1 X120.000 Y115.899 E7.85563
+G1 X120.002 Y116.279 E7.86830
+G1 X120.000 Y116.397 E7.87221
+G1 X120.002 Y116.761 E7.88433
+G1 X120.000 Y117.048 E7.89390
+G1 X119.998 Y117.156 E7.89750
+G1 X120.000 Y117.333 E7.90339
+G1 X120.002 Y117.522 E7.90970
+G1 X120.001 Y117.768 E7.91786
+G1 X119.999 Y118.107 E7.92915
+G1 X120.001 Y118.413 E7.93937
+G1 X120.000 Y118.565 E7.94443
+G1 X120.000 Y118.893 E7.95535
+G1 X119.999 Y119.030 E7.95988
+G1 X120.000 Y119.387 E7.97178
+G1 X120.000 Y119.616 E7.97941
+G1 X120.001 Y119.749 E7.98385
+G1 X119.999 Y119.894 E7.98868
+G1 X120.000 Y120.000 E7.99220
+G1 X119.686 Y119.999 E8.00266
+G1 X119.479 Y120.000 E8.00956
+G1 X119.259 Y119.999 E8.01688
+G1 X118.936 Y120.002 E8.02765
+G1 X118.634 Y119.999 E8.03769
+G1 X118.265 Y120.001 E8.04999
+G1 X117.927 Y119.999 E8.06124
+G1 X117.655 Y120.001 E8.07028
+G1 X117.296 Y120.001 E8.08224
+G1 X117.020 Y120.001 E8.09144
+G1 X116.867 Y119.998 E8.09653
+G1 X116.599 Y120.001 E8.10547
+G1 X116.277 Y120.001 E8.11617
+G1 X115.919 Y120.002 E8.12809
+G1 X115.718 Y119.999 E8.13478
+G1 X115.430 Y120.000 E8.14437
+G1 X115.318 Y120.002 E8.14813
+G1 X115.141 Y119.999 E8.15402
+G1 X114.803 Y119.999 E8.16528
+G1 X114.663 Y120.002 E8.16993
+G1 X114.560 Y120.002 E8.17338
+G1 X114.430 Y119.999 E8.17768
+G1 X114.233 Y120.002 E8.18425
+G1 X113.835 Y119.999 E8.19749
+G1 X113.482 Y120.002 E8.20926
+G1 X113.089 Y119.998 E8.22234
+G1 X112.765 Y120.001 E8.23313
+G1 X112.401 Y120.000 E8.24526
+G1 X112.169 Y119.999 E8.25300
+G1 X111.927 Y120.001 E8.26105
+G1 X111.586 Y120.001 E8.27239
+G1 X111.326 Y119.998 E8.28107
+G1 X111.153 Y120.002 E8.28681
+G1 X110.793 Y120.001 E8.29880
+G1 X110.510 Y120.000 E8.30825
+G1 X110.230 Y120.002 E8.31756
+G1 X109.839 Y120.001 E8.33056
+G1 X109.493 Y120.000 E8.34210
+G1 X109.197 Y120.001 E8.35196
+G1 X108.935 Y120.000 E8.36067
+G1 X108.584 Y120.002 E8.37236
+G1 X108.406 Y120.001 E8.37829
+G1 X108.244 Y120.000 E8.38370
+G1 X107.853 Y119.999 E8.39671
+G1 X107.622 Y120.002 E8.40441
+G1 X107.244 Y119.999 E8.41700
+G1 X106.863 Y120.001 E8.42967
+G1 X106.715 Y120.000 E8.43460
+G1 X106.395 Y120.002 E8.44528
+G1 X106.234 Y119.999 E8.45063
+G1 X106.056 Y120.002 E8.45656
+G1 X105.896 Y120.001 E8.46189
+G1 X105.693 Y120.000 E8.46863
+G1 X105.530 Y119.999 E8.47406
+G1 X105.297 Y120.002 E8.48184
+G1 X105.168 Y120.001 E8.48614
+G1 X104.884 Y120.000 E8.49559
+G1 X104.637 Y120.000 E8.50382
+G1 X104.382 Y120.000 E8.51228
+G1 X104.058 Y120.001 E8.52309
+G1 X103.869 Y120.000 E8.52939
+G1 X103.765 Y120.000 E8.53285
+G1 X103.383 Y119.998 E8.54557
+G1 X103.134 Y119.998 E8.55385
+G1 X102.837 Y120.001 E8.56374
+G1 X102.478 Y119.999 E8.57572
+G1 X102.329 Y120.000 E8.58068
+G1 X102.088 Y119.999 E8.58868
+G1 X101.807 Y120.001 E8.59805
+G1 X101.529 Y120.000 E8.60731
+G1 X101.135 Y120.000 E8.62044
+G1 X101.030 Y120.002 E8.62393
+G1 X100.743 Y120.001 E8.63347
+G1 X100.587 Y120.000 E8.63866
+G1 X100.265 Y120.001 E8.64939
+G1 X99.976 Y119.999 E8.65903
+G1 X99.820 Y119.998 E8.66423
+G1 X99.584 Y120.001 E8.67207
+G1 X99.350 Y119.999 E8.67988
+G1 X99.034 Y120.000 E8.69038
+G1 X98.669 Y120.001 E8.70254
+G1 X98.397 Y120.001 E8.71159
+G1 X98.063 Y120.000 E8.72274
+G1 X97.842 Y119.998 E8.73010
+G1 X97.457 Y120.002 E8.74291
+G1 X97.197 Y119.998 E8.75157
+G1 X96.954 Y120.002 E8.75965
+G1 X96.743 Y120.000 E8.76669
+G1 X96.478 Y119.998 E8.77550
+G1 X96.239 Y119.999 E8.78346
+G1 X95.848 Y119.998 E8.79649
+G1 X95.644 Y120.001 E8.80328
+G1 X95.373 Y120.000 E8.81232
+G1 X95.252 Y119.998 E8.81633
+G1 X95.126 Y119.999 E8.82052
+G1 X94.813 Y120.001 E8.83095
+G1 X94.514 Y119.999 E8.84093
+G1 X94.412 Y120.001 E8.84431
+G1 X94.252 Y120.002 E8.84963
+G1 X94.000 Y120.000 E8.85802
+G1 X93.638 Y119.998 E8.87007
+G1 X93.270 Y119.999 E8.88235
+G1 X92.923 Y119.999 E8.89389
+G1 X92.607 Y120.000 E8.90442
+G1 X92.281 Y120.001 E8.91528
+G1 X92.169 Y119.999 E8.91901
+G1 X91.852 Y120.001 E8.92955
+G1 X91.732 Y120.000 E8.93355
+G1 X91.361 Y119.999 E8.94591
+G1 X91.168 Y119.999 E8.95235
+G1 X90.990 Y120.000 E8.95828
+G1 X90.809 Y119.999 E8.96430
+G1 X90.541 Y119.998 E8.97321
+G1 X90.190 Y120.002 E8.98490
+G1 X89.936 Y119.998 E8.99336
+G1 X89.627 Y120.002 E9.00365
+G1 X89.249 Y119.999 E9.01623
+G1 X89.012 Y120.001 E9.02414
+G1 X88.880 Y120.001 E9.02852
+G1 X88.707 Y120.001 E9.03429
+G1 X88.392 Y120.001 E9.04477
+G1 X88.173 Y120.000 E9.05209
+G1 X87.826 Y120.000 E9.06363
+G1 X87.667 Y119.999 E9.06892
+G1 X87.452 Y119.998 E9.07610
+G1 X87.323 Y119.998 E9.08039
+G1 X86.979 Y120.001 E9.09184
+G1 X86.661 Y119.999 E9.10242
+G1 X86.532 Y120.001 E9.10671
+G1 X86.204 Y119.998 E9.11765
+G1 X85.868 Y119.999 E9.12884
+G1 X85.597 Y119.999 E9.13786
+G1 X85.351 Y120.000 E9.14603
+G1 X85.171 Y119.999 E9.15203
+G1 X84.980 Y119.998 E9.15840
+G1 X84.820 Y120.002 E9.16373
+G1 X84.460 Y120.001 E9.17573
+G1 X84.095 Y119.999 E9.18788
+G1 X83.871 Y120.001 E9.19534
+G1 X83.480 Y120.001 E9.20836
+G1 X83.301 Y120.001 E9.21431
+G1 X83.129 Y120.001 E9.22004
+G1 X82.861 Y120.000 E9.22896
+G1 X82.707 Y120.000 E9.23410
+G1 X82.491 Y120.001 E9.24128
+G1 X82.168 Y119.999 E9.25203
+G1 X81.820 Y120.001 E9.26365
+G1 X81.451 Y120.002 E9.27591
+G1 X81.174 Y120.000 E9.28514
+G1 X81.072 Y120.001 E9.28855
+G1 X80.742 Y120.001 E9.29954
+G1 X80.351 Y120.001 E9.31254
+G1 X80.056 Y120.000 E9.32239
+G1 X80.000 Y120.000 E9.32424
+G1 X80.000 Y119.872 E9.32850
+G1 X80.000 Y119.619 E9.33693
+G1 X80.001 Y119.471 E9.34186
+G1 X80.002 Y119.092 E9.35446
+G1 X80.001 Y118.841 E9.36284
+G1 X79.999 Y118.680 E9.36820
+G1 X80.000 Y118.452 E9.37580
+G1 X80.000 Y118.168 E9.38525
+G1 X79.998 Y118.064 E9.38872
+G1 X80.002 Y117.820 E9.39684
+G1 X80.002 Y117.593 E9.40440
+G1 X79.999 Y117.380 E9.41148
+G1 X79.998 Y117.051 E9.42244
+G1 X80.000 Y116.889 E9.42785
+G1 X80.000 Y116.699 E9.43416
+G1 X79.999 Y116.406 E9.44391
+G1 X80.002 Y116.056 E9.45558
+G1 X79.999 Y115.843 E9.46268
+G1 X79.999 Y115.674 E9.46830
+G1 X80.001 Y115.512 E9.47369
+G1 X80.002 Y115.222 E9.48334
+G1 X80.001 Y115.113 E9.48698
+G1 X80.001 Y114.914 E9.49360
+G1 X80.000 Y114.731 E9.49969
+G1 X79.998 Y114.361 E9.51201
+G1 X80.001 Y114.158 E9.51878
+G1 X79.999 Y114.008 E9.52377
+G1 X79.998 Y113.851 E9.52901
+G1 X80.001 Y113.466 E9.54184
+G1 X80.000 Y113.232 E9.54964
+G1 X80.000 Y112.851 E9.56231
+G1 X79.998 Y112.499 E9.57404
+G1 X79.999 Y112.265 E9.58182
+G1 X80.000 Y111.870 E9.59497
+G1 X79.998 Y111.617 E9.60339
+G1 X79.999 Y111.360 E9.61194
+G1 X79.999 Y111.008 E9.62369
+G1 X80.000 Y110.900 E9.62728
+G1 X79.999 Y110.590 E9.63761
+G1 X80.001 Y110.363 E9.64515
+G1 X79.999 Y110.102 E9.65385
+G1 X79.999 Y109.852 E9.66218
+G1 X79.999 Y109.582 E9.67117
+G1 X80.001 Y109.205 E9.68371
+G1 X79.999 Y108.843 E9.69576
+G1 X80.001 Y108.458 E9.70860
+G1 X80.000 Y108.117 E9.71995
+G1 X80.000 Y107.778 E9.73125
+G1 X80.002 Y107.520 E9.73984
+G1 X80.002 Y107.201 E9.75045
+G1 X79.998 Y106.897 E9.76058
+G1 X79.999 Y106.703 E9.76703
+G1 X80.000 Y106.317 E9.77989
+G1 X80.000 Y106.000 E9.79045
+G1 X80.001 Y105.766 E9.79823
+G1 X79.998 Y105.370 E9.81144
+G1 X80.000 Y104.992 E9.82400
+G1 X79.998 Y104.800 E9.83042
+G1 X79.998 Y104.489 E9.84076
+G1 X80.000 Y104.141 E9.85237
+G1 X80.000 Y103.816 E9.86319
+G1 X80.001 Y103.455 E9.87521
+G1 X80.001 Y103.100 E9.88700
+G1 X80.001 Y102.991 E9.89066
+G1 X80.001 Y102.647 E9.90211
+G1 X80.000 Y102.412 E9.90993
+G1 X80.001 Y102.227 E9.91608
+G1 X80.001 Y101.857 E9.92841
+G1 X80.000 Y101.460 E9.94163
+G1 X80.000 Y101.269 E9.94798
+G1 X80.002 Y101.024 E9.95614
+G1 X79.999 Y100.848 E9.96203
+G1 X80.001 Y100.527 E9.97271
+G1 X80.001 Y100.306 E9.98007
+G1 X79.998 Y100.049 E9.98861
+G1 X80.000 Y99.823 E9.99616
+G1 X79.999 Y99.572 E10.00450
+G1 X80.000 Y99.301 E10.01351
+G1 X79.999 Y99.090 E10.02056
+G1 X80.000 Y98.704 E10.03340
+G1 X80.001 Y98.337 E10.04563
+G1 X79.998 Y98.206 E10.05000
+G1 X80.000 Y97.941 E10.05883
+G1 X79.999 Y97.571 E10.07115
+G1 X80.000 Y97.291 E10.08046
+G1 X80.001 Y97.022 E10.08943
+G1 X79.999 Y96.793 E10.09705
+G1 X79.999 Y96.573 E10.10437
+G1 X80.000 Y96.263 E10.11469
+G1 X80.000 Y96.016 E10.12294
+G1 X80.001 Y95.820 E10.12946
+G1 X80.000 Y95.476 E10.14091
+G1 X80.000 Y95.328 E10.14584
+G1 X80.001 Y95.128 E10.15250
+G1 X80.002 Y95.017 E10.15617
+G1 X80.002 Y94.777 E10.16419
+G1 X80.002 Y94.569 E10.17112
+G1 X80.000 Y94.301 E10.18003
+G1 X80.001 Y94.149 E10.18508
+G1 X80.000 Y94.047 E10.18848
+G1 X80.000 Y93.922 E10.19267
+G1 X79.998 Y93.704 E10.19991
+G1 X79.998 Y93.349 E10.21174
+G1 X80.002 Y92.973 E10.22426
+G1 X80.000 Y92.669 E10.23436
+G1 X79.999 Y92.411 E10.24297
+G1 X80.000 Y92.149 E10.25169
+G1 X79.999 Y91.761 E10.26462
+G1 X80.002 Y91.607 E10.26973
+G1 X79.999 Y91.263 E10.28121
+G1 X79.999 Y91.125 E10.28580
+G1 X80.001 Y90.978 E10.29069
+G1 X80.002 Y90.624 E10.30247
+G1 X79.999 Y90.366 E10.31107
+G1 X79.999 Y90.229 E10.31562
+G1 X79.999 Y89.935 E10.32543
+G1 X80.000 Y89.730 E10.33226
+G1 X80.000 Y89.546 E10.33836
+G1 X80.001 Y89.269 E10.34761
+G1 X80.000 Y88.958 E10.35796
+G1 X79.998 Y88.705 E10.36639
+G1 X79.998 Y88.408 E10.37628
+G1 X79.999 Y88.072 E10.38745
+G1 X80.002 Y87.679 E10.40056
+G1 X80.000 Y87.438 E10.40858
+G1 X80.000 Y87.230 E10.41551
+G1 X80.001 Y86.971 E10.42413
+G1 X80.002 Y86.694 E10.43335
+G1 X80.001 Y86.361 E10.44444
+G1 X79.999 Y86.241 E10.44844
+G1 X79.999 Y85.927 E10.45890
+G1 X79.998 Y85.811 E10.46276
+G1 X79.999 Y85.488 E10.47350
+G1 X80.000 Y85.193 E10.48333
+G1 X80.000 Y84.832 E10.49534
+G1 X80.001 Y84.521 E10.50569
+G1 X80.000 Y84.335 E10.51189
+G1 X80.000 Y83.956 E10.52453
+G1 X79.999 Y83.680 E10.53373
+G1 X80.001 Y83.543 E10.53829
+G1 X80.000 Y83.258 E10.54778
+G1 X80.001 Y83.091 E10.55332
+G1 X79.999 Y82.835 E10.56186
+G1 X80.001 Y82.675 E10.56718
+G1 X80.000 Y82.459 E10.57437
+G1 X80.001 Y82.088 E10.58674
+G1 X80.001 Y81.960 E10.59100
+G1 X80.000 Y81.693 E10.59989
+G1 X79.998 Y81.535 E10.60515
+G1 X80.001 Y81.289 E10.61333
+G1 X79.998 Y81.071 E10.62059
+G1 X79.999 Y80.726 E10.63209
+G1 X79.999 Y80.421 E10.64223
+G1 X80.001 Y80.285 E10.64678
+G1 X80.000 Y80.000 E10.65626
+;LAYER:2
+G1 Z0.70 F600
+G0 X80.000 Y80.000 F7800
+G1 F1800
+G1 X80.260 Y79.998 E10.66493
+G1 X80.427 Y80.002 E10.67050
+G1 X80.793 Y80.002 E10.68267
+G1 X81.103 Y80.002 E10.69300
+G1 X81.207 Y79.999 E10.69645
+G1 X81.366 Y80.001 E10.70176
+G1 X81.691 Y80.001 E10.71256
+G1 X81.929 Y80.002 E10.72049
+G1 X82.273 Y80.002 E10.73195
+G1 X82.637 Y80.002 E10.74409
+G1 X82.818 Y80.001 E10.75011
+G1 X83.088 Y80.000 E10.75911
+G1 X83.380 Y80.001 E10.76884
+G1 X83.630 Y79.998 E10.77716
+G1 X83.961 Y80.001 E10.78818
+G1 X84.354 Y80.001 E10.80127
+G1 X84.526 Y80.000 E10.80699
+G1 X84.885 Y80.000 E10.81893
+G1 X85.134 Y80.000 E10.82725
+G1 X85.294 Y79.998 E10.83255
+G1 X85.683 Y80.001 E10.84552
+G1 X85.939 Y80.001 E10.85404
+G1 X86.272 Y80.002 E10.86514
+G1 X86.541 Y80.001 E10.87407
+G1 X86.780 Y80.002 E10.88204
+G1 X86.960 Y80.000 E10.88804
+G1 X87.269 Y80.000 E10.89833
+G1 X87.424 Y79.998 E10.90350
+G1 X87.551 Y80.001 E10.90773
+G1 X87.675 Y79.999 E10.91186
+G1 X87.959 Y80.001 E10.92130
+G1 X88.313 Y80.001 E10.93310
+G1 X88.653 Y80.000 E10.94442
+G1 X89.001 Y79.998 E10.95599
+G1 X89.316 Y80.002 E10.96649
+G1 X89.438 Y79.999 E10.97057
+G1 X89.660 Y80.000 E10.97795
+G1 X89.862 Y80.000 E10.98467
+G1 X89.975 Y80.001 E10.98844
+G1 X90.232 Y80.002 E10.99699
+G1 X90.350 Y79.999 E11.00092
+G1 X90.510 Y79.999 E11.00627
+G1 X90.659 Y80.000 E11.01122
+G1 X90.912 Y80.000 E11.01964
+G1 X91.104 Y80.001 E11.02605
+G1 X91.305 Y79.999 E11.03273
+G1 X91.537 Y80.001 E11.04047
+G1 X91.887 Y80.000 E11.05210
+G1 X92.033 Y80.000 E11.05698
+G1 X92.362 Y80.002 E11.06792
+G1 X92.660 Y80.001 E11.07785
+G1 X92.842 Y80.002 E11.08391
+G1 X93.044 Y79.999 E11.09065
+G1 X93.423 Y80.001 E11.10325
+G1 X93.799 Y80.000 E11.11580
+G1 X94.006 Y80.000 E11.12267
+G1 X94.371 Y79.999 E11.13485
+G1 X94.517 Y80.001 E11.13971
+G1 X94.883 Y79.999 E11.15187
+G1 X95.019 Y80.002 E11.15641
+G1 X95.161 Y80.002 E11.16113
+G1 X95.544 Y80.001 E11.17388
+G1 X95.909 Y79.998 E11.18603
+G1 X96.025 Y80.000 E11.18992
+G1 X96.308 Y79.999 E11.19932
+G1 X96.492 Y80.001 E11.20546
+G1 X96.759 Y80.001 E11.21435
+G1 X97.079 Y80.001 E11.22502
+G1 X97.436 Y79.998 E11.23690
+G1 X97.585 Y80.000 E11.24185
+G1 X97.976 Y79.998 E11.25489
+G1 X98.125 Y80.002 E11.25985
+G1 X98.269 Y79.999 E11.26463
+G1 X98.504 Y79.998 E11.27248
+G1 X98.774 Y80.001 E11.28146
+G1 X98.951 Y80.001 E11.28736
+G1 X99.092 Y79.999 E11.29205
+G1 X99.475 Y79.998 E11.30480
+G1 X99.820 Y80.000 E11.31630
+G1 X99.924 Y80.001 E11.31974
+G1 X100.078 Y80.001 E11.32487
+G1 X100.285 Y80.000 E11.33178
+G1 X100.617 Y79.998 E11.34282
+G1 X100.753 Y79.999 E11.34737
+G1 X101.120 Y79.998 E11.35959
+G1 X101.458 Y79.999 E11.37084
+G1 X101.661 Y80.002 E11.37759
+G1 X101.969 Y80.000 E11.38784
+G1 X102.085 Y80.001 E11.39171
+G1 X102.465 Y79.998 E11.40436
+G1 X102.808 Y80.001 E11.41581
+G1 X103.019 Y79.998 E11.42281
+G1 X103.363 Y80.000 E11.43428
+G1 X103.597 Y80.001 E11.44208
+G1 X103.896 Y80.001 E11.45202
+G1 X104.185 Y80.002 E11.46164
+G1 X104.578 Y80.002 E11.47475
+G1 X104.748 Y79.999 E11.48039
+G1 X104.993 Y80.001 E11.48855
+G1 X105.344 Y80.002 E11.50024
+G1 X105.471 Y80.001 E11.50446
+G1 X105.748 Y80.002 E11.51370
+G1 X106.122 Y80.001 E11.52615
+G1 X106.263 Y79.999 E11.53084
+G1 X106.467 Y80.001 E11.53765
+G1 X106.781 Y79.999 E11.54808
+G1 X107.068 Y79.999 E11.55764
+G1 X107.371 Y80.001 E11.56774
+G1 X107.584 Y79.999 E11.57484
+G1 X107.772 Y80.002 E11.58109
+G1 X108.154 Y79.998 E11.59383
+G1 X108.314 Y80.002 E11.59915
+G1 X108.660 Y80.000 E11.61067
+G1 X108.950 Y80.001 E11.62034
+G1 X109.343 Y80.001 E11.63340
+G1 X109.473 Y80.001 E11.63774
+G1 X109.711 Y80.001 E11.64565
+G1 X110.055 Y80.001 E11.65713
+G1 X110.375 Y79.998 E11.66778
+G1 X110.674 Y79.999 E11.67774
+G1 X110.975 Y79.999 E11.68775
+G1 X111.250 Y79.998 E11.69693
+G1 X111.462 Y80.001 E11.70399
+G1 X111.844 Y79.999 E11.71668
+G1 X112.071 Y80.002 E11.72426
+G1 X112.379 Y79.999 E11.73450
+G1 X112.744 Y79.999 E11.74668
+G1 X112.876 Y79.999 E11.75107
+G1 X113.269 Y80.000 E11.76415
+G1 X113.634 Y80.000 E11.77630
+G1 X113.765 Y80.001 E11.78065
+G1 X114.154 Y79.999 E11.79363
+G1 X114.487 Y79.998 E11.80471
+G1 X114.886 Y79.998 E11.81800
+G1 X115.089 Y80.001 E11.82476
+G1 X115.245 Y80.000 E11.82996
+G1 X115.607 Y79.998 E11.84202
+G1 X115.888 Y79.999 E11.85138
+G1 X116.156 Y79.999 E11.86029
+G1 X116.484 Y80.000 E11.87122
+G1 X116.814 Y80.000 E11.88219
+G1 X117.205 Y79.999 E11.89522
+G1 X117.451 Y80.002 E11.90343
+G1 X117.832 Y80.001 E11.91609
+G1 X117.960 Y80.001 E11.92037
+G1 X118.175 Y79.999 E11.92752
+G1 X118.346 Y80.001 E11.93320
+G1 X118.736 Y79.998 E11.94621
+G1 X119.031 Y80.001 E11.95602
+G1 X119.411 Y80.001 E11.96868
+G1 X119.671 Y80.001 E11.97733
+G1 X119.912 Y80.001 E11.98536
+G1 X120.000 Y80.000 E11.98830
+G1 X120.002 Y80.208 E11.99522
+G1 X120.000 Y80.600 E12.00828
+G1 X119.999 Y80.854 E12.01673
+G1 X120.002 Y81.233 E12.02936
+G1 X120.002 Y81.421 E12.03562
+G1 X120.001 Y81.701 E12.04496
+G1 X120.000 Y81.845 E12.04973
+G1 X120.001 Y82.180 E12.06091
+G1 X119.999 Y82.461 E12.07023
+G1 X119.998 Y82.617 E12.07545
+G1 X119.998 Y82.784 E12.08101
+G1 X119.999 Y83.054 E12.08998
+G1 X120.001 Y83.218 E12.09546
+G1 X119.998 Y83.477 E12.10408
+G1 X120.001 Y83.664 E12.11030
+G1 X119.999 Y83.931 E12.11920
+G1 X120.002 Y84.154 E12.12663
+G1 X119.998 Y84.495 E12.13800
+G1 X119.998 Y84.631 E12.14251
+G1 X120.001 Y84.978 E12.15406
+G1 X120.002 Y85.242 E12.16285
+G1 X119.999 Y85.424 E12.16892
+G1 X120.000 Y85.700 E12.17811
+G1 X120.000 Y85.851 E12.18314
+G1 X119.998 Y86.068 E12.19037
+G1 X120.000 Y86.321 E12.19879
+G1 X120.001 Y86.513 E12.20517
+G1 X120.000 Y86.652 E12.20980
+G1 X119.998 Y86.773 E12.21385
+G1 X120.001 Y86.925 E12.21891
+G1 X120.002 Y87.245 E12.22956
+G1 X119.998 Y87.480 E12.23739
+G1 X120.000 Y87.835 E12.24923
+G1 X119.999 Y88.031 E12.25572
+G1 X120.001 Y88.230 E12.26235
+G1 X120.000 Y88.616 E12.27522
+G1 X120.001 Y88.829 E12.28231
+G1 X120.000 Y89.157 E12.29323
+G1 X120.001 Y89.471 E12.30370
+G1 X120.001 Y89.661 E12.31002
+G1 X120.001 Y89.812 E12.31506
+G1 X120.001 Y90.179 E12.32727
+G1 X119.998 Y90.528 E12.33889
+G1 X120.001 Y90.768 E12.34688
+G1 X120.001 Y90.983 E12.35405
+G1 X119.998 Y91.346 E12.36613
+G1 X119.999 Y91.577 E12.37383
+G1 X120.001 Y91.942 E12.38598
+G1 X120.000 Y92.053 E12.38967
+G1 X120.002 Y92.268 E12.39684
+G1 X120.001 Y92.387 E12.40081
+G1 X120.001 Y92.614 E12.40836
+G1 X119.999 Y92.899 E12.41784
+G1 X120.000 Y93.165 E12.42671
+G1 X120.001 Y93.275 E12.43038
+G1 X120.002 Y93.403 E12.43461
+G1 X120.000 Y93.727 E12.44543
+G1 X120.001 Y94.074 E12.45698
+G1 X120.000 Y94.397 E12.46772
+G1 X120.001 Y94.654 E12.47629
+G1 X119.999 Y95.003 E12.48789
+G1 X120.001 Y95.342 E12.49918
+G1 X120.000 Y95.541 E12.50583
+G1 X119.998 Y95.779 E12.51374
+G1 X119.999 Y96.092 E12.52417
+G1 X119.999 Y96.213 E12.52821
+G1 X120.001 Y96.589 E12.54073
+G1 X120.002 Y96.852 E12.54947
+G1 X119.999 Y97.135 E12.55891
+G1 X119.998 Y97.315 E12.56491
+G1 X119.999 Y97.543 E12.57251
+G1 X119.999 Y97.773 E12.58014
+G1 X119.998 Y98.018 E12.58830
+G1 X120.002 Y98.334 E12.59883
+G1 X120.001 Y98.543 E12.60581
+G1 X119.999 Y98.766 E12.61324
+G1 X120.000 Y99.062 E12.62308
+G1 X120.001 Y99.289 E12.63064
+G1 X120.000 Y99.666 E12.64318
+G1 X119.999 Y99.932 E12.65204
+G1 X120.002 Y100.033 E12.65542
+G1 X120.002 Y100.301 E12.66432
+G1 X120.000 Y100.550 E12.67264
+G1 X120.001 Y100.878 E12.68355
+G1 X120.001 Y101.140 E12.69228
+G1 X119.999 Y101.345 E12.69911
+G1 X120.001 Y101.474 E12.70339
+G1 X120.001 Y101.693 E12.71070
+G1 X119.998 Y101.958 E12.71953
+G1 X120.000 Y102.103 E12.72434
+G1 X120.001 Y102.465 E12.73640
+G1 X120.000 Y102.753 E12.74599
+G1 X119.999 Y102.960 E12.75287
+G1 X120.002 Y103.344 E12.76567
+G1 X120.000 Y103.479 E12.77016
+G1 X119.998 Y103.800 E12.78085
+G1 X120.001 Y103.924 E12.78499
+G1 X120.002 Y104.121 E12.79156
+G1 X120.002 Y104.302 E12.79757
+G1 X120.000 Y104.408 E12.80110
+G1 X119.998 Y104.754 E12.81264
+G1 X120.000 Y104.914 E12.81794
+G1 X120.000 Y105.121 E12.82485
+G1 X119.998 Y105.283 E12.83023
+G1 X120.000 Y105.679 E12.84343
+G1 X120.000 Y106.071 E12.85648
+G1 X120.002 Y106.349 E12.86574
+G1 X119.998 Y106.533 E12.87186
+G1 X120.001 Y106.924 E12.88490
+G1 X120.002 Y107.184 E12.89354
+G1 X120.001 Y107.356 E12.89927
+G1 X120.000 Y107.488 E12.90368
+G1 X120.000 Y107.589 E12.90703
+G1 X119.998 Y107.978 E12.91998
+G1 X120.001 Y108.210 E12.92771
+G1 X120.000 Y108.372 E12.93310
+G1 X120.000 Y108.743 E12.94547
+G1 X120.000 Y109.012 E12.95441
+G1 X119.999 Y109.191 E12.96038
+G1 X120.001 Y109.491 E12.97036
+G1 X120.000 Y109.883 E12.98342
+G1 X120.000 Y110.074 E12.98980
+G1 X119.999 Y110.299 E12.99729
+G1 X120.000 Y110.662 E13.00936
+G1 X120.000 Y110.968 E13.01956
+G1 X120.000 Y111.158 E13.02588
+G1 X120.002 Y111.374 E13.03306
+G1 X120.001 Y111.549 E13.03889
+G1 X119.999 Y111.741 E13.04530
+G1 X120.001 Y112.042 E13.05533
+G1 X120.000 Y112.426 E13.06810
+G1 X119.999 Y112.811 E13.08094
+G1 X120.000 Y112.997 E13.08711
+G1 X120.001 Y113.242 E13.09527
+G1 X120.000 Y113.626 E13.10805
+G1 X120.000 Y113.746 E13.11205
+G1 X120.001 Y114.090 E13.12351
+G1 X120.000 Y114.362 E13.13256
+G1 X120.000 Y114.736 E13.14503
+G1 X120.002 Y114.950 E13.15217
+G1 X120.000 Y115.191 E13.16018
+G1 X119.999 Y115.562 E13.17252
+G1 X119.999 Y115.880 E13.18313
+G1 X119.999 Y116.022 E13.18786
+G1 X120.000 Y116.278 E13.19638
+G1 X120.002 Y116.396 E13.20032
+G1 X120.000 Y116.768 E13.21268
+G1 X120.002 Y117.160 E13.22576
+G1 X120.000 Y117.507 E13.23731
+G1 X120.001 Y117.885 E13.24990
+G1 X120.000 Y118.139 E13.25837
+G1 X119.999 Y118.413 E13.26749
+G1 X120.000 Y118.814 E13.28082
+G1 X119.999 Y119.128 E13.29129
+G1 X119.999 Y119.410 E13.30067
+G1 X120.000 Y119.531 E13.30471
+G1 X120.002 Y119.679 E13.30965
+G1 X120.000 Y120.000 E13.32032
+G1 X119.747 Y120.000 E13.32877
+G1 X119.504 Y120.000 E13.33686
+G1 X119.377 Y119.999 E13.34106
+G1 X119.178 Y120.001 E13.34771
+G1 X119.046 Y120.002 E13.35208
+G1 X118.758 Y119.998 E13.36170
+G1 X118.387 Y120.001 E13.37404
+G1 X118.190 Y120.000 E13.38061
+G1 X117.795 Y120.000 E13.39376
+G1 X117.670 Y119.999 E13.39793
+G1 X117.298 Y120.000 E13.41030
+G1 X117.191 Y119.999 E13.41388
+G1 X116.865 Y119.999 E13.42472
+G1 X116.497 Y119.999 E13.43697
+G1 X116.101 Y120.000 E13.45015
+G1 X115.814 Y120.001 E13.45972
+G1 X115.423 Y120.000 E13.47276
+G1 X115.108 Y119.998 E13.48322
+G1 X114.756 Y120.001 E13.49496
+G1 X114.545 Y119.999 E13.50200
+G1 X114.391 Y119.999 E13.50711
+G1 X114.215 Y120.000 E13.51298
+G1 X113.988 Y120.001 E13.52054
+G1 X113.637 Y119.999 E13.53223
+G1 X113.384 Y120.000 E13.54064
+G1 X113.100 Y119.999 E13.55009
+G1 X112.763 Y120.000 E13.56131
+G1 X112.397 Y120.001 E13.57349
+G1 X112.175 Y120.002 E13.58089
+G1 X111.950 Y119.999 E13.58841
+G1 X111.650 Y120.001 E13.59839
+G1 X111.430 Y119.999 E13.60572
+G1 X111.269 Y120.001 E13.61107
+G1 X111.137 Y120.002 E13.61546
+G1 X110.845 Y119.999 E13.62518
+G1 X110.547 Y120.000 E13.63512
+G1 X110.300 Y119.999 E13.64334
+G1 X110.160 Y120.001 E13.64801
+G1 X109.873 Y120.001 E13.65755
+G1 X109.571 Y120.002 E13.66763
+G1 X109.448 Y119.999 E13.67171
+G1 X109.206 Y120.000 E13.67977
+G1 X108.863 Y120.001 E13.69120
+G1 X108.606 Y120.002 E13.69975
+G1 X108.462 Y120.001 E13.70454
+G1 X108.171 Y120.001 E13.71423
+G1 X107.772 Y120.001 E13.72751
+G1 X107.432 Y120.000 E13.73886
+G1 X107.052 Y119.999 E13.75152
+G1 X106.833 Y120.002 E13.75880
+G1 X106.591 Y120.001 E13.76686
+G1 X106.358 Y119.999 E13.77462
+G1 X106.054 Y119.998 E13.78474
+G1 X105.796 Y120.001 E13.79332
+G1 X105.665 Y120.001 E13.79768
+G1 X105.503 Y119.999 E13.80309
+G1 X105.249 Y119.998 E13.81156
+G1 X105.076 Y119.999 E13.81730
+G1 X104.906 Y119.998 E13.82296
+G1 X104.617 Y120.001 E13.83258
+G1 X104.306 Y120.002 E13.84296
+G1 X104.145 Y119.999 E13.84831
+G1 X103.746 Y119.999 E13.86161
+G1 X103.502 Y120.000 E13.86972
+G1 X103.205 Y119.999 E13.87960
+G1 X103.012 Y119.999 E13.88603
+G1 X102.771 Y119.998 E13.89407
+G1 X102.491 Y120.000 E13.90338
+G1 X102.146 Y119.999 E13.91487
+G1 X101.928 Y120.001 E13.92214
+G1 X101.642 Y120.001 E13.93166
+G1 X101.259 Y119.999 E13.94442
+G1 X100.898 Y120.002 E13.95644
+G1 X100.794 Y120.002 E13.95989
+G1 X100.452 Y120.000 E13.97128
+G1 X100.316 Y119.999 E13.97581
+G1 X99.968 Y120.000 E13.98739
+G1 X99.627 Y120.002 E13.99875
+G1 X99.364 Y120.002 E14.00751
+G1 X98.981 Y119.998 E14.02027
+G1 X98.786 Y119.999 E14.02676
+G1 X98.435 Y120.000 E14.03846
+G1 X98.153 Y120.002 E14.04783
+G1 X98.045 Y120.001 E14.05145
+G1 X97.870 Y120.000 E14.05728
+G1 X97.650 Y119.999 E14.06460
+G1 X97.453 Y119.999 E14.07116
+G1 X97.248 Y119.999 E14.07799
+G1 X97.090 Y120.000 E14.08323
+G1 X96.957 Y120.001 E14.08769
+G1 X96.792 Y120.002 E14.09318
+G1 X96.532 Y120.000 E14.10181
+G1 X96.168 Y119.998 E14.11393
+G1 X95.875 Y119.999 E14.12369
+G1 X95.499 Y120.000 E14.13623
+G1 X95.166 Y120.001 E14.14732
+G1 X95.028 Y120.000 E14.15190
+G1 X94.758 Y120.001 E14.16091
+G1 X94.398 Y120.001 E14.17288
+G1 X94.057 Y120.001 E14.18423
+G1 X93.840 Y120.000 E14.19148
+G1 X93.454 Y120.000 E14.20433
+G1 X93.311 Y120.001 E14.20910
+G1 X93.128 Y120.001 E14.21518
+G1 X92.834 Y120.000 E14.22498
+G1 X92.672 Y119.999 E14.23035
+G1 X92.462 Y120.000 E14.23737
+G1 X92.156 Y120.000 E14.24756
+G1 X92.007 Y119.999 E14.25251
+G1 X91.826 Y119.999 E14.25855
+G1 X91.657 Y120.001 E14.26417
+G1 X91.452 Y120.002 E14.27099
+G1 X91.319 Y119.998 E14.27544
+G1 X91.147 Y119.998 E14.28115
+G1 X90.808 Y120.001 E14.29243
+G1 X90.662 Y120.000 E14.29730
+G1 X90.373 Y119.999 E14.30691
+G1 X90.000 Y120.000 E14.31934
+G1 X89.658 Y120.001 E14.33072
+G1 X89.286 Y120.002 E14.34311
+G1 X88.973 Y119.998 E14.35354
+G1 X88.593 Y120.001 E14.36619
+G1 X88.363 Y120.000 E14.37387
+G1 X88.214 Y120.001 E14.37881
+G1 X87.839 Y119.999 E14.39130
+G1 X87.565 Y120.001 E14.40042
+G1 X87.377 Y119.998 E14.40671
+G1 X87.068 Y120.002 E14.41700
+G1 X86.814 Y119.999 E14.42543
+G1 X86.555 Y120.000 E14.43408
+G1 X86.254 Y119.998 E14.44411
+G1 X86.053 Y120.000 E14.45079
+G1 X85.839 Y120.002 E14.45791
+G1 X85.553 Y119.998 E14.46744
+G1 X85.429 Y119.998 E14.47156
+G1 X85.239 Y119.999 E14.47790
+G1 X84.879 Y119.998 E14.48989
+G1 X84.769 Y119.999 E14.49353
+G1 X84.520 Y119.999 E14.50183
+G1 X84.210 Y120.000 E14.51217
+G1 X83.963 Y120.001 E14.52040
+G1 X83.733 Y119.999 E14.52803
+G1 X83.463 Y119.999 E14.53702
+G1 X83.199 Y119.999 E14.54582
+G1 X83.023 Y119.999 E14.55169
+G1 X82.677 Y120.002 E14.56322
+G1 X82.525 Y119.999 E14.56827
+G1 X82.341 Y120.000 E14.57439
+G1 X82.215 Y120.001 E14.57859
+G1 X81.933 Y119.999 E14.58799
+G1 X81.792 Y120.001 E14.59269
+G1 X81.422 Y119.999 E14.60500
+G1 X81.280 Y120.000 E14.60973
+G1 X80.981 Y120.001 E14.61970
+G1 X80.738 Y119.998 E14.62779
+G1 X80.416 Y120.001 E14.63849
+G1 X80.000 Y120.000 E14.65236
+G1 X80.002 Y119.739 E14.66105
+G1 X80.000 Y119.415 E14.67184
+G1 X80.002 Y119.254 E14.67721
+G1 X80.001 Y119.052 E14.68393
+G1 X79.999 Y118.806 E14.69213
+G1 X80.000 Y118.663 E14.69689
+G1 X80.002 Y118.422 E14.70492
+G1 X80.000 Y118.076 E14.71642
+G1 X80.001 Y117.880 E14.72294
+G1 X79.999 Y117.744 E14.72747
+G1 X79.999 Y117.448 E14.73733
+G1 X80.000 Y117.202 E14.74554
+G1 X80.001 Y117.066 E14.75004
+G1 X79.998 Y116.777 E14.75969
+G1 X80.001 Y116.620 E14.76491
+G1 X80.000 Y116.499 E14.76893
+G1 X80.001 Y116.113 E14.78180
+G1 X80.001 Y115.984 E14.78608
+G1 X79.999 Y115.687 E14.79598
+G1 X80.000 Y115.544 E14.80073
+G1 X79.999 Y115.307 E14.80863
+G1 X79.998 Y115.106 E14.81533
+G1 X79.998 Y114.791 E14.82582
+G1 X79.998 Y114.439 E14.83755
+G1 X80.000 Y114.332 E14.84110
+G1 X79.999 Y114.230 E14.84449
+G1 X79.999 Y113.995 E14.85233
+G1 X80.000 Y113.720 E14.86147
+G1 X79.999 Y113.445 E14.87064
+G1 X80.001 Y113.245 E14.87732
+G1 X80.002 Y112.967 E14.88657
+G1 X80.002 Y112.709 E14.89515
+G1 X80.000 Y112.608 E14.89853
+G1 X80.001 Y112.260 E14.91012
+G1 X80.000 Y112.090 E14.91575
+G1 X80.000 Y111.867 E14.92320
+G1 X80.001 Y111.534 E14.93429
+G1 X80.000 Y111.376 E14.93956
+G1 X80.001 Y111.162 E14.94665
+G1 X80.001 Y110.863 E14.95661
+G1 X79.999 Y110.745 E14.96056
+G1 X80.001 Y110.594 E14.96559
+G1 X79.998 Y110.261 E14.97668
+G1 X80.000 Y110.074 E14.98289
+G1 X80.001 Y109.965 E14.98653
+G1 X80.002 Y109.700 E14.99536
+G1 X79.999 Y109.531 E15.00098
+G1 X79.998 Y109.314 E15.00822
+G1 X79.999 Y109.005 E15.01849
+G1 X80.000 Y108.782 E15.02592
+G1 X80.001 Y108.651 E15.03027
+G1 X80.000 Y108.265 E15.04315
+G1 X79.999 Y107.944 E15.05382
+G1 X80.000 Y107.690 E15.06229
+G1 X80.001 Y107.315 E15.07476
+G1 X80.002 Y107.183 E15.07917
+G1 X79.999 Y106.804 E15.09181
+G1 X80.000 Y106.536 E15.10072
+G1 X80.000 Y106.406 E15.10504
+G1 X80.001 Y106.233 E15.11080
+G1 X79.999 Y106.101 E15.11520
+G1 X79.999 Y105.991 E15.11888
+G1 X79.999 Y105.883 E15.12245
+G1 X80.001 Y105.528 E15.13429
+G1 X80.000 Y105.328 E15.14094
+G1 X79.999 Y105.207 E15.14496
+G1 X79.998 Y104.984 E15.15240
+G1 X80.000 Y104.784 E15.15905
+G1 X80.000 Y104.508 E15.16825
+G1 X80.001 Y104.316 E15.17463
+G1 X79.999 Y103.997 E15.18528
+G1 X80.000 Y103.644 E15.19702
+G1 X79.999 Y103.490 E15.20215
+G1 X79.999 Y103.372 E15.20608
+G1 X80.001 Y103.074 E15.21600
+G1 X79.999 Y102.702 E15.22838
+G1 X80.000 Y102.454 E15.23665
+G1 X79.999 Y102.162 E15.24636
+G1 X80.001 Y101.925 E15.25427
+G1 X79.998 Y101.719 E15.26113
+G1 X79.999 Y101.438 E15.27048
+G1 X80.002 Y101.298 E15.27514
+G1 X80.001 Y101.107 E15.28152
+G1 X80.001 Y100.979 E15.28577
+G1 X79.999 Y100.871 E15.28935
+G1 X79.999 Y100.671 E15.29602
+G1 X79.999 Y100.453 E15.30330
+G1 X79.998 Y100.161 E15.31299
+G1 X80.001 Y99.800 E15.32502
+G1 X80.000 Y99.440 E15.33701
+G1 X80.000 Y99.082 E15.34893
+G1 X79.998 Y98.690 E15.36198
+G1 X79.998 Y98.588 E15.36539
+G1 X79.999 Y98.369 E15.37268
+G1 X80.001 Y98.243 E15.37688
+G1 X80.001 Y98.055 E15.38314
+G1 X80.001 Y97.931 E15.38727
+G1 X80.001 Y97.724 E15.39417
+G1 X80.002 Y97.486 E15.40210
+G1 X80.002 Y97.146 E15.41341
+G1 X80.001 Y96.910 E15.42128
+G1 X79.999 Y96.708 E15.42798
+G1 X80.001 Y96.549 E15.43328
+G1 X80.000 Y96.203 E15.44482
+G1 X80.001 Y95.877 E15.45568
+G1 X80.001 Y95.520 E15.46756
+G1 X79.998 Y95.152 E15.47983
+G1 X80.001 Y94.817 E15.49098
+G1 X79.999 Y94.593 E15.49843
+G1 X80.001 Y94.403 E15.50474
+G1 X80.001 Y94.110 E15.51452
+G1 X80.000 Y93.968 E15.51923
+G1 X79.999 Y93.587 E15.53194
+G1 X80.000 Y93.347 E15.53992
+G1 X80.002 Y93.149 E15.54653
+G1 X80.000 Y92.761 E15.55942
+G1 X80.002 Y92.408 E15.57118
+G1 X80.002 Y92.228 E15.57720
+G1 X79.998 Y91.922 E15.58738
+G1 X80.000 Y91.532 E15.60034
+G1 X79.999 Y91.268 E15.60916
+G1 X79.999 Y90.894 E15.62159
+G1 X79.999 Y90.787 E15.62518
+G1 X80.000 Y90.559 E15.63277
+G1 X80.001 Y90.267 E15.64247
+G1 X79.998 Y90.154 E15.64624
+G1 X79.999 Y89.805 E15.65786
+G1 X80.001 Y89.454 E15.66957
+G1 X80.002 Y89.311 E15.67433
+G1 X79.999 Y89.053 E15.68291
+G1 X79.999 Y88.816 E15.69080
+G1 X79.998 Y88.554 E15.69954
+G1 X80.001 Y88.204 E15.71119
+G1 X80.001 Y87.984 E15.71850
+G1 X80.000 Y87.840 E15.72329
+G1 X80.001 Y87.685 E15.72846
+G1 X79.999 Y87.584 E15.73184
+G1 X80.000 Y87.430 E15.73697
+G1 X80.001 Y87.122 E15.74721
+G1 X80.000 Y86.832 E15.75688
+G1 X80.002 Y86.663 E15.76250
+G1 X80.000 Y86.525 E15.76709
+G1 X80.000 Y86.282 E15.77519
+G1 X79.999 Y86.127 E15.78037
+G1 X80.001 Y85.972 E15.78550
+G1 X80.001 Y85.658 E15.79596
+G1 X80.000 Y85.549 E15.79961
+G1 X80.000 Y85.302 E15.80784
+G1 X80.000 Y85.024 E15.81708
+G1 X79.998 Y84.636 E15.82999
+G1 X79.999 Y84.507 E15.83428
+G1 X80.001 Y84.344 E15.83972
+G1 X80.001 Y84.023 E15.85043
+G1 X80.000 Y83.789 E15.85819
+G1 X80.002 Y83.658 E15.86256
+G1 X79.999 Y83.547 E15.86625
+G1 X79.998 Y83.372 E15.87209
+G1 X79.999 Y83.177 E15.87858
+G1 X80.000 Y82.797 E15.89124
+G1 X79.999 Y82.562 E15.89908
+G1 X80.000 Y82.385 E15.90497
+G1 X80.001 Y82.281 E15.90842
+G1 X80.000 Y82.031 E15.91674
+G1 X80.002 Y81.655 E15.92926
+G1 X79.998 Y81.541 E15.93306
+G1 X80.001 Y81.185 E15.94494
+G1 X80.000 Y81.038 E15.94981
+G1 X80.001 Y80.832 E15.95669
+G1 X80.000 Y80.443 E15.96962
+G1 X79.998 Y80.116 E15.98053
+G1 X80.000 Y80.000 E15.98439
@@ -0,0 +1,269 @@
+; Commands between collinear segments for the motion replay: the part fan and the
+; flow change in the middle of straight lines split into 0.2 mm segments (4 steps
+; of E each, 2 at 50%). With MERGE_SEGMENTS, they must apply after the segments
+; before them, not to a merged block
+M302 P1 ; no heating
+G21
+G90
+M82
+G28
+G92 E0
+G1 Z0.30 F600
+G0 X80.000 Y80.000 F7800
+G1 F1800
+G1 X80.200 Y80.000 E0.04242
+G1 X80.400 Y80.000 E0.08484
+G1 X80.600 Y80.000 E0.12725
+G1 X80.800 Y80.000 E0.16967
+G1 X81.000 Y80.000 E0.21209
+G1 X81.200 Y80.000 E0.25451
+G1 X81.400 Y80.000 E0.29692
+G1 X81.600 Y80.000 E0.33934
+G1 X81.800 Y80.000 E0.38176
+G1 X82.000 Y80.000 E0.42418
+G1 X82.200 Y80.000 E0.46660
+G1 X82.400 Y80.000 E0.50901
+G1 X82.600 Y80.000 E0.55143
+G1 X82.800 Y80.000 E0.59385
+G1 X83.000 Y80.000 E0.63627
+G1 X83.200 Y80.000 E0.67869
+G1 X83.400 Y80.000 E0.72110
+G1 X83.600 Y80.000 E0.76352
+G1 X83.800 Y80.000 E0.80594
+G1 X84.000 Y80.000 E0.84836
+G1 X84.200 Y80.000 E0.89077
+G1 X84.400 Y80.000 E0.93319
+G1 X84.600 Y80.000 E0.97561
+G1 X84.800 Y80.000 E1.01803
+G1 X85.000 Y80.000 E1.06045
+G1 X85.200 Y80.000 E1.10286
+G1 X85.400 Y80.000 E1.14528
+G1 X85.600 Y80.000 E1.18770
+G1 X85.800 Y80.000 E1.23012
+G1 X86.000 Y80.000 E1.27253
+G1 X86.200 Y80.000 E1.31495
+G1 X86.400 Y80.000 E1.35737
+G1 X86.600 Y80.000 E1.39979
+G1 X86.800 Y80.000 E1.44221
+G1 X87.000 Y80.000 E1.48462
+G1 X87.200 Y80.000 E1.52704
+G1 X87.400 Y80.000 E1.56946
+G1 X87.600 Y80.000 E1.61188
+G1 X87.800 Y80.000 E1.65429
+G1 X88.000 Y80.000 E1.69671
+G1 X88.200 Y80.000 E1.73913
+G1 X88.400 Y80.000 E1.78155
+G1 X88.600 Y80.000 E1.82397
+G1 X88.800 Y80.000 E1.86638
+G1 X89.000 Y80.000 E1.90880
+G1 X89.200 Y80.000 E1.95122
+G1 X89.400 Y80.000 E1.99364
+G1 X89.600 Y80.000 E2.03606
+G1 X89.800 Y80.000 E2.07847
+G1 X90.000 Y80.000 E2.12089
+M106 S255
+G1 X90.200 Y80.000 E2.16331
+G1 X90.400 Y80.000 E2.20573
+G1 X90.600 Y80.000 E2.24814
+G1 X90.800 Y80.000 E2.29056
+G1 X91.000 Y80.000 E2.33298
+G1 X91.200 Y80.000 E2.37540
+G1 X91.400 Y80.000 E2.41782
+G1 X91.600 Y80.000 E2.46023
+G1 X91.800 Y80.000 E2.50265
+G1 X92.000 Y80.000 E2.54507
+G1 X92.200 Y80.000 E2.58749
+G1 X92.400 Y80.000 E2.62990
+G1 X92.600 Y80.000 E2.67232
+G1 X92.800 Y80.000 E2.71474
+G1 X93.000 Y80.000 E2.75716
+G1 X93.200 Y80.000 E2.79958
+G1 X93.400 Y80.000 E2.84199
+G1 X93.600 Y80.000 E2.88441
+G1 X93.800 Y80.000 E2.92683
+G1 X94.000 Y80.000 E2.96925
+G1 X94.200 Y80.000 E3.01166
+G1 X94.400 Y80.000 E3.05408
+G1 X94.600 Y80.000 E3.09650
+G1 X94.800 Y80.000 E3.13892
+G1 X95.000 Y80.000 E3.18134
+G1 X95.200 Y80.000 E3.22375
+G1 X95.400 Y80.000 E3.26617
+G1 X95.600 Y80.000 E3.30859
+G1 X95.800 Y80.000 E3.35101
+G1 X96.000 Y80.000 E3.39343
+G1 X96.200 Y80.000 E3.43584
+G1 X96.400 Y80.000 E3.47826
+G1 X96.600 Y80.000 E3.52068
+G1 X96.800 Y80.000 E3.56310
+G1 X97.000 Y80.000 E3.60551
+G1 X97.200 Y80.000 E3.64793
+G1 X97.400 Y80.000 E3.69035
+G1 X97.600 Y80.000 E3.73277
+G1 X97.800 Y80.000 E3.77519
+G1 X98.000 Y80.000 E3.81760
+G1 X98.200 Y80.000 E3.86002
+G1 X98.400 Y80.000 E3.90244
+G1 X98.600 Y80.000 E3.94486
+G1 X98.800 Y80.000 E3.98727
+G1 X99.000 Y80.000 E4.02969
+G1 X99.200 Y80.000 E4.07211
+G1 X99.400 Y80.000 E4.11453
+G1 X99.600 Y80.000 E4.15695
+G1 X99.800 Y80.000 E4.19936
+G1 X100.000 Y80.000 E4.24178
+M221 S50
+G1 X100.200 Y80.000 E4.28420
+G1 X100.400 Y80.000 E4.32662
+G1 X100.600 Y80.000 E4.36903
+G1 X100.800 Y80.000 E4.41145
+G1 X101.000 Y80.000 E4.45387
+G1 X101.200 Y80.000 E4.49629
+G1 X101.400 Y80.000 E4.53871
+G1 X101.600 Y80.000 E4.58112
+G1 X101.800 Y80.000 E4.62354
+G1 X102.000 Y80.000 E4.66596
+G1 X102.200 Y80.000 E4.70838
+G1 X102.400 Y80.000 E4.75080
+G1 X102.600 Y80.000 E4.79321
+G1 X102.800 Y80.000 E4.83563
+G1 X103.000 Y80.000 E4.87805
+G1 X103.200 Y80.000 E4.92047
+G1 X103.400 Y80.000 E4.96288
+G1 X103.600 Y80.000 E5.00530
+G1 X103.800 Y80.000 E5.04772
+G1 X104.000 Y80.000 E5.09014
+G1 X104.200 Y80.000 E5.13256
+G1 X104.400 Y80.000 E5.17497
+G1 X104.600 Y80.000 E5.21739
+G1 X104.800 Y80.000 E5.25981
+G1 X105.000 Y80.000 E5.30223
+G1 X105.200 Y80.000 E5.34464
+G1 X105.400 Y80.000 E5.38706
+G1 X105.600 Y80.000 E5.42948
+G1 X105.800 Y80.000 E5.47190
+G1 X106.000 Y80.000 E5.51432
+G1 X106.200 Y80.000 E5.55673
+G1 X106.400 Y80.000 E5.59915
+G1 X106.600 Y80.000 E5.64157
+G1 X106.800 Y80.000 E5.68399
+G1 X107.000 Y80.000 E5.72641
+G1 X107.200 Y80.000 E5.76882
+G1 X107.400 Y80.000 E5.81124
+G1 X107.600 Y80.000 E5.85366
+G1 X107.800 Y80.000 E5.89608
+G1 X108.000 Y80.000 E5.93849
+G1 X108.200 Y80.000 E5.98091
+G1 X108.400 Y80.000 E6.02333
+G1 X108.600 Y80.000 E6.06575
+G1 X108.800 Y80.000 E6.10817
+G1 X109.000 Y80.000 E6.15058
+G1 X109.200 Y80.000 E6.19300
+G1 X109.400 Y80.000 E6.23542
+G1 X109.600 Y80.000 E6.27784
+G1 X109.800 Y80.000 E6.32025
+G1 X110.000 Y80.000 E6.36267
+M106 S0
+G1 X110.200 Y80.000 E6.40509
+G1 X110.400 Y80.000 E6.44751
+G1 X110.600 Y80.000 E6.48993
+G1 X110.800 Y80.000 E6.53234
+G1 X111.000 Y80.000 E6.57476
+G1 X111.200 Y80.000 E6.61718
+G1 X111.400 Y80.000 E6.65960
+G1 X111.600 Y80.000 E6.70201
+G1 X111.800 Y80.000 E6.74443
+G1 X112.000 Y80.000 E6.78685
+G1 X112.200 Y80.000 E6.82927
+G1 X112.400 Y80.000 E6.87169
+G1 X112.600 Y80.000 E6.91410
+G1 X112.800 Y80.000 E6.95652
+G1 X113.000 Y80.000 E6.99894
+G1 X113.200 Y80.000 E7.04136
+G1 X113.400 Y80.000 E7.08378
+G1 X113.600 Y80.000 E7.12619
+G1 X113.800 Y80.000 E7.16861
+G1 X114.000 Y80.000 E7.21103
+G1 X114.200 Y80.000 E7.25345
+G1 X114.400 Y80.000 E7.29586
+G1 X114.600 Y80.000 E7.33828
+G1 X114.800 Y80.000 E7.38070
+G1 X115.000 Y80.000 E7.42312
+G1 X115.200 Y80.000 E7.46554
+G1 X115.400 Y80.000 E7.50795
+G1 X115.600 Y80.000 E7.55037
+G1 X115.800 Y80.000 E7.59279
+G1 X116.000 Y80.000 E7.63521
+G1 X116.200 Y80.000 E7.67762
+G1 X116.400 Y80.000 E7.72004
+G1 X116.600 Y80.000 E7.76246
+G1 X116.800 Y80.000 E7.80488
+G1 X117.000 Y80.000 E7.84730
+G1 X117.200 Y80.000 E7.88971
+G1 X117.400 Y80.000 E7.93213
+G1 X117.600 Y80.000 E7.97455
+G1 X117.800 Y80.000 E8.01697
+G1 X118.000 Y80.000 E8.05938
+G1 X118.200 Y80.000 E8.10180
+G1 X118.400 Y80.000 E8.14422
+G1 X118.600 Y80.000 E8.18664
+G1 X118.800 Y80.000 E8.22906
+G1 X119.000 Y80.000 E8.27147
+G1 X119.200 Y80.000 E8.31389
+G1 X119.400 Y80.000 E8.35631
+G1 X119.600 Y80.000 E8.39873
+G1 X119.800 Y80.000 E8.44115
+G1 X120.000 Y80.000 E8.48356
+M221 S100
+G1 X120.200 Y80.000 E8.52598
+G1 X120.400 Y80.000 E8.56840
+G1 X120.600 Y80.000 E8.61082
+G1 X120.800 Y80.000 E8.65323
+G1 X121.000 Y80.000 E8.69565
+G1 X121.200 Y80.000 E8.73807
+G1 X121.400 Y80.000 E8.78049
+G1 X121.600 Y80.000 E8.82291
+G1 X121.800 Y80.000 E8.86532
+G1 X122.000 Y80.000 E8.90774
+G1 X122.200 Y80.000 E8.95016
+G1 X122.400 Y80.000 E8.99258
+G1 X122.600 Y80.000 E9.03499
+G1 X122.800 Y80.000 E9.07741
+G1 X123.000 Y80.000 E9.11983
+G1 X123.200 Y80.000 E9.16225
+G1 X123.400 Y80.000 E9.20467
+G1 X123.600 Y80.000 E9.24708
+G1 X123.800 Y80.000 E9.28950
+G1 X124.000 Y80.000 E9.33192
+G1 X124.200 Y80.000 E9.37434
+G1 X124.400 Y80.000 E9.41676
+G1 X124.600 Y80.000 E9.45917
+G1 X124.800 Y80.000 E9.50159
+G1 X125.000 Y80.000 E9.54401
+G1 X125.200 Y80.000 E9.58643
+G1 X125.400 Y80.000 E9.62884
+G1 X125.600 Y80.000 E9.67126
+G1 X125.800 Y80.000 E9.71368
+G1 X126.000 Y80.000 E9.75610
+G1 X126.200 Y80.000 E9.79852
+G1 X126.400 Y80.000 E9.84093
+G1 X126.600 Y80.000 E9.88335
+G1 X126.800 Y80.000 E9.92577
+G1 X127.000 Y80.000 E9.96819
+G1 X127.200 Y80.000 E10.01060
+G1 X127.400 Y80.000 E10.05302
+G1 X127.600 Y80.000 E10.09544
+G1 X127.800 Y80.000 E10.13786
+G1 X128.000 Y80.000 E10.18028
+G1 X128.200 Y80.000 E10.22269
+G1 X128.400 Y80.000 E10.26511
+G1 X128.600 Y80.000 E10.30753
+G1 X128.800 Y80.000 E10.34995
+G1 X129.000 Y80.000 E10.39236
+G1 X129.200 Y80.000 E10.43478
+G1 X129.400 Y80.000 E10.47720
+G1 X129.600 Y80.000 E10.51962
+G1 X129.800 Y80.000 E10.56204
+G1 X130.000 Y80.000 E10.60445
+M107
+G0 Z10 F600
@@ -0,0 +1,206 @@
+/**
+ * Model of the mechanics and of the heaters of the printer (see printer.h).
+ */
+#include <string.h>
+
+#include "printer.h"
+
+#include "../../Marlin/Marlin.h"
+#include "../../Marlin/planner.h"
+#include "../../Marlin/stepper.h"
+#include "../../Marlin/temperature.h"
+
+using host::Interrupt;
+using host::Time;
+using host::SECOND;
+
+namespace motion {
+
+namespace {
+
+    const float AMBIENT = 25;           //!< Temperature of the room (°C)
+
+    // Hotend: about 70 s to 200 °C at full power
+    const float HOTEND_POWER = 40;      //!< W
+    const float HOTEND_CAPACITY = 10;   //!< J/K
+    const float HOTEND_LOSS = 0.15;     //!< W/K
+
+    // Bed: about 130 s to 60 °C
+    const float BED_POWER = 200;
+    const float BED_CAPACITY = 600;
+    const float BED_LOSS = 2;
+
+    const float steps_per_mm[] = DEFAULT_AXIS_STEPS_PER_UNIT;
+
+    // Set the level of an input pin
+    #define SET_INPUT_LEVEL(IO, LEVEL) _SET_INPUT_LEVEL(IO, LEVEL)
+    #define _SET_INPUT_LEVEL(IO, LEVEL) do{ if (LEVEL) DIO ## IO ## _RPORT |= _BV(DIO ## IO ## _PIN); \
+                                            else DIO ## IO ## _RPORT &= ~_BV(DIO ## IO ## _PIN); }while(0)
+    // Level of an endstop pin, as Endstops::update() reads it
+    #define ENDSTOP_LEVEL(TRIGGERED, INVERTING) ((TRIGGERED) ? !(INVERTING) : (INVERTING))
+
+    const uint64_t FNV_OFFSET = 0xCBF29CE484222325ULL;
+
+    uint64_t fnv1a(uint64_t hash, const void* data, size_t size)
+    {
+        const uint8_t* bytes = static_cast<const uint8_t*>(data);
+        while(size--)
+            hash = (hash ^ *bytes++) * 0x100000001B3ULL;
+        return hash;
+    }
+
+    //! Value of the ADC for a temperature, from a thermistor table of the firmware ({raw * OVERSAMPLENR, °C} by raw).
+    uint16_t adc_value(const short (*table)[2], uint8_t length, float temperature)
+    {
+        for(uint8_t index = 1; index < length; ++index)
+        {
+            const float raw0 = table[index - 1][0], temp0 = table[index - 1][1];
+            const float raw1 = table[index][0], temp1 = table[index][1];
+            if(temperature >= temp1)
+                return static_cast<uint16_t>((raw0 + (raw1 - raw0) * (temperature - temp0) / (temp1 - temp0)) / OVERSAMPLENR);
+        }
+        return static_cast<uint16_t>(table[length - 1][0] / OVERSAMPLENR);
+    }
+
+    float duty(uint8_t soft_pwm_amount)
+    {
+        return soft_pwm_amount >= 128 ? 1.0f : soft_pwm_amount / 128.0f;
+    }
+}
+
+//! Start the model with the carriage at a position (mm from the minimum endstops).
+void Printer::start(const float position[NB_AXES - 1])
+{
+    for(int axis = 0; axis < NB_AXES - 1; ++axis)
+        position_[axis] = static_cast<int64_t>(position[axis] * steps_per_mm[axis]);
+    hotend_ = bed_ = AMBIENT;
+    last_heat_ = host::now();
+    statistics_ = Statistics{};
+    statistics_.blocks_digest = statistics_.steps_digest = FNV_OFFSET;
+    starved_since_ = host::NEVER;
+    update_endstops();
+}
+
+//! Record the blocks and the step timeline in files (nullptr for none).
+void Printer::record(FILE* blocks, FILE* steps)
+{
+    blocks_file_ = blocks;
+    steps_file_ = steps;
+    if(blocks_file_ != nullptr)
+        fprintf(blocks_file_, "# time_ns steps_x steps_y steps_z steps_e step_events direction accelerate_until "
+                              "decelerate_after nominal_rate initial_rate final_rate acceleration_steps_per_s2 "
+                              "millimeters entry_speed nominal_speed\n");
+    if(steps_file_ != nullptr)
+        fprintf(steps_file_, "# time_ns x y z e\n");
+}
+
+void Printer::before(Interrupt interrupt)
+{
+    if(interrupt == Interrupt::Stepper)
+    {
+        for(int axis = 0; axis < NB_AXES; ++axis)
+            count_position_[axis] = static_cast<int32_t>(stepper.position(static_cast<AxisEnum>(axis)));
+        update_endstops();
+    }
+    else
+        heat();
+}
+
+void Printer::after(Interrupt interrupt)
+{
+    if(interrupt == Interrupt::Stepper)
+    {
+        step_done();
+        if(stepper.current_block != block_)
+        {
+            block_ = stepper.current_block;
+            if(block_ != nullptr)
+                block_started();
+        }
+        if(block_ == nullptr && statistics_.blocks > 0 && starved_since_ == host::NEVER && !planner.blocks_queued())
+            starved_since_ = host::now();
+        update_endstops();
+        return;
+    }
+
+    // The ISR started the conversion of a channel: its value is read by the next ISR
+    const uint8_t channel = (ADMUX & 0x07) | ((ADCSRB & _BV(MUX5)) ? 8 : 0);
+    ADC = channel == TEMP_0_PIN ? adc_value(HEATER_0_TEMPTABLE, HEATER_0_TEMPTABLE_LEN, hotend_)
+        : channel == TEMP_BED_PIN ? adc_value(BEDTEMPTABLE, BEDTEMPTABLE_LEN, bed_)
+        : 0;
+}
+
+//! The minimum endstops are triggered at position 0 and below.
+void Printer::update_endstops()
+{
+    SET_INPUT_LEVEL(X_MIN_PIN, ENDSTOP_LEVEL(position_[X_AXIS] <= 0, X_MIN_ENDSTOP_INVERTING));
+    SET_INPUT_LEVEL(Y_MIN_PIN, ENDSTOP_LEVEL(position_[Y_AXIS] <= 0, Y_MIN_ENDSTOP_INVERTING));
+    SET_INPUT_LEVEL(Z_MIN_PIN, ENDSTOP_LEVEL(position_[Z_AXIS] <= 0, Z_MIN_ENDSTOP_INVERTING));
+}
+
+//! Steps made by the stepper ISR: the changes of the position it counts.
+void Printer::step_done()
+{
+    int32_t steps[NB_AXES];
+    bool moved = false;
+    for(int axis = 0; axis < NB_AXES; ++axis)
+    {
+        steps[axis] = static_cast<int32_t>(stepper.position(static_cast<AxisEnum>(axis))) - count_position_[axis];
+        if(steps[axis] == 0)
+            continue;
+        moved = true;
+        position_[axis] += steps[axis];
+        statistics_.steps[axis] += steps[axis] < 0 ? -steps[axis] : steps[axis];
+    }
+    if(!moved)
+        return;
+
+    const Time time = host::now();
+    if(statistics_.first_step == 0)
+        statistics_.first_step = time;
+    statistics_.last_step = time;
+    statistics_.steps_digest = fnv1a(fnv1a(statistics_.steps_digest, &time, sizeof(time)), steps, sizeof(steps));
+    if(steps_file_ != nullptr)
+        fprintf(steps_file_, "%llu %d %d %d %d\n", static_cast<unsigned long long>(time),
+                steps[X_AXIS], steps[Y_AXIS], steps[Z_AXIS], steps[E_AXIS]);
+}
+
+//! A block is started by the stepper ISR: its trapezoid is final.
+void Printer::block_started()
+{
+    const block_t& block = *stepper.current_block;
+    ++statistics_.blocks;
+    if(starved_since_ != host::NEVER)
+    {
+        ++statistics_.underruns;
+        statistics_.starved += host::now() - starved_since_;
+        starved_since_ = host::NEVER;
+    }
+    statistics_.millimeters += block.millimeters;
+    if(block.fan_speed[0] > 0)
+        statistics_.fan_millimeters += block.millimeters;
+
+    char line[256];
+    snprintf(line, sizeof(line), "%ld %ld %ld %ld %lu 0x%02X %ld %ld %lu %lu %lu %lu %.5f %.5f %.5f",
+             static_cast<long>(block.steps[X_AXIS]), static_cast<long>(block.steps[Y_AXIS]),
+             static_cast<long>(block.steps[Z_AXIS]), static_cast<long>(block.steps[E_AXIS]),
+             static_cast<unsigned long>(block.step_event_count), block.direction_bits,
+             static_cast<long>(block.accelerate_until), static_cast<long>(block.decelerate_after),
+             static_cast<unsigned long>(block.nominal_rate), static_cast<unsigned long>(block.initial_rate),
+             static_cast<unsigned long>(block.final_rate), static_cast<unsigned long>(block.acceleration_steps_per_s2),
+             block.millimeters, block.entry_speed, block.nominal_speed);
+    statistics_.blocks_digest = fnv1a(statistics_.blocks_digest, line, strlen(line));
+    if(blocks_file_ != nullptr)
+        fprintf(blocks_file_, "%llu %s\n", static_cast<unsigned long long>(host::now()), line);
+}
+
+//! Temperatures since the last call.
+void Printer::heat()
+{
+    const float seconds = static_cast<float>(host::now() - last_heat_) / SECOND;
+    last_heat_ = host::now();
+    hotend_ += seconds * (HOTEND_POWER * duty(thermalManager.soft_pwm_amount[0]) - HOTEND_LOSS * (hotend_ - AMBIENT)) / HOTEND_CAPACITY;
+    bed_ += seconds * (BED_POWER * duty(thermalManager.soft_pwm_amount_bed) - BED_LOSS * (bed_ - AMBIENT)) / BED_CAPACITY;
+}
+
+}
@@ -0,0 +1,78 @@
+/**
+ * Model of the mechanics and of the heaters of the printer for the host
+ * build of the whole firmware.
+ *
+ * It follows the calls of the ISRs (see hal/timers.h):
+ *
+ *  - the carriage moves with the steps made by the stepper ISR and the
+ *    minimum endstops are triggered at position 0;
+ *  - the hotend and the bed heat with the duty cycles of the soft PWM and
+ *    cool down to the ambient temperature (first order models). The ADC
+ *    returns their values through the thermistor tables of the firmware.
+ *
+ * It also records what the stepper executes: each block when the stepper
+ * ISR starts it and the steps of each ISR (the step timeline), and the
+ * underruns: the stepper finished a block and the planner had no other one.
+ * They include the waits of the firmware for the end of the moves (G28,
+ * M400...).
+ */
+#ifndef MOTION_PRINTER_H
+#define MOTION_PRINTER_H
+
+#include <stdio.h>
+#include <stdint.h>
+
+#include "../hal/timers.h"
+
+namespace motion {
+
+class Printer: public host::InterruptObserver
+{
+public:
+    static const int NB_AXES = 4; //!< X, Y, Z, E
+
+    struct Statistics
+    {
+        uint32_t blocks;                //!< Blocks started by the stepper
+        double millimeters;             //!< Total length of these blocks
+        double fan_millimeters;         //!< Length of the blocks with the part fan on
+        uint64_t steps[NB_AXES];        //!< Steps made on each axis (absolute values)
+        host::Time first_step;          //!< Time of the first step
+        host::Time last_step;           //!< Time of the last step
+        uint64_t blocks_digest;         //!< FNV-1a of the recorded blocks
+        uint64_t steps_digest;          //!< FNV-1a of the step timeline
+        uint32_t underruns;             //!< Times the stepper ran out of blocks before the next one
+        host::Time starved;             //!< Total time without a block between two blocks
+    };
+
+    void start(const float position[NB_AXES - 1]);
+    void record(FILE* blocks, FILE* steps);
+
+    const Statistics& statistics() const { return statistics_; }
+    float hotend_temperature() const { return hotend_; }
+    float bed_temperature() const { return bed_; }
+
+    void before(host::Interrupt interrupt) override;
+    void after(host::Interrupt interrupt) override;
+
+private:
+    void update_endstops();
+    void step_done();
+    void block_started();
+    void heat();
+
+private:
+    int64_t position_[NB_AXES] = {};        //!< Position of the carriage (steps)
+    int32_t count_position_[NB_AXES] = {};  //!< Position counted by the stepper before its ISR
+    const void* block_ = nullptr;           //!< Block executed by the stepper
+    host::Time starved_since_ = host::NEVER; //!< The stepper has no block since this time
+    float hotend_ = 0, bed_ = 0;
+    host::Time last_heat_ = 0;
+    FILE* blocks_file_ = nullptr;
+    FILE* steps_file_ = nullptr;
+    Statistics statistics_ = {};
+};
+
+}
+
+#endif // MOTION_PRINTER_H
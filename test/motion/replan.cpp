@@ -0,0 +1,156 @@
+/**
+ * Incremental planning of Planner::recalculate() against a full re-plan.
+ *
+ * Random moves (short and long segments, changes of direction and of speed)
+ * are added with Planner::buffer_line() while the blocks are taken by an
+ * emulated stepper, sometimes past block_buffer_planned, and sometimes
+ * until the buffer is empty. After each move, a copy of the buffer is
+ * planned again from the tail to the newest block, like the planner did
+ * before block_buffer_planned: a reverse pass, a forward pass and all the
+ * trapezoids. The entry speeds and the trapezoids of the planner must be
+ * those of the full re-plan.
+ *
+ * The exit status is not 0 if a block differs.
+ */
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <random>
+
+#include "../../Marlin/Marlin.h"
+#include "../../Marlin/configuration_store.h"
+#include "../../Marlin/temperature.h"
+// The buffer and the passes of the planner are private
+#define private public
+#include "../../Marlin/planner.h"
+#undef private
+
+namespace
+{
+    const unsigned NB_MOVES = 200000;
+
+    std::mt19937_64 rng{20171016};
+
+    uint32_t uniform(uint32_t min, uint32_t max) { return std::uniform_int_distribution<uint32_t>{min, max}(rng); }
+    float uniform_real(float min, float max) { return std::uniform_real_distribution<float>{min, max}(rng); }
+
+    block_t ring[BLOCK_BUFFER_SIZE];            //!< Copy of the buffer, planned from the tail
+    unsigned nb_blocks = 0, nb_planned_consumed = 0, nb_emptied = 0, nb_failures = 0;
+
+    //! The buffer planned again from the tail, as recalculate() did before block_buffer_planned.
+    void full_replan()
+    {
+        memcpy(ring, Planner::block_buffer, sizeof(ring));
+        const uint8_t tail = Planner::block_buffer_tail, head = Planner::block_buffer_head,
+                      newest = Planner::prev_block_index(head);
+
+        // The entry of the tail is kept: the stepper may be executing it. The newest block is planned to stop, as by _buffer_line
+        block_t& last = ring[newest];
+        if(newest != tail)
+            last.entry_speed = min(last.max_entry_speed,
+                                   Planner::max_allowable_speed(-last.acceleration, MINIMUM_PLANNER_SPEED, last.millimeters));
+
+        for(uint8_t b = newest; b != tail; )
+        {
+            const uint8_t previous = Planner::prev_block_index(b);
+            if(previous == tail || TEST(ring[previous].flag, BLOCK_BIT_START_FROM_FULL_HALT))
+                break;
+            Planner::reverse_pass_kernel(&ring[previous], &ring[b]);
+            b = previous;
+        }
+        for(uint8_t b = Planner::next_block_index(tail); b != head; b = Planner::next_block_index(b))
+        {
+            Planner::forward_pass_kernel(&ring[Planner::prev_block_index(b)], &ring[b]);
+        }
+        for(uint8_t b = tail; b != head; b = Planner::next_block_index(b))
+        {
+            const float exit_speed = b == newest ? MINIMUM_PLANNER_SPEED : ring[Planner::next_block_index(b)].entry_speed;
+            Planner::calculate_trapezoid_for_block(&ring[b], ring[b].entry_speed / ring[b].nominal_speed,
+                                                    exit_speed / ring[b].nominal_speed);
+        }
+    }
+
+    //! Compare the buffer of the planner with the full re-plan.
+    void compare(unsigned move)
+    {
+        for(uint8_t b = Planner::block_buffer_tail; b != Planner::block_buffer_head; b = Planner::next_block_index(b))
+        {
+            const block_t &planned = Planner::block_buffer[b], &full = ring[b];
+            ++nb_blocks;
+            if(planned.entry_speed == full.entry_speed && planned.initial_rate == full.initial_rate &&
+               planned.final_rate == full.final_rate && planned.accelerate_until == full.accelerate_until &&
+               planned.decelerate_after == full.decelerate_after)
+                continue;
+            if(nb_failures++ < 10)
+                printf("    FAILED: move %u, block %u (tail %u, planned %u, head %u): entry %.4f, rates %u -> %u, steps %u..%u"
+                       " instead of %.4f, %u -> %u, %u..%u\n", move, b, Planner::block_buffer_tail,
+                       Planner::block_buffer_planned, Planner::block_buffer_head, planned.entry_speed,
+                       planned.initial_rate, planned.final_rate, planned.accelerate_until, planned.decelerate_after,
+                       full.entry_speed, full.initial_rate, full.final_rate, full.accelerate_until, full.decelerate_after);
+        }
+    }
+
+    //! The stepper takes the current block and discards the one before.
+    void consume(unsigned count)
+    {
+        while(count-- > 0 && Planner::blocks_queued())
+        {
+            if(TEST(Planner::block_buffer[Planner::block_buffer_tail].flag, BLOCK_BIT_BUSY))
+            {
+                if(Planner::block_buffer_tail == Planner::block_buffer_planned)
+                    ++nb_planned_consumed;
+                Planner::discard_current_block();
+            }
+            Planner::get_current_block();
+        }
+    }
+}
+
+int main()
+{
+    settings.reset();
+    thermalManager.allow_cold_extrude = true;
+
+    float position[XYZE] = { 100, 100, 10, 0 };
+    planner.set_position_mm(position[X_AXIS], position[Y_AXIS], position[Z_AXIS], position[E_AXIS]);
+
+    for(unsigned move = 0; move < NB_MOVES; ++move)
+    {
+        // Short segments (curves), long moves, a few reversals and stops
+        const float length = uniform(0, 3) == 0 ? uniform_real(2, 40) : uniform_real(0.05, 1),
+                    angle = uniform_real(0, 2 * M_PI),
+                    feedrate = uniform(0, 3) == 0 ? uniform_real(5, 150) : 60;
+        position[X_AXIS] = constrain(position[X_AXIS] + length * cosf(angle), 0, X_BED_SIZE);
+        position[Y_AXIS] = constrain(position[Y_AXIS] + length * sinf(angle), 0, Y_BED_SIZE);
+        if(uniform(0, 200) == 0)
+            position[Z_AXIS] += 0.2;
+        position[E_AXIS] += length * 0.033;
+
+        // Room for the new block
+        if(Planner::movesplanned() >= BLOCK_BUFFER_SIZE - 1)
+            consume(uniform(1, 4));
+        else if(uniform(0, 500) == 0)
+        {
+            consume(BLOCK_BUFFER_SIZE + 1);
+            ++nb_emptied;
+        }
+        else
+            consume(uniform(0, 2));
+
+        planner.buffer_line(position[X_AXIS], position[Y_AXIS], position[Z_AXIS], position[E_AXIS], feedrate, 0);
+        if(!Planner::blocks_queued())
+            continue;
+
+        full_replan();
+        compare(move);
+    }
+
+    printf("replan: %u moves, %u blocks compared, block_buffer_planned consumed %u times, buffer emptied %u times, %u differences\n",
+           NB_MOVES, nb_blocks, nb_planned_consumed, nb_emptied, nb_failures);
+    printf("    %s\n", nb_failures == 0 ? "OK" : "FAILED");
+
+    // As on the printer, the objects of the firmware are never destroyed (some are cleared with memset)
+    fflush(stdout);
+    _Exit(nb_failures == 0 ? 0 : 1);
+}
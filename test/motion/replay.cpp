@@ -0,0 +1,323 @@
+/**
+ * Replay of a G-code file on the whole firmware, on the host.
+ *
+ * The file is streamed over the serial port like a host does (a line is
+ * sent on each "ok", with a number of lines in flight) or printed from an
+ * emulated SD card (M23, M24). The firmware runs its main loop with the
+ * stepper and temperature ISRs called by the emulated timers, a model of
+ * the printer (see printer.h) and the DGUS panel. At the end, it reports:
+ *
+ *  - the blocks started by the stepper, their length and blocks/mm;
+ *  - the time spent by the host CPU in Planner::_buffer_line per block,
+ *    without the waits for room in the buffer, and the blocks/s it gives;
+ *  - the simulated print time (virtual time), the steps per axis and the
+ *    length moved with the part fan on;
+ *  - the underruns of the stepper and the time it waited for a block;
+ *  - digests of the block stream and of the step timeline, to detect a
+ *    change of the motion.
+ *
+ * Only the calls of the Arduino API, the transfers and the waits take
+ * virtual time, so each call of Planner::_buffer_line is charged a rough
+ * cost on the AVR: without it, the main loop would never fall behind the
+ * stepper.
+ *
+ * The block stream and the step timeline can be written to files.
+ *
+ * The exit status is not 0 if the firmware reported an error.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <chrono>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "printer.h"
+#include "../hal/host_port.h"
+#include "../hal/sd_card.h"
+#include "../hal/timers.h"
+#include "../lcd/dgus_panel.h"
+
+#include "../../Marlin/Marlin.h"
+#include "../../Marlin/cardreader.h"
+#include "../../Marlin/planner.h"
+
+using host::Time;
+using host::US;
+using host::MS;
+using host::SECOND;
+typedef std::chrono::steady_clock Clock;
+
+namespace
+{
+    const uint8_t LCD_PORT = 2;
+    const uint32_t LCD_BAUDRATE = 115200;
+    const Time TIMEOUT = 3600 * SECOND;       //!< Of simulated time
+    Time deadline = host::NEVER;
+    const float START_POSITION[] = {100, 100, 20}; //!< Position of the carriage at power on (mm)
+    const Time PLANNER_COST = 1 * MS;       //!< Of a call of Planner::_buffer_line on the AVR (16000 cycles)
+    const char SD_FILE[] = "print.gco";
+
+    // ----------------------------------------------------------------
+    // Host computer
+    // ----------------------------------------------------------------
+
+    //! Send the lines of a G-code file, with a number of them waiting for their "ok".
+    class Streamer: public host::HostPort
+    {
+    public:
+        Streamer(const std::vector<std::string>& lines, unsigned window)
+        : HostPort{0, BAUDRATE}, lines_{lines}, window_{window} {}
+
+        void start() { while(next_ < lines_.size() && next_ - nb_ok_ < window_) send_line(); }
+        void add(const std::string& line) { lines_.push_back(line); start(); }
+        bool done() const { return nb_ok_ >= lines_.size(); }
+        unsigned nb_errors() const { return nb_errors_; }
+
+        void received(uint8_t byte, Time time) override
+        {
+            const size_t nb_lines = lines().size();
+            HostPort::received(byte, time);
+            if(lines().size() == nb_lines)
+                return;
+
+            const std::string& line = lines().back();
+            if(line.compare(0, 2, "ok") == 0)
+            {
+                ++nb_ok_;
+                start();
+            }
+            else if(line.compare(0, 6, "Error:") == 0)
+            {
+                ++nb_errors_;
+                printf("    < %s\n", line.c_str());
+                // kill() never returns
+                if(line.find(MSG_ERR_KILLED) != std::string::npos)
+                {
+                    printf("    FAILED: printer halted\n");
+                    fflush(stdout);
+                    _Exit(1);
+                }
+            }
+        }
+
+    private:
+        void send_line() { send(lines_[next_++] + "\n"); }
+
+    private:
+        std::vector<std::string> lines_;
+        const unsigned window_;
+        size_t next_ = 0;
+        size_t nb_ok_ = 0;
+        unsigned nb_errors_ = 0;
+    };
+
+    //! Lines of a G-code file without the comments and the empty lines, as hosts send them.
+    std::vector<std::string> read_lines(const char* path)
+    {
+        std::vector<std::string> lines;
+        std::ifstream file{path};
+        std::string line;
+        while(std::getline(file, line))
+        {
+            line = line.substr(0, line.find(';'));
+            const size_t start = line.find_first_not_of(" \t\r");
+            if(start != std::string::npos)
+                lines.push_back(line.substr(start, line.find_last_not_of(" \t\r") + 1 - start));
+        }
+        return lines;
+    }
+
+    // ----------------------------------------------------------------
+    // Time in the planner
+    // ----------------------------------------------------------------
+
+    const void* const buffer_line = reinterpret_cast<const void*>(&Planner::_buffer_line);
+    Time planner_cost = PLANNER_COST;
+    unsigned planner_depth = 0;
+    unsigned nb_plans = 0;
+    bool planner_waiting = false;
+    Clock::time_point planner_start;
+    Clock::duration planner_time{};
+    unsigned nb_parsed_ahead = 0;               //!< Lines of the SD card stored parsed by the look-ahead
+
+    //! Forward the calls of the ISRs to the printer. The ISRs called in the planner are not planner time.
+    class Interrupts: public host::InterruptObserver
+    {
+    public:
+        explicit Interrupts(motion::Printer& printer): printer_{printer} {}
+
+        void before(host::Interrupt interrupt) override
+        {
+            start_ = Clock::now();
+            printer_.before(interrupt);
+        }
+
+        void after(host::Interrupt interrupt) override
+        {
+            printer_.after(interrupt);
+            planner_start += Clock::now() - start_;
+        }
+
+    private:
+        motion::Printer& printer_;
+        Clock::time_point start_;
+    };
+}
+
+// planner.cpp is built with -finstrument-functions: time Planner::_buffer_line and charge its cost on the AVR
+extern "C" __attribute__((no_instrument_function)) void __cyg_profile_func_enter(void* function, void*)
+{
+    if(function == buffer_line && planner_depth++ == 0)
+    {
+        ++nb_plans;
+        host::charge(planner_cost);
+        planner_waiting = false;
+        planner_start = Clock::now();
+    }
+}
+
+extern "C" __attribute__((no_instrument_function)) void __cyg_profile_func_exit(void* function, void*)
+{
+    if(function == buffer_line && --planner_depth == 0)
+        planner_time += Clock::now() - planner_start;
+}
+
+// Linked with --wrap: the planner waits for room in idle(). The wait is not planner time, the code before
+// and after it is. The firmware calls idle() in all its waits: stop there if the file never ends.
+extern "C" void __real__Z4idlev();
+extern "C" void __wrap__Z4idlev()
+{
+    if(host::now() > deadline)
+    {
+        printf("    FAILED: timeout\n");
+        fflush(stdout);
+        _Exit(1);
+    }
+
+    if(planner_depth > 0 && !planner_waiting)
+    {
+        planner_time += Clock::now() - planner_start;
+        planner_waiting = true;
+    }
+    __real__Z4idlev();
+    planner_start = Clock::now();
+}
+
+#if ENABLED(BINARY_GCODE)
+// Linked with --wrap: the look-ahead stores the lines it reads parsed (BINARY_GCODE), count them
+extern "C" uint8_t __real__ZN11GCodeParser8tokenizeEPKcPc(const char* line, char* record);
+extern "C" uint8_t __wrap__ZN11GCodeParser8tokenizeEPKcPc(const char* line, char* record)
+{
+    const uint8_t length = __real__ZN11GCodeParser8tokenizeEPKcPc(line, record);
+    if(length > 0)
+        ++nb_parsed_ahead;
+    return length;
+}
+#endif
+
+int main(int argc, char* argv[])
+{
+    unsigned window = 1;
+    bool sd_print = false;
+    const char* lookahead = nullptr;
+    FILE* blocks_file = nullptr;
+    FILE* steps_file = nullptr;
+    int option;
+    while((option = getopt(argc, argv, "w:dl:c:b:s:")) != -1)
+    {
+        switch(option)
+        {
+            case 'w': window = static_cast<unsigned>(atoi(optarg)); break;
+            case 'd': sd_print = true; break;
+            case 'l': lookahead = optarg; break;
+            case 'c': planner_cost = static_cast<Time>(atoi(optarg)) * US; break;
+            case 'b': blocks_file = fopen(optarg, "w"); break;
+            case 's': steps_file = fopen(optarg, "w"); break;
+            default: break;
+        }
+    }
+    if(optind >= argc || window < 1)
+    {
+        printf("Usage: %s [-w lines in flight] [-d (SD print) [-l SD look-ahead 0|1]] [-c planner cost (us)]\n"
+               "       [-b blocks.txt] [-s steps.txt] file.gcode\n", argv[0]);
+        return 2;
+    }
+
+    // From the SD card, the host only starts the print
+    const auto lines = read_lines(argv[optind]);
+    std::vector<std::string> commands;
+    host::SdCard sd_card;
+    if(sd_print)
+    {
+        std::ifstream file{argv[optind], std::ios::binary};
+        sd_card.add_file(SD_FILE, std::string{std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}});
+        sd_card.insert();
+        commands = {"M21", std::string{"M23 "} + SD_FILE, "M24"};
+        if(lookahead != nullptr)
+            commands.insert(commands.begin(), std::string{"M780 L"} + lookahead);
+    }
+    Streamer streamer{sd_print ? commands : lines, window};
+    lcd::DgusPanel panel{LCD_PORT, LCD_BAUDRATE};
+    motion::Printer printer;
+    Interrupts interrupts{printer};
+
+    setup();
+    printer.start(START_POSITION);
+    printer.record(blocks_file, steps_file);
+    host::start_timers(&interrupts);
+
+    const Time start = host::now();
+    const Clock::time_point wall_start = Clock::now();
+    streamer.start();
+    deadline = start + TIMEOUT;
+    while(!streamer.done() || card.sdprinting)
+        loop();
+    // The end of the commands already queued and of the moves
+    streamer.add("M400");
+    while(!streamer.done())
+        loop();
+    const double wall_time = std::chrono::duration<double>(Clock::now() - wall_start).count();
+
+    const auto& stats = printer.statistics();
+    const double print_time = static_cast<double>(host::now() - start) / SECOND;
+    const double planner_us = std::chrono::duration<double, std::micro>(planner_time).count();
+    if(sd_print)
+    {
+        printf("%s: %zu lines, SD card (%u blocks read)%s%s\n", argv[optind], lines.size(), sd_card.blocks_read(),
+               lookahead != nullptr ? ", look-ahead " : "", lookahead != nullptr ? lookahead : "");
+        #if ENABLED(BINARY_GCODE)
+            printf("    parsed ahead: %u lines\n", nb_parsed_ahead);
+        #endif
+    }
+    else
+        printf("%s: %zu lines, %u in flight\n", argv[optind], lines.size(), window);
+    printf("    blocks: %u, %.1f mm, %.3f blocks/mm\n", stats.blocks, stats.millimeters,
+           stats.millimeters > 0 ? stats.blocks / stats.millimeters : 0.0);
+    printf("    planner (host): %u calls, %.3f us per block, %.0f blocks/s\n", nb_plans,
+           stats.blocks > 0 ? planner_us / stats.blocks : 0.0, planner_us > 0 ? stats.blocks / planner_us * 1e6 : 0.0);
+    printf("    print time (simulated): %.1f s, moving %.1f s\n", print_time,
+           static_cast<double>(stats.last_step - stats.first_step) / SECOND);
+    printf("    underruns: %u, %.3f s without a block\n", stats.underruns, static_cast<double>(stats.starved) / SECOND);
+    printf("    part fan: on for %.1f mm\n", stats.fan_millimeters);
+    printf("    steps: X %llu, Y %llu, Z %llu, E %llu\n",
+           static_cast<unsigned long long>(stats.steps[X_AXIS]), static_cast<unsigned long long>(stats.steps[Y_AXIS]),
+           static_cast<unsigned long long>(stats.steps[Z_AXIS]), static_cast<unsigned long long>(stats.steps[E_AXIS]));
+    printf("    stepper ISRs: %u (%u delayed), temperatures: hotend %.1f, bed %.1f\n",
+           host::timer_statistics().stepper_isrs, host::timer_statistics().delayed_isrs,
+           printer.hotend_temperature(), printer.bed_temperature());
+    printf("    digests: blocks %016llx, steps %016llx\n",
+           static_cast<unsigned long long>(stats.blocks_digest), static_cast<unsigned long long>(stats.steps_digest));
+    printf("    replay: %.2f s on the host\n", wall_time);
+    printf("    %s\n", streamer.nb_errors() == 0 ? "OK" : "FAILED");
+
+    if(blocks_file != nullptr) fclose(blocks_file);
+    if(steps_file != nullptr) fclose(steps_file);
+
+    // As on the printer, the objects of the firmware are never destroyed (some are cleared with memset)
+    fflush(stdout);
+    _Exit(streamer.nb_errors() == 0 ? 0 : 1);
+}
@@ -0,0 +1,426 @@
+; Sample print for the motion replay: 3 layers of a square, a circle and an infill
+M104 S200
+G21
+G90
+M82
+G28 ; home all axes
+G1 Z5 F600
+M109 S200
+G92 E0
+;LAYER:0
+G1 Z0.30 F600
+G0 F7800 X80 Y80
+G1 F1800
+G1 X120.000 Y80.000 E1.33200
+G1 X120.000 Y120.000 E2.66400
+G1 X80.000 Y120.000 E3.99600
+G1 X80.000 Y80.000 E5.32800
+G1 F2400 E4.32800
+G0 F7800 X115 Y100
+G1 F2400 E5.32800
+G1 F1500
+G1 X114.943 Y101.307 E5.37158
+G1 X114.772 Y102.605 E5.41515
+G1 X114.489 Y103.882 E5.45873
+G1 X114.095 Y105.130 E5.50230
+G1 X113.595 Y106.339 E5.54588
+G1 X112.990 Y107.500 E5.58945
+G1 X112.287 Y108.604 E5.63303
+G1 X111.491 Y109.642 E5.67661
+G1 X110.607 Y110.607 E5.72018
+G1 X109.642 Y111.491 E5.76376
+G1 X108.604 Y112.287 E5.80733
+G1 X107.500 Y112.990 E5.85091
+G1 X106.339 Y113.595 E5.89448
+G1 X105.130 Y114.095 E5.93806
+G1 X103.882 Y114.489 E5.98164
+G1 X102.605 Y114.772 E6.02521
+G1 X101.307 Y114.943 E6.06879
+G1 X100.000 Y115.000 E6.11236
+G1 X98.693 Y114.943 E6.15594
+G1 X97.395 Y114.772 E6.19952
+G1 X96.118 Y114.489 E6.24309
+G1 X94.870 Y114.095 E6.28667
+G1 X93.661 Y113.595 E6.33024
+G1 X92.500 Y112.990 E6.37382
+G1 X91.396 Y112.287 E6.41739
+G1 X90.358 Y111.491 E6.46097
+G1 X89.393 Y110.607 E6.50455
+G1 X88.509 Y109.642 E6.54812
+G1 X87.713 Y108.604 E6.59170
+G1 X87.010 Y107.500 E6.63527
+G1 X86.405 Y106.339 E6.67885
+G1 X85.905 Y105.130 E6.72242
+G1 X85.511 Y103.882 E6.76600
+G1 X85.228 Y102.605 E6.80958
+G1 X85.057 Y101.307 E6.85315
+G1 X85.000 Y100.000 E6.89673
+G1 X85.057 Y98.693 E6.94030
+G1 X85.228 Y97.395 E6.98388
+G1 X85.511 Y96.118 E7.02745
+G1 X85.905 Y94.870 E7.07103
+G1 X86.405 Y93.661 E7.11461
+G1 X87.010 Y92.500 E7.15818
+G1 X87.713 Y91.396 E7.20176
+G1 X88.509 Y90.358 E7.24533
+G1 X89.393 Y89.393 E7.28891
+G1 X90.358 Y88.509 E7.33249
+G1 X91.396 Y87.713 E7.37606
+G1 X92.500 Y87.010 E7.41964
+G1 X93.661 Y86.405 E7.46321
+G1 X94.870 Y85.905 E7.50679
+G1 X96.118 Y85.511 E7.55036
+G1 X97.395 Y85.228 E7.59394
+G1 X98.693 Y85.057 E7.63752
+G1 X100.000 Y85.000 E7.68109
+G1 X101.307 Y85.057 E7.72467
+G1 X102.605 Y85.228 E7.76824
+G1 X103.882 Y85.511 E7.81182
+G1 X105.130 Y85.905 E7.85539
+G1 X106.339 Y86.405 E7.89897
+G1 X107.500 Y87.010 E7.94255
+G1 X108.604 Y87.713 E7.98612
+G1 X109.642 Y88.509 E8.02970
+G1 X110.607 Y89.393 E8.07327
+G1 X111.491 Y90.358 E8.11685
+G1 X112.287 Y91.396 E8.16042
+G1 X112.990 Y92.500 E8.20400
+G1 X113.595 Y93.661 E8.24758
+G1 X114.095 Y94.870 E8.29115
+G1 X114.489 Y96.118 E8.33473
+G1 X114.772 Y97.395 E8.37830
+G1 X114.943 Y98.693 E8.42188
+G1 X115.000 Y100.000 E8.46546
+G0 F7800 X82 Y82
+G1 F3000
+G1 X118.000 Y82.000 E9.66426
+G1 X118.000 Y83.500 E9.71421
+G1 X82.000 Y83.500 E10.91301
+G1 X82.000 Y85.000 E10.96296
+G1 X118.000 Y85.000 E12.16176
+G1 X118.000 Y86.500 E12.21171
+G1 X82.000 Y86.500 E13.41051
+G1 X82.000 Y88.000 E13.46046
+G1 X118.000 Y88.000 E14.65926
+G1 X118.000 Y89.500 E14.70921
+G1 X82.000 Y89.500 E15.90801
+G1 X82.000 Y91.000 E15.95796
+G1 X118.000 Y91.000 E17.15676
+G1 X118.000 Y92.500 E17.20671
+G1 X82.000 Y92.500 E18.40551
+G1 X82.000 Y94.000 E18.45546
+G1 X118.000 Y94.000 E19.65426
+G1 X118.000 Y95.500 E19.70421
+G1 X82.000 Y95.500 E20.90301
+G1 X82.000 Y97.000 E20.95296
+G1 X118.000 Y97.000 E22.15176
+G1 X118.000 Y98.500 E22.20171
+G1 X82.000 Y98.500 E23.40051
+G1 X82.000 Y100.000 E23.45046
+G1 X118.000 Y100.000 E24.64926
+G1 X118.000 Y101.500 E24.69921
+G1 X82.000 Y101.500 E25.89801
+G1 X82.000 Y103.000 E25.94796
+G1 X118.000 Y103.000 E27.14676
+G1 X118.000 Y104.500 E27.19671
+G1 X82.000 Y104.500 E28.39551
+G1 X82.000 Y106.000 E28.44546
+G1 X118.000 Y106.000 E29.64426
+G1 X118.000 Y107.500 E29.69421
+G1 X82.000 Y107.500 E30.89301
+G1 X82.000 Y109.000 E30.94296
+G1 X118.000 Y109.000 E32.14176
+G1 X118.000 Y110.500 E32.19171
+G1 X82.000 Y110.500 E33.39051
+G1 X82.000 Y112.000 E33.44046
+G1 X118.000 Y112.000 E34.63926
+G1 X118.000 Y113.500 E34.68921
+G1 X82.000 Y113.500 E35.88801
+G1 X82.000 Y115.000 E35.93796
+G1 X118.000 Y115.000 E37.13676
+G1 X118.000 Y116.500 E37.18671
+G1 X82.000 Y116.500 E38.38551
+G1 X82.000 Y118.000 E38.43546
+G0 F7800 X130 Y100
+G2 X130 Y100 I10 J0 E38.93546 F1800
+G3 X150 Y100 I10 J0 E39.43546
+;LAYER:1
+G1 Z0.50 F600
+G0 F7800 X80 Y80
+G1 F1800
+G1 X120.000 Y80.000 E40.76746
+G1 X120.000 Y120.000 E42.09946
+G1 X80.000 Y120.000 E43.43146
+G1 X80.000 Y80.000 E44.76346
+G1 F2400 E43.76346
+G0 F7800 X115 Y100
+G1 F2400 E44.76346
+G1 F1500
+G1 X114.943 Y101.307 E44.80703
+G1 X114.772 Y102.605 E44.85061
+G1 X114.489 Y103.882 E44.89418
+G1 X114.095 Y105.130 E44.93776
+G1 X113.595 Y106.339 E44.98133
+G1 X112.990 Y107.500 E45.02491
+G1 X112.287 Y108.604 E45.06849
+G1 X111.491 Y109.642 E45.11206
+G1 X110.607 Y110.607 E45.15564
+G1 X109.642 Y111.491 E45.19921
+G1 X108.604 Y112.287 E45.24279
+G1 X107.500 Y112.990 E45.28636
+G1 X106.339 Y113.595 E45.32994
+G1 X105.130 Y114.095 E45.37352
+G1 X103.882 Y114.489 E45.41709
+G1 X102.605 Y114.772 E45.46067
+G1 X101.307 Y114.943 E45.50424
+G1 X100.000 Y115.000 E45.54782
+G1 X98.693 Y114.943 E45.59139
+G1 X97.395 Y114.772 E45.63497
+G1 X96.118 Y114.489 E45.67855
+G1 X94.870 Y114.095 E45.72212
+G1 X93.661 Y113.595 E45.76570
+G1 X92.500 Y112.990 E45.80927
+G1 X91.396 Y112.287 E45.85285
+G1 X90.358 Y111.491 E45.89643
+G1 X89.393 Y110.607 E45.94000
+G1 X88.509 Y109.642 E45.98358
+G1 X87.713 Y108.604 E46.02715
+G1 X87.010 Y107.500 E46.07073
+G1 X86.405 Y106.339 E46.11430
+G1 X85.905 Y105.130 E46.15788
+G1 X85.511 Y103.882 E46.20146
+G1 X85.228 Y102.605 E46.24503
+G1 X85.057 Y101.307 E46.28861
+G1 X85.000 Y100.000 E46.33218
+G1 X85.057 Y98.693 E46.37576
+G1 X85.228 Y97.395 E46.41933
+G1 X85.511 Y96.118 E46.46291
+G1 X85.905 Y94.870 E46.50649
+G1 X86.405 Y93.661 E46.55006
+G1 X87.010 Y92.500 E46.59364
+G1 X87.713 Y91.396 E46.63721
+G1 X88.509 Y90.358 E46.68079
+G1 X89.393 Y89.393 E46.72436
+G1 X90.358 Y88.509 E46.76794
+G1 X91.396 Y87.713 E46.81152
+G1 X92.500 Y87.010 E46.85509
+G1 X93.661 Y86.405 E46.89867
+G1 X94.870 Y85.905 E46.94224
+G1 X96.118 Y85.511 E46.98582
+G1 X97.395 Y85.228 E47.02940
+G1 X98.693 Y85.057 E47.07297
+G1 X100.000 Y85.000 E47.11655
+G1 X101.307 Y85.057 E47.16012
+G1 X102.605 Y85.228 E47.20370
+G1 X103.882 Y85.511 E47.24727
+G1 X105.130 Y85.905 E47.29085
+G1 X106.339 Y86.405 E47.33443
+G1 X107.500 Y87.010 E47.37800
+G1 X108.604 Y87.713 E47.42158
+G1 X109.642 Y88.509 E47.46515
+G1 X110.607 Y89.393 E47.50873
+G1 X111.491 Y90.358 E47.55230
+G1 X112.287 Y91.396 E47.59588
+G1 X112.990 Y92.500 E47.63946
+G1 X113.595 Y93.661 E47.68303
+G1 X114.095 Y94.870 E47.72661
+G1 X114.489 Y96.118 E47.77018
+G1 X114.772 Y97.395 E47.81376
+G1 X114.943 Y98.693 E47.85733
+G1 X115.000 Y100.000 E47.90091
+G0 F7800 X82 Y82
+G1 F3000
+G1 X118.000 Y82.000 E49.09971
+G1 X118.000 Y83.500 E49.14966
+G1 X82.000 Y83.500 E50.34846
+G1 X82.000 Y85.000 E50.39841
+G1 X118.000 Y85.000 E51.59721
+G1 X118.000 Y86.500 E51.64716
+G1 X82.000 Y86.500 E52.84596
+G1 X82.000 Y88.000 E52.89591
+G1 X118.000 Y88.000 E54.09471
+G1 X118.000 Y89.500 E54.14466
+G1 X82.000 Y89.500 E55.34346
+G1 X82.000 Y91.000 E55.39341
+G1 X118.000 Y91.000 E56.59221
+G1 X118.000 Y92.500 E56.64216
+G1 X82.000 Y92.500 E57.84096
+G1 X82.000 Y94.000 E57.89091
+G1 X118.000 Y94.000 E59.08971
+G1 X118.000 Y95.500 E59.13966
+G1 X82.000 Y95.500 E60.33846
+G1 X82.000 Y97.000 E60.38841
+G1 X118.000 Y97.000 E61.58721
+G1 X118.000 Y98.500 E61.63716
+G1 X82.000 Y98.500 E62.83596
+G1 X82.000 Y100.000 E62.88591
+G1 X118.000 Y100.000 E64.08471
+G1 X118.000 Y101.500 E64.13466
+G1 X82.000 Y101.500 E65.33346
+G1 X82.000 Y103.000 E65.38341
+G1 X118.000 Y103.000 E66.58221
+G1 X118.000 Y104.500 E66.63216
+G1 X82.000 Y104.500 E67.83096
+G1 X82.000 Y106.000 E67.88091
+G1 X118.000 Y106.000 E69.07971
+G1 X118.000 Y107.500 E69.12966
+G1 X82.000 Y107.500 E70.32846
+G1 X82.000 Y109.000 E70.37841
+G1 X118.000 Y109.000 E71.57721
+G1 X118.000 Y110.500 E71.62716
+G1 X82.000 Y110.500 E72.82596
+G1 X82.000 Y112.000 E72.87591
+G1 X118.000 Y112.000 E74.07471
+G1 X118.000 Y113.500 E74.12466
+G1 X82.000 Y113.500 E75.32346
+G1 X82.000 Y115.000 E75.37341
+G1 X118.000 Y115.000 E76.57221
+G1 X118.000 Y116.500 E76.62216
+G1 X82.000 Y116.500 E77.82096
+G1 X82.000 Y118.000 E77.87091
+G0 F7800 X130 Y100
+G2 X130 Y100 I10 J0 E78.37091 F1800
+G3 X150 Y100 I10 J0 E78.87091
+;LAYER:2
+G1 Z0.70 F600
+G0 F7800 X80 Y80
+G1 F1800
+G1 X120.000 Y80.000 E80.20291
+G1 X120.000 Y120.000 E81.53491
+G1 X80.000 Y120.000 E82.86691
+G1 X80.000 Y80.000 E84.19891
+G1 F2400 E83.19891
+G0 F7800 X115 Y100
+G1 F2400 E84.19891
+G1 F1500
+G1 X114.943 Y101.307 E84.24249
+G1 X114.772 Y102.605 E84.28606
+G1 X114.489 Y103.882 E84.32964
+G1 X114.095 Y105.130 E84.37321
+G1 X113.595 Y106.339 E84.41679
+G1 X112.990 Y107.500 E84.46037
+G1 X112.287 Y108.604 E84.50394
+G1 X111.491 Y109.642 E84.54752
+G1 X110.607 Y110.607 E84.59109
+G1 X109.642 Y111.491 E84.63467
+G1 X108.604 Y112.287 E84.67824
+G1 X107.500 Y112.990 E84.72182
+G1 X106.339 Y113.595 E84.76540
+G1 X105.130 Y114.095 E84.80897
+G1 X103.882 Y114.489 E84.85255
+G1 X102.605 Y114.772 E84.89612
+G1 X101.307 Y114.943 E84.93970
+G1 X100.000 Y115.000 E84.98327
+G1 X98.693 Y114.943 E85.02685
+G1 X97.395 Y114.772 E85.07043
+G1 X96.118 Y114.489 E85.11400
+G1 X94.870 Y114.095 E85.15758
+G1 X93.661 Y113.595 E85.20115
+G1 X92.500 Y112.990 E85.24473
+G1 X91.396 Y112.287 E85.28830
+G1 X90.358 Y111.491 E85.33188
+G1 X89.393 Y110.607 E85.37546
+G1 X88.509 Y109.642 E85.41903
+G1 X87.713 Y108.604 E85.46261
+G1 X87.010 Y107.500 E85.50618
+G1 X86.405 Y106.339 E85.54976
+G1 X85.905 Y105.130 E85.59334
+G1 X85.511 Y103.882 E85.63691
+G1 X85.228 Y102.605 E85.68049
+G1 X85.057 Y101.307 E85.72406
+G1 X85.000 Y100.000 E85.76764
+G1 X85.057 Y98.693 E85.81121
+G1 X85.228 Y97.395 E85.85479
+G1 X85.511 Y96.118 E85.89837
+G1 X85.905 Y94.870 E85.94194
+G1 X86.405 Y93.661 E85.98552
+G1 X87.010 Y92.500 E86.02909
+G1 X87.713 Y91.396 E86.07267
+G1 X88.509 Y90.358 E86.11624
+G1 X89.393 Y89.393 E86.15982
+G1 X90.358 Y88.509 E86.20340
+G1 X91.396 Y87.713 E86.24697
+G1 X92.500 Y87.010 E86.29055
+G1 X93.661 Y86.405 E86.33412
+G1 X94.870 Y85.905 E86.37770
+G1 X96.118 Y85.511 E86.42127
+G1 X97.395 Y85.228 E86.46485
+G1 X98.693 Y85.057 E86.50843
+G1 X100.000 Y85.000 E86.55200
+G1 X101.307 Y85.057 E86.59558
+G1 X102.605 Y85.228 E86.63915
+G1 X103.882 Y85.511 E86.68273
+G1 X105.130 Y85.905 E86.72631
+G1 X106.339 Y86.405 E86.76988
+G1 X107.500 Y87.010 E86.81346
+G1 X108.604 Y87.713 E86.85703
+G1 X109.642 Y88.509 E86.90061
+G1 X110.607 Y89.393 E86.94418
+G1 X111.491 Y90.358 E86.98776
+G1 X112.287 Y91.396 E87.03134
+G1 X112.990 Y92.500 E87.07491
+G1 X113.595 Y93.661 E87.11849
+G1 X114.095 Y94.870 E87.16206
+G1 X114.489 Y96.118 E87.20564
+G1 X114.772 Y97.395 E87.24921
+G1 X114.943 Y98.693 E87.29279
+G1 X115.000 Y100.000 E87.33637
+G0 F7800 X82 Y82
+G1 F3000
+G1 X118.000 Y82.000 E88.53517
+G1 X118.000 Y83.500 E88.58512
+G1 X82.000 Y83.500 E89.78392
+G1 X82.000 Y85.000 E89.83387
+G1 X118.000 Y85.000 E91.03267
+G1 X118.000 Y86.500 E91.08262
+G1 X82.000 Y86.500 E92.28142
+G1 X82.000 Y88.000 E92.33137
+G1 X118.000 Y88.000 E93.53017
+G1 X118.000 Y89.500 E93.58012
+G1 X82.000 Y89.500 E94.77892
+G1 X82.000 Y91.000 E94.82887
+G1 X118.000 Y91.000 E96.02767
+G1 X118.000 Y92.500 E96.07762
+G1 X82.000 Y92.500 E97.27642
+G1 X82.000 Y94.000 E97.32637
+G1 X118.000 Y94.000 E98.52517
+G1 X118.000 Y95.500 E98.57512
+G1 X82.000 Y95.500 E99.77392
+G1 X82.000 Y97.000 E99.82387
+G1 X118.000 Y97.000 E101.02267
+G1 X118.000 Y98.500 E101.07262
+G1 X82.000 Y98.500 E102.27142
+G1 X82.000 Y100.000 E102.32137
+G1 X118.000 Y100.000 E103.52017
+G1 X118.000 Y101.500 E103.57012
+G1 X82.000 Y101.500 E104.76892
+G1 X82.000 Y103.000 E104.81887
+G1 X118.000 Y103.000 E106.01767
+G1 X118.000 Y104.500 E106.06762
+G1 X82.000 Y104.500 E107.26642
+G1 X82.000 Y106.000 E107.31637
+G1 X118.000 Y106.000 E108.51517
+G1 X118.000 Y107.500 E108.56512
+G1 X82.000 Y107.500 E109.76392
+G1 X82.000 Y109.000 E109.81387
+G1 X118.000 Y109.000 E111.01267
+G1 X118.000 Y110.500 E111.06262
+G1 X82.000 Y110.500 E112.26142
+G1 X82.000 Y112.000 E112.31137
+G1 X118.000 Y112.000 E113.51017
+G1 X118.000 Y113.500 E113.56012
+G1 X82.000 Y113.500 E114.75892
+G1 X82.000 Y115.000 E114.80887
+G1 X118.000 Y115.000 E116.00767
+G1 X118.000 Y116.500 E116.05762
+G1 X82.000 Y116.500 E117.25642
+G1 X82.000 Y118.000 E117.30637
+G0 F7800 X130 Y100
+G2 X130 Y100 I10 J0 E117.80637 F1800
+G3 X150 Y100 I10 J0 E118.30637
+M104 S0
+G91
+G1 Z10 F600
+G90
+G28 X0
+M84
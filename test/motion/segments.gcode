@@ -0,0 +1,2090 @@
+; Short segments for the motion replay: circles of 0.5 mm, 0.25 mm and 0.1 mm segments
+; at 100, 100 and 60 mm/s, as a slicer makes for curved surfaces
+M302 P1 ; no heating
+G21
+G90
+M82
+G28
+G1 Z0.3 F600
+G92 E0
+; radius 40, 503 segments
+G0 X140.000 Y100.000 F9000
+G1 X139.997 Y100.500 E0.01664 F6000
+G1 X139.988 Y100.999 E0.03328
+G1 X139.972 Y101.499 E0.04992
+G1 X139.950 Y101.998 E0.06655
+G1 X139.922 Y102.497 E0.08319
+G1 X139.888 Y102.995 E0.09983
+G1 X139.847 Y103.493 E0.11647
+G1 X139.800 Y103.991 E0.13311
+G1 X139.747 Y104.487 E0.14975
+G1 X139.688 Y104.984 E0.16639
+G1 X139.623 Y105.479 E0.18302
+G1 X139.551 Y105.973 E0.19966
+G1 X139.474 Y106.467 E0.21630
+G1 X139.390 Y106.960 E0.23294
+G1 X139.300 Y107.451 E0.24958
+G1 X139.204 Y107.941 E0.26622
+G1 X139.101 Y108.430 E0.28286
+G1 X138.993 Y108.918 E0.29949
+G1 X138.879 Y109.405 E0.31613
+G1 X138.758 Y109.890 E0.33277
+G1 X138.632 Y110.373 E0.34941
+G1 X138.499 Y110.855 E0.36605
+G1 X138.360 Y111.335 E0.38269
+G1 X138.216 Y111.813 E0.39933
+G1 X138.065 Y112.289 E0.41596
+G1 X137.909 Y112.764 E0.43260
+G1 X137.746 Y113.236 E0.44924
+G1 X137.578 Y113.707 E0.46588
+G1 X137.404 Y114.175 E0.48252
+G1 X137.224 Y114.641 E0.49916
+G1 X137.038 Y115.105 E0.51580
+G1 X136.847 Y115.567 E0.53243
+G1 X136.649 Y116.026 E0.54907
+G1 X136.446 Y116.482 E0.56571
+G1 X136.238 Y116.936 E0.58235
+G1 X136.023 Y117.387 E0.59899
+G1 X135.803 Y117.836 E0.61563
+G1 X135.578 Y118.282 E0.63227
+G1 X135.347 Y118.725 E0.64890
+G1 X135.110 Y119.165 E0.66554
+G1 X134.868 Y119.602 E0.68218
+G1 X134.620 Y120.036 E0.69882
+G1 X134.367 Y120.467 E0.71546
+G1 X134.109 Y120.895 E0.73210
+G1 X133.845 Y121.319 E0.74874
+G1 X133.576 Y121.740 E0.76537
+G1 X133.302 Y122.158 E0.78201
+G1 X133.023 Y122.572 E0.79865
+G1 X132.738 Y122.983 E0.81529
+G1 X132.449 Y123.390 E0.83193
+G1 X132.154 Y123.793 E0.84857
+G1 X131.854 Y124.193 E0.86521
+G1 X131.549 Y124.589 E0.88184
+G1 X131.240 Y124.981 E0.89848
+G1 X130.925 Y125.370 E0.91512
+G1 X130.606 Y125.754 E0.93176
+G1 X130.282 Y126.134 E0.94840
+G1 X129.953 Y126.511 E0.96504
+G1 X129.620 Y126.883 E0.98168
+G1 X129.282 Y127.250 E0.99831
+G1 X128.939 Y127.614 E1.01495
+G1 X128.592 Y127.973 E1.03159
+G1 X128.240 Y128.328 E1.04823
+G1 X127.884 Y128.679 E1.06487
+G1 X127.524 Y129.025 E1.08151
+G1 X127.159 Y129.367 E1.09815
+G1 X126.790 Y129.703 E1.11478
+G1 X126.417 Y130.036 E1.13142
+G1 X126.040 Y130.363 E1.14806
+G1 X125.658 Y130.686 E1.16470
+G1 X125.273 Y131.004 E1.18134
+G1 X124.884 Y131.318 E1.19798
+G1 X124.491 Y131.626 E1.21462
+G1 X124.094 Y131.930 E1.23125
+G1 X123.693 Y132.228 E1.24789
+G1 X123.289 Y132.521 E1.26453
+G1 X122.880 Y132.810 E1.28117
+G1 X122.469 Y133.093 E1.29781
+G1 X122.054 Y133.371 E1.31445
+G1 X121.635 Y133.644 E1.33109
+G1 X121.213 Y133.912 E1.34772
+G1 X120.788 Y134.174 E1.36436
+G1 X120.360 Y134.431 E1.38100
+G1 X119.928 Y134.683 E1.39764
+G1 X119.493 Y134.929 E1.41428
+G1 X119.055 Y135.170 E1.43092
+G1 X118.614 Y135.405 E1.44756
+G1 X118.171 Y135.635 E1.46419
+G1 X117.724 Y135.859 E1.48083
+G1 X117.275 Y136.077 E1.49747
+G1 X116.823 Y136.290 E1.51411
+G1 X116.368 Y136.498 E1.53075
+G1 X115.911 Y136.699 E1.54739
+G1 X115.451 Y136.895 E1.56403
+G1 X114.989 Y137.085 E1.58066
+G1 X114.525 Y137.270 E1.59730
+G1 X114.058 Y137.448 E1.61394
+G1 X113.589 Y137.621 E1.63058
+G1 X113.118 Y137.788 E1.64722
+G1 X112.645 Y137.949 E1.66386
+G1 X112.170 Y138.104 E1.68050
+G1 X111.694 Y138.253 E1.69713
+G1 X111.215 Y138.396 E1.71377
+G1 X110.734 Y138.533 E1.73041
+G1 X110.252 Y138.664 E1.74705
+G1 X109.768 Y138.789 E1.76369
+G1 X109.283 Y138.908 E1.78033
+G1 X108.796 Y139.021 E1.79697
+G1 X108.308 Y139.128 E1.81360
+G1 X107.819 Y139.228 E1.83024
+G1 X107.328 Y139.323 E1.84688
+G1 X106.837 Y139.411 E1.86352
+G1 X106.344 Y139.494 E1.88016
+G1 X105.850 Y139.570 E1.89680
+G1 X105.355 Y139.640 E1.91344
+G1 X104.860 Y139.704 E1.93007
+G1 X104.363 Y139.761 E1.94671
+G1 X103.866 Y139.813 E1.96335
+G1 X103.369 Y139.858 E1.97999
+G1 X102.871 Y139.897 E1.99663
+G1 X102.372 Y139.930 E2.01327
+G1 X101.873 Y139.956 E2.02991
+G1 X101.374 Y139.976 E2.04654
+G1 X100.874 Y139.990 E2.06318
+G1 X100.375 Y139.998 E2.07982
+G1 X99.875 Y140.000 E2.09646
+G1 X99.375 Y139.995 E2.11310
+G1 X98.876 Y139.984 E2.12974
+G1 X98.377 Y139.967 E2.14638
+G1 X97.877 Y139.944 E2.16301
+G1 X97.379 Y139.914 E2.17965
+G1 X96.880 Y139.878 E2.19629
+G1 X96.382 Y139.836 E2.21293
+G1 X95.885 Y139.788 E2.22957
+G1 X95.388 Y139.733 E2.24621
+G1 X94.892 Y139.673 E2.26285
+G1 X94.397 Y139.606 E2.27948
+G1 X93.903 Y139.533 E2.29612
+G1 X93.410 Y139.453 E2.31276
+G1 X92.917 Y139.368 E2.32940
+G1 X92.426 Y139.276 E2.34604
+G1 X91.936 Y139.179 E2.36268
+G1 X91.447 Y139.075 E2.37932
+G1 X90.960 Y138.965 E2.39595
+G1 X90.474 Y138.849 E2.41259
+G1 X89.990 Y138.727 E2.42923
+G1 X89.507 Y138.599 E2.44587
+G1 X89.025 Y138.465 E2.46251
+G1 X88.546 Y138.325 E2.47915
+G1 X88.068 Y138.179 E2.49579
+G1 X87.592 Y138.027 E2.51242
+G1 X87.118 Y137.869 E2.52906
+G1 X86.646 Y137.705 E2.54570
+G1 X86.176 Y137.535 E2.56234
+G1 X85.708 Y137.360 E2.57898
+G1 X85.243 Y137.178 E2.59562
+G1 X84.779 Y136.991 E2.61226
+G1 X84.318 Y136.798 E2.62889
+G1 X83.860 Y136.599 E2.64553
+G1 X83.404 Y136.395 E2.66217
+G1 X82.951 Y136.185 E2.67881
+G1 X82.500 Y135.969 E2.69545
+G1 X82.052 Y135.747 E2.71209
+G1 X81.607 Y135.520 E2.72873
+G1 X81.165 Y135.288 E2.74536
+G1 X80.725 Y135.050 E2.76200
+G1 X80.289 Y134.806 E2.77864
+G1 X79.856 Y134.557 E2.79528
+G1 X79.426 Y134.303 E2.81192
+G1 X78.999 Y134.043 E2.82856
+G1 X78.575 Y133.778 E2.84520
+G1 X78.155 Y133.508 E2.86183
+G1 X77.738 Y133.233 E2.87847
+G1 X77.325 Y132.952 E2.89511
+G1 X76.915 Y132.666 E2.91175
+G1 X76.509 Y132.375 E2.92839
+G1 X76.106 Y132.079 E2.94503
+G1 X75.707 Y131.778 E2.96167
+G1 X75.312 Y131.473 E2.97830
+G1 X74.921 Y131.162 E2.99494
+G1 X74.534 Y130.846 E3.01158
+G1 X74.151 Y130.525 E3.02822
+G1 X73.771 Y130.200 E3.04486
+G1 X73.396 Y129.870 E3.06150
+G1 X73.025 Y129.536 E3.07814
+G1 X72.658 Y129.196 E3.09477
+G1 X72.296 Y128.853 E3.11141
+G1 X71.937 Y128.504 E3.12805
+G1 X71.584 Y128.151 E3.14469
+G1 X71.234 Y127.794 E3.16133
+G1 X70.889 Y127.433 E3.17797
+G1 X70.549 Y127.067 E3.19461
+G1 X70.213 Y126.697 E3.21124
+G1 X69.882 Y126.323 E3.22788
+G1 X69.555 Y125.945 E3.24452
+G1 X69.234 Y125.562 E3.26116
+G1 X68.917 Y125.176 E3.27780
+G1 X68.605 Y124.786 E3.29444
+G1 X68.298 Y124.392 E3.31108
+G1 X67.995 Y123.994 E3.32771
+G1 X67.698 Y123.592 E3.34435
+G1 X67.406 Y123.187 E3.36099
+G1 X67.119 Y122.778 E3.37763
+G1 X66.837 Y122.365 E3.39427
+G1 X66.560 Y121.949 E3.41091
+G1 X66.289 Y121.530 E3.42755
+G1 X66.022 Y121.107 E3.44418
+G1 X65.761 Y120.681 E3.46082
+G1 X65.506 Y120.252 E3.47746
+G1 X65.255 Y119.819 E3.49410
+G1 X65.011 Y119.384 E3.51074
+G1 X64.771 Y118.945 E3.52738
+G1 X64.537 Y118.504 E3.54402
+G1 X64.309 Y118.059 E3.56065
+G1 X64.086 Y117.612 E3.57729
+G1 X63.869 Y117.162 E3.59393
+G1 X63.657 Y116.710 E3.61057
+G1 X63.451 Y116.254 E3.62721
+G1 X63.251 Y115.796 E3.64385
+G1 X63.057 Y115.336 E3.66049
+G1 X62.868 Y114.874 E3.67712
+G1 X62.685 Y114.409 E3.69376
+G1 X62.508 Y113.941 E3.71040
+G1 X62.337 Y113.472 E3.72704
+G1 X62.172 Y113.000 E3.74368
+G1 X62.012 Y112.527 E3.76032
+G1 X61.859 Y112.051 E3.77696
+G1 X61.711 Y111.574 E3.79359
+G1 X61.569 Y111.095 E3.81023
+G1 X61.434 Y110.614 E3.82687
+G1 X61.304 Y110.131 E3.84351
+G1 X61.181 Y109.647 E3.86015
+G1 X61.063 Y109.162 E3.87679
+G1 X60.952 Y108.675 E3.89343
+G1 X60.847 Y108.186 E3.91006
+G1 X60.747 Y107.696 E3.92670
+G1 X60.654 Y107.205 E3.94334
+G1 X60.567 Y106.713 E3.95998
+G1 X60.487 Y106.220 E3.97662
+G1 X60.412 Y105.726 E3.99326
+G1 X60.344 Y105.231 E4.00990
+G1 X60.281 Y104.736 E4.02653
+G1 X60.225 Y104.239 E4.04317
+G1 X60.175 Y103.742 E4.05981
+G1 X60.132 Y103.244 E4.07645
+G1 X60.094 Y102.746 E4.09309
+G1 X60.063 Y102.247 E4.10973
+G1 X60.038 Y101.748 E4.12637
+G1 X60.020 Y101.249 E4.14300
+G1 X60.007 Y100.749 E4.15964
+G1 X60.001 Y100.250 E4.17628
+G1 X60.001 Y99.750 E4.19292
+G1 X60.007 Y99.251 E4.20956
+G1 X60.020 Y98.751 E4.22620
+G1 X60.038 Y98.252 E4.24284
+G1 X60.063 Y97.753 E4.25947
+G1 X60.094 Y97.254 E4.27611
+G1 X60.132 Y96.756 E4.29275
+G1 X60.175 Y96.258 E4.30939
+G1 X60.225 Y95.761 E4.32603
+G1 X60.281 Y95.264 E4.34267
+G1 X60.344 Y94.769 E4.35931
+G1 X60.412 Y94.274 E4.37595
+G1 X60.487 Y93.780 E4.39258
+G1 X60.567 Y93.287 E4.40922
+G1 X60.654 Y92.795 E4.42586
+G1 X60.747 Y92.304 E4.44250
+G1 X60.847 Y91.814 E4.45914
+G1 X60.952 Y91.325 E4.47578
+G1 X61.063 Y90.838 E4.49242
+G1 X61.181 Y90.353 E4.50905
+G1 X61.304 Y89.869 E4.52569
+G1 X61.434 Y89.386 E4.54233
+G1 X61.569 Y88.905 E4.55897
+G1 X61.711 Y88.426 E4.57561
+G1 X61.859 Y87.949 E4.59225
+G1 X62.012 Y87.473 E4.60889
+G1 X62.172 Y87.000 E4.62552
+G1 X62.337 Y86.528 E4.64216
+G1 X62.508 Y86.059 E4.65880
+G1 X62.685 Y85.591 E4.67544
+G1 X62.868 Y85.126 E4.69208
+G1 X63.057 Y84.664 E4.70872
+G1 X63.251 Y84.204 E4.72536
+G1 X63.451 Y83.746 E4.74199
+G1 X63.657 Y83.290 E4.75863
+G1 X63.869 Y82.838 E4.77527
+G1 X64.086 Y82.388 E4.79191
+G1 X64.309 Y81.941 E4.80855
+G1 X64.537 Y81.496 E4.82519
+G1 X64.771 Y81.055 E4.84183
+G1 X65.011 Y80.616 E4.85846
+G1 X65.255 Y80.181 E4.87510
+G1 X65.506 Y79.748 E4.89174
+G1 X65.761 Y79.319 E4.90838
+G1 X66.022 Y78.893 E4.92502
+G1 X66.289 Y78.470 E4.94166
+G1 X66.560 Y78.051 E4.95830
+G1 X66.837 Y77.635 E4.97493
+G1 X67.119 Y77.222 E4.99157
+G1 X67.406 Y76.813 E5.00821
+G1 X67.698 Y76.408 E5.02485
+G1 X67.995 Y76.006 E5.04149
+G1 X68.298 Y75.608 E5.05813
+G1 X68.605 Y75.214 E5.07477
+G1 X68.917 Y74.824 E5.09140
+G1 X69.234 Y74.438 E5.10804
+G1 X69.555 Y74.055 E5.12468
+G1 X69.882 Y73.677 E5.14132
+G1 X70.213 Y73.303 E5.15796
+G1 X70.549 Y72.933 E5.17460
+G1 X70.889 Y72.567 E5.19124
+G1 X71.234 Y72.206 E5.20787
+G1 X71.584 Y71.849 E5.22451
+G1 X71.937 Y71.496 E5.24115
+G1 X72.296 Y71.147 E5.25779
+G1 X72.658 Y70.804 E5.27443
+G1 X73.025 Y70.464 E5.29107
+G1 X73.396 Y70.130 E5.30771
+G1 X73.771 Y69.800 E5.32434
+G1 X74.151 Y69.475 E5.34098
+G1 X74.534 Y69.154 E5.35762
+G1 X74.921 Y68.838 E5.37426
+G1 X75.312 Y68.527 E5.39090
+G1 X75.707 Y68.222 E5.40754
+G1 X76.106 Y67.921 E5.42418
+G1 X76.509 Y67.625 E5.44081
+G1 X76.915 Y67.334 E5.45745
+G1 X77.325 Y67.048 E5.47409
+G1 X77.738 Y66.767 E5.49073
+G1 X78.155 Y66.492 E5.50737
+G1 X78.575 Y66.222 E5.52401
+G1 X78.999 Y65.957 E5.54065
+G1 X79.426 Y65.697 E5.55728
+G1 X79.856 Y65.443 E5.57392
+G1 X80.289 Y65.194 E5.59056
+G1 X80.725 Y64.950 E5.60720
+G1 X81.165 Y64.712 E5.62384
+G1 X81.607 Y64.480 E5.64048
+G1 X82.052 Y64.253 E5.65712
+G1 X82.500 Y64.031 E5.67375
+G1 X82.951 Y63.815 E5.69039
+G1 X83.404 Y63.605 E5.70703
+G1 X83.860 Y63.401 E5.72367
+G1 X84.318 Y63.202 E5.74031
+G1 X84.779 Y63.009 E5.75695
+G1 X85.243 Y62.822 E5.77359
+G1 X85.708 Y62.640 E5.79022
+G1 X86.176 Y62.465 E5.80686
+G1 X86.646 Y62.295 E5.82350
+G1 X87.118 Y62.131 E5.84014
+G1 X87.592 Y61.973 E5.85678
+G1 X88.068 Y61.821 E5.87342
+G1 X88.546 Y61.675 E5.89006
+G1 X89.025 Y61.535 E5.90669
+G1 X89.507 Y61.401 E5.92333
+G1 X89.990 Y61.273 E5.93997
+G1 X90.474 Y61.151 E5.95661
+G1 X90.960 Y61.035 E5.97325
+G1 X91.447 Y60.925 E5.98989
+G1 X91.936 Y60.821 E6.00653
+G1 X92.426 Y60.724 E6.02316
+G1 X92.917 Y60.632 E6.03980
+G1 X93.410 Y60.547 E6.05644
+G1 X93.903 Y60.467 E6.07308
+G1 X94.397 Y60.394 E6.08972
+G1 X94.892 Y60.327 E6.10636
+G1 X95.388 Y60.267 E6.12300
+G1 X95.885 Y60.212 E6.13963
+G1 X96.382 Y60.164 E6.15627
+G1 X96.880 Y60.122 E6.17291
+G1 X97.379 Y60.086 E6.18955
+G1 X97.877 Y60.056 E6.20619
+G1 X98.377 Y60.033 E6.22283
+G1 X98.876 Y60.016 E6.23947
+G1 X99.375 Y60.005 E6.25610
+G1 X99.875 Y60.000 E6.27274
+G1 X100.375 Y60.002 E6.28938
+G1 X100.874 Y60.010 E6.30602
+G1 X101.374 Y60.024 E6.32266
+G1 X101.873 Y60.044 E6.33930
+G1 X102.372 Y60.070 E6.35594
+G1 X102.871 Y60.103 E6.37257
+G1 X103.369 Y60.142 E6.38921
+G1 X103.866 Y60.187 E6.40585
+G1 X104.363 Y60.239 E6.42249
+G1 X104.860 Y60.296 E6.43913
+G1 X105.355 Y60.360 E6.45577
+G1 X105.850 Y60.430 E6.47241
+G1 X106.344 Y60.506 E6.48904
+G1 X106.837 Y60.589 E6.50568
+G1 X107.328 Y60.677 E6.52232
+G1 X107.819 Y60.772 E6.53896
+G1 X108.308 Y60.872 E6.55560
+G1 X108.796 Y60.979 E6.57224
+G1 X109.283 Y61.092 E6.58888
+G1 X109.768 Y61.211 E6.60551
+G1 X110.252 Y61.336 E6.62215
+G1 X110.734 Y61.467 E6.63879
+G1 X111.215 Y61.604 E6.65543
+G1 X111.694 Y61.747 E6.67207
+G1 X112.170 Y61.896 E6.68871
+G1 X112.645 Y62.051 E6.70535
+G1 X113.118 Y62.212 E6.72198
+G1 X113.589 Y62.379 E6.73862
+G1 X114.058 Y62.552 E6.75526
+G1 X114.525 Y62.730 E6.77190
+G1 X114.989 Y62.915 E6.78854
+G1 X115.451 Y63.105 E6.80518
+G1 X115.911 Y63.301 E6.82182
+G1 X116.368 Y63.502 E6.83845
+G1 X116.823 Y63.710 E6.85509
+G1 X117.275 Y63.923 E6.87173
+G1 X117.724 Y64.141 E6.88837
+G1 X118.171 Y64.365 E6.90501
+G1 X118.614 Y64.595 E6.92165
+G1 X119.055 Y64.830 E6.93829
+G1 X119.493 Y65.071 E6.95492
+G1 X119.928 Y65.317 E6.97156
+G1 X120.360 Y65.569 E6.98820
+G1 X120.788 Y65.826 E7.00484
+G1 X121.213 Y66.088 E7.02148
+G1 X121.635 Y66.356 E7.03812
+G1 X122.054 Y66.629 E7.05476
+G1 X122.469 Y66.907 E7.07139
+G1 X122.880 Y67.190 E7.08803
+G1 X123.289 Y67.479 E7.10467
+G1 X123.693 Y67.772 E7.12131
+G1 X124.094 Y68.070 E7.13795
+G1 X124.491 Y68.374 E7.15459
+G1 X124.884 Y68.682 E7.17123
+G1 X125.273 Y68.996 E7.18786
+G1 X125.658 Y69.314 E7.20450
+G1 X126.040 Y69.637 E7.22114
+G1 X126.417 Y69.964 E7.23778
+G1 X126.790 Y70.297 E7.25442
+G1 X127.159 Y70.633 E7.27106
+G1 X127.524 Y70.975 E7.28770
+G1 X127.884 Y71.321 E7.30433
+G1 X128.240 Y71.672 E7.32097
+G1 X128.592 Y72.027 E7.33761
+G1 X128.939 Y72.386 E7.35425
+G1 X129.282 Y72.750 E7.37089
+G1 X129.620 Y73.117 E7.38753
+G1 X129.953 Y73.489 E7.40417
+G1 X130.282 Y73.866 E7.42080
+G1 X130.606 Y74.246 E7.43744
+G1 X130.925 Y74.630 E7.45408
+G1 X131.240 Y75.019 E7.47072
+G1 X131.549 Y75.411 E7.48736
+G1 X131.854 Y75.807 E7.50400
+G1 X132.154 Y76.207 E7.52064
+G1 X132.449 Y76.610 E7.53727
+G1 X132.738 Y77.017 E7.55391
+G1 X133.023 Y77.428 E7.57055
+G1 X133.302 Y77.842 E7.58719
+G1 X133.576 Y78.260 E7.60383
+G1 X133.845 Y78.681 E7.62047
+G1 X134.109 Y79.105 E7.63711
+G1 X134.367 Y79.533 E7.65374
+G1 X134.620 Y79.964 E7.67038
+G1 X134.868 Y80.398 E7.68702
+G1 X135.110 Y80.835 E7.70366
+G1 X135.347 Y81.275 E7.72030
+G1 X135.578 Y81.718 E7.73694
+G1 X135.803 Y82.164 E7.75358
+G1 X136.023 Y82.613 E7.77021
+G1 X136.238 Y83.064 E7.78685
+G1 X136.446 Y83.518 E7.80349
+G1 X136.649 Y83.974 E7.82013
+G1 X136.847 Y84.433 E7.83677
+G1 X137.038 Y84.895 E7.85341
+G1 X137.224 Y85.359 E7.87005
+G1 X137.404 Y85.825 E7.88668
+G1 X137.578 Y86.293 E7.90332
+G1 X137.746 Y86.764 E7.91996
+G1 X137.909 Y87.236 E7.93660
+G1 X138.065 Y87.711 E7.95324
+G1 X138.216 Y88.187 E7.96988
+G1 X138.360 Y88.665 E7.98652
+G1 X138.499 Y89.145 E8.00315
+G1 X138.632 Y89.627 E8.01979
+G1 X138.758 Y90.110 E8.03643
+G1 X138.879 Y90.595 E8.05307
+G1 X138.993 Y91.082 E8.06971
+G1 X139.101 Y91.570 E8.08635
+G1 X139.204 Y92.059 E8.10299
+G1 X139.300 Y92.549 E8.11962
+G1 X139.390 Y93.040 E8.13626
+G1 X139.474 Y93.533 E8.15290
+G1 X139.551 Y94.027 E8.16954
+G1 X139.623 Y94.521 E8.18618
+G1 X139.688 Y95.016 E8.20282
+G1 X139.747 Y95.513 E8.21946
+G1 X139.800 Y96.009 E8.23609
+G1 X139.847 Y96.507 E8.25273
+G1 X139.888 Y97.005 E8.26937
+G1 X139.922 Y97.503 E8.28601
+G1 X139.950 Y98.002 E8.30265
+G1 X139.972 Y98.501 E8.31929
+G1 X139.988 Y99.001 E8.33593
+G1 X139.997 Y99.500 E8.35256
+G1 X140.000 Y100.000 E8.36920
+; radius 25, 628 segments
+G0 X125.000 Y100.000 F9000
+G1 X124.999 Y100.250 E8.37753 F6000
+G1 X124.995 Y100.500 E8.38586
+G1 X124.989 Y100.750 E8.39419
+G1 X124.980 Y101.000 E8.40252
+G1 X124.969 Y101.250 E8.41085
+G1 X124.955 Y101.500 E8.41918
+G1 X124.939 Y101.749 E8.42751
+G1 X124.920 Y101.999 E8.43584
+G1 X124.899 Y102.248 E8.44417
+G1 X124.875 Y102.497 E8.45250
+G1 X124.849 Y102.746 E8.46082
+G1 X124.820 Y102.994 E8.46915
+G1 X124.789 Y103.242 E8.47748
+G1 X124.755 Y103.490 E8.48581
+G1 X124.719 Y103.738 E8.49414
+G1 X124.680 Y103.985 E8.50247
+G1 X124.639 Y104.232 E8.51080
+G1 X124.596 Y104.478 E8.51913
+G1 X124.550 Y104.724 E8.52746
+G1 X124.501 Y104.969 E8.53579
+G1 X124.450 Y105.214 E8.54412
+G1 X124.397 Y105.458 E8.55245
+G1 X124.341 Y105.702 E8.56077
+G1 X124.283 Y105.946 E8.56910
+G1 X124.222 Y106.188 E8.57743
+G1 X124.159 Y106.430 E8.58576
+G1 X124.093 Y106.672 E8.59409
+G1 X124.025 Y106.912 E8.60242
+G1 X123.955 Y107.152 E8.61075
+G1 X123.882 Y107.392 E8.61908
+G1 X123.807 Y107.630 E8.62741
+G1 X123.730 Y107.868 E8.63574
+G1 X123.650 Y108.105 E8.64407
+G1 X123.567 Y108.341 E8.65240
+G1 X123.483 Y108.577 E8.66073
+G1 X123.396 Y108.811 E8.66905
+G1 X123.306 Y109.045 E8.67738
+G1 X123.215 Y109.277 E8.68571
+G1 X123.121 Y109.509 E8.69404
+G1 X123.025 Y109.740 E8.70237
+G1 X122.926 Y109.970 E8.71070
+G1 X122.825 Y110.199 E8.71903
+G1 X122.722 Y110.427 E8.72736
+G1 X122.616 Y110.654 E8.73569
+G1 X122.509 Y110.879 E8.74402
+G1 X122.399 Y111.104 E8.75235
+G1 X122.287 Y111.327 E8.76068
+G1 X122.172 Y111.550 E8.76901
+G1 X122.055 Y111.771 E8.77733
+G1 X121.937 Y111.991 E8.78566
+G1 X121.815 Y112.210 E8.79399
+G1 X121.692 Y112.428 E8.80232
+G1 X121.567 Y112.644 E8.81065
+G1 X121.439 Y112.859 E8.81898
+G1 X121.309 Y113.073 E8.82731
+G1 X121.178 Y113.286 E8.83564
+G1 X121.044 Y113.497 E8.84397
+G1 X120.908 Y113.707 E8.85230
+G1 X120.769 Y113.915 E8.86063
+G1 X120.629 Y114.122 E8.86896
+G1 X120.487 Y114.328 E8.87729
+G1 X120.342 Y114.532 E8.88561
+G1 X120.196 Y114.735 E8.89394
+G1 X120.048 Y114.936 E8.90227
+G1 X119.897 Y115.136 E8.91060
+G1 X119.745 Y115.335 E8.91893
+G1 X119.590 Y115.531 E8.92726
+G1 X119.434 Y115.727 E8.93559
+G1 X119.276 Y115.920 E8.94392
+G1 X119.115 Y116.112 E8.95225
+G1 X118.953 Y116.303 E8.96058
+G1 X118.789 Y116.491 E8.96891
+G1 X118.623 Y116.679 E8.97724
+G1 X118.455 Y116.864 E8.98557
+G1 X118.286 Y117.048 E8.99389
+G1 X118.114 Y117.230 E9.00222
+G1 X117.941 Y117.410 E9.01055
+G1 X117.766 Y117.589 E9.01888
+G1 X117.589 Y117.766 E9.02721
+G1 X117.410 Y117.941 E9.03554
+G1 X117.230 Y118.114 E9.04387
+G1 X117.048 Y118.286 E9.05220
+G1 X116.864 Y118.455 E9.06053
+G1 X116.679 Y118.623 E9.06886
+G1 X116.491 Y118.789 E9.07719
+G1 X116.303 Y118.953 E9.08552
+G1 X116.112 Y119.115 E9.09385
+G1 X115.920 Y119.276 E9.10217
+G1 X115.727 Y119.434 E9.11050
+G1 X115.531 Y119.590 E9.11883
+G1 X115.335 Y119.745 E9.12716
+G1 X115.136 Y119.897 E9.13549
+G1 X114.936 Y120.048 E9.14382
+G1 X114.735 Y120.196 E9.15215
+G1 X114.532 Y120.342 E9.16048
+G1 X114.328 Y120.487 E9.16881
+G1 X114.122 Y120.629 E9.17714
+G1 X113.915 Y120.769 E9.18547
+G1 X113.707 Y120.908 E9.19380
+G1 X113.497 Y121.044 E9.20213
+G1 X113.286 Y121.178 E9.21045
+G1 X113.073 Y121.309 E9.21878
+G1 X112.859 Y121.439 E9.22711
+G1 X112.644 Y121.567 E9.23544
+G1 X112.428 Y121.692 E9.24377
+G1 X112.210 Y121.815 E9.25210
+G1 X111.991 Y121.937 E9.26043
+G1 X111.771 Y122.055 E9.26876
+G1 X111.550 Y122.172 E9.27709
+G1 X111.327 Y122.287 E9.28542
+G1 X111.104 Y122.399 E9.29375
+G1 X110.879 Y122.509 E9.30208
+G1 X110.654 Y122.616 E9.31040
+G1 X110.427 Y122.722 E9.31873
+G1 X110.199 Y122.825 E9.32706
+G1 X109.970 Y122.926 E9.33539
+G1 X109.740 Y123.025 E9.34372
+G1 X109.509 Y123.121 E9.35205
+G1 X109.277 Y123.215 E9.36038
+G1 X109.045 Y123.306 E9.36871
+G1 X108.811 Y123.396 E9.37704
+G1 X108.577 Y123.483 E9.38537
+G1 X108.341 Y123.567 E9.39370
+G1 X108.105 Y123.650 E9.40203
+G1 X107.868 Y123.730 E9.41036
+G1 X107.630 Y123.807 E9.41868
+G1 X107.392 Y123.882 E9.42701
+G1 X107.152 Y123.955 E9.43534
+G1 X106.912 Y124.025 E9.44367
+G1 X106.672 Y124.093 E9.45200
+G1 X106.430 Y124.159 E9.46033
+G1 X106.188 Y124.222 E9.46866
+G1 X105.946 Y124.283 E9.47699
+G1 X105.702 Y124.341 E9.48532
+G1 X105.458 Y124.397 E9.49365
+G1 X105.214 Y124.450 E9.50198
+G1 X104.969 Y124.501 E9.51031
+G1 X104.724 Y124.550 E9.51864
+G1 X104.478 Y124.596 E9.52696
+G1 X104.232 Y124.639 E9.53529
+G1 X103.985 Y124.680 E9.54362
+G1 X103.738 Y124.719 E9.55195
+G1 X103.490 Y124.755 E9.56028
+G1 X103.242 Y124.789 E9.56861
+G1 X102.994 Y124.820 E9.57694
+G1 X102.746 Y124.849 E9.58527
+G1 X102.497 Y124.875 E9.59360
+G1 X102.248 Y124.899 E9.60193
+G1 X101.999 Y124.920 E9.61026
+G1 X101.749 Y124.939 E9.61859
+G1 X101.500 Y124.955 E9.62692
+G1 X101.250 Y124.969 E9.63524
+G1 X101.000 Y124.980 E9.64357
+G1 X100.750 Y124.989 E9.65190
+G1 X100.500 Y124.995 E9.66023
+G1 X100.250 Y124.999 E9.66856
+G1 X100.000 Y125.000 E9.67689
+G1 X99.750 Y124.999 E9.68522
+G1 X99.500 Y124.995 E9.69355
+G1 X99.250 Y124.989 E9.70188
+G1 X99.000 Y124.980 E9.71021
+G1 X98.750 Y124.969 E9.71854
+G1 X98.500 Y124.955 E9.72687
+G1 X98.251 Y124.939 E9.73520
+G1 X98.001 Y124.920 E9.74352
+G1 X97.752 Y124.899 E9.75185
+G1 X97.503 Y124.875 E9.76018
+G1 X97.254 Y124.849 E9.76851
+G1 X97.006 Y124.820 E9.77684
+G1 X96.758 Y124.789 E9.78517
+G1 X96.510 Y124.755 E9.79350
+G1 X96.262 Y124.719 E9.80183
+G1 X96.015 Y124.680 E9.81016
+G1 X95.768 Y124.639 E9.81849
+G1 X95.522 Y124.596 E9.82682
+G1 X95.276 Y124.550 E9.83515
+G1 X95.031 Y124.501 E9.84348
+G1 X94.786 Y124.450 E9.85180
+G1 X94.542 Y124.397 E9.86013
+G1 X94.298 Y124.341 E9.86846
+G1 X94.054 Y124.283 E9.87679
+G1 X93.812 Y124.222 E9.88512
+G1 X93.570 Y124.159 E9.89345
+G1 X93.328 Y124.093 E9.90178
+G1 X93.088 Y124.025 E9.91011
+G1 X92.848 Y123.955 E9.91844
+G1 X92.608 Y123.882 E9.92677
+G1 X92.370 Y123.807 E9.93510
+G1 X92.132 Y123.730 E9.94343
+G1 X91.895 Y123.650 E9.95176
+G1 X91.659 Y123.567 E9.96008
+G1 X91.423 Y123.483 E9.96841
+G1 X91.189 Y123.396 E9.97674
+G1 X90.955 Y123.306 E9.98507
+G1 X90.723 Y123.215 E9.99340
+G1 X90.491 Y123.121 E10.00173
+G1 X90.260 Y123.025 E10.01006
+G1 X90.030 Y122.926 E10.01839
+G1 X89.801 Y122.825 E10.02672
+G1 X89.573 Y122.722 E10.03505
+G1 X89.346 Y122.616 E10.04338
+G1 X89.121 Y122.509 E10.05171
+G1 X88.896 Y122.399 E10.06004
+G1 X88.673 Y122.287 E10.06836
+G1 X88.450 Y122.172 E10.07669
+G1 X88.229 Y122.055 E10.08502
+G1 X88.009 Y121.937 E10.09335
+G1 X87.790 Y121.815 E10.10168
+G1 X87.572 Y121.692 E10.11001
+G1 X87.356 Y121.567 E10.11834
+G1 X87.141 Y121.439 E10.12667
+G1 X86.927 Y121.309 E10.13500
+G1 X86.714 Y121.178 E10.14333
+G1 X86.503 Y121.044 E10.15166
+G1 X86.293 Y120.908 E10.15999
+G1 X86.085 Y120.769 E10.16831
+G1 X85.878 Y120.629 E10.17664
+G1 X85.672 Y120.487 E10.18497
+G1 X85.468 Y120.342 E10.19330
+G1 X85.265 Y120.196 E10.20163
+G1 X85.064 Y120.048 E10.20996
+G1 X84.864 Y119.897 E10.21829
+G1 X84.665 Y119.745 E10.22662
+G1 X84.469 Y119.590 E10.23495
+G1 X84.273 Y119.434 E10.24328
+G1 X84.080 Y119.276 E10.25161
+G1 X83.888 Y119.115 E10.25994
+G1 X83.697 Y118.953 E10.26827
+G1 X83.509 Y118.789 E10.27659
+G1 X83.321 Y118.623 E10.28492
+G1 X83.136 Y118.455 E10.29325
+G1 X82.952 Y118.286 E10.30158
+G1 X82.770 Y118.114 E10.30991
+G1 X82.590 Y117.941 E10.31824
+G1 X82.411 Y117.766 E10.32657
+G1 X82.234 Y117.589 E10.33490
+G1 X82.059 Y117.410 E10.34323
+G1 X81.886 Y117.230 E10.35156
+G1 X81.714 Y117.048 E10.35989
+G1 X81.545 Y116.864 E10.36822
+G1 X81.377 Y116.679 E10.37655
+G1 X81.211 Y116.491 E10.38487
+G1 X81.047 Y116.303 E10.39320
+G1 X80.885 Y116.112 E10.40153
+G1 X80.724 Y115.920 E10.40986
+G1 X80.566 Y115.727 E10.41819
+G1 X80.410 Y115.531 E10.42652
+G1 X80.255 Y115.335 E10.43485
+G1 X80.103 Y115.136 E10.44318
+G1 X79.952 Y114.936 E10.45151
+G1 X79.804 Y114.735 E10.45984
+G1 X79.658 Y114.532 E10.46817
+G1 X79.513 Y114.328 E10.47650
+G1 X79.371 Y114.122 E10.48483
+G1 X79.231 Y113.915 E10.49315
+G1 X79.092 Y113.707 E10.50148
+G1 X78.956 Y113.497 E10.50981
+G1 X78.822 Y113.286 E10.51814
+G1 X78.691 Y113.073 E10.52647
+G1 X78.561 Y112.859 E10.53480
+G1 X78.433 Y112.644 E10.54313
+G1 X78.308 Y112.428 E10.55146
+G1 X78.185 Y112.210 E10.55979
+G1 X78.063 Y111.991 E10.56812
+G1 X77.945 Y111.771 E10.57645
+G1 X77.828 Y111.550 E10.58478
+G1 X77.713 Y111.327 E10.59311
+G1 X77.601 Y111.104 E10.60143
+G1 X77.491 Y110.879 E10.60976
+G1 X77.384 Y110.654 E10.61809
+G1 X77.278 Y110.427 E10.62642
+G1 X77.175 Y110.199 E10.63475
+G1 X77.074 Y109.970 E10.64308
+G1 X76.975 Y109.740 E10.65141
+G1 X76.879 Y109.509 E10.65974
+G1 X76.785 Y109.277 E10.66807
+G1 X76.694 Y109.045 E10.67640
+G1 X76.604 Y108.811 E10.68473
+G1 X76.517 Y108.577 E10.69306
+G1 X76.433 Y108.341 E10.70139
+G1 X76.350 Y108.105 E10.70971
+G1 X76.270 Y107.868 E10.71804
+G1 X76.193 Y107.630 E10.72637
+G1 X76.118 Y107.392 E10.73470
+G1 X76.045 Y107.152 E10.74303
+G1 X75.975 Y106.912 E10.75136
+G1 X75.907 Y106.672 E10.75969
+G1 X75.841 Y106.430 E10.76802
+G1 X75.778 Y106.188 E10.77635
+G1 X75.717 Y105.946 E10.78468
+G1 X75.659 Y105.702 E10.79301
+G1 X75.603 Y105.458 E10.80134
+G1 X75.550 Y105.214 E10.80967
+G1 X75.499 Y104.969 E10.81799
+G1 X75.450 Y104.724 E10.82632
+G1 X75.404 Y104.478 E10.83465
+G1 X75.361 Y104.232 E10.84298
+G1 X75.320 Y103.985 E10.85131
+G1 X75.281 Y103.738 E10.85964
+G1 X75.245 Y103.490 E10.86797
+G1 X75.211 Y103.242 E10.87630
+G1 X75.180 Y102.994 E10.88463
+G1 X75.151 Y102.746 E10.89296
+G1 X75.125 Y102.497 E10.90129
+G1 X75.101 Y102.248 E10.90962
+G1 X75.080 Y101.999 E10.91794
+G1 X75.061 Y101.749 E10.92627
+G1 X75.045 Y101.500 E10.93460
+G1 X75.031 Y101.250 E10.94293
+G1 X75.020 Y101.000 E10.95126
+G1 X75.011 Y100.750 E10.95959
+G1 X75.005 Y100.500 E10.96792
+G1 X75.001 Y100.250 E10.97625
+G1 X75.000 Y100.000 E10.98458
+G1 X75.001 Y99.750 E10.99291
+G1 X75.005 Y99.500 E11.00124
+G1 X75.011 Y99.250 E11.00957
+G1 X75.020 Y99.000 E11.01790
+G1 X75.031 Y98.750 E11.02622
+G1 X75.045 Y98.500 E11.03455
+G1 X75.061 Y98.251 E11.04288
+G1 X75.080 Y98.001 E11.05121
+G1 X75.101 Y97.752 E11.05954
+G1 X75.125 Y97.503 E11.06787
+G1 X75.151 Y97.254 E11.07620
+G1 X75.180 Y97.006 E11.08453
+G1 X75.211 Y96.758 E11.09286
+G1 X75.245 Y96.510 E11.10119
+G1 X75.281 Y96.262 E11.10952
+G1 X75.320 Y96.015 E11.11785
+G1 X75.361 Y95.768 E11.12618
+G1 X75.404 Y95.522 E11.13450
+G1 X75.450 Y95.276 E11.14283
+G1 X75.499 Y95.031 E11.15116
+G1 X75.550 Y94.786 E11.15949
+G1 X75.603 Y94.542 E11.16782
+G1 X75.659 Y94.298 E11.17615
+G1 X75.717 Y94.054 E11.18448
+G1 X75.778 Y93.812 E11.19281
+G1 X75.841 Y93.570 E11.20114
+G1 X75.907 Y93.328 E11.20947
+G1 X75.975 Y93.088 E11.21780
+G1 X76.045 Y92.848 E11.22613
+G1 X76.118 Y92.608 E11.23446
+G1 X76.193 Y92.370 E11.24278
+G1 X76.270 Y92.132 E11.25111
+G1 X76.350 Y91.895 E11.25944
+G1 X76.433 Y91.659 E11.26777
+G1 X76.517 Y91.423 E11.27610
+G1 X76.604 Y91.189 E11.28443
+G1 X76.694 Y90.955 E11.29276
+G1 X76.785 Y90.723 E11.30109
+G1 X76.879 Y90.491 E11.30942
+G1 X76.975 Y90.260 E11.31775
+G1 X77.074 Y90.030 E11.32608
+G1 X77.175 Y89.801 E11.33441
+G1 X77.278 Y89.573 E11.34274
+G1 X77.384 Y89.346 E11.35106
+G1 X77.491 Y89.121 E11.35939
+G1 X77.601 Y88.896 E11.36772
+G1 X77.713 Y88.673 E11.37605
+G1 X77.828 Y88.450 E11.38438
+G1 X77.945 Y88.229 E11.39271
+G1 X78.063 Y88.009 E11.40104
+G1 X78.185 Y87.790 E11.40937
+G1 X78.308 Y87.572 E11.41770
+G1 X78.433 Y87.356 E11.42603
+G1 X78.561 Y87.141 E11.43436
+G1 X78.691 Y86.927 E11.44269
+G1 X78.822 Y86.714 E11.45102
+G1 X78.956 Y86.503 E11.45934
+G1 X79.092 Y86.293 E11.46767
+G1 X79.231 Y86.085 E11.47600
+G1 X79.371 Y85.878 E11.48433
+G1 X79.513 Y85.672 E11.49266
+G1 X79.658 Y85.468 E11.50099
+G1 X79.804 Y85.265 E11.50932
+G1 X79.952 Y85.064 E11.51765
+G1 X80.103 Y84.864 E11.52598
+G1 X80.255 Y84.665 E11.53431
+G1 X80.410 Y84.469 E11.54264
+G1 X80.566 Y84.273 E11.55097
+G1 X80.724 Y84.080 E11.55930
+G1 X80.885 Y83.888 E11.56762
+G1 X81.047 Y83.697 E11.57595
+G1 X81.211 Y83.509 E11.58428
+G1 X81.377 Y83.321 E11.59261
+G1 X81.545 Y83.136 E11.60094
+G1 X81.714 Y82.952 E11.60927
+G1 X81.886 Y82.770 E11.61760
+G1 X82.059 Y82.590 E11.62593
+G1 X82.234 Y82.411 E11.63426
+G1 X82.411 Y82.234 E11.64259
+G1 X82.590 Y82.059 E11.65092
+G1 X82.770 Y81.886 E11.65925
+G1 X82.952 Y81.714 E11.66757
+G1 X83.136 Y81.545 E11.67590
+G1 X83.321 Y81.377 E11.68423
+G1 X83.509 Y81.211 E11.69256
+G1 X83.697 Y81.047 E11.70089
+G1 X83.888 Y80.885 E11.70922
+G1 X84.080 Y80.724 E11.71755
+G1 X84.273 Y80.566 E11.72588
+G1 X84.469 Y80.410 E11.73421
+G1 X84.665 Y80.255 E11.74254
+G1 X84.864 Y80.103 E11.75087
+G1 X85.064 Y79.952 E11.75920
+G1 X85.265 Y79.804 E11.76753
+G1 X85.468 Y79.658 E11.77585
+G1 X85.672 Y79.513 E11.78418
+G1 X85.878 Y79.371 E11.79251
+G1 X86.085 Y79.231 E11.80084
+G1 X86.293 Y79.092 E11.80917
+G1 X86.503 Y78.956 E11.81750
+G1 X86.714 Y78.822 E11.82583
+G1 X86.927 Y78.691 E11.83416
+G1 X87.141 Y78.561 E11.84249
+G1 X87.356 Y78.433 E11.85082
+G1 X87.572 Y78.308 E11.85915
+G1 X87.790 Y78.185 E11.86748
+G1 X88.009 Y78.063 E11.87581
+G1 X88.229 Y77.945 E11.88413
+G1 X88.450 Y77.828 E11.89246
+G1 X88.673 Y77.713 E11.90079
+G1 X88.896 Y77.601 E11.90912
+G1 X89.121 Y77.491 E11.91745
+G1 X89.346 Y77.384 E11.92578
+G1 X89.573 Y77.278 E11.93411
+G1 X89.801 Y77.175 E11.94244
+G1 X90.030 Y77.074 E11.95077
+G1 X90.260 Y76.975 E11.95910
+G1 X90.491 Y76.879 E11.96743
+G1 X90.723 Y76.785 E11.97576
+G1 X90.955 Y76.694 E11.98409
+G1 X91.189 Y76.604 E11.99241
+G1 X91.423 Y76.517 E12.00074
+G1 X91.659 Y76.433 E12.00907
+G1 X91.895 Y76.350 E12.01740
+G1 X92.132 Y76.270 E12.02573
+G1 X92.370 Y76.193 E12.03406
+G1 X92.608 Y76.118 E12.04239
+G1 X92.848 Y76.045 E12.05072
+G1 X93.088 Y75.975 E12.05905
+G1 X93.328 Y75.907 E12.06738
+G1 X93.570 Y75.841 E12.07571
+G1 X93.812 Y75.778 E12.08404
+G1 X94.054 Y75.717 E12.09237
+G1 X94.298 Y75.659 E12.10069
+G1 X94.542 Y75.603 E12.10902
+G1 X94.786 Y75.550 E12.11735
+G1 X95.031 Y75.499 E12.12568
+G1 X95.276 Y75.450 E12.13401
+G1 X95.522 Y75.404 E12.14234
+G1 X95.768 Y75.361 E12.15067
+G1 X96.015 Y75.320 E12.15900
+G1 X96.262 Y75.281 E12.16733
+G1 X96.510 Y75.245 E12.17566
+G1 X96.758 Y75.211 E12.18399
+G1 X97.006 Y75.180 E12.19232
+G1 X97.254 Y75.151 E12.20065
+G1 X97.503 Y75.125 E12.20897
+G1 X97.752 Y75.101 E12.21730
+G1 X98.001 Y75.080 E12.22563
+G1 X98.251 Y75.061 E12.23396
+G1 X98.500 Y75.045 E12.24229
+G1 X98.750 Y75.031 E12.25062
+G1 X99.000 Y75.020 E12.25895
+G1 X99.250 Y75.011 E12.26728
+G1 X99.500 Y75.005 E12.27561
+G1 X99.750 Y75.001 E12.28394
+G1 X100.000 Y75.000 E12.29227
+G1 X100.250 Y75.001 E12.30060
+G1 X100.500 Y75.005 E12.30893
+G1 X100.750 Y75.011 E12.31725
+G1 X101.000 Y75.020 E12.32558
+G1 X101.250 Y75.031 E12.33391
+G1 X101.500 Y75.045 E12.34224
+G1 X101.749 Y75.061 E12.35057
+G1 X101.999 Y75.080 E12.35890
+G1 X102.248 Y75.101 E12.36723
+G1 X102.497 Y75.125 E12.37556
+G1 X102.746 Y75.151 E12.38389
+G1 X102.994 Y75.180 E12.39222
+G1 X103.242 Y75.211 E12.40055
+G1 X103.490 Y75.245 E12.40888
+G1 X103.738 Y75.281 E12.41720
+G1 X103.985 Y75.320 E12.42553
+G1 X104.232 Y75.361 E12.43386
+G1 X104.478 Y75.404 E12.44219
+G1 X104.724 Y75.450 E12.45052
+G1 X104.969 Y75.499 E12.45885
+G1 X105.214 Y75.550 E12.46718
+G1 X105.458 Y75.603 E12.47551
+G1 X105.702 Y75.659 E12.48384
+G1 X105.946 Y75.717 E12.49217
+G1 X106.188 Y75.778 E12.50050
+G1 X106.430 Y75.841 E12.50883
+G1 X106.672 Y75.907 E12.51716
+G1 X106.912 Y75.975 E12.52548
+G1 X107.152 Y76.045 E12.53381
+G1 X107.392 Y76.118 E12.54214
+G1 X107.630 Y76.193 E12.55047
+G1 X107.868 Y76.270 E12.55880
+G1 X108.105 Y76.350 E12.56713
+G1 X108.341 Y76.433 E12.57546
+G1 X108.577 Y76.517 E12.58379
+G1 X108.811 Y76.604 E12.59212
+G1 X109.045 Y76.694 E12.60045
+G1 X109.277 Y76.785 E12.60878
+G1 X109.509 Y76.879 E12.61711
+G1 X109.740 Y76.975 E12.62544
+G1 X109.970 Y77.074 E12.63376
+G1 X110.199 Y77.175 E12.64209
+G1 X110.427 Y77.278 E12.65042
+G1 X110.654 Y77.384 E12.65875
+G1 X110.879 Y77.491 E12.66708
+G1 X111.104 Y77.601 E12.67541
+G1 X111.327 Y77.713 E12.68374
+G1 X111.550 Y77.828 E12.69207
+G1 X111.771 Y77.945 E12.70040
+G1 X111.991 Y78.063 E12.70873
+G1 X112.210 Y78.185 E12.71706
+G1 X112.428 Y78.308 E12.72539
+G1 X112.644 Y78.433 E12.73372
+G1 X112.859 Y78.561 E12.74204
+G1 X113.073 Y78.691 E12.75037
+G1 X113.286 Y78.822 E12.75870
+G1 X113.497 Y78.956 E12.76703
+G1 X113.707 Y79.092 E12.77536
+G1 X113.915 Y79.231 E12.78369
+G1 X114.122 Y79.371 E12.79202
+G1 X114.328 Y79.513 E12.80035
+G1 X114.532 Y79.658 E12.80868
+G1 X114.735 Y79.804 E12.81701
+G1 X114.936 Y79.952 E12.82534
+G1 X115.136 Y80.103 E12.83367
+G1 X115.335 Y80.255 E12.84200
+G1 X115.531 Y80.410 E12.85032
+G1 X115.727 Y80.566 E12.85865
+G1 X115.920 Y80.724 E12.86698
+G1 X116.112 Y80.885 E12.87531
+G1 X116.303 Y81.047 E12.88364
+G1 X116.491 Y81.211 E12.89197
+G1 X116.679 Y81.377 E12.90030
+G1 X116.864 Y81.545 E12.90863
+G1 X117.048 Y81.714 E12.91696
+G1 X117.230 Y81.886 E12.92529
+G1 X117.410 Y82.059 E12.93362
+G1 X117.589 Y82.234 E12.94195
+G1 X117.766 Y82.411 E12.95028
+G1 X117.941 Y82.590 E12.95860
+G1 X118.114 Y82.770 E12.96693
+G1 X118.286 Y82.952 E12.97526
+G1 X118.455 Y83.136 E12.98359
+G1 X118.623 Y83.321 E12.99192
+G1 X118.789 Y83.509 E13.00025
+G1 X118.953 Y83.697 E13.00858
+G1 X119.115 Y83.888 E13.01691
+G1 X119.276 Y84.080 E13.02524
+G1 X119.434 Y84.273 E13.03357
+G1 X119.590 Y84.469 E13.04190
+G1 X119.745 Y84.665 E13.05023
+G1 X119.897 Y84.864 E13.05856
+G1 X120.048 Y85.064 E13.06688
+G1 X120.196 Y85.265 E13.07521
+G1 X120.342 Y85.468 E13.08354
+G1 X120.487 Y85.672 E13.09187
+G1 X120.629 Y85.878 E13.10020
+G1 X120.769 Y86.085 E13.10853
+G1 X120.908 Y86.293 E13.11686
+G1 X121.044 Y86.503 E13.12519
+G1 X121.178 Y86.714 E13.13352
+G1 X121.309 Y86.927 E13.14185
+G1 X121.439 Y87.141 E13.15018
+G1 X121.567 Y87.356 E13.15851
+G1 X121.692 Y87.572 E13.16684
+G1 X121.815 Y87.790 E13.17516
+G1 X121.937 Y88.009 E13.18349
+G1 X122.055 Y88.229 E13.19182
+G1 X122.172 Y88.450 E13.20015
+G1 X122.287 Y88.673 E13.20848
+G1 X122.399 Y88.896 E13.21681
+G1 X122.509 Y89.121 E13.22514
+G1 X122.616 Y89.346 E13.23347
+G1 X122.722 Y89.573 E13.24180
+G1 X122.825 Y89.801 E13.25013
+G1 X122.926 Y90.030 E13.25846
+G1 X123.025 Y90.260 E13.26679
+G1 X123.121 Y90.491 E13.27511
+G1 X123.215 Y90.723 E13.28344
+G1 X123.306 Y90.955 E13.29177
+G1 X123.396 Y91.189 E13.30010
+G1 X123.483 Y91.423 E13.30843
+G1 X123.567 Y91.659 E13.31676
+G1 X123.650 Y91.895 E13.32509
+G1 X123.730 Y92.132 E13.33342
+G1 X123.807 Y92.370 E13.34175
+G1 X123.882 Y92.608 E13.35008
+G1 X123.955 Y92.848 E13.35841
+G1 X124.025 Y93.088 E13.36674
+G1 X124.093 Y93.328 E13.37507
+G1 X124.159 Y93.570 E13.38339
+G1 X124.222 Y93.812 E13.39172
+G1 X124.283 Y94.054 E13.40005
+G1 X124.341 Y94.298 E13.40838
+G1 X124.397 Y94.542 E13.41671
+G1 X124.450 Y94.786 E13.42504
+G1 X124.501 Y95.031 E13.43337
+G1 X124.550 Y95.276 E13.44170
+G1 X124.596 Y95.522 E13.45003
+G1 X124.639 Y95.768 E13.45836
+G1 X124.680 Y96.015 E13.46669
+G1 X124.719 Y96.262 E13.47502
+G1 X124.755 Y96.510 E13.48335
+G1 X124.789 Y96.758 E13.49167
+G1 X124.820 Y97.006 E13.50000
+G1 X124.849 Y97.254 E13.50833
+G1 X124.875 Y97.503 E13.51666
+G1 X124.899 Y97.752 E13.52499
+G1 X124.920 Y98.001 E13.53332
+G1 X124.939 Y98.251 E13.54165
+G1 X124.955 Y98.500 E13.54998
+G1 X124.969 Y98.750 E13.55831
+G1 X124.980 Y99.000 E13.56664
+G1 X124.989 Y99.250 E13.57497
+G1 X124.995 Y99.500 E13.58330
+G1 X124.999 Y99.750 E13.59163
+G1 X125.000 Y100.000 E13.59995
+; radius 15, 942 segments
+G0 X115.000 Y100.000 F9000
+G1 X115.000 Y100.100 E13.60329 F3600
+G1 X114.999 Y100.200 E13.60662
+G1 X114.997 Y100.300 E13.60995
+G1 X114.995 Y100.400 E13.61328
+G1 X114.992 Y100.500 E13.61661
+G1 X114.988 Y100.600 E13.61994
+G1 X114.984 Y100.700 E13.62328
+G1 X114.979 Y100.800 E13.62661
+G1 X114.973 Y100.900 E13.62994
+G1 X114.967 Y101.000 E13.63327
+G1 X114.960 Y101.100 E13.63660
+G1 X114.952 Y101.199 E13.63993
+G1 X114.944 Y101.299 E13.64327
+G1 X114.935 Y101.399 E13.64660
+G1 X114.925 Y101.498 E13.64993
+G1 X114.915 Y101.598 E13.65326
+G1 X114.904 Y101.697 E13.65659
+G1 X114.892 Y101.797 E13.65992
+G1 X114.880 Y101.896 E13.66326
+G1 X114.867 Y101.995 E13.66659
+G1 X114.853 Y102.094 E13.66992
+G1 X114.839 Y102.193 E13.67325
+G1 X114.824 Y102.292 E13.67658
+G1 X114.808 Y102.391 E13.67992
+G1 X114.792 Y102.490 E13.68325
+G1 X114.775 Y102.588 E13.68658
+G1 X114.757 Y102.687 E13.68991
+G1 X114.739 Y102.785 E13.69324
+G1 X114.720 Y102.883 E13.69657
+G1 X114.701 Y102.982 E13.69991
+G1 X114.680 Y103.080 E13.70324
+G1 X114.660 Y103.177 E13.70657
+G1 X114.638 Y103.275 E13.70990
+G1 X114.616 Y103.373 E13.71323
+G1 X114.593 Y103.470 E13.71656
+G1 X114.570 Y103.567 E13.71990
+G1 X114.546 Y103.664 E13.72323
+G1 X114.521 Y103.761 E13.72656
+G1 X114.495 Y103.858 E13.72989
+G1 X114.469 Y103.955 E13.73322
+G1 X114.443 Y104.051 E13.73655
+G1 X114.415 Y104.147 E13.73989
+G1 X114.387 Y104.243 E13.74322
+G1 X114.359 Y104.339 E13.74655
+G1 X114.329 Y104.435 E13.74988
+G1 X114.299 Y104.530 E13.75321
+G1 X114.269 Y104.626 E13.75654
+G1 X114.238 Y104.721 E13.75988
+G1 X114.206 Y104.816 E13.76321
+G1 X114.174 Y104.910 E13.76654
+G1 X114.140 Y105.005 E13.76987
+G1 X114.107 Y105.099 E13.77320
+G1 X114.072 Y105.193 E13.77653
+G1 X114.037 Y105.287 E13.77987
+G1 X114.002 Y105.380 E13.78320
+G1 X113.966 Y105.473 E13.78653
+G1 X113.929 Y105.566 E13.78986
+G1 X113.891 Y105.659 E13.79319
+G1 X113.853 Y105.752 E13.79652
+G1 X113.815 Y105.844 E13.79986
+G1 X113.775 Y105.936 E13.80319
+G1 X113.736 Y106.028 E13.80652
+G1 X113.695 Y106.119 E13.80985
+G1 X113.654 Y106.211 E13.81318
+G1 X113.612 Y106.301 E13.81651
+G1 X113.570 Y106.392 E13.81985
+G1 X113.527 Y106.482 E13.82318
+G1 X113.483 Y106.573 E13.82651
+G1 X113.439 Y106.662 E13.82984
+G1 X113.394 Y106.752 E13.83317
+G1 X113.349 Y106.841 E13.83650
+G1 X113.303 Y106.930 E13.83984
+G1 X113.257 Y107.019 E13.84317
+G1 X113.210 Y107.107 E13.84650
+G1 X113.162 Y107.195 E13.84983
+G1 X113.114 Y107.282 E13.85316
+G1 X113.065 Y107.370 E13.85649
+G1 X113.015 Y107.457 E13.85983
+G1 X112.965 Y107.543 E13.86316
+G1 X112.915 Y107.630 E13.86649
+G1 X112.864 Y107.716 E13.86982
+G1 X112.812 Y107.801 E13.87315
+G1 X112.759 Y107.886 E13.87648
+G1 X112.707 Y107.971 E13.87982
+G1 X112.653 Y108.056 E13.88315
+G1 X112.599 Y108.140 E13.88648
+G1 X112.545 Y108.224 E13.88981
+G1 X112.489 Y108.308 E13.89314
+G1 X112.434 Y108.391 E13.89647
+G1 X112.377 Y108.473 E13.89981
+G1 X112.321 Y108.556 E13.90314
+G1 X112.263 Y108.638 E13.90647
+G1 X112.205 Y108.719 E13.90980
+G1 X112.147 Y108.801 E13.91313
+G1 X112.088 Y108.881 E13.91647
+G1 X112.029 Y108.962 E13.91980
+G1 X111.968 Y109.042 E13.92313
+G1 X111.908 Y109.121 E13.92646
+G1 X111.847 Y109.201 E13.92979
+G1 X111.785 Y109.280 E13.93312
+G1 X111.723 Y109.358 E13.93646
+G1 X111.660 Y109.436 E13.93979
+G1 X111.597 Y109.513 E13.94312
+G1 X111.533 Y109.591 E13.94645
+G1 X111.469 Y109.667 E13.94978
+G1 X111.404 Y109.744 E13.95311
+G1 X111.339 Y109.819 E13.95645
+G1 X111.273 Y109.895 E13.95978
+G1 X111.207 Y109.970 E13.96311
+G1 X111.140 Y110.044 E13.96644
+G1 X111.073 Y110.118 E13.96977
+G1 X111.005 Y110.192 E13.97310
+G1 X110.937 Y110.265 E13.97644
+G1 X110.869 Y110.338 E13.97977
+G1 X110.799 Y110.410 E13.98310
+G1 X110.730 Y110.482 E13.98643
+G1 X110.660 Y110.553 E13.98976
+G1 X110.589 Y110.624 E13.99309
+G1 X110.518 Y110.695 E13.99643
+G1 X110.446 Y110.765 E13.99976
+G1 X110.374 Y110.834 E14.00309
+G1 X110.302 Y110.903 E14.00642
+G1 X110.229 Y110.971 E14.00975
+G1 X110.155 Y111.039 E14.01308
+G1 X110.081 Y111.107 E14.01642
+G1 X110.007 Y111.174 E14.01975
+G1 X109.932 Y111.240 E14.02308
+G1 X109.857 Y111.306 E14.02641
+G1 X109.782 Y111.372 E14.02974
+G1 X109.706 Y111.437 E14.03307
+G1 X109.629 Y111.501 E14.03641
+G1 X109.552 Y111.565 E14.03974
+G1 X109.475 Y111.629 E14.04307
+G1 X109.397 Y111.692 E14.04640
+G1 X109.319 Y111.754 E14.04973
+G1 X109.240 Y111.816 E14.05306
+G1 X109.161 Y111.877 E14.05640
+G1 X109.082 Y111.938 E14.05973
+G1 X109.002 Y111.999 E14.06306
+G1 X108.922 Y112.058 E14.06639
+G1 X108.841 Y112.118 E14.06972
+G1 X108.760 Y112.176 E14.07305
+G1 X108.679 Y112.234 E14.07639
+G1 X108.597 Y112.292 E14.07972
+G1 X108.515 Y112.349 E14.08305
+G1 X108.432 Y112.406 E14.08638
+G1 X108.349 Y112.462 E14.08971
+G1 X108.266 Y112.517 E14.09304
+G1 X108.182 Y112.572 E14.09638
+G1 X108.098 Y112.626 E14.09971
+G1 X108.014 Y112.680 E14.10304
+G1 X107.929 Y112.733 E14.10637
+G1 X107.844 Y112.786 E14.10970
+G1 X107.758 Y112.838 E14.11303
+G1 X107.673 Y112.889 E14.11637
+G1 X107.586 Y112.940 E14.11970
+G1 X107.500 Y112.990 E14.12303
+G1 X107.413 Y113.040 E14.12636
+G1 X107.326 Y113.089 E14.12969
+G1 X107.239 Y113.138 E14.13302
+G1 X107.151 Y113.186 E14.13636
+G1 X107.063 Y113.233 E14.13969
+G1 X106.974 Y113.280 E14.14302
+G1 X106.886 Y113.326 E14.14635
+G1 X106.796 Y113.372 E14.14968
+G1 X106.707 Y113.417 E14.15301
+G1 X106.618 Y113.461 E14.15635
+G1 X106.528 Y113.505 E14.15968
+G1 X106.437 Y113.548 E14.16301
+G1 X106.347 Y113.591 E14.16634
+G1 X106.256 Y113.633 E14.16967
+G1 X106.165 Y113.675 E14.17301
+G1 X106.074 Y113.715 E14.17634
+G1 X105.982 Y113.756 E14.17967
+G1 X105.890 Y113.795 E14.18300
+G1 X105.798 Y113.834 E14.18633
+G1 X105.706 Y113.873 E14.18966
+G1 X105.613 Y113.910 E14.19300
+G1 X105.520 Y113.947 E14.19633
+G1 X105.427 Y113.984 E14.19966
+G1 X105.333 Y114.020 E14.20299
+G1 X105.240 Y114.055 E14.20632
+G1 X105.146 Y114.090 E14.20965
+G1 X105.052 Y114.124 E14.21299
+G1 X104.958 Y114.157 E14.21632
+G1 X104.863 Y114.190 E14.21965
+G1 X104.768 Y114.222 E14.22298
+G1 X104.673 Y114.253 E14.22631
+G1 X104.578 Y114.284 E14.22964
+G1 X104.483 Y114.315 E14.23298
+G1 X104.387 Y114.344 E14.23631
+G1 X104.291 Y114.373 E14.23964
+G1 X104.195 Y114.401 E14.24297
+G1 X104.099 Y114.429 E14.24630
+G1 X104.003 Y114.456 E14.24963
+G1 X103.906 Y114.482 E14.25297
+G1 X103.810 Y114.508 E14.25630
+G1 X103.713 Y114.533 E14.25963
+G1 X103.616 Y114.558 E14.26296
+G1 X103.519 Y114.581 E14.26629
+G1 X103.421 Y114.605 E14.26962
+G1 X103.324 Y114.627 E14.27296
+G1 X103.226 Y114.649 E14.27629
+G1 X103.128 Y114.670 E14.27962
+G1 X103.031 Y114.691 E14.28295
+G1 X102.932 Y114.711 E14.28628
+G1 X102.834 Y114.730 E14.28961
+G1 X102.736 Y114.748 E14.29295
+G1 X102.638 Y114.766 E14.29628
+G1 X102.539 Y114.784 E14.29961
+G1 X102.440 Y114.800 E14.30294
+G1 X102.342 Y114.816 E14.30627
+G1 X102.243 Y114.831 E14.30960
+G1 X102.144 Y114.846 E14.31294
+G1 X102.045 Y114.860 E14.31627
+G1 X101.945 Y114.873 E14.31960
+G1 X101.846 Y114.886 E14.32293
+G1 X101.747 Y114.898 E14.32626
+G1 X101.648 Y114.909 E14.32959
+G1 X101.548 Y114.920 E14.33293
+G1 X101.448 Y114.930 E14.33626
+G1 X101.349 Y114.939 E14.33959
+G1 X101.249 Y114.948 E14.34292
+G1 X101.149 Y114.956 E14.34625
+G1 X101.050 Y114.963 E14.34958
+G1 X100.950 Y114.970 E14.35292
+G1 X100.850 Y114.976 E14.35625
+G1 X100.750 Y114.981 E14.35958
+G1 X100.650 Y114.986 E14.36291
+G1 X100.550 Y114.990 E14.36624
+G1 X100.450 Y114.993 E14.36957
+G1 X100.350 Y114.996 E14.37291
+G1 X100.250 Y114.998 E14.37624
+G1 X100.150 Y114.999 E14.37957
+G1 X100.050 Y115.000 E14.38290
+G1 X99.950 Y115.000 E14.38623
+G1 X99.850 Y114.999 E14.38956
+G1 X99.750 Y114.998 E14.39290
+G1 X99.650 Y114.996 E14.39623
+G1 X99.550 Y114.993 E14.39956
+G1 X99.450 Y114.990 E14.40289
+G1 X99.350 Y114.986 E14.40622
+G1 X99.250 Y114.981 E14.40956
+G1 X99.150 Y114.976 E14.41289
+G1 X99.050 Y114.970 E14.41622
+G1 X98.950 Y114.963 E14.41955
+G1 X98.851 Y114.956 E14.42288
+G1 X98.751 Y114.948 E14.42621
+G1 X98.651 Y114.939 E14.42955
+G1 X98.552 Y114.930 E14.43288
+G1 X98.452 Y114.920 E14.43621
+G1 X98.352 Y114.909 E14.43954
+G1 X98.253 Y114.898 E14.44287
+G1 X98.154 Y114.886 E14.44620
+G1 X98.055 Y114.873 E14.44954
+G1 X97.955 Y114.860 E14.45287
+G1 X97.856 Y114.846 E14.45620
+G1 X97.757 Y114.831 E14.45953
+G1 X97.658 Y114.816 E14.46286
+G1 X97.560 Y114.800 E14.46619
+G1 X97.461 Y114.784 E14.46953
+G1 X97.362 Y114.766 E14.47286
+G1 X97.264 Y114.748 E14.47619
+G1 X97.166 Y114.730 E14.47952
+G1 X97.068 Y114.711 E14.48285
+G1 X96.969 Y114.691 E14.48618
+G1 X96.872 Y114.670 E14.48952
+G1 X96.774 Y114.649 E14.49285
+G1 X96.676 Y114.627 E14.49618
+G1 X96.579 Y114.605 E14.49951
+G1 X96.481 Y114.581 E14.50284
+G1 X96.384 Y114.558 E14.50617
+G1 X96.287 Y114.533 E14.50951
+G1 X96.190 Y114.508 E14.51284
+G1 X96.094 Y114.482 E14.51617
+G1 X95.997 Y114.456 E14.51950
+G1 X95.901 Y114.429 E14.52283
+G1 X95.805 Y114.401 E14.52616
+G1 X95.709 Y114.373 E14.52950
+G1 X95.613 Y114.344 E14.53283
+G1 X95.517 Y114.315 E14.53616
+G1 X95.422 Y114.284 E14.53949
+G1 X95.327 Y114.253 E14.54282
+G1 X95.232 Y114.222 E14.54615
+G1 X95.137 Y114.190 E14.54949
+G1 X95.042 Y114.157 E14.55282
+G1 X94.948 Y114.124 E14.55615
+G1 X94.854 Y114.090 E14.55948
+G1 X94.760 Y114.055 E14.56281
+G1 X94.667 Y114.020 E14.56614
+G1 X94.573 Y113.984 E14.56948
+G1 X94.480 Y113.947 E14.57281
+G1 X94.387 Y113.910 E14.57614
+G1 X94.294 Y113.873 E14.57947
+G1 X94.202 Y113.834 E14.58280
+G1 X94.110 Y113.795 E14.58613
+G1 X94.018 Y113.756 E14.58947
+G1 X93.926 Y113.715 E14.59280
+G1 X93.835 Y113.675 E14.59613
+G1 X93.744 Y113.633 E14.59946
+G1 X93.653 Y113.591 E14.60279
+G1 X93.563 Y113.548 E14.60612
+G1 X93.472 Y113.505 E14.60946
+G1 X93.382 Y113.461 E14.61279
+G1 X93.293 Y113.417 E14.61612
+G1 X93.204 Y113.372 E14.61945
+G1 X93.114 Y113.326 E14.62278
+G1 X93.026 Y113.280 E14.62611
+G1 X92.937 Y113.233 E14.62945
+G1 X92.849 Y113.186 E14.63278
+G1 X92.761 Y113.138 E14.63611
+G1 X92.674 Y113.089 E14.63944
+G1 X92.587 Y113.040 E14.64277
+G1 X92.500 Y112.990 E14.64610
+G1 X92.414 Y112.940 E14.64944
+G1 X92.327 Y112.889 E14.65277
+G1 X92.242 Y112.838 E14.65610
+G1 X92.156 Y112.786 E14.65943
+G1 X92.071 Y112.733 E14.66276
+G1 X91.986 Y112.680 E14.66610
+G1 X91.902 Y112.626 E14.66943
+G1 X91.818 Y112.572 E14.67276
+G1 X91.734 Y112.517 E14.67609
+G1 X91.651 Y112.462 E14.67942
+G1 X91.568 Y112.406 E14.68275
+G1 X91.485 Y112.349 E14.68609
+G1 X91.403 Y112.292 E14.68942
+G1 X91.321 Y112.234 E14.69275
+G1 X91.240 Y112.176 E14.69608
+G1 X91.159 Y112.118 E14.69941
+G1 X91.078 Y112.058 E14.70274
+G1 X90.998 Y111.999 E14.70608
+G1 X90.918 Y111.938 E14.70941
+G1 X90.839 Y111.877 E14.71274
+G1 X90.760 Y111.816 E14.71607
+G1 X90.681 Y111.754 E14.71940
+G1 X90.603 Y111.692 E14.72273
+G1 X90.525 Y111.629 E14.72607
+G1 X90.448 Y111.565 E14.72940
+G1 X90.371 Y111.501 E14.73273
+G1 X90.294 Y111.437 E14.73606
+G1 X90.218 Y111.372 E14.73939
+G1 X90.143 Y111.306 E14.74272
+G1 X90.068 Y111.240 E14.74606
+G1 X89.993 Y111.174 E14.74939
+G1 X89.919 Y111.107 E14.75272
+G1 X89.845 Y111.039 E14.75605
+G1 X89.771 Y110.971 E14.75938
+G1 X89.698 Y110.903 E14.76271
+G1 X89.626 Y110.834 E14.76605
+G1 X89.554 Y110.765 E14.76938
+G1 X89.482 Y110.695 E14.77271
+G1 X89.411 Y110.624 E14.77604
+G1 X89.340 Y110.553 E14.77937
+G1 X89.270 Y110.482 E14.78270
+G1 X89.201 Y110.410 E14.78604
+G1 X89.131 Y110.338 E14.78937
+G1 X89.063 Y110.265 E14.79270
+G1 X88.995 Y110.192 E14.79603
+G1 X88.927 Y110.118 E14.79936
+G1 X88.860 Y110.044 E14.80269
+G1 X88.793 Y109.970 E14.80603
+G1 X88.727 Y109.895 E14.80936
+G1 X88.661 Y109.819 E14.81269
+G1 X88.596 Y109.744 E14.81602
+G1 X88.531 Y109.667 E14.81935
+G1 X88.467 Y109.591 E14.82268
+G1 X88.403 Y109.513 E14.82602
+G1 X88.340 Y109.436 E14.82935
+G1 X88.277 Y109.358 E14.83268
+G1 X88.215 Y109.280 E14.83601
+G1 X88.153 Y109.201 E14.83934
+G1 X88.092 Y109.121 E14.84267
+G1 X88.032 Y109.042 E14.84601
+G1 X87.971 Y108.962 E14.84934
+G1 X87.912 Y108.881 E14.85267
+G1 X87.853 Y108.801 E14.85600
+G1 X87.795 Y108.719 E14.85933
+G1 X87.737 Y108.638 E14.86266
+G1 X87.679 Y108.556 E14.86600
+G1 X87.623 Y108.473 E14.86933
+G1 X87.566 Y108.391 E14.87266
+G1 X87.511 Y108.308 E14.87599
+G1 X87.455 Y108.224 E14.87932
+G1 X87.401 Y108.140 E14.88265
+G1 X87.347 Y108.056 E14.88599
+G1 X87.293 Y107.971 E14.88932
+G1 X87.241 Y107.886 E14.89265
+G1 X87.188 Y107.801 E14.89598
+G1 X87.136 Y107.716 E14.89931
+G1 X87.085 Y107.630 E14.90265
+G1 X87.035 Y107.543 E14.90598
+G1 X86.985 Y107.457 E14.90931
+G1 X86.935 Y107.370 E14.91264
+G1 X86.886 Y107.282 E14.91597
+G1 X86.838 Y107.195 E14.91930
+G1 X86.790 Y107.107 E14.92264
+G1 X86.743 Y107.019 E14.92597
+G1 X86.697 Y106.930 E14.92930
+G1 X86.651 Y106.841 E14.93263
+G1 X86.606 Y106.752 E14.93596
+G1 X86.561 Y106.662 E14.93929
+G1 X86.517 Y106.573 E14.94263
+G1 X86.473 Y106.482 E14.94596
+G1 X86.430 Y106.392 E14.94929
+G1 X86.388 Y106.301 E14.95262
+G1 X86.346 Y106.211 E14.95595
+G1 X86.305 Y106.119 E14.95928
+G1 X86.264 Y106.028 E14.96262
+G1 X86.225 Y105.936 E14.96595
+G1 X86.185 Y105.844 E14.96928
+G1 X86.147 Y105.752 E14.97261
+G1 X86.109 Y105.659 E14.97594
+G1 X86.071 Y105.566 E14.97927
+G1 X86.034 Y105.473 E14.98261
+G1 X85.998 Y105.380 E14.98594
+G1 X85.963 Y105.287 E14.98927
+G1 X85.928 Y105.193 E14.99260
+G1 X85.893 Y105.099 E14.99593
+G1 X85.860 Y105.005 E14.99926
+G1 X85.826 Y104.910 E15.00260
+G1 X85.794 Y104.816 E15.00593
+G1 X85.762 Y104.721 E15.00926
+G1 X85.731 Y104.626 E15.01259
+G1 X85.701 Y104.530 E15.01592
+G1 X85.671 Y104.435 E15.01925
+G1 X85.641 Y104.339 E15.02259
+G1 X85.613 Y104.243 E15.02592
+G1 X85.585 Y104.147 E15.02925
+G1 X85.557 Y104.051 E15.03258
+G1 X85.531 Y103.955 E15.03591
+G1 X85.505 Y103.858 E15.03924
+G1 X85.479 Y103.761 E15.04258
+G1 X85.454 Y103.664 E15.04591
+G1 X85.430 Y103.567 E15.04924
+G1 X85.407 Y103.470 E15.05257
+G1 X85.384 Y103.373 E15.05590
+G1 X85.362 Y103.275 E15.05923
+G1 X85.340 Y103.177 E15.06257
+G1 X85.320 Y103.080 E15.06590
+G1 X85.299 Y102.982 E15.06923
+G1 X85.280 Y102.883 E15.07256
+G1 X85.261 Y102.785 E15.07589
+G1 X85.243 Y102.687 E15.07922
+G1 X85.225 Y102.588 E15.08256
+G1 X85.208 Y102.490 E15.08589
+G1 X85.192 Y102.391 E15.08922
+G1 X85.176 Y102.292 E15.09255
+G1 X85.161 Y102.193 E15.09588
+G1 X85.147 Y102.094 E15.09921
+G1 X85.133 Y101.995 E15.10255
+G1 X85.120 Y101.896 E15.10588
+G1 X85.108 Y101.797 E15.10921
+G1 X85.096 Y101.697 E15.11254
+G1 X85.085 Y101.598 E15.11587
+G1 X85.075 Y101.498 E15.11920
+G1 X85.065 Y101.399 E15.12254
+G1 X85.056 Y101.299 E15.12587
+G1 X85.048 Y101.199 E15.12920
+G1 X85.040 Y101.100 E15.13253
+G1 X85.033 Y101.000 E15.13586
+G1 X85.027 Y100.900 E15.13919
+G1 X85.021 Y100.800 E15.14253
+G1 X85.016 Y100.700 E15.14586
+G1 X85.012 Y100.600 E15.14919
+G1 X85.008 Y100.500 E15.15252
+G1 X85.005 Y100.400 E15.15585
+G1 X85.003 Y100.300 E15.15919
+G1 X85.001 Y100.200 E15.16252
+G1 X85.000 Y100.100 E15.16585
+G1 X85.000 Y100.000 E15.16918
+G1 X85.000 Y99.900 E15.17251
+G1 X85.001 Y99.800 E15.17584
+G1 X85.003 Y99.700 E15.17918
+G1 X85.005 Y99.600 E15.18251
+G1 X85.008 Y99.500 E15.18584
+G1 X85.012 Y99.400 E15.18917
+G1 X85.016 Y99.300 E15.19250
+G1 X85.021 Y99.200 E15.19583
+G1 X85.027 Y99.100 E15.19917
+G1 X85.033 Y99.000 E15.20250
+G1 X85.040 Y98.900 E15.20583
+G1 X85.048 Y98.801 E15.20916
+G1 X85.056 Y98.701 E15.21249
+G1 X85.065 Y98.601 E15.21582
+G1 X85.075 Y98.502 E15.21916
+G1 X85.085 Y98.402 E15.22249
+G1 X85.096 Y98.303 E15.22582
+G1 X85.108 Y98.203 E15.22915
+G1 X85.120 Y98.104 E15.23248
+G1 X85.133 Y98.005 E15.23581
+G1 X85.147 Y97.906 E15.23915
+G1 X85.161 Y97.807 E15.24248
+G1 X85.176 Y97.708 E15.24581
+G1 X85.192 Y97.609 E15.24914
+G1 X85.208 Y97.510 E15.25247
+G1 X85.225 Y97.412 E15.25580
+G1 X85.243 Y97.313 E15.25914
+G1 X85.261 Y97.215 E15.26247
+G1 X85.280 Y97.117 E15.26580
+G1 X85.299 Y97.018 E15.26913
+G1 X85.320 Y96.920 E15.27246
+G1 X85.340 Y96.823 E15.27579
+G1 X85.362 Y96.725 E15.27913
+G1 X85.384 Y96.627 E15.28246
+G1 X85.407 Y96.530 E15.28579
+G1 X85.430 Y96.433 E15.28912
+G1 X85.454 Y96.336 E15.29245
+G1 X85.479 Y96.239 E15.29578
+G1 X85.505 Y96.142 E15.29912
+G1 X85.531 Y96.045 E15.30245
+G1 X85.557 Y95.949 E15.30578
+G1 X85.585 Y95.853 E15.30911
+G1 X85.613 Y95.757 E15.31244
+G1 X85.641 Y95.661 E15.31577
+G1 X85.671 Y95.565 E15.31911
+G1 X85.701 Y95.470 E15.32244
+G1 X85.731 Y95.374 E15.32577
+G1 X85.762 Y95.279 E15.32910
+G1 X85.794 Y95.184 E15.33243
+G1 X85.826 Y95.090 E15.33576
+G1 X85.860 Y94.995 E15.33910
+G1 X85.893 Y94.901 E15.34243
+G1 X85.928 Y94.807 E15.34576
+G1 X85.963 Y94.713 E15.34909
+G1 X85.998 Y94.620 E15.35242
+G1 X86.034 Y94.527 E15.35575
+G1 X86.071 Y94.434 E15.35909
+G1 X86.109 Y94.341 E15.36242
+G1 X86.147 Y94.248 E15.36575
+G1 X86.185 Y94.156 E15.36908
+G1 X86.225 Y94.064 E15.37241
+G1 X86.264 Y93.972 E15.37574
+G1 X86.305 Y93.881 E15.37908
+G1 X86.346 Y93.789 E15.38241
+G1 X86.388 Y93.699 E15.38574
+G1 X86.430 Y93.608 E15.38907
+G1 X86.473 Y93.518 E15.39240
+G1 X86.517 Y93.427 E15.39573
+G1 X86.561 Y93.338 E15.39907
+G1 X86.606 Y93.248 E15.40240
+G1 X86.651 Y93.159 E15.40573
+G1 X86.697 Y93.070 E15.40906
+G1 X86.743 Y92.981 E15.41239
+G1 X86.790 Y92.893 E15.41573
+G1 X86.838 Y92.805 E15.41906
+G1 X86.886 Y92.718 E15.42239
+G1 X86.935 Y92.630 E15.42572
+G1 X86.985 Y92.543 E15.42905
+G1 X87.035 Y92.457 E15.43238
+G1 X87.085 Y92.370 E15.43572
+G1 X87.136 Y92.284 E15.43905
+G1 X87.188 Y92.199 E15.44238
+G1 X87.241 Y92.114 E15.44571
+G1 X87.293 Y92.029 E15.44904
+G1 X87.347 Y91.944 E15.45237
+G1 X87.401 Y91.860 E15.45571
+G1 X87.455 Y91.776 E15.45904
+G1 X87.511 Y91.692 E15.46237
+G1 X87.566 Y91.609 E15.46570
+G1 X87.623 Y91.527 E15.46903
+G1 X87.679 Y91.444 E15.47236
+G1 X87.737 Y91.362 E15.47570
+G1 X87.795 Y91.281 E15.47903
+G1 X87.853 Y91.199 E15.48236
+G1 X87.912 Y91.119 E15.48569
+G1 X87.971 Y91.038 E15.48902
+G1 X88.032 Y90.958 E15.49235
+G1 X88.092 Y90.879 E15.49569
+G1 X88.153 Y90.799 E15.49902
+G1 X88.215 Y90.720 E15.50235
+G1 X88.277 Y90.642 E15.50568
+G1 X88.340 Y90.564 E15.50901
+G1 X88.403 Y90.487 E15.51234
+G1 X88.467 Y90.409 E15.51568
+G1 X88.531 Y90.333 E15.51901
+G1 X88.596 Y90.256 E15.52234
+G1 X88.661 Y90.181 E15.52567
+G1 X88.727 Y90.105 E15.52900
+G1 X88.793 Y90.030 E15.53233
+G1 X88.860 Y89.956 E15.53567
+G1 X88.927 Y89.882 E15.53900
+G1 X88.995 Y89.808 E15.54233
+G1 X89.063 Y89.735 E15.54566
+G1 X89.131 Y89.662 E15.54899
+G1 X89.201 Y89.590 E15.55232
+G1 X89.270 Y89.518 E15.55566
+G1 X89.340 Y89.447 E15.55899
+G1 X89.411 Y89.376 E15.56232
+G1 X89.482 Y89.305 E15.56565
+G1 X89.554 Y89.235 E15.56898
+G1 X89.626 Y89.166 E15.57231
+G1 X89.698 Y89.097 E15.57565
+G1 X89.771 Y89.029 E15.57898
+G1 X89.845 Y88.961 E15.58231
+G1 X89.919 Y88.893 E15.58564
+G1 X89.993 Y88.826 E15.58897
+G1 X90.068 Y88.760 E15.59230
+G1 X90.143 Y88.694 E15.59564
+G1 X90.218 Y88.628 E15.59897
+G1 X90.294 Y88.563 E15.60230
+G1 X90.371 Y88.499 E15.60563
+G1 X90.448 Y88.435 E15.60896
+G1 X90.525 Y88.371 E15.61229
+G1 X90.603 Y88.308 E15.61563
+G1 X90.681 Y88.246 E15.61896
+G1 X90.760 Y88.184 E15.62229
+G1 X90.839 Y88.123 E15.62562
+G1 X90.918 Y88.062 E15.62895
+G1 X90.998 Y88.001 E15.63228
+G1 X91.078 Y87.942 E15.63562
+G1 X91.159 Y87.882 E15.63895
+G1 X91.240 Y87.824 E15.64228
+G1 X91.321 Y87.766 E15.64561
+G1 X91.403 Y87.708 E15.64894
+G1 X91.485 Y87.651 E15.65228
+G1 X91.568 Y87.594 E15.65561
+G1 X91.651 Y87.538 E15.65894
+G1 X91.734 Y87.483 E15.66227
+G1 X91.818 Y87.428 E15.66560
+G1 X91.902 Y87.374 E15.66893
+G1 X91.986 Y87.320 E15.67227
+G1 X92.071 Y87.267 E15.67560
+G1 X92.156 Y87.214 E15.67893
+G1 X92.242 Y87.162 E15.68226
+G1 X92.327 Y87.111 E15.68559
+G1 X92.414 Y87.060 E15.68892
+G1 X92.500 Y87.010 E15.69226
+G1 X92.587 Y86.960 E15.69559
+G1 X92.674 Y86.911 E15.69892
+G1 X92.761 Y86.862 E15.70225
+G1 X92.849 Y86.814 E15.70558
+G1 X92.937 Y86.767 E15.70891
+G1 X93.026 Y86.720 E15.71225
+G1 X93.114 Y86.674 E15.71558
+G1 X93.204 Y86.628 E15.71891
+G1 X93.293 Y86.583 E15.72224
+G1 X93.382 Y86.539 E15.72557
+G1 X93.472 Y86.495 E15.72890
+G1 X93.563 Y86.452 E15.73224
+G1 X93.653 Y86.409 E15.73557
+G1 X93.744 Y86.367 E15.73890
+G1 X93.835 Y86.325 E15.74223
+G1 X93.926 Y86.285 E15.74556
+G1 X94.018 Y86.244 E15.74889
+G1 X94.110 Y86.205 E15.75223
+G1 X94.202 Y86.166 E15.75556
+G1 X94.294 Y86.127 E15.75889
+G1 X94.387 Y86.090 E15.76222
+G1 X94.480 Y86.053 E15.76555
+G1 X94.573 Y86.016 E15.76888
+G1 X94.667 Y85.980 E15.77222
+G1 X94.760 Y85.945 E15.77555
+G1 X94.854 Y85.910 E15.77888
+G1 X94.948 Y85.876 E15.78221
+G1 X95.042 Y85.843 E15.78554
+G1 X95.137 Y85.810 E15.78887
+G1 X95.232 Y85.778 E15.79221
+G1 X95.327 Y85.747 E15.79554
+G1 X95.422 Y85.716 E15.79887
+G1 X95.517 Y85.685 E15.80220
+G1 X95.613 Y85.656 E15.80553
+G1 X95.709 Y85.627 E15.80886
+G1 X95.805 Y85.599 E15.81220
+G1 X95.901 Y85.571 E15.81553
+G1 X95.997 Y85.544 E15.81886
+G1 X96.094 Y85.518 E15.82219
+G1 X96.190 Y85.492 E15.82552
+G1 X96.287 Y85.467 E15.82885
+G1 X96.384 Y85.442 E15.83219
+G1 X96.481 Y85.419 E15.83552
+G1 X96.579 Y85.395 E15.83885
+G1 X96.676 Y85.373 E15.84218
+G1 X96.774 Y85.351 E15.84551
+G1 X96.872 Y85.330 E15.84884
+G1 X96.969 Y85.309 E15.85218
+G1 X97.068 Y85.289 E15.85551
+G1 X97.166 Y85.270 E15.85884
+G1 X97.264 Y85.252 E15.86217
+G1 X97.362 Y85.234 E15.86550
+G1 X97.461 Y85.216 E15.86883
+G1 X97.560 Y85.200 E15.87217
+G1 X97.658 Y85.184 E15.87550
+G1 X97.757 Y85.169 E15.87883
+G1 X97.856 Y85.154 E15.88216
+G1 X97.955 Y85.140 E15.88549
+G1 X98.055 Y85.127 E15.88882
+G1 X98.154 Y85.114 E15.89216
+G1 X98.253 Y85.102 E15.89549
+G1 X98.352 Y85.091 E15.89882
+G1 X98.452 Y85.080 E15.90215
+G1 X98.552 Y85.070 E15.90548
+G1 X98.651 Y85.061 E15.90882
+G1 X98.751 Y85.052 E15.91215
+G1 X98.851 Y85.044 E15.91548
+G1 X98.950 Y85.037 E15.91881
+G1 X99.050 Y85.030 E15.92214
+G1 X99.150 Y85.024 E15.92547
+G1 X99.250 Y85.019 E15.92881
+G1 X99.350 Y85.014 E15.93214
+G1 X99.450 Y85.010 E15.93547
+G1 X99.550 Y85.007 E15.93880
+G1 X99.650 Y85.004 E15.94213
+G1 X99.750 Y85.002 E15.94546
+G1 X99.850 Y85.001 E15.94880
+G1 X99.950 Y85.000 E15.95213
+G1 X100.050 Y85.000 E15.95546
+G1 X100.150 Y85.001 E15.95879
+G1 X100.250 Y85.002 E15.96212
+G1 X100.350 Y85.004 E15.96545
+G1 X100.450 Y85.007 E15.96879
+G1 X100.550 Y85.010 E15.97212
+G1 X100.650 Y85.014 E15.97545
+G1 X100.750 Y85.019 E15.97878
+G1 X100.850 Y85.024 E15.98211
+G1 X100.950 Y85.030 E15.98544
+G1 X101.050 Y85.037 E15.98878
+G1 X101.149 Y85.044 E15.99211
+G1 X101.249 Y85.052 E15.99544
+G1 X101.349 Y85.061 E15.99877
+G1 X101.448 Y85.070 E16.00210
+G1 X101.548 Y85.080 E16.00543
+G1 X101.648 Y85.091 E16.00877
+G1 X101.747 Y85.102 E16.01210
+G1 X101.846 Y85.114 E16.01543
+G1 X101.945 Y85.127 E16.01876
+G1 X102.045 Y85.140 E16.02209
+G1 X102.144 Y85.154 E16.02542
+G1 X102.243 Y85.169 E16.02876
+G1 X102.342 Y85.184 E16.03209
+G1 X102.440 Y85.200 E16.03542
+G1 X102.539 Y85.216 E16.03875
+G1 X102.638 Y85.234 E16.04208
+G1 X102.736 Y85.252 E16.04541
+G1 X102.834 Y85.270 E16.04875
+G1 X102.932 Y85.289 E16.05208
+G1 X103.031 Y85.309 E16.05541
+G1 X103.128 Y85.330 E16.05874
+G1 X103.226 Y85.351 E16.06207
+G1 X103.324 Y85.373 E16.06540
+G1 X103.421 Y85.395 E16.06874
+G1 X103.519 Y85.419 E16.07207
+G1 X103.616 Y85.442 E16.07540
+G1 X103.713 Y85.467 E16.07873
+G1 X103.810 Y85.492 E16.08206
+G1 X103.906 Y85.518 E16.08539
+G1 X104.003 Y85.544 E16.08873
+G1 X104.099 Y85.571 E16.09206
+G1 X104.195 Y85.599 E16.09539
+G1 X104.291 Y85.627 E16.09872
+G1 X104.387 Y85.656 E16.10205
+G1 X104.483 Y85.685 E16.10538
+G1 X104.578 Y85.716 E16.10872
+G1 X104.673 Y85.747 E16.11205
+G1 X104.768 Y85.778 E16.11538
+G1 X104.863 Y85.810 E16.11871
+G1 X104.958 Y85.843 E16.12204
+G1 X105.052 Y85.876 E16.12537
+G1 X105.146 Y85.910 E16.12871
+G1 X105.240 Y85.945 E16.13204
+G1 X105.333 Y85.980 E16.13537
+G1 X105.427 Y86.016 E16.13870
+G1 X105.520 Y86.053 E16.14203
+G1 X105.613 Y86.090 E16.14537
+G1 X105.706 Y86.127 E16.14870
+G1 X105.798 Y86.166 E16.15203
+G1 X105.890 Y86.205 E16.15536
+G1 X105.982 Y86.244 E16.15869
+G1 X106.074 Y86.285 E16.16202
+G1 X106.165 Y86.325 E16.16536
+G1 X106.256 Y86.367 E16.16869
+G1 X106.347 Y86.409 E16.17202
+G1 X106.437 Y86.452 E16.17535
+G1 X106.528 Y86.495 E16.17868
+G1 X106.618 Y86.539 E16.18201
+G1 X106.707 Y86.583 E16.18535
+G1 X106.796 Y86.628 E16.18868
+G1 X106.886 Y86.674 E16.19201
+G1 X106.974 Y86.720 E16.19534
+G1 X107.063 Y86.767 E16.19867
+G1 X107.151 Y86.814 E16.20200
+G1 X107.239 Y86.862 E16.20534
+G1 X107.326 Y86.911 E16.20867
+G1 X107.413 Y86.960 E16.21200
+G1 X107.500 Y87.010 E16.21533
+G1 X107.586 Y87.060 E16.21866
+G1 X107.673 Y87.111 E16.22199
+G1 X107.758 Y87.162 E16.22533
+G1 X107.844 Y87.214 E16.22866
+G1 X107.929 Y87.267 E16.23199
+G1 X108.014 Y87.320 E16.23532
+G1 X108.098 Y87.374 E16.23865
+G1 X108.182 Y87.428 E16.24198
+G1 X108.266 Y87.483 E16.24532
+G1 X108.349 Y87.538 E16.24865
+G1 X108.432 Y87.594 E16.25198
+G1 X108.515 Y87.651 E16.25531
+G1 X108.597 Y87.708 E16.25864
+G1 X108.679 Y87.766 E16.26197
+G1 X108.760 Y87.824 E16.26531
+G1 X108.841 Y87.882 E16.26864
+G1 X108.922 Y87.942 E16.27197
+G1 X109.002 Y88.001 E16.27530
+G1 X109.082 Y88.062 E16.27863
+G1 X109.161 Y88.123 E16.28196
+G1 X109.240 Y88.184 E16.28530
+G1 X109.319 Y88.246 E16.28863
+G1 X109.397 Y88.308 E16.29196
+G1 X109.475 Y88.371 E16.29529
+G1 X109.552 Y88.435 E16.29862
+G1 X109.629 Y88.499 E16.30195
+G1 X109.706 Y88.563 E16.30529
+G1 X109.782 Y88.628 E16.30862
+G1 X109.857 Y88.694 E16.31195
+G1 X109.932 Y88.760 E16.31528
+G1 X110.007 Y88.826 E16.31861
+G1 X110.081 Y88.893 E16.32194
+G1 X110.155 Y88.961 E16.32528
+G1 X110.229 Y89.029 E16.32861
+G1 X110.302 Y89.097 E16.33194
+G1 X110.374 Y89.166 E16.33527
+G1 X110.446 Y89.235 E16.33860
+G1 X110.518 Y89.305 E16.34193
+G1 X110.589 Y89.376 E16.34527
+G1 X110.660 Y89.447 E16.34860
+G1 X110.730 Y89.518 E16.35193
+G1 X110.799 Y89.590 E16.35526
+G1 X110.869 Y89.662 E16.35859
+G1 X110.937 Y89.735 E16.36192
+G1 X111.005 Y89.808 E16.36526
+G1 X111.073 Y89.882 E16.36859
+G1 X111.140 Y89.956 E16.37192
+G1 X111.207 Y90.030 E16.37525
+G1 X111.273 Y90.105 E16.37858
+G1 X111.339 Y90.181 E16.38191
+G1 X111.404 Y90.256 E16.38525
+G1 X111.469 Y90.333 E16.38858
+G1 X111.533 Y90.409 E16.39191
+G1 X111.597 Y90.487 E16.39524
+G1 X111.660 Y90.564 E16.39857
+G1 X111.723 Y90.642 E16.40191
+G1 X111.785 Y90.720 E16.40524
+G1 X111.847 Y90.799 E16.40857
+G1 X111.908 Y90.879 E16.41190
+G1 X111.968 Y90.958 E16.41523
+G1 X112.029 Y91.038 E16.41856
+G1 X112.088 Y91.119 E16.42190
+G1 X112.147 Y91.199 E16.42523
+G1 X112.205 Y91.281 E16.42856
+G1 X112.263 Y91.362 E16.43189
+G1 X112.321 Y91.444 E16.43522
+G1 X112.377 Y91.527 E16.43855
+G1 X112.434 Y91.609 E16.44189
+G1 X112.489 Y91.692 E16.44522
+G1 X112.545 Y91.776 E16.44855
+G1 X112.599 Y91.860 E16.45188
+G1 X112.653 Y91.944 E16.45521
+G1 X112.707 Y92.029 E16.45854
+G1 X112.759 Y92.114 E16.46188
+G1 X112.812 Y92.199 E16.46521
+G1 X112.864 Y92.284 E16.46854
+G1 X112.915 Y92.370 E16.47187
+G1 X112.965 Y92.457 E16.47520
+G1 X113.015 Y92.543 E16.47853
+G1 X113.065 Y92.630 E16.48187
+G1 X113.114 Y92.718 E16.48520
+G1 X113.162 Y92.805 E16.48853
+G1 X113.210 Y92.893 E16.49186
+G1 X113.257 Y92.981 E16.49519
+G1 X113.303 Y93.070 E16.49852
+G1 X113.349 Y93.159 E16.50186
+G1 X113.394 Y93.248 E16.50519
+G1 X113.439 Y93.338 E16.50852
+G1 X113.483 Y93.427 E16.51185
+G1 X113.527 Y93.518 E16.51518
+G1 X113.570 Y93.608 E16.51851
+G1 X113.612 Y93.699 E16.52185
+G1 X113.654 Y93.789 E16.52518
+G1 X113.695 Y93.881 E16.52851
+G1 X113.736 Y93.972 E16.53184
+G1 X113.775 Y94.064 E16.53517
+G1 X113.815 Y94.156 E16.53850
+G1 X113.853 Y94.248 E16.54184
+G1 X113.891 Y94.341 E16.54517
+G1 X113.929 Y94.434 E16.54850
+G1 X113.966 Y94.527 E16.55183
+G1 X114.002 Y94.620 E16.55516
+G1 X114.037 Y94.713 E16.55849
+G1 X114.072 Y94.807 E16.56183
+G1 X114.107 Y94.901 E16.56516
+G1 X114.140 Y94.995 E16.56849
+G1 X114.174 Y95.090 E16.57182
+G1 X114.206 Y95.184 E16.57515
+G1 X114.238 Y95.279 E16.57848
+G1 X114.269 Y95.374 E16.58182
+G1 X114.299 Y95.470 E16.58515
+G1 X114.329 Y95.565 E16.58848
+G1 X114.359 Y95.661 E16.59181
+G1 X114.387 Y95.757 E16.59514
+G1 X114.415 Y95.853 E16.59847
+G1 X114.443 Y95.949 E16.60181
+G1 X114.469 Y96.045 E16.60514
+G1 X114.495 Y96.142 E16.60847
+G1 X114.521 Y96.239 E16.61180
+G1 X114.546 Y96.336 E16.61513
+G1 X114.570 Y96.433 E16.61846
+G1 X114.593 Y96.530 E16.62180
+G1 X114.616 Y96.627 E16.62513
+G1 X114.638 Y96.725 E16.62846
+G1 X114.660 Y96.823 E16.63179
+G1 X114.680 Y96.920 E16.63512
+G1 X114.701 Y97.018 E16.63845
+G1 X114.720 Y97.117 E16.64179
+G1 X114.739 Y97.215 E16.64512
+G1 X114.757 Y97.313 E16.64845
+G1 X114.775 Y97.412 E16.65178
+G1 X114.792 Y97.510 E16.65511
+G1 X114.808 Y97.609 E16.65845
+G1 X114.824 Y97.708 E16.66178
+G1 X114.839 Y97.807 E16.66511
+G1 X114.853 Y97.906 E16.66844
+G1 X114.867 Y98.005 E16.67177
+G1 X114.880 Y98.104 E16.67510
+G1 X114.892 Y98.203 E16.67844
+G1 X114.904 Y98.303 E16.68177
+G1 X114.915 Y98.402 E16.68510
+G1 X114.925 Y98.502 E16.68843
+G1 X114.935 Y98.601 E16.69176
+G1 X114.944 Y98.701 E16.69509
+G1 X114.952 Y98.801 E16.69843
+G1 X114.960 Y98.900 E16.70176
+G1 X114.967 Y99.000 E16.70509
+G1 X114.973 Y99.100 E16.70842
+G1 X114.979 Y99.200 E16.71175
+G1 X114.984 Y99.300 E16.71508
+G1 X114.988 Y99.400 E16.71842
+G1 X114.992 Y99.500 E16.72175
+G1 X114.995 Y99.600 E16.72508
+G1 X114.997 Y99.700 E16.72841
+G1 X114.999 Y99.800 E16.73174
+G1 X115.000 Y99.900 E16.73507
+G1 X115.000 Y100.000 E16.73841
+G1 Z10 F600
+M84
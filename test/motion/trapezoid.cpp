@@ -0,0 +1,130 @@
+/**
+ * Comparison of the trapezoid step counts of the planner with INTEGER_TRAPEZOID_STEPS.
+ *
+ * Planner::calculate_trapezoid_for_block() is called on random blocks (rates,
+ * acceleration, steps) and its acceleration and plateau steps are compared
+ * with an exact computation in 64-bit integers, and with the float formulas
+ * of the planner without the option (estimate_acceleration_distance() and
+ * intersection_distance()). The integer counts must be exact, the report
+ * gives how often and by how much the floats differ.
+ *
+ * The exit status is not 0 if an integer count differs from the exact one.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <random>
+
+#include "../../Marlin/Marlin.h"
+// calculate_trapezoid_for_block() and the float formulas are private to the planner
+#define private public
+#include "../../Marlin/planner.h"
+#undef private
+
+#if DISABLED(INTEGER_TRAPEZOID_STEPS)
+    #error "This test compares the planner built with INTEGER_TRAPEZOID_STEPS"
+#endif
+
+namespace
+{
+    const unsigned NB_BLOCKS = 2000000;
+    const uint32_t MINIMAL_STEP_RATE = 120;     //!< Of the planner
+    const uint32_t MAX_INTEGER_RATE = 65535;    //!< Faster blocks use the floats
+
+    std::mt19937_64 rng{20171016};
+
+    uint32_t random(uint32_t min, uint32_t max) { return std::uniform_int_distribution<uint32_t>{min, max}(rng); }
+
+    //! Steps of acceleration and of plateau of a trapezoid.
+    struct Steps
+    {
+        int32_t accelerate;
+        int32_t plateau;
+    };
+
+    //! The steps rounded like the planner (up for the acceleration, down for the deceleration), in exact integers.
+    Steps exact_steps(int64_t nominal, int64_t initial, int64_t final, int64_t accel, int64_t steps)
+    {
+        const int64_t den = 2 * accel,
+                      accelerate = (nominal * nominal - initial * initial + den - 1) / den,
+                      decelerate = (nominal * nominal - final * final) / den,
+                      plateau = steps - accelerate - decelerate;
+        if(plateau >= 0)
+            return Steps{static_cast<int32_t>(accelerate), static_cast<int32_t>(plateau)};
+
+        // Intersection of the acceleration and of the deceleration, rounded up
+        const int64_t num = 2 * accel * steps - initial * initial + final * final;
+        int64_t intersection = num >= 0 ? (num + 2 * den - 1) / (2 * den) : -(-num / (2 * den));
+        if(intersection < 0) intersection = 0;
+        if(intersection > steps) intersection = steps;
+        return Steps{static_cast<int32_t>(intersection), 0};
+    }
+
+    //! The steps computed with floats, as the planner does without INTEGER_TRAPEZOID_STEPS.
+    Steps float_steps(uint32_t nominal, uint32_t initial, uint32_t final, int32_t accel, uint32_t steps)
+    {
+        int32_t accelerate = CEIL(Planner::estimate_acceleration_distance(initial, nominal, accel)),
+                decelerate = FLOOR(Planner::estimate_acceleration_distance(nominal, final, -accel)),
+                plateau = steps - accelerate - decelerate;
+        if(plateau < 0)
+        {
+            accelerate = CEIL(Planner::intersection_distance(initial, final, accel, steps));
+            NOLESS(accelerate, 0);
+            accelerate = min((uint32_t)accelerate, steps);
+            plateau = 0;
+        }
+        return Steps{accelerate, plateau};
+    }
+
+    //! A random block, short (a few steps, mostly triangles) or long (mostly trapezoids).
+    block_t random_block()
+    {
+        block_t block{};
+        block.nominal_rate = random(MINIMAL_STEP_RATE, MAX_INTEGER_RATE);
+        block.acceleration_steps_per_s2 = random(100, 400000);
+        block.step_event_count = random(1, random(0, 1) ? 200 : 100000);
+        return block;
+    }
+}
+
+int main()
+{
+    unsigned nb_failures = 0, nb_float_differences = 0;
+    int32_t float_max_difference = 0;
+
+    for(unsigned index = 0; index < NB_BLOCKS; ++index)
+    {
+        block_t block = random_block();
+        const float entry_factor = random(MINIMAL_STEP_RATE, block.nominal_rate) / static_cast<float>(block.nominal_rate),
+                    exit_factor = random(MINIMAL_STEP_RATE, block.nominal_rate) / static_cast<float>(block.nominal_rate);
+        Planner::calculate_trapezoid_for_block(&block, entry_factor, exit_factor);
+
+        // The rates after the rounding of the planner
+        const Steps integer{static_cast<int32_t>(block.accelerate_until),
+                            static_cast<int32_t>(block.decelerate_after - block.accelerate_until)},
+                    exact = exact_steps(block.nominal_rate, block.initial_rate, block.final_rate,
+                                        block.acceleration_steps_per_s2, block.step_event_count),
+                    floats = float_steps(block.nominal_rate, block.initial_rate, block.final_rate,
+                                         block.acceleration_steps_per_s2, block.step_event_count);
+
+        if(integer.accelerate != exact.accelerate || integer.plateau != exact.plateau)
+        {
+            if(nb_failures++ < 10)
+                printf("    FAILED: rates %u -> %u -> %u, acceleration %u, %u steps: %d+%d steps instead of %d+%d\n",
+                       block.initial_rate, block.nominal_rate, block.final_rate, block.acceleration_steps_per_s2,
+                       block.step_event_count, integer.accelerate, integer.plateau, exact.accelerate, exact.plateau);
+        }
+
+        const int32_t difference = abs(floats.accelerate - exact.accelerate) + abs(floats.plateau - exact.plateau);
+        if(difference > 0)
+            ++nb_float_differences;
+        NOLESS(float_max_difference, difference);
+    }
+
+    printf("trapezoids: %u blocks, integer steps: %u differences, float steps: %u differences (up to %d steps)\n",
+           NB_BLOCKS, nb_failures, nb_float_differences, float_max_difference);
+    printf("    %s\n", nb_failures == 0 ? "OK" : "FAILED");
+
+    // As on the printer, the objects of the firmware are never destroyed (some are cleared with memset)
+    fflush(stdout);
+    _Exit(nb_failures == 0 ? 0 : 1);
+}
@@ -0,0 +1,113 @@
+/**
+ * Names of the files of a directory read by CardReader::getfilename(), as
+ * the SD card page of the LCD does, with and without SDCARD_FILE_INDEX.
+ *
+ * The root directory of an emulated SD card (hal/sd_card.h) is filled with
+ * N files, up to more than SDINDEX_LIMIT times 8 so that the stride of the
+ * index doubles several times. The pages of 5 files are read from the last
+ * file to the first one, then all the files in a random order. Each name
+ * must be the one of the file at this position in the directory. The report
+ * gives the blocks read from the card to count the files and per page.
+ *
+ * The exit status is not 0 if a name or the count of files is wrong.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../hal/sd_card.h"
+#include "../../Marlin/Marlin.h"
+// The index of the card reader is private
+#define private public
+#include "../../Marlin/cardreader.h"
+#undef private
+
+namespace
+{
+    const unsigned NB_FILES[] = {3, 20, 32, 33, 64, 100, 200, 300, 500};
+    const unsigned NB_VISIBLE_FILES = 5;    //!< Of the SD card page of the LCD
+
+    std::mt19937_64 rng{20171016};
+    unsigned nb_failures = 0;
+
+    std::string file_name(unsigned index)
+    {
+        char name[13];
+        snprintf(name, sizeof(name), "F%04u.GCO", index);
+        return name;
+    }
+
+    //! Get the name of a file and check it.
+    void check_name(unsigned nb_files, uint16_t index)
+    {
+        card.getfilename(index);
+        if(file_name(index) != card.filename && nb_failures++ < 10)
+            printf("    FAILED: %u files, file %u: %s instead of %s\n", nb_files, index, card.filename,
+                   file_name(index).c_str());
+    }
+
+    //! A directory of files, its pages read from the end as by the LCD, then its files in any order.
+    void check_directory(unsigned nb_files)
+    {
+        host::SdCard sd_card;
+        for(unsigned index = 0; index < nb_files; ++index)
+            sd_card.add_file(file_name(index), "G28\n");
+        sd_card.insert();
+        card.initsd();
+
+        uint32_t blocks = sd_card.blocks_read();
+        const uint16_t count = card.getnrfilenames();
+        const uint32_t count_blocks = sd_card.blocks_read() - blocks;
+        if(count != nb_files && nb_failures++ < 10)
+            printf("    FAILED: %u files counted instead of %u\n", count, nb_files);
+
+        uint32_t pages = 0, pages_blocks = 0, max_page_blocks = 0;
+        for(int last = static_cast<int>(count) - 1; last >= 0; last -= NB_VISIBLE_FILES)
+        {
+            blocks = sd_card.blocks_read();
+            for(int index = last; index >= 0 && index > last - static_cast<int>(NB_VISIBLE_FILES); --index)
+                check_name(nb_files, index);
+            const uint32_t page_blocks = sd_card.blocks_read() - blocks;
+            ++pages;
+            pages_blocks += page_blocks;
+            NOLESS(max_page_blocks, page_blocks);
+        }
+
+        std::vector<uint16_t> indexes(count);
+        for(uint16_t index = 0; index < count; ++index)
+            indexes[index] = index;
+        std::shuffle(indexes.begin(), indexes.end(), rng);
+        for(auto index: indexes)
+            check_name(nb_files, index);
+
+        printf("    %3u files: %3u blocks to count them, %5.1f blocks per page (up to %u)", nb_files, count_blocks,
+               pages > 0 ? static_cast<double>(pages_blocks) / pages : 0.0, max_page_blocks);
+        #if ENABLED(SDCARD_FILE_INDEX)
+            printf(", one file every %u indexed", 1u << card.file_index_shift);
+        #endif
+        printf("\n");
+
+        card.release();
+        sd_card.remove();
+    }
+}
+
+int main()
+{
+    #if ENABLED(SDCARD_FILE_INDEX)
+        printf("directory (SDCARD_FILE_INDEX, %u positions):\n", SDINDEX_LIMIT);
+    #else
+        printf("directory (without SDCARD_FILE_INDEX):\n");
+    #endif
+    for(auto nb_files: NB_FILES)
+        check_directory(nb_files);
+    printf("    %s\n", nb_failures == 0 ? "OK" : "FAILED");
+
+    // As on the printer, the objects of the firmware are never destroyed (some are cleared with memset)
+    fflush(stdout);
+    _Exit(nb_failures == 0 ? 0 : 1);
+}